@@ -20,6 +20,10 @@
  *
  *  WRITTEN BY    : Robert Kirby, NSWC Z17
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Increment mapVer for devcfg_t mgrsStd, default MGRS_STD
+ *      Initialize CFGPGM by member (not byte image) so it also builds on host
+ *      Increment mapVer for devcfg_t fset and selFset
  *    2021/07/15, Robert Kirby, NSWC H12
  *      Remove various vestigial includes
  *    2021/06/01, Robert Kirby, NSWC H12
@@ -48,6 +52,7 @@
 #include <stdint.h>
 #include "stdint_extended.h"    // for uint64byte_t, BIT0, etc.
 #include "config_memory.h"
+#include "coords.h"             // for MGRS_STD
 #include "crc.h"                // for crc_t
 #include "main.h"               // for esdErrFlags, devcfg_t, FKLB, FKHB
 #include "mc24aa512.h"          // to access EEPROM
@@ -76,23 +81,28 @@
 //----- MODULE ATTRIBUTES ------------------------------------------------------
 static  cfgerr_t    cfgErr = {.val = 0xFFFF};
 static  cfgblock_t  CFGPGM =
-{ .u8 = {                           // 38 bytes of 128-byte page
-  0x02,0x00,0x00,0x00,              // mapVer 0x02/write 0x000000
-  FKLB,FKHB,                        // uint16_t    fwKey
-  0x01,0x00,                        // opstat_t    opStat                  OS_ON
-  0x30,0x30,0x31,0x00,              // char[4]     brevCode                  001
-  0x00,0x00,                        // csysset_t   cSysSet                CS_DMS
-  0x03,0x00,                        // bkltset_t   bkltSet               BS_HIGH
-  0x30,0x00,                        // extcom_t    extCom          rsvd  EC_NONE
-  0x33,0x00,                        // rxdtycy_t   rxDtyCy         rsvd  RA_NONE
-  0x30,0x00,                        // rspsack_t   respAuto911Ack  rsvd  RDC_ON
-  0x30,0x00,                        // rspsack_t   respMan911Ack   rsvd  RDC_ON
-  0x31,0x00,                        // ws_t        selWfChar            WF_SLOT1
-  0x01,0x00,                        // uint16_t    selWfIdx    (selWfChar - '0')
-  0xFF,0xFF,                        // wgm_t       geoMuting              WGM_NA
-  0x32,0x00,                        // txpwr_t     txPwr                 TP_HIGH
-  0x31,0x00,                        // txdtycy_t   txDtyCy         rsvd TDC_NORM
-  0x23,0x30,0x7B,0xED}              // uint32_t    crc             {LSB,...,MSB}
+{ .mbr = {                          // 44 bytes of 128-byte page on XC16
+  .mapVer         = {.L = 0x04, .w = 0x000000}, // mapVer 0x04/write 0x000000
+  .cfg = {
+    .fwKey          = FW_KEY,
+    .opStat         = OS_ON,
+    .brevCode       = {'0','0','1',0},
+    .cSysSet        = CS_DMS,
+    .bkltSet        = BS_HIGH,
+    .extCom         = '0',          // rsvd  EC_NONE
+    .rxDtyCy        = '3',          // rsvd  RA_NONE
+    .respAuto911Ack = '0',          // rsvd  RDC_ON
+    .respMan911Ack  = '0',          // rsvd  RDC_ON
+    .selWfChar      = WF_SLOT1,
+    .selWfIdx       = WF_SLOT1 - '0',
+    .geoMuting      = WGM_NA,
+    .txPwr          = TP_HIGH,
+    .txDtyCy        = TDC_NORM,
+    .fset           = 0,
+    .selFset        = 0,
+    .mgrsStd        = MGRS_STD,
+  },
+  .crc            = 0xFFFFFFFF}     // not checked, set by WriteToEepMem
 };
 /*
 { .u8 = {                                   // 34 bytes of 128-byte page
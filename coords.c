@@ -7,25 +7,88 @@
  *  DESCRIPTION   : contains procedure definitions required to convert between
  *    geographic coordinate systems and compute range & bearing
  *
- *    (*) MGRS_1989_STD void LatLonToUTM(lat, lon, * mgrsZones, * mgrsCoords)
- *    (*) MGRS_2014_STD double ComputeUtmX(double lamda, double phi)
- *    (*) MGRS_2014_STD double ComputeUtmY(double lamda, double phi)
- *    (*) MGRS_2014_STD void LatLonToUTM(lat, lon, * mgrsZones, * mgrsCoords)
- *    (*) ComputeUpsX(double lamda, double phi, double k90)
- *    (*) ComputeUpsY(double lamda, double phi, double k90)
- *    (*) void LatLonToUPS(lat, lon, * mgrsZones, * mgrsCoords)
- *    (1) double HexDegToDblDeg(char* hexDeg, bool isLat)
+ *    (*) void SinCosRad(double rad, double* pSin, double* pCos)
+ *    (*) MGRS_2014_STD double Atan2Rad(double y, double x)
+ *    (*) MGRS_1989_STD double RootW(double sinPhi, double cosPhi)
+ *    (*) int UtmZone(double latitude, double longitude, char* band)
+ *    (*) void UtmToStr(zone, band, eLetter, nLetter, easting, northing,
+ *                      * mgrsZones, * mgrsCoords)
+ *    (*) MGRS_1989_STD void LatLonToUTM1989(lat, lon, * mgrsZones, * mgrsCoords)
+ *    (*) double Atanh(double x)
+ *    (*) MGRS_2014_STD void ComputeChi(sinPhi, cosPhi, * sinChi, * cosChi)
+ *    (*) MGRS_2014_STD void ComputeUtmXY(lamda, phi, double* x, double* y)
+ *    (*) MGRS_2014_STD void LatLonToUTM2014(lat, lon, * mgrsZones, * mgrsCoords)
+ *    (*) MGRS_2014_STD double ComputeUpsRho(double phi)
+ *    (*) MGRS_1989_STD void ComputeUpsXY(lamda, phi, k90, double* x, double* y)
+ *    (*) void LatLonToUPS(lat, lon, * mgrsZones, * mgrsCoords, isKrueger)
+ *    (*) int32_t DecDegToPt32(char *pDec, int32_t maxPt)
+ *    (*) int32_t Pt32ToDms(int32_t pt)
+ *    (*) void DmsToStr(int32_t dms, char *hemi, char *str)
+ *    (*) void Pt32ToDecStr(int32_t pt, char *str)
+ *    (*) int32_t MulQ30(int32_t a, int32_t b)
+ *    (*) void SinCosPt32(int32_t pt, int32_t *pSin, int32_t *pCos)
+ *    (*) int32_t Atan2Q29(int32_t y, int32_t x, uint32_t *pMag)
+ *    (*) int16_t Pt32ToPt16(int32_t pt, uint32_t maxPt)
+ *    (1) int32_t HexDegToPt32(char* hexDeg, bool isLat)
  *    (2) void ClearCoords(coords_t *coord)
  *    (3) bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon)
- *    (4) void DecLatLonToDblLatLon(coords_t *pCoord)
- *    (5) void DblLatLonToDMS(coords_t *pCoord)
- *    (6) void DblLatLonToMGRS(coords_t *pCoord)
- *    (7) void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
- *    (8) bool CalcRngBrg(double frLat, double frLon,
- *                        double toLat, double toLon,
- *                        char*  rng,   char* brg)
+ *    (4) void RenderCoords(coords_t *pCoord, coordfmt_t fmt)
+ *    (5) void DblLatLonToMGRS(coords_t *pCoord)
+ *    (6) void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
+ *    (7) void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt)
+ *    (8) void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig)
+ *    (9) bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+ *                        geopt32_t to, const geotrig_t *pToTrig,
+ *                        char* rng, char* brg)
+ *   (10) void SetMgrsStd(uint16_t std)
  *
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      CORDIC opt-ins (cordic.c):  SinCosPt32() & Atan2Q29() by CordicSinCos()
+ *      & CordicAtan2() when COORDS_CORDIC_RNGBRG is 1; UTM & UPS sines &
+ *      cosines, atan2() and the 1989 square root through SinCosRad(),
+ *      Atan2Rad() & RootW(), by cordic.c when COORDS_CORDIC_UTM is 1.
+ *      ComputeUpsXY() (was ComputeUpsX() & ComputeUpsY()) takes one sine &
+ *      cosine pair of each angle rather than two
+ *      RootW() casts cosPhi to void when COORDS_CORDIC_UTM is 0 (unused there)
+ *      Fixed-point position pipeline:  HexDegToPt32() (was HexDegToDblDeg())
+ *      parses PLI hex to geopt32_t; CoordsToGeopt16() scales geopt32_t in
+ *      integer math; SetGeoTrig() caches Q30 sines & cosines of geopt32_t
+ *      (SinCosPt32); CalcRngBrg() takes geopt32_t ends and computes in Q30,
+ *      bearing, |(f, g)| & central angle by Atan2Q29() (33-entry atan and
+ *      cosine tables, no square root).  Only MGRS uses float, RenderCoords()
+ *      CF_MGRS setting dblLat & dblLon from the fix
+ *      MGRS_1989 100 km row letter from northing by long division (float put
+ *      9999999 in the next row just south of the equator)
+ *      MGRS_1989 100 km column letter by abs(zone) % 3, as MGRS_2014 (southern
+ *      zones 1, 4, 7, ... got the letters of zones 3, 6, 9, ...)
+ *      UtmZone() band of lats exactly on a band's south edge is that band
+ *      (was the one below, none at -80); DblLatLonToMGRS() takes lon 180 as
+ *      -180 (was 0); CalcRngBrg() Lon change across the anti-meridian the
+ *      short way, so by series when small
+ *      Format MGRS, DMS, decimal, range and bearing text by numfmt.c in place
+ *      of sprintf(); UTM strings of both standards by UtmToStr()
+ *      Add SetGeoTrig(); SetCoordsFromDecLatLon() caches the fix's sines &
+ *      cosines in coords_t trig, and CalcRngBrg() takes each end's cache, so
+ *      a range & bearing costs one atan2 (and atan) plus multiplies; sine &
+ *      cosine of a Lon change under 5.7 degrees by series, else by identity
+ *      Format coordinate lines on demand:  SetCoordsFromDecLatLon() only parses
+ *      the fix (integer, to geopt32_t, and to double); RenderCoords() formats
+ *      the HOME screen format's lines when what they show changes.  DMS and
+ *      DEC lines come from the integer fix (exact, no strtod or float DMS);
+ *      DecLatLonToDblLatLon() and DblLatLonToDMS() replaced by static
+ *      DecDegToPt32(), Pt32ToDms(), DmsToStr(), and Pt32ToDecStr()
+ *      Link both MGRS standards, selected at run time by SetMgrsStd() (devcfg_t
+ *      mgrsStd) rather than compiled by MGRS_STD, which is now the default
+ *      Complete MGRS_2014_STD: conformal latitude once per conversion, alpha
+ *      series to a8 summed by complex Clenshaw, eta' by Atanh() from log(),
+ *      and UPS by the same conformal latitude (ComputeUpsRho)
+ *      Factor UTM zone & band shared by both standards into UtmZone()
+ *      UPS k90 is the constant UPS_K90 rather than sqrt(pow() * pow())
+ *      MGRS_1989_STD LatLonToUTM() takes its series coefficients as folded
+ *      constants and evaluates the series in Horner form from one sin/cos
+ *      pair, rather than ~15 pow() plus tan() twice and sin(2,4,6 phi)
+ *      Add CoordsToGeopt32()
  *    2021/09/23, Robert Kirby, NSWC H12
  *      Add HexDegToDblDeg(), ClearCoords(), SetCoordsFromDecLatLon(),
  *      DecLatLonToDblLatLon(), DblLatLonToDMS(), and CalcRngBrg()
@@ -92,56 +155,174 @@
  *       https://www.fcc.gov/media/radio/distance-and-azimuths
  */
 #include <dsp.h>                // for PI optimized to XC16 double
-#include <float.h>              // for DBL_MIN
 #include <math.h>               // for trig functions
-#include <stdio.h>              // for sprintf
 #include <stdlib.h>             // for strtoul (atoi)
 #include <stdbool.h>            // for bool true false
 #include <string.h>             // for strcmp, memcpy, etc.
 #include "coords.h"
+#include "numfmt.h"             // for FmtUDec() etc. in place of sprintf
+#include "cordic.h"             // for CordicSinCos() etc. (COORDS_CORDIC_*)
 
 
 #define DEG_TO_RAD(dblDeg)  ((dblDeg) * PI/180.0)
-#define RAD_TO_DEG(dblRad)  ((dblRad) * 180.0/PI)
 
 // GPS uses WGS84.  WGS84 radii in meters:
 //    equatorial Re  = 6378137   (semi-major axis)
 //    polar      Rp ~= 6356752   (semi-minor axis)
 //    mean       Rm ~= 6371009 = ((2*Re + Rp)/3)
 #define MER_M   6371008.7714            // WGS-84 Mean Earth Radius in meters
-#define ME_MPD  DEG_TO_RAD(MER_M)       // WGS-84 Mean Earth meters per degree
 #define WGS_84_SEMI_MAJOR_AXIS 6378137  // WGS-84 Equatorial radius
 //#define WGS_84_SEMI_MINOR_AXIS 6356752.314245
 #define e  0.081819190842621494335
 #define e2 0.0066943799901413169961
 #define K0_UTM 0.9996
 #define K0_UPS 0.994
+#define UPS_K90 1.0033565552493156 // sqrt((1+e)^(1+e) * (1-e)^(1-e))
 
 //Currently using WGS 84 ellipsoid reference
 #define alpha WGS_84_SEMI_MAJOR_AXIS
 //#define beta WGS_84_SEMI_MINOR_AXIS
+#define B_OVER_A 0.9966471893352525 // sqrt(1 - e2), semi-minor / semi-major
+
+// UTM & UPS fixed point of CORDIC (COORDS_CORDIC_UTM):  Q29 radians, Q30 1.0
+#define Q29_PER_RAD 536870912.0         // 2^29
+#define Q30_PER_ONE 1073741824.0        // 2^30
+
+
+// Fixed point of the position pipeline (HexDegToPt32 to CalcRngBrg):  Q30
+// sines & cosines (1 << 30 is 1.0, lsb ~6 mm of great circle), Q29 angles in
+// radians (so +-PI fits), geopt32_t 0.00001 degree
+#define Q30_ONE       (1L << 30)
+#define PI_Q29        1686629713L       // PI   * 2^29
+#define HALF_PI_Q29   843314857L        // PI/2 * 2^29
+#define PT_45         ( 45L * GEOPT32_PER_DEG)
+#define PT_90         ( 90L * GEOPT32_PER_DEG)
+#define PT_180        (180L * GEOPT32_PER_DEG)
+#define PT_POLE_SNAP  (PT_90 - 1)       // within 1.35 m (0.0000135 deg) of pole
+#define RAD_Q56_PER_PT 12576422670LL    // PI/180/100000 * 2^56
+#define DEG_Q24_PER_RAD 961263669L      // 180/PI * 2^24
+#define MER_MQ8       1630978245LL      // MER_M * 2^8
+#define MQ8_Q16_PER_PT 18655439LL       // MER_M * PI/180/100000 * 2^8 * 2^16
+#define HEX_PT_PER_TURN (360LL * GEOPT32_PER_DEG) // UINT32_MAX hex per 360 deg
+#define KM_DOT_M_MQ8  2547072UL         // 9.9495 km, most shown as K.m
+#define ATAN_LUT_STEPS 32               // atan table of k/32, k 0 to 32
+#define SIN_TERMS     5                 // SIN_Q30[] x^3 to x^11
+#define COS_TERMS     6                 // COS_Q30[] x^2 to x^12
+
+#if (COORDS_CORDIC_RNGBRG == 0)
+// Taylor coefficients in Q30, SinCosPt32() Horner form:  sin x = x + x^3 *
+// (SIN_Q30[0] + x^2 * (SIN_Q30[1] + ...)), cos x = 1 + x^2 * (COS_Q30[0] + ...)
+static const int32_t SIN_Q30[SIN_TERMS] =
+{ // -1/3!, 1/5!, -1/7!, 1/9!, -1/11!
+  -178956971L, 8947849L, -213044L, 2959L, -27L
+};
+static const int32_t COS_Q30[COS_TERMS] =
+{ // -1/2!, 1/4!, -1/6!, 1/8!, -1/10!, 1/12!
+  -536870912L, 44739243L, -1491308L, 26631L, -296L, 2L
+};
+
+// atan(k / ATAN_LUT_STEPS) in Q29 radians, k = 0 to ATAN_LUT_STEPS
+static const int32_t ATAN_LUT[ATAN_LUT_STEPS + 1] =
+{
+          0,  16771758,  33510843,  50184965,  66762579,  83213242,
+   99507923, 115619285, 131521918, 147192530, 162610076, 177755853,
+  192613537, 207169181, 221411170, 235330149, 248918915, 262172294,
+  275086997, 287661468, 299895724, 311791193, 323350557, 334577593,
+  345477027, 356054396, 366315911, 376268345, 385918917, 395275197,
+  404345015, 413136383, 421657428
+};
+
+// cos(atan(k / ATAN_LUT_STEPS)) in Q30, k = 0 to ATAN_LUT_STEPS, Atan2Q29()
+// magnitude
+static const int32_t COS_ATAN_LUT[ATAN_LUT_STEPS + 1] =
+{
+  1073741824, 1073217920, 1071650796, 1069054110, 1065450257, 1060869843,
+  1055350975, 1048938407, 1041682578, 1033638576, 1024865073, 1015423254,
+  1005375799,  994785912,  983716448,  972229129,  960383883,  948238283,
+   935847107,  923262001,  910531246,  897699609,  884808279,  871894866,
+   858993459,  846134728,  833346062,  820651732,  808073073,  795628681,
+   783334608,  771204567,  759250125
+};
+#endif
+
+
+// MGRS standard DblLatLonToMGRS() uses, set by SetMgrsStd()
+static uint16_t mgrsStd = MGRS_STD;
 
 
-#if (MGRS_STD == 1989)
-//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// Code specifically for MGRS_1989_STD
-//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 /*
- * LatLonToUTM MGRS_1989_STD
- * Inputs: latitude (decimal degrees)
- *         longitude (decimal degrees)
- * Outputs: MGRS strings
- * Function: Converts the latitude longitude to UTM using old methods
- *           and then formats for Military Grid Reference System (MGRS)
+ * SinCosRad
+ * Inputs: rad (radians, |rad| <= PI)
+ * Outputs: sine & cosine of rad
+ * Function: Sine & cosine pair of the UTM & UPS conversions, by the math
+ *           library, or one CordicSinCos() pass when COORDS_CORDIC_UTM is 1
  */
-static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char* mgrsCoords)
+static void SinCosRad(double rad, double* pSin, double* pCos)
 {
-  if(latitude < -80 || latitude >= 84) {
-    mgrsZones = " ";
-    mgrsCoords = " ";
-    return; //needs to use UPS instead
-  }
+#if (COORDS_CORDIC_UTM == 1)
+  int32_t s, c;
+  CordicSinCos((int32_t)(rad * Q29_PER_RAD), &s, &c);
+  *pSin = s * (1.0 / Q30_PER_ONE);
+  *pCos = c * (1.0 / Q30_PER_ONE);
+#else
+  *pSin = sin(rad);
+  *pCos = cos(rad);
+#endif
+} // end SinCosRad
+
+
+/*
+ * Atan2Rad MGRS_2014_STD
+ * Inputs: y, x (|y|, |x| <= 1)
+ * Outputs: atan2(y, x) (radians)
+ * Function: Angle of (x, y) for the UTM conversion, by the math library, or
+ *           one CordicAtan2() pass when COORDS_CORDIC_UTM is 1
+ */
+static double Atan2Rad(double y, double x)
+{
+#if (COORDS_CORDIC_UTM == 1)
+  return CordicAtan2((int32_t)(y * Q30_PER_ONE), (int32_t)(x * Q30_PER_ONE),
+                     NULL) * (1.0 / Q29_PER_RAD);
+#else
+  return atan2(y, x);
+#endif
+} // end Atan2Rad MGRS_2014_STD
+
 
+/*
+ * RootW MGRS_1989_STD
+ * Inputs: sinPhi, cosPhi (of latitude phi)
+ * Outputs: W = sqrt(1 - e2 * sinPhi^2), so the prime vertical radius of
+ *          curvature N = alpha / W
+ * Function: By the math library, or when COORDS_CORDIC_UTM is 1 as the
+ *           CordicAtan2() magnitude of (cosPhi, B_OVER_A * sinPhi), as
+ *           1 - e2 * sinPhi^2 = cosPhi^2 + (1 - e2) * sinPhi^2
+ */
+static double RootW(double sinPhi, double cosPhi)
+{
+#if (COORDS_CORDIC_UTM == 1)
+  uint32_t w;
+  CordicAtan2((int32_t)(sinPhi * (B_OVER_A * Q30_PER_ONE)),
+              (int32_t)(cosPhi * Q30_PER_ONE), &w);
+  return w * (1.0 / Q30_PER_ONE);
+#else
+  (void)cosPhi;                       // only the CORDIC magnitude needs it
+  return sqrt(1.0 - e2 * sinPhi * sinPhi);
+#endif
+} // end RootW MGRS_1989_STD
+
+
+/*
+ * UtmZone
+ * Inputs: latitude (decimal degrees, -80 <= latitude < 84)
+ *         longitude (decimal degrees)
+ * Outputs: latitude band letter
+ * Function: Returns the UTM zone (negative south of the equator), with the
+ *           Norway (32V) and Svalbard (31X-37X) exceptions, common to both
+ *           MGRS standards
+ */
+static int UtmZone(double latitude, double longitude, char* band)
+{
   int zone = (int)((longitude + 180) / 6) + 1;
   if(latitude < 0)
   {
@@ -186,47 +367,117 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
     }
   }
 
+  // Bands are 8 degrees from -80 (X is 12), each including its south edge:
+  // truncation toward 0 is the band north of the equator, one band too far
+  // north south of it but on an edge (lat / 8 is exact, 8 being 2^3)
   char *letters = "CDEFGHJKLMNPQRSTUVWXX";
-  int latBandIndex = 9 + (int)(latitude / 8);
-  if(latitude > 0)
+  int latBandIndex = (int)(latitude / 8);
+  if(latitude < 8 * latBandIndex)
   {
-    latBandIndex++;
+    latBandIndex--;
   }
+  latBandIndex += 10;
 
-  char latitudeBandLetter = letters[latBandIndex];
+  *band = letters[latBandIndex];
+  return zone;
+} // end UtmZone
 
-  double phi = latitude * PI / 180;
-  double lamda0 = (-183 + (6 * abs(zone))) * PI / 180;
 
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Code specifically for MGRS_1989_STD
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Series coefficients, all constant expressions the compiler folds:
+// second eccentricity squared, its multiples in the A^5 and A^6 terms, and
+// the meridian arc  M = alpha*(m0*phi - m2*sin2phi + m4*sin4phi - m6*sin6phi)
+// as  M0*phi - sin2phi*(M2C0 + cos2phi*(M2C1 + cos2phi*M2C2)),  since
+// sin4phi = 2*sin2phi*cos2phi  and  sin6phi = sin2phi*(4*cos2phi^2 - 1)
+#define UTM_EP2     (e2 / (1.0 - e2))
+#define UTM_58EP2   (58.0 * UTM_EP2)
+#define UTM_330EP2  (330.0 * UTM_EP2)
+#define UTM_M0      (alpha * (1.0 - e2 / 4.0 - 3.0 * e2 * e2 / 64.0 - \
+                              5.0 * e2 * e2 * e2 / 256.0))
+#define UTM_M2      (alpha * (3.0 * e2 / 8.0 + 3.0 * e2 * e2 / 32.0 + \
+                              45.0 * e2 * e2 * e2 / 1024.0))
+#define UTM_M4      (alpha * (15.0 * e2 * e2 / 256.0 + \
+                              45.0 * e2 * e2 * e2 / 1024.0))
+#define UTM_M6      (alpha * (35.0 * e2 * e2 * e2 / 3072.0))
+#define UTM_M2C0    (UTM_M2 - UTM_M6)
+#define UTM_M2C1    (-2.0 * UTM_M4)
+#define UTM_M2C2    (4.0 * UTM_M6)
+
+/*
+ * UtmToStr
+ * Inputs: zone, band letter, 100 km square letters, and 10 m easting and
+ *         northing within the square
+ * Outputs: MGRS strings <ZZBsn> and <EEEE NNNN>
+ * Function: Formats UTM MGRS strings for both standards
+ */
+static void UtmToStr(int zone, char band, char eastingLetter,
+                     char northingLetter, long easting, long northing,
+                     char* mgrsZones, char* mgrsCoords)
+{
+  mgrsZones    = FmtUDec(mgrsZones, abs(zone), 2, '0');
+  *mgrsZones++ = band;
+  *mgrsZones++ = ' ';
+  *mgrsZones++ = eastingLetter;
+  *mgrsZones++ = northingLetter;
+  *mgrsZones   = '\0';
+  FmtGrid(mgrsCoords, (uint16_t)easting, (uint16_t)northing);
+} // end UtmToStr
+
+/*
+ * LatLonToUTM1989 MGRS_1989_STD
+ * Inputs: latitude (decimal degrees)
+ *         longitude (decimal degrees)
+ * Outputs: MGRS strings
+ * Function: Converts the latitude longitude to UTM using old methods
+ *           and then formats for Military Grid Reference System (MGRS)
+ */
+static void LatLonToUTM1989(double latitude, double longitude, char* mgrsZones, char* mgrsCoords)
+{
+  if(latitude < -80 || latitude >= 84) {
+    mgrsZones = " ";
+    mgrsCoords = " ";
+    return; //needs to use UPS instead
+  }
+
+  char latitudeBandLetter;
+  int zone = UtmZone(latitude, longitude, &latitudeBandLetter);
+
+  double phi = latitude * DEG_TO_RAD(1.0);
+  double lamda0 = (-183 + (6 * abs(zone))) * DEG_TO_RAD(1.0);
 
-  double ePrimeSquared = e * e / (1 - e * e); //eccentricity prime squared
+  // One sin/cos pair gives tan, and sin(2phi), cos(2phi) for the arc series
+  double sinPhi, cosPhi;
+  SinCosRad(phi, &sinPhi, &cosPhi);
+  double tanPhi = sinPhi / cosPhi;
+  double sin2   = 2.0 * sinPhi * cosPhi;
+  double cos2   = 1.0 - 2.0 * sinPhi * sinPhi;
 
-  double N = alpha / sqrt(1 - pow(e * sin(phi), 2));
-  double T = pow(tan(phi), 2);
-  double C = ePrimeSquared * pow(cos(phi), 2);
-  //double A = ((longitude * PI / 180) - (lamda0 * PI / 180)) * cos(phi);
-  double A = ((longitude * PI / 180) - lamda0) * cos(phi);
+  double N = alpha / RootW(sinPhi, cosPhi);
+  double T = tanPhi * tanPhi;
+  double C = UTM_EP2 * cosPhi * cosPhi;
+  double A = ((longitude * DEG_TO_RAD(1.0)) - lamda0) * cosPhi;
+  double A2 = A * A;
 
-  double M = (1 - (e2 / 4) - (3 * pow(e2, 2) / 64) - (5 * pow(e2, 3) / 256)) * phi;
-  M -= ((3 * e2 / 8) + (3 * pow(e2, 2) / 32) + (45 * pow(e2, 3) / 1024)) * sin(2 * phi);
-  M += ((15 * pow(e2, 2) / 256) + (45 * pow(e2, 3) / 1024)) * sin(4 * phi);
-  M -= (35 * pow(e2, 3) / 3072) * sin(6 * phi);
-  M *= alpha;
+  // Meridian arc, sin(4phi) & sin(6phi) folded into a polynomial in cos(2phi)
+  double M = UTM_M0 * phi - sin2 * (UTM_M2C0 + cos2 * (UTM_M2C1 + cos2 * UTM_M2C2));
 
-  //easting relative to central meridian
-  double east = (K0_UTM * N * (A + (1.0 - T + C) * pow(A, 3) / 6.0
-              + (5.0 - (18.0 * T) + pow(T, 2)
-              + (72.0 * C) - (58.0 * ePrimeSquared)) * pow(A, 5) / 120.0));
+  //easting relative to central meridian (Horner in A^2)
+  double east = K0_UTM * N * A *
+                (1.0 + A2 * ((1.0 - T + C) / 6.0 +
+                             A2 * (5.0 - 18.0 * T + T * T + 72.0 * C -
+                                   UTM_58EP2) / 120.0));
 
   east += 500000.0; //add false easting
 
   long easting = floor(east);
 
-  //northing from equator
-  double north = (K0_UTM * (M + N * tan(phi)
-               * (pow(A, 2) / 2 + (5 - T + 9 * C + 4 * pow(C, 2))
-               * pow(A, 4) / 24 + (61 - 58 * T + pow(T, 2)
-               + 600 * C - 330 * ePrimeSquared) * pow(A, 6) / 720)));
+  //northing from equator (Horner in A^2)
+  double north = K0_UTM * (M + N * tanPhi * A2 *
+                 (0.5 + A2 * ((5.0 - T + 9.0 * C + 4.0 * C * C) / 24.0 +
+                              A2 * (61.0 - 58.0 * T + T * T + 600.0 * C -
+                                    UTM_330EP2) / 720.0)));
 
   if(north < 0)                   {     //if southern hemisphere
     north += 10000000.0;          }     //add false northing
@@ -238,14 +489,14 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
     northing = 10000000 + northing;
   }
 
-  int slicesFromOrigin = floor(northing / 100000.0);
+  int slicesFromOrigin = (int)(northing / 100000L); // in long, float rounds up
 
   if(!(zone % 2)) //if zone is not odd
   {
     slicesFromOrigin += 5; //start w/ 'F'
   }
 
-  letters = "ABCDEFGHJKLMNPQRSTUVWXYZ";
+  char *letters = "ABCDEFGHJKLMNPQRSTUVWXYZ";
   int sliceId;
   char eastingLetter;
 
@@ -254,9 +505,9 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
   else                                        {
     sliceId = ((easting / 100000.0) - 1.0);   }
 
-  if((zone % 3) == 0)                         {
+  if((abs(zone) % 3) == 0)                    {
     eastingLetter = letters[16 + sliceId];    }
-  else if((zone % 3) == 1)                    {
+  else if((abs(zone) % 3) == 1)               {
     eastingLetter = letters[sliceId];         }
   else                                        {
     eastingLetter = letters[8 + sliceId];     }
@@ -266,81 +517,134 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
   easting = (easting % 100000) / 10;
   northing = (northing % 100000) /10;
 
-  sprintf(mgrsZones,  "%02d%c %c%c", abs(zone), latitudeBandLetter, eastingLetter, northingLetter);
-  sprintf(mgrsCoords, "%04ld %04ld", easting, northing);
-} // end LatLonToUTM MGRS_1989_STD
+  UtmToStr(zone, latitudeBandLetter, eastingLetter, northingLetter,
+           easting, northing, mgrsZones, mgrsCoords);
+} // end LatLonToUTM1989 MGRS_1989_STD
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // end MGRS_1989_STD specific code
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-#elif (MGRS_STD == 2014)
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Code specifically for MGRS_2014_STD
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Krueger series (ref 1) to 4th order in n = f/(2-f): rectifying radius R4
+// and alpha coefficients a2, a4, a6, a8 (of sin 2,4,6,8 xi'), giving easting
+// and northing within nanometers; a6 and a8 add ~8 mm and ~15 um at 4000 km.
 #define R4 6367449.1458234153093
 #define a2 8.3773182062446983032E-04
 #define a4 7.608527773572489156E-07
+#define a6 1.1976455033294526E-09
+#define a8 2.4291706072013588E-12
 
 
 /*
- * ComputeUtmX MGRS_2014_STD
- * Inputs: lamda (radians)
- *         phi (radians)
- * Outputs: x value
- * Function: Calculates x of the Krueger series based conversion
- *           from latitude/longitude to Universal Tranverse Mercator (UTM)
+ * Atanh
+ * Inputs: x (|x| < 1)
+ * Outputs: atanh(x)
+ * Function: Inverse hyperbolic tangent from log(), which XC16 lacks (C99)
  */
-static double ComputeUtmX(double lamda, double phi)
+static double Atanh(double x)
 {
-  double sinPhi = sin(phi);
-  double sinLamda = sin(lamda);
+  return 0.5 * log((1.0 + x) / (1.0 - x));
+} // end Atanh
 
-  double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
-  //chi (X) is "conformal latitude"
-  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
-  double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
 
-  long double u = log((1.0 + (cosChi * sinLamda)) / (1.0 - (cosChi * sinLamda))) / 2; //atanh(cosChi * sinLamda);
-  double v = atan2(sinChi, cosChi * cos(lamda));
+/*
+ * ComputeChi MGRS_2014_STD
+ * Inputs: sinPhi, cosPhi (of latitude phi)
+ * Outputs: sinChi, cosChi (of conformal latitude chi)
+ * Function: Calculates the conformal latitude, tan(chi) = sinh(psi) of the
+ *           isometric latitude  psi = atanh(sinPhi) - e * atanh(e * sinPhi).
+ *           Since exp(atanh(s)) = (1 + s)/cosPhi, with P = exp(e*atanh(e*s))
+ *             sinChi = ((1 + s)/P - (1 - s)*P) / ((1 + s)/P + (1 - s)*P)
+ *             cosChi = 2*cosPhi               / ((1 + s)/P + (1 - s)*P)
+ *           As e*s < 0.082 and e*atanh(e*s) < 0.0068, P is summed from the
+ *           atanh and exp series (to 1e-12) rather than with log() and exp()
+ */
+static void ComputeChi(double sinPhi, double cosPhi, double* sinChi, double* cosChi)
+{
+  double es2 = e2 * sinPhi * sinPhi;
+  double q = e2 * sinPhi * (1.0 + es2 * (1.0 / 3.0 + es2 * (1.0 / 5.0 + es2 / 7.0)));
+  double P = 1.0 + q * (1.0 + q * (0.5 + q * (1.0 / 6.0 + q / 24.0)));
+  double plus = (1.0 + sinPhi) / P;
+  double minus = (1.0 - sinPhi) * P;
 
-  return R4 * (u + (a2 * sinh(2 * u) * cos(2 * v)) + (a4 * sinh(4 * u) * cos(4 * v)));
-} // end ComputeUtmX MGRS_2014_STD
+  *sinChi = (plus - minus) / (plus + minus);
+  *cosChi = 2.0 * cosPhi / (plus + minus);
+} // end ComputeChi MGRS_2014_STD
 
 
 /*
- * ComputeUtmY MGRS_2014_STD
- * Inputs: lamda (radians)
+ * ComputeUtmXY MGRS_2014_STD
+ * Inputs: lamda (radians from central meridian)
  *         phi (radians)
- * Outputs: y value
- * Function: Calculates y of the Krueger series based conversion
- *           from latitude/longitude to Universal Tranverse Mercator (UTM)
+ * Outputs: x, y values (unscaled, from central meridian and equator)
+ * Function: Calculates x and y of the Krueger series based conversion
+ *           from latitude/longitude to Universal Tranverse Mercator (UTM).
+ *           With xi' = atan2(sinChi, cosChi*cosLamda) and
+ *           eta' = atanh(cosChi*sinLamda), zeta = xi + i*eta is
+ *             zeta' + sum(a2j * sin(2j * zeta'))
+ *           summed by complex Clenshaw from sin & cos of 2*zeta', which take
+ *           no more library calls: r = cosChi*sinLamda, 1 - r^2 = the squared
+ *           hypotenuse of xi', so  sin(2xi') = 2*sinChi*cosChi*cosLamda/(1-r^2),
+ *           cosh(2eta') = (1+r^2)/(1-r^2)  and  sinh(2eta') = 2r/(1-r^2)
  */
-static double ComputeUtmY(double lamda, double phi)
+static void ComputeUtmXY(double lamda, double phi, double* x, double* y)
 {
-  double sinPhi = sin(phi);
-  double sinLamda = sin(lamda);
-
-  double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
-  //chi (X) is "conformal latitude"
-  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
-  double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
-
-  double u = log((1 + (cosChi * sinLamda)) / (1 - (cosChi * sinLamda))) / 2; //atanh(cosChi * sinLamda);
-  double v = atan2(sinChi, cosChi * cos(lamda));
+  static const double ALPHA[4] = { a2, a4, a6, a8 };
+  double sinPhi, cosPhi, sinChi, cosChi;
+  SinCosRad(phi, &sinPhi, &cosPhi);
+  ComputeChi(sinPhi, cosPhi, &sinChi, &cosChi);
+
+  // |lamda| < 0.16 (9 degrees wide 31X-37X), so sin & cos by series to 1e-14
+  double l2 = lamda * lamda;
+  double sinLamda = lamda * (1.0 - l2 / 6.0 * (1.0 - l2 / 20.0 * (1.0 - l2 / 42.0 * (1.0 - l2 / 72.0))));
+  double cosLamda = 1.0 - l2 / 2.0 * (1.0 - l2 / 12.0 * (1.0 - l2 / 30.0 * (1.0 - l2 / 56.0)));
+
+  double xiY = sinChi;
+  double xiX = cosChi * cosLamda;
+  double r = cosChi * sinLamda;
+  double xi = Atan2Rad(xiY, xiX);
+  double eta = Atanh(r);
+
+  double inv = 1.0 / (1.0 - r * r);
+  double sin2Xi = 2.0 * xiY * xiX * inv;
+  double cos2Xi = (xiX * xiX - xiY * xiY) * inv;
+  double sinh2Eta = 2.0 * r * inv;
+  double cosh2Eta = (1.0 + r * r) * inv;
+
+  // 2*cos(2zeta') and sin(2zeta'), real and imaginary parts
+  double ar = 2.0 * cos2Xi * cosh2Eta;
+  double ai = -2.0 * sin2Xi * sinh2Eta;
+  double sr = sin2Xi * cosh2Eta;
+  double si = cos2Xi * sinh2Eta;
+
+  double br = 0, bi = 0;        // Clenshaw b(k+1)
+  double cr = 0, ci = 0;        // Clenshaw b(k+2)
+  int k;
+  for(k = 3; k >= 0; k--)
+  {
+    double tr = ar * br - ai * bi - cr + ALPHA[k];
+    double ti = ar * bi + ai * br - ci;
+    cr = br;  ci = bi;
+    br = tr;  bi = ti;
+  }
 
-  return R4 * (v + (a2 * cosh(2 * u) * sin(2 * v)) + (a4 * cosh(4 * u) * sin(4 * v)));
-} // end ComputeUtmY MGRS_2014_STD
+  *y = R4 * (xi + br * sr - bi * si);
+  *x = R4 * (eta + br * si + bi * sr);
+} // end ComputeUtmXY MGRS_2014_STD
 
 
 /*
- * LatLonToUTM MGRS_2014_STD
+ * LatLonToUTM2014 MGRS_2014_STD
  * Inputs: latitude (decimal degrees)
  *         longitude (decimal degrees)
  * Outputs: MGRS strings
  * Function: Converts the latitude longitude to UTM
  *           and then formats for Military Grid Reference System (MGRS)
  */
-static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char* mgrsCoords)
+static void LatLonToUTM2014(double latitude, double longitude, char* mgrsZones, char* mgrsCoords)
 {
   if(latitude < -80 || latitude >= 84) {
     mgrsZones = " ";
@@ -348,72 +652,22 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
     return; //needs to use UPS instead
   }
 
-  int zone = (int)((longitude + 180) / 6) + 1;
-  if(latitude < 0)
-  {
-    zone = -zone;
-  }
-
-  if(zone == 31 && 56 <= latitude && latitude < 64 && longitude >= 3)
-  {
-    zone = 32;
-  }
-  else if(zone == 32 && latitude >= 72)
-  {
-    if(longitude < 9)
-    {
-      zone = 31;
-    }
-    else
-    {
-      zone = 33;
-    }
-  }
-  else if(zone == 34 && latitude >= 72)
-  {
-    if(longitude < 21)
-    {
-      zone = 33;
-    }
-    else
-    {
-      zone = 35;
-    }
-  }
-  else if(zone == 36 && latitude >= 72)
-  {
-    if(longitude < 33)
-    {
-      zone = 35;
-    }
-    else
-    {
-      zone = 37;
-    }
-  }
-
-  char *letters = "CDEFGHJKLMNPQRSTUVWXX";
-  int latBandIndex = 9 + (int)(latitude / 8);
-  if(latitude > 0)
-  {
-    latBandIndex++;
-  }
-
-  char latitudeBandLetter = letters[latBandIndex];
+  char latitudeBandLetter;
+  int zone = UtmZone(latitude, longitude, &latitudeBandLetter);
 
+  // lamda from the central meridian in degrees, exactly, before scaling
   double phi = latitude * PI / 180;
-  double lamda = longitude * PI / 180;
-  double lamda0 = (-183 + (6 * abs(zone))) * PI / 180;
+  double lamda = (longitude - (-183 + (6 * abs(zone)))) * PI / 180;
   double x_origin = 500000; //"false easting"
   double y_origin = 0; //"false northing"
   if(zone < 0)                      {
     y_origin= 10000000;             }
 
-  double x_cm = x_origin - K0_UTM * ComputeUtmX(0.0, 0.0);
-  double y_eq = y_origin - K0_UTM * ComputeUtmY(0.0, 0.0);
+  double x, y;
+  ComputeUtmXY(lamda, phi, &x, &y);
 
-  double x_utm = K0_UTM * ComputeUtmX(lamda - lamda0, phi) + x_cm;
-  double y_utm = K0_UTM * ComputeUtmY(lamda - lamda0, phi) + y_eq;
+  double x_utm = K0_UTM * x + x_origin;
+  double y_utm = K0_UTM * y + y_origin;
 
   long easting = (long)x_utm % 100000 / 10; //floor(mod(x_utm, 10^5) / 10^(5-4))
   long northing = (long)y_utm % 100000 / 10; //floor(mod(y_utm, 10^5) / 10^(5-4))
@@ -435,70 +689,69 @@ static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char
 
   char northingLetter = northLetters[((long) y_utm % 2000000 / 100000)];
 
-  sprintf(mgrsZones,  "%02d%c %c%c", abs(zone), latitudeBandLetter, eastingLetter, northingLetter);
-  sprintf(mgrsCoords, "%04ld %04ld", easting, northing);
-} // end LatLonToUTM MGRS_2014_STD
-
-//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-// end MGRS_2014_STD specific code
-//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-#else
-  #error MGRS_STD must be either 1989 or 2014
-#endif // MGRS_STD
+  UtmToStr(zone, latitudeBandLetter, eastingLetter, northingLetter,
+           easting, northing, mgrsZones, mgrsCoords);
+} // end LatLonToUTM2014 MGRS_2014_STD
 
 
 /*
- * ComputeUpsX
- * Inputs: lamda (radians)
- *         phi (radians)
- * Outputs: x value
- * Function: Calculates x of the Krueger series based conversion
- *           from latitude/longitude to Universal Polar Stereographic (UPS)
+ * ComputeUpsRho MGRS_2014_STD
+ * Inputs: phi (radians, toward the pole)
+ * Outputs: distance from the pole (meters, scaled by K0_UPS)
+ * Function: Calculates the Universal Polar Stereographic (UPS) distance
+ *           from the pole by the conformal latitude:
+ *             2 * alpha * K0_UPS / UPS_K90 * cosChi / (1 + sinChi)
  */
-static double ComputeUpsX(double lamda, double phi, double k90)
+static double ComputeUpsRho(double phi)
 {
-  double sinPhi = sin(phi);
+  double sinPhi, cosPhi, sinChi, cosChi;
+  SinCosRad(phi, &sinPhi, &cosPhi);
+  ComputeChi(sinPhi, cosPhi, &sinChi, &cosChi);
 
-  double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
-  //chi (X) is "conformal latitude"
-  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
-  double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+  return (2 * alpha * K0_UPS / UPS_K90) * cosChi / (1 + sinChi);
+} // end ComputeUpsRho MGRS_2014_STD
 
-  return ((2 * alpha * sin(lamda) * cosChi) / (k90 * (1 + sinChi)));
-} // end ComputeUpsX
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// end MGRS_2014_STD specific code
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 
 /*
- * ComputeUpsY
+ * ComputeUpsXY MGRS_1989_STD
  * Inputs: lamda (radians)
  *         phi (radians)
- * Outputs: y value
- * Function: Calculates y of the Krueger series based conversion
- *           from latitude/longitude to Universal Polar Stereographic (UPS)
+ * Outputs: x & y values
+ * Function: Calculates x & y of the Krueger series based conversion
+ *           from latitude/longitude to Universal Polar Stereographic (UPS),
+ *           from one sin/cos pair of each of phi and lamda
  */
-static double ComputeUpsY(double lamda, double phi, double k90)
+static void ComputeUpsXY(double lamda, double phi, double k90, double* x, double* y)
 {
-  double sinPhi = sin(phi);
+  double sinPhi, cosPhi, sinLamda, cosLamda;
+  SinCosRad(phi, &sinPhi, &cosPhi);
+  SinCosRad(lamda, &sinLamda, &cosLamda);
 
   double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
   //chi (X) is "conformal latitude"
-  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+  double cosChi = 2 * cosPhi / ((1 + sinPhi) / P + (1 - sinPhi) / P);
   double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
 
-  return ((-2 * alpha * cos(lamda) * cosChi) / (k90 * (1 + sinChi)));
-} // end ComputeUpsY
+  *x = ((2 * alpha * sinLamda * cosChi) / (k90 * (1 + sinChi)));
+  *y = ((-2 * alpha * cosLamda * cosChi) / (k90 * (1 + sinChi)));
+} // end ComputeUpsXY MGRS_1989_STD
 
 
 /*
  * LatLonToUPS
  * Inputs: latitude (decimal degrees)
  *         longitude (decimal degrees)
+ *         isKrueger (MGRS_2014_STD, else MGRS_1989_STD)
  * Outputs: MGRS strings
  * Function: Converts the latitude longitude to UPS
  *           and then formats for Military Grid Reference System (MGRS)
  */
 static void LatLonToUPS(double latitude, double longitude,
-                        char* mgrsZones, char* mgrsCoords)
+                        char* mgrsZones, char* mgrsCoords, bool isKrueger)
 {
   int zone = 0; //denote error
   if(latitude >= 84)
@@ -527,13 +780,29 @@ static void LatLonToUPS(double latitude, double longitude,
   char* eastingStr = "";
   char northingLetter;
 
-  double k90 = sqrt(pow((1 + e), (1 + e)) * pow((1 - e), (1 - e)));
+  if(isKrueger)
+  {
+    double rho = ComputeUpsRho(zone * phi);
+    double sinLamda, cosLamda;
+    SinCosRad(lamda - lamda0, &sinLamda, &cosLamda);
+    x = rho * sinLamda + x_pole;
+    y = -zone * rho * cosLamda + y_pole;
+  }
+  else if(zone == -1) //south pole
+  {
+    ComputeUpsXY(lamda - lamda0, (-1 * phi), UPS_K90, &x, &y);
+    x = K0_UPS * x + x_pole;
+    y = (-1 * K0_UPS) * y + y_pole;
+  }
+  else //north pole
+  {
+    ComputeUpsXY(lamda - lamda0, phi, UPS_K90, &x, &y);
+    x = K0_UPS * x + x_pole;
+    y = K0_UPS * y + y_pole;
+  }
 
   if(zone == -1) //south pole
   {
-    x = K0_UPS * ComputeUpsX(lamda - lamda0, (-1 * phi), k90) + x_pole;
-    y = (-1 * K0_UPS) * ComputeUpsY(lamda - lamda0, (-1 * phi), k90) + y_pole;
-
     char* eastingLetters[24] = { "AJ", "AK", "AL", "AP", "AQ", "AR", "AS", "AT", "AU", "AX", "AY", "AZ", "BA", "BB", "BC", "BF", "BG", "BH", "BJ", "BK", "BL", "BP", "BQ", "BR" };
     char* northingLetters = "ABCDEFGHJKLMNPQRSTUVWXYZ";
 
@@ -542,9 +811,6 @@ static void LatLonToUPS(double latitude, double longitude,
   }
   else //north pole
   {
-    x = K0_UPS * ComputeUpsX(lamda - lamda0, phi, k90) + x_pole;
-    y = K0_UPS * ComputeUpsY(lamda - lamda0, phi, k90) + y_pole;
-
     char* eastingLetters[14] = { "YR", "YS", "YT", "YU", "YX", "YY", "YZ", "ZA", "ZB", "ZC", "ZF", "ZG", "ZH", "ZJ" };
     char* northingLetters = "ABCDEFGHJKLMNP";
 
@@ -555,51 +821,53 @@ static void LatLonToUPS(double latitude, double longitude,
   long easting = (long)x % 100000 / 10; //floor(mod(x, 10^5) / 10^(5-4))
   long northing = (long)y % 100000 / 10; //floor(mod(y, 10^5) / 10^(5-4))
 
-  sprintf(mgrsZones,  "  %s %c", eastingStr, northingLetter);
-  sprintf(mgrsCoords, "%04ld %04ld", easting, northing);
+  mgrsZones[0] = ' ';
+  mgrsZones[1] = ' ';
+  mgrsZones[2] = eastingStr[0];
+  mgrsZones[3] = eastingStr[1];
+  mgrsZones[4] = ' ';
+  mgrsZones[5] = northingLetter;
+  mgrsZones[6] = '\0';
+  FmtGrid(mgrsCoords, (uint16_t)easting, (uint16_t)northing);
 } // end LatLonToUPS
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  double HexDegToDblDeg(char* hexDeg, bool isLat)
-//  Converts hexadecimal representation of 32-bit scaled degrees to double.
+//  int32_t HexDegToPt32(char* hexDeg, bool isLat)
+//  Converts hexadecimal representation of 32-bit scaled degrees (two's
+//  complement, 360/UINT32_MAX degrees per count) to geopt32_t 0.00001
+//  degrees, rounded.  Integer math:  x = scaled * 36000000, over UINT32_MAX as
+//  (x + x/2^32)/2^32 (the rest < 1e-9 lsb).
 //
 //  INPUT : char * - hextext representation of scaled degrees value to convert
 //          bool   - isLat indicates if this is a latitude (for range checks)
-//  OUTPUT: double - returns COORD_ERR on error, otherwise degrees represented
+//  OUTPUT: int32_t - returns COORD_ERR_PT on error, otherwise 0.00001 degrees
 //  CALLS : strtoul
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-double HexDegToDblDeg(char* hexDeg, bool isLat)
+int32_t HexDegToPt32(char* hexDeg, bool isLat)
 {
-  #define HEX_DEG_SCALER (360.0 / (double)UINT32_MAX)
   char*     endPtr;
   uint32_t  scaled;           // strtol w/int32_t doesn't always work w/ hexDeg
-  double    dbl;
+  int64_t   x;                // scaled * 36000000
+  int32_t   pt;
 
   scaled = strtoul(hexDeg, &endPtr, 16);
-  if (0x80000000 & scaled)
-  { // When scaled value represents negative coordinate, make it so
-    scaled *= -1; // scaled = ~scaled; scaled++;
-    dbl = ((double)scaled) * (-HEX_DEG_SCALER);
-  }
-  else
-  { // When scaled value represents non-negative there is nothing special to do
-    dbl = ((double)scaled) * HEX_DEG_SCALER;
-  }
+  x  = (int64_t)(int32_t)scaled * HEX_PT_PER_TURN;
+  pt = (int32_t)((x + (x >> 32) + 0x80000000LL) >> 32); // rounded, x/UINT32_MAX
 
   if ((endPtr != (hexDeg + 8))                    ||    // wrong # hex digits,
-      (isLat && ((-90.0 > dbl) || (90.0 < dbl)))  ||    // out-of-range lat, or
-      ((-180.0 > dbl) || (180.0 < dbl)))              { // out-of-range lon:
-    return COORD_ERR;                                 } // return error value.
+      (isLat && ((-PT_90 > pt) || (PT_90 < pt)))  ||    // out-of-range lat, or
+      ((-PT_180 > pt) || (PT_180 < pt)))              { // out-of-range lon:
+    return COORD_ERR_PT;                              } // return error value.
   else                                                { // Otherwise:
-    return dbl;                                       } // return calculated deg
-} // end function HexDegToDblDeg
+    return pt;                                        } // return 0.00001 deg
+} // end function HexDegToPt32
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void ClearCoords(coords_t *pCoord)
-//  Clears/Initializes a coords_t structure to the geo-strings ' ' filled and
-//  the double values are set to COORD_ERR.
+//  Clears/Initializes a coords_t structure to no fix (COORD_ERR) and nothing
+//  rendered.
 //
 //  INPUT : coords_t * - structure to clear
 //  OUTPUT: NONE (other than the updating structure)
@@ -607,131 +875,216 @@ double HexDegToDblDeg(char* hexDeg, bool isLat)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 void ClearCoords(coords_t *pCoord)
 {
-  memset((void*)pCoord,' ',(sizeof(coords_t) - (2*sizeof(double))));
-  pCoord->decLat[COORD_LEN]   = '\0';   // memset filled struct with ' '
-  pCoord->decLon[COORD_LEN]   = '\0';   // now need to NULL terminate
-  pCoord->dmsLat[COORD_LEN]   = '\0';   // every string and set doubles
-  pCoord->dmsLon[COORD_LEN]   = '\0';   // to special 'error' value
-  pCoord->mgrsGzd[COORD_LEN]  = '\0';
-  pCoord->mgrs10m[COORD_LEN]  = '\0';
-  pCoord->dblLat              = COORD_ERR;
-  pCoord->dblLon              = COORD_ERR;
+  pCoord->pt.lat      = COORD_ERR_PT;   // no fix
+  pCoord->pt.lon      = COORD_ERR_PT;
+  pCoord->dblLat      = COORD_ERR;
+  pCoord->dblLon      = COORD_ERR;
+  pCoord->memo.fmt    = CF_NONE;        // nothing rendered, lines ' ' filled
+  memset((void*)pCoord->memo.line, ' ', sizeof(pCoord->memo.line));
+  pCoord->memo.line[0][COORD_LEN] = '\0';
+  pCoord->memo.line[1][COORD_LEN] = '\0';
 } // end routine ClearCoords
 
 
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t DecDegToPt32(char *pDec, int32_t maxPt)
+//  Converts fixed width <sDDD.ddddd> decimal degrees to 0.00001 degree units.
+//
+//  INPUT : char    *pDec  - degrees in fixed width form <sDDD.ddddd>
+//          int32_t  maxPt - largest magnitude allowed (0.00001 degree)
+//  OUTPUT: int32_t - 0.00001 degrees, or COORD_ERR_PT if wrong form or range
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t DecDegToPt32(char *pDec, int32_t maxPt)
+{
+  int32_t pt = 0;
+  int16_t i;
+
+  if ((('+' != pDec[0]) && ('-' != pDec[0])) || ('.' != pDec[4])) {
+    return COORD_ERR_PT;                                         }
+  for (i = 1; i < COORD_LEN; i++)
+  {
+    if (4 == i)                               {
+      continue;                               }   // skip '.'
+    if (('0' > pDec[i]) || ('9' < pDec[i]))   {
+      return COORD_ERR_PT;                    }
+    pt = (pt * 10) + (pDec[i] - '0');
+  }
+  if (maxPt < pt)         {
+    return COORD_ERR_PT;  }
+  return ('-' == pDec[0]) ? -pt : pt;
+} // end function DecDegToPt32
+
+
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon)
-//  Populates entire coords_t structure based on lat & lon input of fixed-width
-//  form <sDDD.ddddd> (e.g. +012.01234 or -180.00000).
+//  Sets the coords_t fix from lat & lon input of fixed-width form <sDDD.ddddd>
+//  (e.g. +012.01234 or -180.00000), and its SetGeoTrig() cache, in integer
+//  math.  No strings are formatted until RenderCoords().
 //
 //  INPUT : coords_t *pCoord - structure to populate
 //          char     *pLat   - latitude  in fixed width form <sDDD.ddddd>
 //          char     *pLon   - longitude in fixed width form <sDDD.ddddd>
 //  OUTPUT: bool - returns true if input lat/lon representation valid
 //          updates structure (invokes ClearCoords() if lat/lon invalid)
-//  CALLS : memcpy
-//          DecLatLonToDblLatLon
+//  CALLS : DecDegToPt32
 //          ClearCoords
-//          DblLatLonToDMS
-//          DblLatLonToMGRS
+//          SetGeoTrig
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon)
 {
-  memcpy((void*)pCoord->decLat, (const void*)pLat,  COORD_LEN);
-  memcpy((void*)pCoord->decLon, (const void*)pLon,  COORD_LEN);
-  DecLatLonToDblLatLon(pCoord);
-  if (COORD_ERR == pCoord->dblLat || COORD_ERR == pCoord->dblLon)
+  pCoord->pt.lat = DecDegToPt32(pLat,  90 * GEOPT32_PER_DEG);
+  pCoord->pt.lon = DecDegToPt32(pLon, 180 * GEOPT32_PER_DEG);
+  if ((COORD_ERR_PT == pCoord->pt.lat) || (COORD_ERR_PT == pCoord->pt.lon))
   {
     ClearCoords(pCoord);
     return false;
   }
   else
   {
-    DblLatLonToDMS(pCoord);
-    DblLatLonToMGRS(pCoord);
+    SetGeoTrig(pCoord->pt, &pCoord->trig);
     return true;
   }
 } // end function SetCoordsFromDecLatLon
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  void DecLatLonToDblLatLon(coords_t *pCoord)
-//  Converts fixed length sDDD.DDDDD representation of decimal degrees to double
+//  int32_t Pt32ToDms(int32_t pt)
+//  Converts 0.00001 degrees to signed DDDMMSS as displayed:  degrees and
+//  minutes truncated, seconds rounded (up to 60, as always shown).  Integer
+//  math, so exact.
 //
-//  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure using COORD_ERR if appropriate
-//  CALLS : strtod
+//  INPUT : int32_t pt - 0.00001 degrees
+//  OUTPUT: int32_t - (DDD * 10000 + MM * 100 + SS), one's complement (~) if pt
+//          negative, so S & W keep their letter even at 000.00.00
+//  CALLS : NONE
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-void DecLatLonToDblLatLon(coords_t *pCoord)
+static int32_t Pt32ToDms(int32_t pt)
 {
-  char*   endPtr;
-  double  dbl;
+  uint32_t u = (0 > pt) ? -pt : pt;
+  uint32_t d, m;
 
-  dbl = strtod(pCoord->decLat, &endPtr);
-  if ((endPtr != (pCoord->decLat + 10)) ||    // When wrong # digits/form
-      ((-90.0 > dbl) || (90.0 < dbl)))      { // or out-of-range lat
-    dbl = COORD_ERR;                        } // then set error value.
-  pCoord->dblLat = dbl;
+  d = u / GEOPT32_PER_DEG;  u = (u % GEOPT32_PER_DEG) * 60; // do NOT round 'd'
+  m = u / GEOPT32_PER_DEG;  u = (u % GEOPT32_PER_DEG) * 60; // do NOT round 'm'
+  u = (d * 10000) + (m * 100) +                             // but DO round 's'
+      ((u + (GEOPT32_PER_DEG / 2)) / GEOPT32_PER_DEG);
+  return (0 > pt) ? ~(int32_t)u : (int32_t)u;
+} // end function Pt32ToDms
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void DmsToStr(int32_t dms, char *hemi, char *str)
+//  Formats signed DDDMMSS (Pt32ToDms) as fixed length <HDDD.MM.SS>.
+//
+//  INPUT : int32_t dms  - DDDMMSS, one's complement (negative) for hemi[1]
+//          char   *hemi - hemisphere letters positive & negative ("NS", "EW")
+//          char   *str  - COORD_LEN+1 chars to update
+//  OUTPUT: updates str
+//  CALLS : FmtUDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void DmsToStr(int32_t dms, char *hemi, char *str)
+{
+  uint32_t u = (0 > dms) ? ~dms : dms;
 
-  dbl = strtod(pCoord->decLon, &endPtr);
-  if ((endPtr != (pCoord->decLon + 10)) ||    // When wrong # digits/form
-      ((-180.0 > dbl) || (180.0 < dbl)))    { // or out-of-range lon
-    dbl = COORD_ERR;                        } // then set error value.
-  pCoord->dblLon = dbl;
-} // end function DecLatLonToDblLatLon
+  *str++ = hemi[0 > dms];
+  str    = FmtUDec(str, (uint16_t)(u / 10000), 3, '0');
+  *str++ = '.';
+  str    = FmtUDec(str, (uint16_t)(u / 100 % 100), 2, '0');
+  *str++ = '.';
+  FmtUDec(str, (uint16_t)(u % 100), 2, '0');
+} // end routine DmsToStr
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  void DblLatLonToDMS(coords_t *pCoord)
-//  Converts lat and lon to corresponding fixed length HDDD.MM.SS characters.
+//  void Pt32ToDecStr(int32_t pt, char *str)
+//  Formats 0.00001 degrees as fixed length <sDDD.ddddd>, as D.GLL gives it.
 //
-//  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure lat/lon with <HDDD.MM.SS> chars
-//  CALLS : fabs
-//          sprintf
+//  INPUT : int32_t pt  - 0.00001 degrees
+//          char   *str - COORD_LEN+1 chars to update
+//  OUTPUT: updates str
+//  CALLS : FmtFixed
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-void DblLatLonToDMS(coords_t *pCoord)
+static void Pt32ToDecStr(int32_t pt, char *str)
 {
-  double  dblLat = pCoord->dblLat;      // local:smaller code & preserves pCoord
-  double  dblLon = pCoord->dblLon;
-  char    caLat[COORD_LEN+1] = "";
-  char    caLon[COORD_LEN+1] = "";
-  bool    isNeg;                        // i.e. is SOUTH or WEST ?
-  uint16_t d, m, s;                     // degrees, minutes, seconds
+  uint32_t u = (0 > pt) ? -pt : pt;
+
+  *str++ = (0 > pt) ? '-' : '+';
+  FmtFixed(str, u, 3, 5);             // 5 digits: GEOPT32_PER_DEG
+} // end routine Pt32ToDecStr
 
-  if (( -90.0 <= dblLat) && ( 90.0 >= dblLat) &&
-      (-180.0 <= dblLon) && (180.0 >= dblLon))
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void RenderCoords(coords_t *pCoord, coordfmt_t fmt)
+//  Makes pCoord->memo.line[] the two 10-char lines of the fix in format fmt,
+//  ' ' filled if no fix.  The lines are formatted only when fmt or what they
+//  would show changed since last rendered:  DMS whole seconds, DEC digits, or
+//  (MGRS) the fix.  MGRS sets dblLat & dblLon from the fix, for
+//  DblLatLonToMGRS().
+//
+//  INPUT : coords_t  *pCoord - structure holding fix and memo
+//          coordfmt_t fmt    - CF_DMS, CF_DEC or CF_MGRS
+//  OUTPUT: updates structure memo
+//  CALLS : Pt32ToDms
+//          DmsToStr
+//          Pt32ToDecStr
+//          DblLatLonToMGRS
+//          memset
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void RenderCoords(coords_t *pCoord, coordfmt_t fmt)
+{
+  coordmemo_t * pMemo = &pCoord->memo;
+  bool          isFix = (COORD_ERR_PT != pCoord->pt.lat);
+  int32_t       keyLat = pCoord->pt.lat;      // DEC & MGRS show the fix
+  int32_t       keyLon = pCoord->pt.lon;
+
+  if (isFix && (CF_DMS == fmt))
+  { // DMS shows whole seconds, so fixes within one are the same lines
+    keyLat = Pt32ToDms(keyLat);
+    keyLon = Pt32ToDms(keyLon);
+  }
+  if ((fmt == pMemo->fmt) && (keyLat == pMemo->key[0]) &&
+      (keyLon == pMemo->key[1]))        {
+    return;                             }   // lines already show this
+
+  pMemo->fmt    = fmt;
+  pMemo->key[0] = keyLat;
+  pMemo->key[1] = keyLon;
+  if (!isFix)
+  {
+    memset((void*)pMemo->line, ' ', sizeof(pMemo->line));
+    pMemo->line[0][COORD_LEN] = '\0';
+    pMemo->line[1][COORD_LEN] = '\0';
+  }
+  else if (CF_DMS == fmt)
+  {
+    DmsToStr(keyLat, "NS", pMemo->line[0]);
+    DmsToStr(keyLon, "EW", pMemo->line[1]);
+  }
+  else if (CF_DEC == fmt)
+  {
+    Pt32ToDecStr(keyLat, pMemo->line[0]);
+    Pt32ToDecStr(keyLon, pMemo->line[1]);
+  }
+  else // CF_MGRS, the one use of float
   {
-    isNeg = (0 > dblLat);
-    dblLat = fabs(dblLat);
-    d = dblLat;  dblLat = (dblLat - d) * 60;  // do NOT round 'd' up
-    m = dblLat;  dblLat = (dblLat - m) * 60;  // do NOT round 'm' up
-    s = dblLat + 0.5;                         // but DO round 's' up
-    sprintf(caLat, "%04d.%02d.%02d", d, m, s);
-    caLat[0] = (isNeg) ? 'S' : 'N';
-
-    isNeg = (0 > dblLon);
-    dblLon = fabs(dblLon);
-    d = dblLon;  dblLon = (dblLon - d) * 60;
-    m = dblLon;  dblLon = (dblLon - m) * 60;
-    s = dblLon + 0.5;
-    sprintf(caLon, "%04d.%02d.%02d", d, m, s);
-    caLon[0] = (isNeg) ? 'W' : 'E';
-  }
-  sprintf(pCoord->dmsLat, "%-10s", caLat);
-  sprintf(pCoord->dmsLon, "%-10s", caLon);
-} // end routine DblLatLonToDMS
+    pCoord->dblLat = keyLat / (double)GEOPT32_PER_DEG;
+    pCoord->dblLon = keyLon / (double)GEOPT32_PER_DEG;
+    DblLatLonToMGRS(pCoord);
+  }
+} // end routine RenderCoords
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void DblLatLonToMGRS(coords_t *pCoord)
-//  Converts lat/lon coordinate to geopt16_t without verifying inputs.
+//  Converts lat/lon coordinate to MGRS without verifying inputs.
+//  The MGRS standard used is the one last set by SetMgrsStd() (MGRS_STD).
 //
 //  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure mgrsGzd and mgrs10m
+//  OUTPUT: updates structure memo.line[] with grid-zone and easting & northing
 //  CALLS : LatLonToUPS
-//          LatLonToUTM
-//          sprintf
+//          LatLonToUTM1989
+//          LatLonToUTM2014
+//          FmtPadRight
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 void DblLatLonToMGRS(coords_t *pCoord)
 {
@@ -742,44 +1095,281 @@ void DblLatLonToMGRS(coords_t *pCoord)
       (-180.0 <= pCoord->dblLon) && (180.0 >= pCoord->dblLon))
   {
     double lclDblLon = pCoord->dblLon;            // do NOT mod pCoord->dblLon
-    if(lclDblLon == 180.0 || lclDblLon == -180.0)
-    { //adjust edge case
-      lclDblLon = 0;
+    if(lclDblLon == 180.0)
+    { //adjust edge case: the anti-meridian is zone 1's west edge, not zone 61
+      lclDblLon = -180.0;
     }
 
     if(pCoord->dblLat >= 84 || pCoord->dblLat < -80)
     {
-      LatLonToUPS(pCoord->dblLat, lclDblLon, mgrsZones, mgrsCoords);
+      LatLonToUPS(pCoord->dblLat, lclDblLon, mgrsZones, mgrsCoords,
+                  (MGRS_2014 == mgrsStd));
+    }
+    else if (MGRS_2014 == mgrsStd)
+    {
+      LatLonToUTM2014(pCoord->dblLat, lclDblLon, mgrsZones, mgrsCoords);
     }
     else
     {
-      LatLonToUTM(pCoord->dblLat, lclDblLon, mgrsZones, mgrsCoords);
+      LatLonToUTM1989(pCoord->dblLat, lclDblLon, mgrsZones, mgrsCoords);
     }
   }
-  sprintf(pCoord->mgrsGzd, "%-10s", mgrsZones);
-  sprintf(pCoord->mgrs10m, "%-10s", mgrsCoords);
+  FmtPadRight(pCoord->memo.line[0], mgrsZones,  COORD_LEN);
+  FmtPadRight(pCoord->memo.line[1], mgrsCoords, COORD_LEN);
 } // end routine DblLatLonToMGRS
 
 
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SetMgrsStd(uint16_t std)
+//  Selects the MGRS standard DblLatLonToMGRS() uses from then on, such as the
+//  devcfg_t setting.  Any value other than MGRS_1989 or MGRS_2014 (e.g. from
+//  unwritten NVMEM) selects the compiled default MGRS_STD.  MGRS lines already
+//  rendered (RenderCoords) are kept until their fix changes.
+//
+//  INPUT : uint16_t std - MGRS_1989 or MGRS_2014
+//  OUTPUT: NONE
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void SetMgrsStd(uint16_t std)
+{
+  if ((MGRS_1989 == std) || (MGRS_2014 == std)) {
+    mgrsStd = std;                              }
+  else                                          {
+    mgrsStd = MGRS_STD;                         }
+} // end routine SetMgrsStd
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t Pt32ToPt16(int32_t pt, uint32_t maxPt)
+//  Scales 0.00001 degrees to geopt16_t, 32767 at maxPt, truncated toward 0
+//  as (int16_t)(deg * 32767 / maxDeg) would be if exact.  Integer math:  |pt|
+//  splits at 1000s so no product or sum passes 32 bits.
+//
+//  INPUT : int32_t  pt    - 0.00001 degrees, within +-maxPt
+//          uint32_t maxPt - 90 or 180 degrees (0.00001 degree), a multiple
+//                           of 1000
+//  OUTPUT: int16_t - geopt16_t lat or lon
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int16_t Pt32ToPt16(int32_t pt, uint32_t maxPt)
+{
+  uint32_t a    = (0 > pt) ? (0 - (uint32_t)pt) : (uint32_t)pt;
+  uint32_t m    = maxPt / 1000;
+  uint32_t u    = (a / 1000) * 32767;               // < 2^30
+  uint32_t q    = u / m;
+  uint32_t rest = ((u % m) * 1000) + ((a % 1000) * 32767); // < maxPt + 2^25
+
+  q += rest / maxPt;
+  return (0 > pt) ? -(int16_t)q : (int16_t)q;
+} // end function Pt32ToPt16
+
+
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
 //  Converts coordinate in coords_t to geopt16_t without verifying inputs.
+//  Integer math from the geopt32_t fix, no float round-trip.
 //
-//  INPUT : coords_t *pCoord - struct holding inputs dblLat and dblLon
+//  INPUT : coords_t *pCoord - struct holding input fix pt
 //          geopt16_t* geoPt - struct to be updated if conversion successful
 //  OUTPUT: updates geoPt
-//  CALLS : NONE
+//  CALLS : Pt32ToPt16
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
 { // geopt16_t uses 32767 in scaling because lon -90 does not wrap to +90
-  geoPt->lat = (int16_t)(pCoord->dblLat * 32767.0 /  90.0);
-  geoPt->lon = (int16_t)(pCoord->dblLon * 32767.0 / 180.0);
+  geoPt->lat = Pt32ToPt16(pCoord->pt.lat, PT_90);
+  geoPt->lon = Pt32ToPt16(pCoord->pt.lon, PT_180);
 } // end routine CoordsToGeopt16
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  bool CalcRngBrg(double frLat, double frLon,
-//                  double toLat, double toLon,
+//  void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt)
+//  Converts coordinate in coords_t to geopt32_t (0.00001 degree, the fix as
+//  received) without verifying inputs.
+//
+//  INPUT : coords_t *pCoord - struct holding input fix
+//          geopt32_t* geoPt - struct to be updated
+//  OUTPUT: updates geoPt
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt)
+{
+  *geoPt = pCoord->pt;
+} // end routine CoordsToGeopt32
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t MulQ30(int32_t a, int32_t b)
+//  Q30 product, rounded.
+//
+//  INPUT : int32_t a, b - Q30 values
+//  OUTPUT: int32_t - a * b in Q30
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t MulQ30(int32_t a, int32_t b)
+{
+  return (int32_t)((((int64_t)a * b) + (1L << 29)) >> 30);
+} // end function MulQ30
+
+
+#if (COORDS_CORDIC_RNGBRG == 1)
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SinCosPt32(int32_t pt, int32_t *pSin, int32_t *pCos)
+//  Q30 sine & cosine of 0.00001 degrees by one CORDIC rotation pass of pt in
+//  Q29 radians (within 7 lsbs, see cordic.h).
+//
+//  INPUT : int32_t pt - angle, 0.00001 degrees within +-180 degrees (beyond,
+//                       taken as 0)
+//          int32_t *pSin, *pCos - returned Q30 sine & cosine
+//  OUTPUT: updates *pSin & *pCos
+//  CALLS : CordicSinCos
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void SinCosPt32(int32_t pt, int32_t *pSin, int32_t *pCos)
+{
+  if ((PT_180 < pt) || (-PT_180 > pt))  {
+    pt = 0;                             }
+  CordicSinCos((int32_t)((((int64_t)pt * RAD_Q56_PER_PT) + (1L << 26)) >> 27),
+               pSin, pCos);
+} // end routine SinCosPt32
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t Atan2Q29(int32_t y, int32_t x, uint32_t *pMag)
+//  Q29 angle of (x, y), -PI to PI, as atan2(y, x), and its magnitude, by one
+//  CORDIC vectoring pass (angle within 4.5 lsbs, see cordic.h).
+//
+//  INPUT : int32_t y, x - of any common scale
+//          uint32_t *pMag - returned sqrt(x^2 + y^2), or NULL if not wanted
+//  OUTPUT: int32_t - angle in Q29 radians, 0 for (0, 0)
+//  CALLS : CordicAtan2
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t Atan2Q29(int32_t y, int32_t x, uint32_t *pMag)
+{
+  return CordicAtan2(y, x, pMag);
+} // end function Atan2Q29
+#else
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SinCosPt32(int32_t pt, int32_t *pSin, int32_t *pCos)
+//  Q30 sine & cosine of 0.00001 degrees.  Folded by symmetry to 0-45 degrees
+//  (0.785 rad), then Taylor series to x^11 and x^12 in Horner form:
+//  truncation < 1e-11, so within 2 lsbs (2e-9) of the exact values.
+//
+//  INPUT : int32_t pt - angle, 0.00001 degrees within +-180 degrees (beyond,
+//                       taken as 0)
+//          int32_t *pSin, *pCos - returned Q30 sine & cosine
+//  OUTPUT: updates *pSin & *pCos
+//  CALLS : MulQ30
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void SinCosPt32(int32_t pt, int32_t *pSin, int32_t *pCos)
+{
+  uint32_t a = (0 > pt) ? (0 - (uint32_t)pt) : (uint32_t)pt;
+  bool     isBack, isSwap;
+  int32_t  x, x2, s, c;
+  int16_t  i;
+
+  if (PT_180 < a)   {
+    a = 0;          }
+  isBack = (PT_90 < a);                 // sin(180 - a) = sin(a),
+  if (isBack)       {                   // cos(180 - a) = -cos(a)
+    a = PT_180 - a; }
+  isSwap = (PT_45 < a);                 // sin(90 - a) = cos(a)
+  if (isSwap)       {
+    a = PT_90 - a;  }
+  x  = (int32_t)((((int64_t)a * RAD_Q56_PER_PT) + (1L << 25)) >> 26);
+  x2 = MulQ30(x, x);
+
+  s = SIN_Q30[SIN_TERMS - 1];
+  c = COS_Q30[COS_TERMS - 1];
+  for (i = SIN_TERMS - 1; i; i--)   {
+    s = SIN_Q30[i - 1] + MulQ30(x2, s); }
+  for (i = COS_TERMS - 1; i; i--)   {
+    c = COS_Q30[i - 1] + MulQ30(x2, c); }
+  s = x + MulQ30(MulQ30(x, x2), s);
+  c = Q30_ONE + MulQ30(x2, c);
+
+  *pSin = (0 > pt) ? -(isSwap ? c : s) : (isSwap ? c : s);
+  *pCos = isBack   ? -(isSwap ? s : c) : (isSwap ? s : c);
+} // end routine SinCosPt32
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t Atan2Q29(int32_t y, int32_t x, uint32_t *pMag)
+//  Q29 angle of (x, y), -PI to PI, as atan2(y, x), and its magnitude.  Folded
+//  to the first octant (t = y/x, 0 to 1), t's nearest k/32 taken from
+//  ATAN_LUT, and the rest, atan(r) with r = (t - k/32) / (1 + t k/32) of at
+//  most ~1/64, by r - r^3/3 (error < 2e-10).  The magnitude is that of (x, y)
+//  turned by -atan(k/32), (x + k/32 y) cos(atan(k/32)) sqrt(1 + r^2), so
+//  needs no square root.  x & y need not be normalized:  tiny ratios (e.g.
+//  central angles of a few meters) keep their full precision.
+//
+//  INPUT : int32_t y, x - of any common scale
+//          uint32_t *pMag - returned sqrt(x^2 + y^2), or NULL if not wanted
+//  OUTPUT: int32_t - angle in Q29 radians, 0 for (0, 0)
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t Atan2Q29(int32_t y, int32_t x, uint32_t *pMag)
+{
+  uint32_t ax = (0 > x) ? (0 - (uint32_t)x) : (uint32_t)x;
+  uint32_t ay = (0 > y) ? (0 - (uint32_t)y) : (uint32_t)y;
+  bool     isSwap = (ay > ax);
+  uint32_t t;
+  int16_t  k, sh;
+  int64_t  num, den;
+  int32_t  r, r2, a;
+
+  if (isSwap)                   {       // atan(t) = PI/2 - atan(1/t)
+    t = ax;  ax = ay;  ay = t;  }
+  if (0 == ax)
+  {
+    if (NULL != pMag) {
+      *pMag = 0;      }
+    return 0;
+  }
+  for (sh = 0; (ax >> sh) >= (1UL << 26); sh++) {}  // k from 26 bits
+  t = ax >> sh;
+  k = (int16_t)((((ay >> sh) * ATAN_LUT_STEPS) + (t >> 1)) / t);
+
+  num = ((int64_t)ay * ATAN_LUT_STEPS) - ((int64_t)k * ax);
+  den = ((int64_t)ax * ATAN_LUT_STEPS) + ((int64_t)k * ay);
+  r   = (int32_t)((num * (1L << 29)) / den);
+  r2  = (int32_t)(((int64_t)r * r) >> 29);
+  a   = ATAN_LUT[k] + r - (int32_t)((((int64_t)r2 * r) >> 29) / 3);
+  if (NULL != pMag)
+  { // sqrt(1 + r^2) = 1 + r^2/2 - r^4/8 (error < 4e-13)
+    uint64_t m = (((uint64_t)den + (ATAN_LUT_STEPS / 2)) / ATAN_LUT_STEPS) *
+                 (uint32_t)COS_ATAN_LUT[k];
+    int32_t  sec = (1L << 29) + (r2 >> 1) - (int32_t)(((int64_t)r2 * r2) >> 32);
+    *pMag = (uint32_t)((((m + (1UL << 29)) >> 30) * sec + (1UL << 28)) >> 29);
+  }
+
+  if (isSwap)             {
+    a = HALF_PI_Q29 - a;  }
+  if (0 > x)              {
+    a = PI_Q29 - a;       }
+  return (0 > y) ? -a : a;
+} // end function Atan2Q29
+#endif
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig)
+//  Caches Q30 sines & cosines of a point's lat & lon for CalcRngBrg(), once
+//  per point rather than each time a range & bearing is shown.
+//
+//  INPUT : geopt32_t pt     - point, 0.00001 degrees
+//          geotrig_t *pTrig - struct to be updated
+//  OUTPUT: updates pTrig
+//  CALLS : SinCosPt32
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig)
+{
+  SinCosPt32(pt.lat, &pTrig->sinLat, &pTrig->cosLat);
+  SinCosPt32(pt.lon, &pTrig->sinLon, &pTrig->cosLon);
+} // end routine SetGeoTrig
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+//                  geopt32_t to, const geotrig_t *pToTrig,
 //                  char*  range, char*  bearing)
 //  Calculate the geodetic vector from one lat/lon to another, placing resultant
 //  range and bearing as 3-characters ASCII into buffers while returning whether
@@ -791,126 +1381,127 @@ void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
 //  'Equirectangular Approximation' require 64-bit 'long double' trigonometry,
 //  especially since we MUST work with small distances.
 //
-//  INPUT : double frLat - input start point latitude  ( -90.0 <= lat <=  +90.0)
-//          double frLon - input start point longitude (-180.0 <= lon <= +180.0)
-//          double toLat - input end point latitude  ( -90.0 <= lat <=  +90.0)
-//          double toLon - input end point longitude (-180.0 <= lon <= +180.0)
+//  NOTE - Fixed point, no float:  Q30 sines & cosines (SetGeoTrig), so f, g &
+//  h are within a few lsbs (~2 cm of range); bearing, |(f, g)|, and central
+//  angle by Atan2Q29(); range in meters * 2^8.
+//
+//  INPUT : geopt32_t fr - start point (0.00001 degree, lat +-90, lon +-180)
+//          geotrig_t *pFrTrig - start point SetGeoTrig()
+//          geopt32_t to - end point (0.00001 degree, lat +-90, lon +-180)
+//          geotrig_t *pToTrig - end point SetGeoTrig()
 //          char*  range - return 3-char range (meters, km, or ### [OutOfRange])
 //          char*bearing - return 3-char bearing in degrees (000-359)
 //  OUTPUT: always updates range and bearing char buffers...
 //          returns false if range is less than 1 km, otherwise true; plus:...
 //          if range is > 999 km the range buffer will be filled w/ '#' chars...
 //          if there's an error both range & bearing buffers get filled w/ '!'
-//  CALLS : fabs, sin, cos, atan, atan2
+//  CALLS : MulQ30, Atan2Q29, FmtFixed, FmtUDec
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-bool CalcRngBrg(double frLat, double frLon,
-                double toLat, double toLon,
+bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+                geopt32_t to, const geotrig_t *pToTrig,
                 char*  rng,   char* brg)
 {
   int    i;
   bool   isKm   = false;
 
-  if (( -90.0 <= frLat) && ( 90.0 >= frLat) &&
-      (-180.0 <= frLon) && (180.0 >= frLon) &&
-      ( -90.0 <= toLat) && ( 90.0 >= toLat) &&
-      (-180.0 <= toLon) && (180.0 >= toLon) &&
+  if ((-PT_90  <= fr.lat) && (PT_90  >= fr.lat) &&
+      (-PT_180 <= fr.lon) && (PT_180 >= fr.lon) &&
+      (-PT_90  <= to.lat) && (PT_90  >= to.lat) &&
+      (-PT_180 <= to.lon) && (PT_180 >= to.lon) &&
+      (NULL != pFrTrig) && (NULL != pToTrig)  &&
       (NULL   != rng)   && (NULL  != brg))
   { // All input validity checks passed so calc range & bearing
-    double dblBrg;                      // final answer to be 0-359 degrees
-    double dblRng;                      // final answer to be in meters
+    int32_t  brgQ29;                    // bearing, Q29 radians
+    uint64_t rngMQ8;                    // range, meters * 2^8
+    uint32_t mQ8;
+    int32_t  dLat = to.lat - fr.lat;
+    int32_t  deg;
+    uint16_t u16;
 
     // Calculate range used in 3 special if-else cases not doing spherical trig
-    dblRng  = fabs(toLat - frLat) * ME_MPD; // calc before ~polar adjustments
+    if (0 > dLat)   {                   // calc before ~polar adjustments
+      dLat = -dLat; }
+    rngMQ8 = (((uint64_t)dLat * MQ8_Q16_PER_PT) + 0x8000) >> 16;
 
-    // when frLat or toLat within ~1.5 meters of pole just set value to pole
-    if (0.0000135 > (90.0 - fabs(frLat)))   {
-      frLat = (0 < frLat) ? 90.0 : -90.0;   }
-    if (0.0000135 > (90.0 - fabs(toLat)))   {
-      toLat = (0 < toLat) ? 90.0 : -90.0;   }
+    // when fr or to lat within ~1.35 meters of pole just set value to pole
+    if (PT_POLE_SNAP <= labs(fr.lat))       {
+      fr.lat = (0 < fr.lat) ? PT_90 : -PT_90; }
+    if (PT_POLE_SNAP <= labs(to.lat))       {
+      to.lat = (0 < to.lat) ? PT_90 : -PT_90; }
 
-    if ((frLat == toLat) && (frLon == toLon))
+    if ((fr.lat == to.lat) && (fr.lon == to.lon))
     { // <same points> is a simple case to handle (and it shall be done first)
-      dblBrg = 0.0;                     // At same place (or within 1.5m @ pole)
+      brgQ29 = 0;                       // At same place (or within 1.5m @ pole)
     }                                   // Range calculated before polar adjust
-    else if (90.0 == fabs(frLat))
+    else if (PT_90 == labs(fr.lat))
     { // when coming from pole: easily avoid divide-by-zero when finding range
-      dblBrg = (0 > frLat) ? 0 : 180;   // due N or S from applicable pole
+      brgQ29 = (0 > fr.lat) ? 0 : PI_Q29; // due N or S from applicable pole
     }                                   // Range calculated before polar adjust
-    else if (90.0 == fabs(toLat))
-    { // when going to pole: brg easily calculated, but check after frLat
-      dblBrg = (0 < toLat) ? 0 : 180;   // due N or S to applicable pole
+    else if (PT_90 == labs(to.lat))
+    { // when going to pole: brg easily calculated, but check after fr.lat
+      brgQ29 = (0 < to.lat) ? 0 : PI_Q29; // due N or S to applicable pole
     }                                   // Range calculated before polar adjust
     else
     { // Perform spherical earth calculations using WGS-84 Mean Earth Radius
-      // Pre-calculate radians, sines, and cosines used in bearing and/or range
-      double phiF, sinPf, cosPf;        // radian relatives of frLat
-      double phiT, sinPt, cosPt;        // radian relatives of toLat
-      double deltaLamda, sinDl, cosDl;  // radian relatives of Lon change
-      double f,g,h;                     // re-used combinations of trig values
-
-      deltaLamda = DEG_TO_RAD(toLon - frLon);
-      sinDl      = sin(deltaLamda);
-      cosDl      = cos(deltaLamda);
-      phiF       = DEG_TO_RAD(frLat);
-      sinPf      = sin(phiF);
-      cosPf      = cos(phiF);
-      phiT       = DEG_TO_RAD(toLat);
-      sinPt      = sin(phiT);
-      cosPt      = cos(phiT);
-
-      f = (cosPt * sinDl);
-      g = (cosPf * sinPt) - (sinPf * cosPt * cosDl);
-      h = (sinPf * sinPt) + (cosPf * cosPt * cosDl);
-      if (0 == h)         {             // Protect against divide-by-zero
-        h = DBL_MIN;      }             // in range calculation
+      // Sines and cosines cached per point; those of Lon change by identity
+      // (absolute error a few lsbs, so small changes lose nothing in Q30)
+      int32_t  sinDl = MulQ30(pToTrig->sinLon, pFrTrig->cosLon) -
+                       MulQ30(pToTrig->cosLon, pFrTrig->sinLon);
+      int32_t  cosDl = MulQ30(pToTrig->cosLon, pFrTrig->cosLon) +
+                       MulQ30(pToTrig->sinLon, pFrTrig->sinLon);
+      int32_t  cosPtDl = MulQ30(pToTrig->cosLat, cosDl);
+      int32_t  f,g,h;                   // re-used combinations of trig values
+      uint32_t s;                       // sin of central angle, |(f, g)|
+
+      f = MulQ30(pToTrig->cosLat, sinDl);
+      g = MulQ30(pFrTrig->cosLat, pToTrig->sinLat) -
+          MulQ30(pFrTrig->sinLat, cosPtDl);
+      h = MulQ30(pFrTrig->sinLat, pToTrig->sinLat) +
+          MulQ30(pFrTrig->cosLat, cosPtDl);
 
       // Calculate Great-Circle route initial bearing (FAZ - forward azimuth)
-      // Never calls atan2(0,0) since checked for <polar points> & <same points>
-      dblBrg = RAD_TO_DEG(atan2(f,g));  // -180 to 180 degrees (at end 0 to 359)
+      brgQ29 = Atan2Q29(f, g, &s);      // -PI to PI (at end 0 to 359 degrees)
 
       // Use special case of Vincenty formula for ellipsoid w/ equal major and
-      // minor axes to calculate Great-Circle central angle * distance in meters
-      dblRng  = atan(sqrtf(f*f + g*g) / h);   // Central angle in radians, but
-      if (0 > dblRng)     {                   // when atan returns a negative
-        dblRng += PI;     }                   // normalize back to positive.
-      dblRng *= MER_M;                        // Then put final answer in meters
+      // minor axes to calculate Great-Circle central angle (0 to PI, h < 0
+      // past PI/2) * distance in meters
+      rngMQ8 = ((uint64_t)Atan2Q29((int32_t)s, h, NULL) * MER_MQ8) >> 29;
     } // end if-else the various ways of deriving range & bearing
 
-    // Now it is time to use dblRng and dblBrg to set range & bearing 'strings'
-    uint16_t u16;                       // for rounding doubles to final values
-
-    if(1000 <= dblRng)
-    {                                   // When range is 1 km or more
-      isKm    = true;                   // note that and
-      dblRng /= 1000;                   // convert meters to km
+    // Now it is time to use rngMQ8 and brgQ29 to set range & bearing 'strings'
+    if ((1000UL << 8) <= rngMQ8)        // When range is 1 km or more
+    {                                   // note that
+      isKm    = true;
     }
 
-    if (1000 <= dblRng)                 // When > 999 km, would over-run display
+    if ((1000000ULL << 8) <= rngMQ8)    // When > 999 km, would over-run display
     {                                   // so indicate range > 999 km ala excel
       for (i = 3; i && rng; i--, rng++)   {
         *rng = '#';                       }
     }
     else
     {
-      if (isKm && (9.9495 >= dblRng))   // When single-digit kilometers don't
+      mQ8 = (uint32_t)rngMQ8;
+      if (isKm && (KM_DOT_M_MQ8 >= mQ8))// When single-digit kilometers don't
       {                                 // round up to double digit, generate a
-        sprintf(rng, "%01.1f", dblRng); // 3-char K.m to fit display Range
+        FmtFixed(rng, (mQ8 + (50UL << 8)) / (100UL << 8), 1, 1); // K.m
       }
       else
       {                                 // When meters or multi-digit km
-        u16 = dblRng + 0.5;             // Round up when convert double to int
+        u16 = isKm ? ((mQ8 + (500UL << 8)) / (1000UL << 8)) : // Round up
+                     ((mQ8 + (1UL << 7)) >> 8);              // to km or m
         if (999 < u16)              {   // but don't allow rounding out of range
           u16--;                    }   // of 3-digits available on display when
-        sprintf(rng, "%03d", u16);      // generate left 0-padded range string
+        FmtUDec(rng, u16, 3, '0');      // generate left 0-padded range string
       }
     }
 
-    if (0.0 > dblBrg)   {               // As needed convert a negative
-      dblBrg += 360.0;  }               // bearing to 180...360 equivalent.
-    u16 = dblBrg + 0.5;                 // Round up when convert double to int
-    if (360 <= u16)               {     // but don't allow rounding out of range
-      u16 = 0;                    }     // by converting 360 back to 0.
-    sprintf(brg, "%03d", u16);          // Generate left 0-padded bearing string
+    deg = (int32_t)((((int64_t)brgQ29 * DEG_Q24_PER_RAD) + (1LL << 52)) >> 53);
+    if (0 > deg)        {               // Rounded degrees, as needed convert a
+      deg += 360;       }               // negative bearing to 180...360 equiv.
+    if (360 <= deg)     {               // but don't allow rounding out of range
+      deg = 0;          }               // by converting 360 back to 0.
+    FmtUDec(brg, (uint16_t)deg, 3, '0');// Generate left 0-padded bearing string
   }
   else
   { // invalid input(s)... garbage in; garbage out (checking ptr also not bad)
@@ -9,28 +9,33 @@
  *  DESCRIPTION   : defines the macros and declares procedures required to
  *    convert between geographic coordinate systems and compute range & bearing
  *
- *    (1) double HexDegToDblDeg(char* hexDeg, bool isLat)
+ *    (1) int32_t HexDegToPt32(char* hexDeg, bool isLat)
  *    (2) void ClearCoords(coords_t *coord)
  *    (3) bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon)
- *    (4) void DecLatLonToDblLatLon(coords_t *pCoord)
- *    (5) void DblLatLonToDMS(coords_t *pCoord)
- *    (6) void DblLatLonToMGRS(coords_t *pCoord)
- *    (7) void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
- *    (8) bool CalcRngBrg(double frLat, double frLon,
- *                        double toLat, double toLon,
- *                        char*  rng,   char* brg)
+ *    (4) void RenderCoords(coords_t *pCoord, coordfmt_t fmt)
+ *    (5) void DblLatLonToMGRS(coords_t *pCoord)
+ *    (6) void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
+ *    (7) void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt)
+ *    (8) void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig)
+ *    (9) bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+ *                        geopt32_t to, const geotrig_t *pToTrig,
+ *                        char* rng, char* brg)
+ *   (10) void SetMgrsStd(uint16_t std)
  *
  *  NOTE - Currently utilizing WGS-84 ellipsoid reference.
  *
  *  NOTE: The 2014 MGRS standard (ref 1) provides more correct answers...
  *        but 1989 MGRS standard (ref 3) is the de facto standard...
- *        Use #define MGRS_STD below to select standard to be used (compiled)
+ *        Both are linked; SetMgrsStd() selects the standard used at run
+ *        time (devcfg_t mgrsStd), #define MGRS_STD below is the default.
  *
  *  NOTE - Reference (1) denotes the most recent "version" of calculating
  *         MGRS from Latitude/Longitude. It utilizes an extention
  *         of the Krueger series which should result in accuracy to
  *         a few nanometers and run about 5-6 faster than the
- *         exact methods by Thompson and Lee (Ref 2).
+ *         exact methods by Thompson and Lee (Ref 2).  As implemented here
+ *         (4 math library calls) it costs about what the 1989 series does
+ *         (host/coordbench.c), the speedup being over elliptic functions.
  *
  *  NOTE - MGRS, if following the standards in Reference (1) will output a
  *         single string without any whitespace. USNG (also according to Ref 1),
@@ -45,6 +50,20 @@
  *              "5963 2839 "
  *
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add COORDS_CORDIC_RNGBRG and COORDS_CORDIC_UTM (cordic.c), default 0
+ *      Fixed-point position pipeline:  HexDegToPt32() replaces
+ *      HexDegToDblDeg(); geotrig_t is Q30; SetGeoTrig() and CalcRngBrg() take
+ *      geopt32_t; coords_t dblLat & dblLon are only for MGRS
+ *      Add geotrig_t, SetGeoTrig(), and coords_t trig; CalcRngBrg() takes
+ *      each end's cached sines & cosines instead of computing them
+ *      coords_t holds the fix (geopt32_t and doubles) and a memo of the lines
+ *      last rendered in one format, rather than all six strings; add
+ *      RenderCoords() and coordfmt_t, drop DecLatLonToDblLatLon() and
+ *      DblLatLonToDMS() (now static in coords.c)
+ *      Add SetMgrsStd(), MGRS_1989 and MGRS_2014; MGRS_STD is the default
+ *      standard rather than the only one compiled
+ *      Add CoordsToGeopt32()
  *    2021/10/06, Robert Kirby, NSWC H12
  *      Add HexDegToDblDeg(), ClearCoords(), SetCoordsFromDecLatLon(),
  *      DecLatLonToDblLatLon(), DblLatLonToDMS(), and CalcRngBrg()
@@ -107,29 +126,51 @@
  */
 
 //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// Define either    1989  - or -  2014
-#define MGRS_STD    1989      // 1989 is the defacto standard even though ...
-//#define MGRS_STD    2014    // ... 2014 is gives more-correct answers
+// Both standards are linked, SetMgrsStd() selects, MGRS_STD is the default
+#define MGRS_1989   1989      // devcfg_t mgrsStd values
+#define MGRS_2014   2014
+// Define either    MGRS_1989  - or -  MGRS_2014
+#define MGRS_STD    MGRS_1989 // 1989 is the defacto standard even though ...
+//#define MGRS_STD    MGRS_2014 // ... 2014 is gives more-correct answers
+#if ((MGRS_STD != MGRS_1989) && (MGRS_STD != MGRS_2014))
+  #error MGRS_STD must be either 1989 or 2014
+#endif
 //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
+// 1: SetGeoTrig() & CalcRngBrg() sines, cosines, angles & magnitudes by
+//    cordic.c passes (within a few cm, see cordic.h)
+// 0: by Taylor series and atan table (within ~1 cm)
+#ifndef COORDS_CORDIC_RNGBRG
+#define COORDS_CORDIC_RNGBRG (0)
+#endif
+// 1: UTM & UPS sines & cosines, MGRS_2014 atan2(), and MGRS_1989 square root
+//    (radius of curvature) by cordic.c passes, to better than float resolution
+// 0: by the math library
+#ifndef COORDS_CORDIC_UTM
+#define COORDS_CORDIC_UTM (0)
+#endif
+
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  double HexDegToDblDeg(char* hexDeg, bool isLat)
-//  Converts hexadecimal representation of 32-bit scaled degrees to double.
+//  int32_t HexDegToPt32(char* hexDeg, bool isLat)
+//  Converts hexadecimal representation of 32-bit scaled degrees (two's
+//  complement, 360/UINT32_MAX degrees per count) to geopt32_t 0.00001
+//  degrees, rounded.
 //
 //  INPUT : char * - hextext representation of scaled degrees value to convert
 //          bool   - isLat indicates if this is a latitude (for range checks)
-//  OUTPUT: double - returns COORD_ERR on error, otherwise degrees represented
+//  OUTPUT: int32_t - returns COORD_ERR_PT on error, otherwise 0.00001 degrees
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void ClearCoords(coords_t *pCoord)
-//  Clears/Initializes a coords_t structure to the geo-strings ' ' filled and
-//  the double values are set to COORD_ERR.
+//  Clears/Initializes a coords_t structure to no fix (COORD_ERR) and nothing
+//  rendered.
 //
 //  INPUT : coords_t * - structure to clear
 //  OUTPUT: NONE (other than the updating structure)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon)
-//  Populates entire coords_t structure based on lat & lon input of fixed-width
-//  form <sDDD.ddddd> (e.g. +012.01234 or -180.00000).
+//  Sets the coords_t fix from lat & lon input of fixed-width form <sDDD.ddddd>
+//  (e.g. +012.01234 or -180.00000), and its SetGeoTrig() cache, in integer
+//  math.  No strings are formatted until RenderCoords().
 //
 //  INPUT : coords_t *pCoord - structure to populate
 //          char     *pLat   - latitude  in fixed width form <sDDD.ddddd>
@@ -137,42 +178,58 @@
 //  OUTPUT: bool - returns true if input lat/lon representation valid
 //          updates structure (invokes ClearCoords() if lat/lon invalid)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  void DecLatLonToDblLatLon(coords_t *pCoord)
-//  Converts fixed length sDDD.DDDDD representation of decimal degrees to double
-//
-//  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure using COORD_ERR if appropriate
-//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  void DblLatLonToDMS(coords_t *pCoord)
-//  Converts lat and lon to corresponding fixed length HDDD.MM.SS characters.
+//  void RenderCoords(coords_t *pCoord, coordfmt_t fmt)
+//  Makes pCoord->memo.line[] the two 10-char lines of the fix in format fmt,
+//  ' ' filled if no fix.  The lines are formatted only when fmt or what they
+//  would show changed since last rendered:  DMS whole seconds, DEC digits, or
+//  (MGRS) the fix.  MGRS sets dblLat & dblLon from the fix, for
+//  DblLatLonToMGRS().
 //
-//  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure lat/lon with <HDDD.MM.SS> chars
+//  INPUT : coords_t  *pCoord - structure holding fix and memo
+//          coordfmt_t fmt    - CF_DMS, CF_DEC or CF_MGRS
+//  OUTPUT: updates structure memo
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void DblLatLonToMGRS(coords_t *pCoord)
-//  Converts lat/lon coordinate to geopt16_t without verifying inputs.
+//  Converts lat/lon coordinate to MGRS without verifying inputs.
 //
 //  INPUT : coords_t *pCoord - structure to update
-//  OUTPUT: updates structure mgrsGzd and mgrs10m
+//  OUTPUT: updates structure memo.line[] with grid-zone and easting & northing
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt)
 //  Converts coordinate in coords_t to geopt16_t without verifying inputs.
+//  Integer math from the geopt32_t fix, no float round-trip.
 //
-//  INPUT : coords_t *pCoord - struct holding inputs dblLat and dblLon
+//  INPUT : coords_t *pCoord - struct holding input fix pt
 //          geopt16_t* geoPt - struct to be updated if conversion successful
 //  OUTPUT: updates geoPt
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  bool CalcRngBrg(double frLat, double frLon,
-//                  double toLat, double toLon,
+//  void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt)
+//  Converts coordinate in coords_t to geopt32_t (0.00001 degree, the fix as
+//  received) without verifying inputs.
+//
+//  INPUT : coords_t *pCoord - struct holding input fix
+//          geopt32_t* geoPt - struct to be updated
+//  OUTPUT: updates geoPt
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig)
+//  Caches Q30 sines & cosines of a point's lat & lon for CalcRngBrg(), once
+//  per point rather than each time a range & bearing is shown.
+//
+//  INPUT : geopt32_t pt     - point, 0.00001 degrees
+//          geotrig_t *pTrig - struct to be updated
+//  OUTPUT: updates pTrig
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+//                  geopt32_t to, const geotrig_t *pToTrig,
 //                  char*  range, char*  bearing)
 //  Calculate the geodetic vector from one lat/lon to another, placing resultant
 //  range and bearing as 3-characters ASCII into buffers while returning whether
-//  or not the range is in kilometers (or meters).
+//  or not the range is in kilometers (or meters).  Fixed point, no float.
 //
-//  INPUT : double frLat - input start point latitude  ( -90.0 <= lat <=  +90.0)
-//          double frLon - input start point longitude (-180.0 <= lon <= +180.0)
-//          double toLat - input end point latitude  ( -90.0 <= lat <=  +90.0)
-//          double toLon - input end point longitude (-180.0 <= lon <= +180.0)
+//  INPUT : geopt32_t fr - start point (0.00001 degree, lat +-90, lon +-180)
+//          geotrig_t *pFrTrig - start point SetGeoTrig()
+//          geopt32_t to - end point (0.00001 degree, lat +-90, lon +-180)
+//          geotrig_t *pToTrig - end point SetGeoTrig()
 //          char*  range - return 3-char range (meters, km, or ### [OutOfRange])
 //          char*bearing - return 3-char bearing in degrees (000-359)
 //  OUTPUT: always updates range and bearing char buffers...
@@ -180,39 +237,74 @@
 //          if range is > 999 km the range buffer will be filled w/ '#' chars...
 //          if there's an error both range & bearing buffers get filled w/ '!'
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SetMgrsStd(uint16_t std)
+//  Selects the MGRS standard DblLatLonToMGRS() uses from then on, such as the
+//  devcfg_t setting.  Any value other than MGRS_1989 or MGRS_2014 (e.g. from
+//  unwritten NVMEM) selects the compiled default MGRS_STD.  MGRS lines already
+//  rendered (RenderCoords) are kept until their fix changes.
+//
+//  INPUT : uint16_t std - MGRS_1989 or MGRS_2014
+//  OUTPUT: NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 #include <stdbool.h>
-#include "geofence.h"     // for geopt16_t
+#include <stdint.h>
+#include "geofence.h"     // for geopt16_t and geopt32_t
 
 //----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
 #define COORD_ERR -666.666// special value to indicate error in coord_t
 #define COORD_LEN   10    // LAT/LON, or padded MGRS chars displayed on line
 typedef char geostr_t[COORD_LEN+1]; // add byte for NULL terminator
 
+typedef enum tagCOORDINATE_FORMAT
+{ // same values as main.h csysset_t
+  CF_NONE = -1,           // nothing rendered
+  CF_DMS,                 // <NDDD.MM.SS><EDDD.MM.SS> ~31m LAT & LON
+  CF_DEC,                 // <+DDD.ddddd><+DDD.ddddd> ~1m LAT & LON
+  CF_MGRS                 // <GZsi      ><1234 5678 >  10m grid-zone, E & N
+} coordfmt_t;
+
+typedef struct tagGEO_COORDINATE_MEMO
+{ // last lines rendered, and what they show, so unchanged ones aren't redone
+  int16_t   fmt;          // coordfmt_t of line[]
+  int32_t   key[2];       // lat & lon as shown: DMS DDDMMSS, DEC & MGRS fix
+  geostr_t  line[2];      // LAT & LON, or MGRS grid-zone & easting/northing
+} coordmemo_t;
+
+typedef struct tagGEO_TRIGONOMETRY
+{ // set by SetGeoTrig() once per point, used by CalcRngBrg()
+  int32_t   sinLat;       // Q30:  1 << 30 is 1.0
+  int32_t   cosLat;
+  int32_t   sinLon;
+  int32_t   cosLon;
+} geotrig_t;
+
 typedef struct tagGEO_COORDINATE_DATA
-{ // order of fields matter because memset used to clear out the geostr_t fields
-  geostr_t  decLat;       // <+DDD.ddddd> ~1m LAT
-  geostr_t  decLon;       // <+DDD.ddddd> ~1m LON
-  geostr_t  dmsLat;       // <NDDD.MM.SS> ~31m LAT
-  geostr_t  dmsLon;       // <EDDD.MM.SS> ~31m LON
-  geostr_t  mgrsGzd;      // <GZsi      >  10m MGRS grid-zone
-  geostr_t  mgrs10m;      // <1234 5678 >  10m MGRS easting & northing
-  double    dblLat;       // XC16 v1.24 double is the same as float
-  double    dblLon;       //
+{
+  geopt32_t   pt;         // fix as received, 0.00001 degree (COORD_ERR_PT)
+  double      dblLat;     // of pt for MGRS, set by RenderCoords() CF_MGRS
+  double      dblLon;     // (XC16 v1.24 double is the same as float)
+  geotrig_t   trig;       // of pt, set with it
+  coordmemo_t memo;       // set by RenderCoords()
 } coords_t;
+#define COORD_ERR_PT  INT32_MIN   // pt.lat & pt.lon when no fix
 
 
 //----- EXPOSED ATTRIBUTES -----------------------------------------------------
 
 
 //----- EXPOSED PROCEDURES -----------------------------------------------------
-double HexDegToDblDeg(char* hexDeg, bool isLat);
+int32_t HexDegToPt32(char* hexDeg, bool isLat);
 void ClearCoords(coords_t *coord);
 bool SetCoordsFromDecLatLon(coords_t *pCoord, char *pLat, char *pLon);
-void DecLatLonToDblLatLon(coords_t *pCoord);
-void DblLatLonToDMS(coords_t *pCoord);
+void RenderCoords(coords_t *pCoord, coordfmt_t fmt);
 void DblLatLonToMGRS(coords_t *pCoord);
 void CoordsToGeopt16(coords_t *pCoord, geopt16_t* geoPt);
-bool CalcRngBrg(double frLat,double frLon,double toLat,double toLon,char* rng,char* brg);
+void CoordsToGeopt32(coords_t *pCoord, geopt32_t* geoPt);
+void SetGeoTrig(geopt32_t pt, geotrig_t *pTrig);
+bool CalcRngBrg(geopt32_t fr, const geotrig_t *pFrTrig,
+                geopt32_t to, const geotrig_t *pToTrig,
+                char* rng, char* brg);
+void SetMgrsStd(uint16_t std);
 
 
 //----- MACROS -----------------------------------------------------------------
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : cordic.c
+ *
+ *  DESCRIPTION   : 32-bit fixed-point CORDIC sine & cosine (rotation mode) and
+ *    angle & magnitude (vectoring mode) (see cordic.h).
+ *
+ *      (1) void CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos)
+ *      (2) int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <stdbool.h>
+#include <stddef.h>            // for NULL
+#include <stdint.h>
+#include "cordic.h"
+
+
+//----- MODULE DEFINES ---------------------------------------------------------
+#define CORDIC_GAIN_Q30 652032874L      // 1 / prod(sqrt(1 + 2^-2i)), Q30
+#define VEC_BITS        (30)            // vectoring x & y shifted to 2^29 up to
+                                        // 2^30, so x * gain * sqrt(2) < 2^32
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+// atan(2^-i) in Q30 radians, i = 0 to CORDIC_ITERS - 1 (sums to 1.743 rad)
+static const int32_t ATAN_Q30[CORDIC_ITERS] =
+{
+  843314857L, 497837829L, 263043837L, 133525159L, 67021687L, 33543516L,
+   16775851L,   8388437L,   4194283L,   2097149L,  1048576L,   524288L,
+     262144L,    131072L,     65536L,     32768L
+};
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos)
+//  Q30 sine & cosine of a Q29 angle by one rotation mode pass.  The angle is
+//  taken within +-PI/2 (sine & cosine of ang -+ PI are -sine & -cosine), so
+//  within the turns' 1.743 rad reach, and in Q30 for the pass.  Shifts round
+//  (adding half the lsb shifted out) so errors don't drift one way.  The
+//  turns leave under atan(2^-15) to turn, as sin z = z & cos z = 1 (off by
+//  z^2/2, under 1/2 lsb).
+//
+//  INPUT : int32_t ang - angle in Q29 radians, any (+-4 radians)
+//          int32_t *pSin, *pCos - returned Q30 sine & cosine
+//  OUTPUT: updates *pSin & *pCos
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos)
+{
+  bool    isBack = false;
+  int32_t x = CORDIC_GAIN_Q30;
+  int32_t y = 0;
+  int32_t z, d, dx, dy;
+  int32_t half = 0;                     // half the lsb shifted out
+  int16_t i;
+
+  if (CORDIC_PI < ang)                        {
+    ang = (ang - CORDIC_PI) - CORDIC_PI;      }
+  else if (-CORDIC_PI > ang)                  {
+    ang = (ang + CORDIC_PI) + CORDIC_PI;      }
+  if (CORDIC_HALF_PI < ang)                   {
+    ang -= CORDIC_PI;       isBack = true;    }
+  else if (-CORDIC_HALF_PI > ang)             {
+    ang += CORDIC_PI;       isBack = true;    }
+  z = ang << 1;
+
+  for (i = 0; i < CORDIC_ITERS; i++)
+  {
+    d  = z >> 31;                       // 0 turning toward +z, -1 toward -z
+    dx = (y + half) >> i;
+    dy = (x + half) >> i;
+    x -= (dx ^ d) - d;                  // (n ^ d) - d is n, or -n when d is -1
+    y += (dy ^ d) - d;
+    z -= (ATAN_Q30[i] ^ d) - d;
+    half = half ? (half << 1) : 1;
+  }
+
+  // |z| <= atan(2^-15):  the rest of the turn, sin z = z and cos z = 1
+  d = x - (int32_t)((((int64_t)y * z) + (1L << 29)) >> 30);
+  y = y + (int32_t)((((int64_t)x * z) + (1L << 29)) >> 30);
+  x = d;
+
+  *pSin = isBack ? -y : y;
+  *pCos = isBack ? -x : x;
+} // end routine CordicSinCos
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag)
+//  Q29 angle of (x, y), -PI to PI, as atan2(y, x), and its magnitude, by one
+//  vectoring mode pass over |x|, |y| shifted so the larger is VEC_BITS bits
+//  (x unsigned, as it grows to gain * sqrt(2) times that), then unfolded to
+//  the quadrant of (x, y).  The turns leave y/x under 2^-15, added to the
+//  angle as atan(y/x) = y/x (by a 15-bit divisor, within ~2 Q30 lsbs).  The
+//  magnitude is x times 1/gain, shifted back.
+//
+//  INPUT : int32_t y, x - of any common scale
+//          uint32_t *pMag - returned sqrt(x^2 + y^2), or NULL if not wanted
+//  OUTPUT: int32_t - angle in Q29 radians, 0 for (0, 0)
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag)
+{
+  uint32_t ax = (0 > x) ? (0 - (uint32_t)x) : (uint32_t)x;
+  uint32_t ay = (0 > y) ? (0 - (uint32_t)y) : (uint32_t)y;
+  uint32_t m  = (ax > ay) ? ax : ay;
+  uint32_t u;                           // x of the pass, 0 to ~2.5e9
+  int32_t  v, z = 0, d, du, dv, a;
+  int32_t  half = 0;                    // half the lsb shifted out
+  int16_t  sh = 0, i;
+
+  if (0 == m)
+  {
+    if (NULL != pMag) {
+      *pMag = 0;      }
+    return 0;
+  }
+  for ( ; m >= (1UL << VEC_BITS); m >>= 1)      {
+    sh++;                                       }
+  for ( ; m < (1UL << (VEC_BITS - 1)); m <<= 1) {
+    sh--;                                       }
+  if (0 < sh)
+  {
+    u = (ax >> sh) + ((ax >> (sh - 1)) & 1);
+    v = (int32_t)((ay >> sh) + ((ay >> (sh - 1)) & 1));
+  }
+  else
+  {
+    u = ax << -sh;
+    v = (int32_t)(ay << -sh);
+  }
+
+  for (i = 0; i < CORDIC_ITERS; i++)
+  {
+    d  = v >> 31;                       // 0 turning toward -y, -1 toward +y
+    du = (v + half) >> i;
+    dv = (int32_t)((u + (uint32_t)half) >> i);
+    u += (uint32_t)((du ^ d) - d);      // (n ^ d) - d is n, or -n when d is -1
+    v -= (dv ^ d) - d;
+    z += (ATAN_Q30[i] ^ d) - d;
+    half = half ? (half << 1) : 1;
+  }
+  // |v/u| <= 2^-15:  the rest of the angle, atan(v/u) = v/u in Q30 (u >> 16
+  // is 15 to 16 bits, v * 2^14 under 31)
+  z += (v * (1L << 14)) / (int32_t)(u >> 16);
+
+  if (NULL != pMag)
+  {
+    uint32_t mag = (uint32_t)((((uint64_t)u * CORDIC_GAIN_Q30) +
+                               (1UL << 29)) >> 30);
+    if (0 < sh)                                               {
+      mag <<= sh;                                             }
+    else if (0 > sh)                                          {
+      mag = (mag >> -sh) + ((mag >> (-sh - 1)) & 1);          }
+    *pMag = mag;
+  }
+
+  a = (z + 1) >> 1;                     // Q29, first quadrant
+  if (0 > a)                    {
+    a = 0;                      }
+  else if (CORDIC_HALF_PI < a)  {
+    a = CORDIC_HALF_PI;         }
+  if (0 > x)                    {
+    a = CORDIC_PI - a;          }
+  return (0 > y) ? -a : a;
+} // end function CordicAtan2
@@ -0,0 +1,96 @@
+#ifndef CORDIC_H__
+#define CORDIC_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : cordic.h
+ *
+ *  DESCRIPTION   : Define 32-bit fixed-point CORDIC (shift-and-add rotation)
+ *    procedures for the coordinate paths, in place of XC16's soft-float sin(),
+ *    cos(), atan2() and sqrt():  one pass of rotation mode gives a sine and
+ *    cosine pair, one pass of vectoring mode an angle and magnitude.  Each
+ *    pass is CORDIC_ITERS turns by +-atan(2^-i) of 32-bit shifts, adds, and
+ *    a table read, then one turn of what is left (under 2^-15 rad) to first
+ *    order:  two multiplies for sine & cosine, one divide for the angle (and
+ *    a multiply by 1/gain for the magnitude).  That takes half the turns 30
+ *    bits would otherwise need; no float.
+ *
+ *      (1) void CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos)
+ *      (2) int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag)
+ *
+ *  Angles are Q29 radians (CORDIC_PI is PI, lsb 1.9e-9 rad), sines & cosines
+ *  Q30 (CORDIC_ONE is 1.0, lsb 9.3e-10, ~6 mm of great circle).  Errors, as
+ *  swept by host tool host/cordicbench.c ("make -f host/Makefile cordicbench")
+ *  against long double:
+ *
+ *    CordicSinCos()      sine & cosine within 7 lsbs (6.5e-9, 4 cm of great
+ *                        circle)
+ *    CordicAtan2()       angle within 4.5 lsbs (8.4e-9 rad, 4.8e-7 degree,
+ *                        5 cm of great circle); magnitude within 7e-9 of
+ *                        itself plus 1/2 unit of x & y
+ *
+ *  Against what is shown:  a 10 m MGRS grid digit (1.6e-6 rad of latitude)
+ *  is ~250 times the sine & cosine error, and a float's 24 bits (6e-8) ~9
+ *  times, so UTM & UPS by CORDIC show the digits soft-float does but where
+ *  float alone leaves a digit in doubt.  The 1 degree bearing shown is ~2
+ *  million times the angle error, and a range's 1 m digit (under 1 km) ~10
+ *  times the few cm its sines & angles can be off together.
+ *
+ *  coords.c uses these for range & bearing when COORDS_CORDIC_RNGBRG is 1, and
+ *  for UTM & UPS when COORDS_CORDIC_UTM is 1 (see coords.h).
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ *
+ *  REFERENCE DOCUMENTS
+ *    1. "The CORDIC Trigonometric Computing Technique"
+ *       Jack E. Volder (1959) IRE Transactions on Electronic Computers
+ *       Vol. EC-8, No. 3, pp330-334
+ *
+ *    2. "A survey of CORDIC algorithms for FPGA based computers"
+ *       Ray Andraka (1998) Proceedings of the ACM/SIGDA Sixth International
+ *       Symposium on Field Programmable Gate Arrays, pp191-200
+ */
+//**PROCEDURES******************************************************************
+//  void CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos)
+//  Q30 sine & cosine of a Q29 angle by one rotation mode pass:  the vector
+//  (1/gain, 0) is turned toward ang by +-atan(2^-i), i = 0 to CORDIC_ITERS-1,
+//  then by the rest of ang.
+//
+//  INPUT : int32_t ang - angle in Q29 radians, any (+-4 radians), taken within
+//                        +-PI first
+//          int32_t *pSin, *pCos - returned Q30 sine & cosine
+//  OUTPUT: updates *pSin & *pCos
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag)
+//  Q29 angle of (x, y), -PI to PI, as atan2(y, x), and its magnitude, by one
+//  vectoring mode pass:  (x, y), folded to the first quadrant and shifted to
+//  30 bits, is turned to the x axis by +-atan(2^-i); the turns, and y/x of
+//  what is left, sum to the angle and x ends at the magnitude times the gain.
+//  x & y need not be normalized:  tiny ratios keep their full precision.
+//
+//  INPUT : int32_t y, x - of any common scale
+//          uint32_t *pMag - returned sqrt(x^2 + y^2), or NULL if not wanted
+//  OUTPUT: int32_t - angle in Q29 radians, 0 for (0, 0)
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#include <stdint.h>
+
+//----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
+#define CORDIC_ONE      (1L << 30)      // 1.0 in Q30
+#define CORDIC_PI       1686629713L     // PI   * 2^29
+#define CORDIC_HALF_PI  843314857L      // PI/2 * 2^29
+#define CORDIC_ITERS    (16)            // turns, then one to finish
+
+//----- EXPOSED ATTRIBUTES -----------------------------------------------------
+
+//----- EXPOSED PROCEDURES -----------------------------------------------------
+void    CordicSinCos(int32_t ang, int32_t *pSin, int32_t *pCos);
+int32_t CordicAtan2(int32_t y, int32_t x, uint32_t *pMag);
+
+//----- MACROS -----------------------------------------------------------------
+
+
+#endif  // CORDIC_H__
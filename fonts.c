@@ -27,8 +27,22 @@
  * Further characters can be created using the LCD FontMaker program, or
  * manually designed in a spreasheet program such as Microsoft Excel.
  *
+ * Glyphs of a font are held in an atlas, in order of character code, so the
+ * glyph of a character is found by subtracting the code of the atlas's first
+ * character (see font_t in fonts.h).
+ *
+ * The TERMINAL 12X16 and VERDANA 34X56 glyphs below are the source for their
+ * packed form in fonts_rle.h, which is what is built when FONTS_USE_RLE is 1.
+ * After changing them run "make -f host/Makefile fonts" to regenerate it.
+ *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Build packed TERMINAL 12X16 and VERDANA 34X56 (fonts_rle.h) instead of
+ *      plain glyphs when FONTS_USE_RLE is 1
+ *      Replace per-character TERMINAL_6X8_x, TERMINAL_12X16_x, VERDANA_34X56_x
+ *      arrays with one contiguous atlas per font, indexed by character code,
+ *      and define font_t descriptor for each (ENVELOPE 6X8 appended to 6X8)
  *    2021/06/01, Robert Kirby, NSWC H12
  *      Add VERDANA_34X56_SPACE, stub out VERDANA_34X56_EQUALS
  *    2017/03/31, Robert Kirby, NSWC H12
@@ -41,395 +55,501 @@
  *  REFERENCE DOCUMENTS
  *    1.
  */
+#include <stddef.h>
 #include <stdint.h>
+#include "fonts.h"
+#if (FONTS_USE_RLE == 1)
+#include "fonts_rle.h"
+#endif
 
 
-// ENVELOPE 6X8
-const uint8_t ENVELOPE_6X8_LEFT[] = { 0xFF, 0x83, 0x85, 0x89, 0x91, 0xA1 };
-const uint8_t ENVELOPE_6X8_RIGHT[] = { 0xA1, 0x91, 0x89, 0x85, 0x83, 0xFF };
-
-// TERMINAL 6X8
-const uint8_t TERMINAL_6X8_SPACE[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_EXCLAMATION[] = { 0x00, 0x00, 0x06, 0x5F, 0x06, 0x00 };
-const uint8_t TERMINAL_6X8_DOUBLEQUOTE[] = { 0x00, 0x07, 0x03, 0x00, 0x07, 0x03 };
-const uint8_t TERMINAL_6X8_HASH[] = { 0x00, 0x24, 0x7E, 0x24, 0x7E, 0x24 };
-const uint8_t TERMINAL_6X8_DOLLAR[] = { 0x00, 0x24, 0x2B, 0x6A, 0x12, 0x00 };
-const uint8_t TERMINAL_6X8_PERCENT[] = { 0x00, 0x63, 0x13, 0x08, 0x64, 0x63 };
-const uint8_t TERMINAL_6X8_AMPERSAND[] = { 0x00, 0x36, 0x49, 0x56, 0x20, 0x50 };
-const uint8_t TERMINAL_6X8_SINGLEQUOTE[] = { 0x00, 0x00, 0x07, 0x03, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_OPENPAREN[] = { 0x00, 0x00, 0x3E, 0x41, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_CLOSEPAREN[] = { 0x00, 0x00, 0x41, 0x3E, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_ASTERISK[] = { 0x00, 0x08, 0x3E, 0x1C, 0x3E, 0x08 };
-const uint8_t TERMINAL_6X8_PLUS[] = { 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08 };
-const uint8_t TERMINAL_6X8_COMMA[] = { 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_MINUS[] = { 0x00, 0x08, 0x08, 0x08, 0x08, 0x08 };
-const uint8_t TERMINAL_6X8_PERIOD[] = { 0x00, 0x00, 0x60, 0x60, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_FWDSLASH[] = { 0x00, 0x20, 0x10, 0x08, 0x04, 0x02 };
-const uint8_t TERMINAL_6X8_0[] = { 0x00, 0x3E, 0x51, 0x49, 0x45, 0x3E };
-const uint8_t TERMINAL_6X8_1[] = { 0x00, 0x00, 0x42, 0x7F, 0x40, 0x00 };
-const uint8_t TERMINAL_6X8_2[] = { 0x00, 0x62, 0x51, 0x49, 0x49, 0x46 };
-const uint8_t TERMINAL_6X8_3[] = { 0x00, 0x22, 0x49, 0x49, 0x49, 0x36 };
-const uint8_t TERMINAL_6X8_4[] = { 0x00, 0x18, 0x14, 0x12, 0x7F, 0x10 };
-const uint8_t TERMINAL_6X8_5[] = { 0x00, 0x2F, 0x49, 0x49, 0x49, 0x31 };
-const uint8_t TERMINAL_6X8_6[] = { 0x00, 0x3C, 0x4A, 0x49, 0x49, 0x30 };
-const uint8_t TERMINAL_6X8_7[] = { 0x00, 0x01, 0x71, 0x09, 0x05, 0x03 };
-const uint8_t TERMINAL_6X8_8[] = { 0x00, 0x36, 0x49, 0x49, 0x49, 0x36 };
-const uint8_t TERMINAL_6X8_9[] = { 0x00, 0x06, 0x49, 0x49, 0x29, 0x1E };
-const uint8_t TERMINAL_6X8_COLON[] = { 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_SEMICOLON[] = { 0x00, 0x00, 0xEC, 0x6C, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_LESS[] = { 0x00, 0x08, 0x14, 0x22, 0x41, 0x00 };
-const uint8_t TERMINAL_6X8_EQUALS[] = { 0x00, 0x24, 0x24, 0x24, 0x24, 0x24 };
-const uint8_t TERMINAL_6X8_GREATER[] = { 0x00, 0x00, 0x41, 0x22, 0x14, 0x08 };
-const uint8_t TERMINAL_6X8_QUESTION[] = { 0x00, 0x02, 0x01, 0x59, 0x09, 0x06 };
-const uint8_t TERMINAL_6X8_AT[] = { 0x00, 0x3E, 0x41, 0x5D, 0x55, 0x1E };
-const uint8_t TERMINAL_6X8_A[] = { 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E };
-const uint8_t TERMINAL_6X8_B[] = { 0x00, 0x7F, 0x49, 0x49, 0x49, 0x36 };
-const uint8_t TERMINAL_6X8_C[] = { 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22 };
-const uint8_t TERMINAL_6X8_D[] = { 0x00, 0x7F, 0x41, 0x41, 0x41, 0x3E };
-const uint8_t TERMINAL_6X8_E[] = { 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41 };
-const uint8_t TERMINAL_6X8_F[] = { 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01 };
-const uint8_t TERMINAL_6X8_G[] = { 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A };
-const uint8_t TERMINAL_6X8_H[] = { 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F };
-const uint8_t TERMINAL_6X8_I[] = { 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00 };
-const uint8_t TERMINAL_6X8_J[] = { 0x00, 0x30, 0x40, 0x40, 0x40, 0x3F };
-const uint8_t TERMINAL_6X8_K[] = { 0x00, 0x7F, 0x08, 0x14, 0x22, 0x41 };
-const uint8_t TERMINAL_6X8_L[] = { 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40 };
-const uint8_t TERMINAL_6X8_M[] = { 0x00, 0x7F, 0x02, 0x04, 0x02, 0x7F };
-const uint8_t TERMINAL_6X8_N[] = { 0x00, 0x7F, 0x02, 0x04, 0x08, 0x7F };
-const uint8_t TERMINAL_6X8_O[] = { 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E };
-const uint8_t TERMINAL_6X8_P[] = { 0x00, 0x7F, 0x09, 0x09, 0x09, 0x06 };
-const uint8_t TERMINAL_6X8_Q[] = { 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E };
-const uint8_t TERMINAL_6X8_R[] = { 0x00, 0x7F, 0x09, 0x09, 0x19, 0x66 };
-const uint8_t TERMINAL_6X8_S[] = { 0x00, 0x26, 0x49, 0x49, 0x49, 0x32 };
-const uint8_t TERMINAL_6X8_T[] = { 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01 };
-const uint8_t TERMINAL_6X8_U[] = { 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F };
-const uint8_t TERMINAL_6X8_V[] = { 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F };
-const uint8_t TERMINAL_6X8_W[] = { 0x00, 0x3F, 0x40, 0x3C, 0x40, 0x3F };
-const uint8_t TERMINAL_6X8_X[] = { 0x00, 0x63, 0x14, 0x08, 0x14, 0x63 };
-const uint8_t TERMINAL_6X8_Y[] = { 0x00, 0x07, 0x08, 0x70, 0x08, 0x07 };
-const uint8_t TERMINAL_6X8_Z[] = { 0x00, 0x71, 0x49, 0x45, 0x43, 0x00 };
-const uint8_t TERMINAL_6X8_OPENBRACKET[] = { 0x00, 0x00, 0x7F, 0x41, 0x41, 0x00 };
-const uint8_t TERMINAL_6X8_BACKSLASH[] = { 0x00, 0x02, 0x04, 0x08, 0x10, 0x20 };
-const uint8_t TERMINAL_6X8_CLOSEDBRACKET[] = { 0x00, 0x00, 0x41, 0x41, 0x7F, 0x00 };
-const uint8_t TERMINAL_6X8_CARET[] = { 0x00, 0x04, 0x02, 0x01, 0x02, 0x04 };
-const uint8_t TERMINAL_6X8_UNDERSCORE[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
-const uint8_t TERMINAL_6X8_GRAVE[] = { 0x00, 0x00, 0x03, 0x07, 0x00, 0x00 };
-const uint8_t TERMINAL_6X8_a[] = { 0x00, 0x20, 0x54, 0x54, 0x54, 0x78 };
-const uint8_t TERMINAL_6X8_b[] = { 0x00, 0x7F, 0x44, 0x44, 0x44, 0x38 };
-const uint8_t TERMINAL_6X8_c[] = { 0x00, 0x38, 0x44, 0x44, 0x44, 0x28 };
-const uint8_t TERMINAL_6X8_d[] = { 0x00, 0x38, 0x44, 0x44, 0x44, 0x7F };
-const uint8_t TERMINAL_6X8_e[] = { 0x00, 0x38, 0x54, 0x54, 0x54, 0x08 };
-const uint8_t TERMINAL_6X8_f[] = { 0x00, 0x08, 0x7E, 0x09, 0x09, 0x00 };
-const uint8_t TERMINAL_6X8_g[] = { 0x00, 0x18, 0xA4, 0xA4, 0xA4, 0x7C };
-const uint8_t TERMINAL_6X8_h[] = { 0x00, 0x7F, 0x04, 0x04, 0x78, 0x00 };
-const uint8_t TERMINAL_6X8_i[] = { 0x00, 0x00, 0x00, 0x7D, 0x40, 0x00 };
-const uint8_t TERMINAL_6X8_j[] = { 0x00, 0x40, 0x80, 0x84, 0x7D, 0x00 };
-const uint8_t TERMINAL_6X8_k[] = { 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00 };
-const uint8_t TERMINAL_6X8_l[] = { 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00 };
-const uint8_t TERMINAL_6X8_m[] = { 0x00, 0x7C, 0x04, 0x18, 0x04, 0x78 };
-const uint8_t TERMINAL_6X8_n[] = { 0x00, 0x7C, 0x04, 0x04, 0x78, 0x00 };
-const uint8_t TERMINAL_6X8_o[] = { 0x00, 0x38, 0x44, 0x44, 0x44, 0x38 };
-const uint8_t TERMINAL_6X8_p[] = { 0x00, 0xFC, 0x44, 0x44, 0x44, 0x38 };
-const uint8_t TERMINAL_6X8_q[] = { 0x00, 0x38, 0x44, 0x44, 0x44, 0xFC };
-const uint8_t TERMINAL_6X8_r[] = { 0x00, 0x44, 0x78, 0x44, 0x04, 0x08 };
-const uint8_t TERMINAL_6X8_s[] = { 0x00, 0x08, 0x54, 0x54, 0x54, 0x20 };
-const uint8_t TERMINAL_6X8_t[] = { 0x00, 0x04, 0x3E, 0x44, 0x24, 0x00 };
-const uint8_t TERMINAL_6X8_u[] = { 0x00, 0x3C, 0x40, 0x20, 0x7C, 0x00 };
-const uint8_t TERMINAL_6X8_v[] = { 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C };
-const uint8_t TERMINAL_6X8_w[] = { 0x00, 0x3C, 0x60, 0x30, 0x60, 0x3C };
-const uint8_t TERMINAL_6X8_x[] = { 0x00, 0x6C, 0x10, 0x10, 0x6C, 0x00 };
-const uint8_t TERMINAL_6X8_y[] = { 0x00, 0x9C, 0xA0, 0x60, 0x3C, 0x00 };
-const uint8_t TERMINAL_6X8_z[] = { 0x00, 0x64, 0x54, 0x54, 0x4C, 0x00 };
-const uint8_t TERMINAL_6X8_OPENBRACE[] = { 0x00, 0x08, 0x3E, 0x41, 0x41, 0x00 };
-const uint8_t TERMINAL_6X8_CLOSEDBRACE[] = { 0x00, 0x41, 0x41, 0x3e, 0x08, 0x00 };
-const uint8_t TERMINAL_6X8_VERTBAR[] = { 0x00, 0x00, 0x00, 0x77, 0x00, 0x00 };
+// TERMINAL 6X8: ' ' (0x20) thru '}' (0x7D), then ENVELOPE 6X8 left & right
+static const uint8_t TERMINAL_6X8_ATLAS[][WIDTH_6X8 * HEIGHT_6X8] =
+{
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ' '
+  { 0x00, 0x00, 0x06, 0x5F, 0x06, 0x00 },   // '!'
+  { 0x00, 0x07, 0x03, 0x00, 0x07, 0x03 },   // '"'
+  { 0x00, 0x24, 0x7E, 0x24, 0x7E, 0x24 },   // '#'
+  { 0x00, 0x24, 0x2B, 0x6A, 0x12, 0x00 },   // '$'
+  { 0x00, 0x63, 0x13, 0x08, 0x64, 0x63 },   // '%'
+  { 0x00, 0x36, 0x49, 0x56, 0x20, 0x50 },   // '&'
+  { 0x00, 0x00, 0x07, 0x03, 0x00, 0x00 },   // '\''
+  { 0x00, 0x00, 0x3E, 0x41, 0x00, 0x00 },   // '('
+  { 0x00, 0x00, 0x41, 0x3E, 0x00, 0x00 },   // ')'
+  { 0x00, 0x08, 0x3E, 0x1C, 0x3E, 0x08 },   // '*'
+  { 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08 },   // '+'
+  { 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00 },   // ','
+  { 0x00, 0x08, 0x08, 0x08, 0x08, 0x08 },   // '-'
+  { 0x00, 0x00, 0x60, 0x60, 0x00, 0x00 },   // '.'
+  { 0x00, 0x20, 0x10, 0x08, 0x04, 0x02 },   // '/'
+  { 0x00, 0x3E, 0x51, 0x49, 0x45, 0x3E },   // '0'
+  { 0x00, 0x00, 0x42, 0x7F, 0x40, 0x00 },   // '1'
+  { 0x00, 0x62, 0x51, 0x49, 0x49, 0x46 },   // '2'
+  { 0x00, 0x22, 0x49, 0x49, 0x49, 0x36 },   // '3'
+  { 0x00, 0x18, 0x14, 0x12, 0x7F, 0x10 },   // '4'
+  { 0x00, 0x2F, 0x49, 0x49, 0x49, 0x31 },   // '5'
+  { 0x00, 0x3C, 0x4A, 0x49, 0x49, 0x30 },   // '6'
+  { 0x00, 0x01, 0x71, 0x09, 0x05, 0x03 },   // '7'
+  { 0x00, 0x36, 0x49, 0x49, 0x49, 0x36 },   // '8'
+  { 0x00, 0x06, 0x49, 0x49, 0x29, 0x1E },   // '9'
+  { 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00 },   // ':'
+  { 0x00, 0x00, 0xEC, 0x6C, 0x00, 0x00 },   // ';'
+  { 0x00, 0x08, 0x14, 0x22, 0x41, 0x00 },   // '<'
+  { 0x00, 0x24, 0x24, 0x24, 0x24, 0x24 },   // '='
+  { 0x00, 0x00, 0x41, 0x22, 0x14, 0x08 },   // '>'
+  { 0x00, 0x02, 0x01, 0x59, 0x09, 0x06 },   // '?'
+  { 0x00, 0x3E, 0x41, 0x5D, 0x55, 0x1E },   // '@'
+  { 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E },   // 'A'
+  { 0x00, 0x7F, 0x49, 0x49, 0x49, 0x36 },   // 'B'
+  { 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22 },   // 'C'
+  { 0x00, 0x7F, 0x41, 0x41, 0x41, 0x3E },   // 'D'
+  { 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41 },   // 'E'
+  { 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01 },   // 'F'
+  { 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A },   // 'G'
+  { 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F },   // 'H'
+  { 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00 },   // 'I'
+  { 0x00, 0x30, 0x40, 0x40, 0x40, 0x3F },   // 'J'
+  { 0x00, 0x7F, 0x08, 0x14, 0x22, 0x41 },   // 'K'
+  { 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40 },   // 'L'
+  { 0x00, 0x7F, 0x02, 0x04, 0x02, 0x7F },   // 'M'
+  { 0x00, 0x7F, 0x02, 0x04, 0x08, 0x7F },   // 'N'
+  { 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E },   // 'O'
+  { 0x00, 0x7F, 0x09, 0x09, 0x09, 0x06 },   // 'P'
+  { 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E },   // 'Q'
+  { 0x00, 0x7F, 0x09, 0x09, 0x19, 0x66 },   // 'R'
+  { 0x00, 0x26, 0x49, 0x49, 0x49, 0x32 },   // 'S'
+  { 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01 },   // 'T'
+  { 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F },   // 'U'
+  { 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F },   // 'V'
+  { 0x00, 0x3F, 0x40, 0x3C, 0x40, 0x3F },   // 'W'
+  { 0x00, 0x63, 0x14, 0x08, 0x14, 0x63 },   // 'X'
+  { 0x00, 0x07, 0x08, 0x70, 0x08, 0x07 },   // 'Y'
+  { 0x00, 0x71, 0x49, 0x45, 0x43, 0x00 },   // 'Z'
+  { 0x00, 0x00, 0x7F, 0x41, 0x41, 0x00 },   // '['
+  { 0x00, 0x02, 0x04, 0x08, 0x10, 0x20 },   // '\\'
+  { 0x00, 0x00, 0x41, 0x41, 0x7F, 0x00 },   // ']'
+  { 0x00, 0x04, 0x02, 0x01, 0x02, 0x04 },   // '^'
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },   // '_'
+  { 0x00, 0x00, 0x03, 0x07, 0x00, 0x00 },   // '`'
+  { 0x00, 0x20, 0x54, 0x54, 0x54, 0x78 },   // 'a'
+  { 0x00, 0x7F, 0x44, 0x44, 0x44, 0x38 },   // 'b'
+  { 0x00, 0x38, 0x44, 0x44, 0x44, 0x28 },   // 'c'
+  { 0x00, 0x38, 0x44, 0x44, 0x44, 0x7F },   // 'd'
+  { 0x00, 0x38, 0x54, 0x54, 0x54, 0x08 },   // 'e'
+  { 0x00, 0x08, 0x7E, 0x09, 0x09, 0x00 },   // 'f'
+  { 0x00, 0x18, 0xA4, 0xA4, 0xA4, 0x7C },   // 'g'
+  { 0x00, 0x7F, 0x04, 0x04, 0x78, 0x00 },   // 'h'
+  { 0x00, 0x00, 0x00, 0x7D, 0x40, 0x00 },   // 'i'
+  { 0x00, 0x40, 0x80, 0x84, 0x7D, 0x00 },   // 'j'
+  { 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00 },   // 'k'
+  { 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00 },   // 'l'
+  { 0x00, 0x7C, 0x04, 0x18, 0x04, 0x78 },   // 'm'
+  { 0x00, 0x7C, 0x04, 0x04, 0x78, 0x00 },   // 'n'
+  { 0x00, 0x38, 0x44, 0x44, 0x44, 0x38 },   // 'o'
+  { 0x00, 0xFC, 0x44, 0x44, 0x44, 0x38 },   // 'p'
+  { 0x00, 0x38, 0x44, 0x44, 0x44, 0xFC },   // 'q'
+  { 0x00, 0x44, 0x78, 0x44, 0x04, 0x08 },   // 'r'
+  { 0x00, 0x08, 0x54, 0x54, 0x54, 0x20 },   // 's'
+  { 0x00, 0x04, 0x3E, 0x44, 0x24, 0x00 },   // 't'
+  { 0x00, 0x3C, 0x40, 0x20, 0x7C, 0x00 },   // 'u'
+  { 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C },   // 'v'
+  { 0x00, 0x3C, 0x60, 0x30, 0x60, 0x3C },   // 'w'
+  { 0x00, 0x6C, 0x10, 0x10, 0x6C, 0x00 },   // 'x'
+  { 0x00, 0x9C, 0xA0, 0x60, 0x3C, 0x00 },   // 'y'
+  { 0x00, 0x64, 0x54, 0x54, 0x4C, 0x00 },   // 'z'
+  { 0x00, 0x08, 0x3E, 0x41, 0x41, 0x00 },   // '{'
+  { 0x00, 0x00, 0x00, 0x77, 0x00, 0x00 },   // '|'
+  { 0x00, 0x41, 0x41, 0x3E, 0x08, 0x00 },   // '}'
+  { 0xFF, 0x83, 0x85, 0x89, 0x91, 0xA1 },   // ENVELOPE_LEFT_CHAR
+  { 0xA1, 0x91, 0x89, 0x85, 0x83, 0xFF }    // ENVELOPE_RIGHT_CHAR
+};
 
-// TERMINAL 12X16
-const uint8_t TERMINAL_12X16_SPACE[] =                                        {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_EXCLAMATION[] =                                  {
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_DOUBLEQUOTE[] =                                  {
-0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_HASH[] =                                         {
-0x00, 0x00, 0x10, 0x90, 0xF0, 0x7E, 0x1E, 0x90, 0xF0, 0x7E, 0x1E, 0x10,
-0x00, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_DOLLAR[] =                                       {
-0x00, 0x00, 0x78, 0xFC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x88, 0x00, 0x00,
-0x00, 0x00, 0x04, 0x0C, 0x0C, 0x3F, 0x3F, 0x0C, 0x0F, 0x07, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_PERCENT[] =                                      {
-0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
-0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x38, 0x38, 0x38, 0x00        };
-const uint8_t TERMINAL_12X16_AMPERSAND[] =                                    {
-0x00, 0x00, 0x00, 0xB8, 0xFC, 0xC6, 0xE2, 0x3E, 0x1C, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x1F, 0x3F, 0x31, 0x21, 0x37, 0x1E, 0x1C, 0x36, 0x22, 0x00        };
-const uint8_t TERMINAL_12X16_SINGLEQUOTE[] =                                  {
-0x00, 0x00, 0x00, 0x00, 0x27, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_OPENPAREN[] =                                    {
-0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x38, 0x20, 0x20, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_CLOSEPAREN[] =                                   {
-0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x20, 0x38, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_ASTERISK[] =                                     {
-0x00, 0x00, 0x98, 0xB8, 0xE0, 0xF8, 0xF8, 0xE0, 0xB8, 0x98, 0x00, 0x00,
-0x00, 0x00, 0x0C, 0x0E, 0x03, 0x0F, 0x0F, 0x03, 0x0E, 0x0C, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_PLUS[] =                                         {
-0x00, 0x00, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_COMMA[] =                                        {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_MINUS[] =                                        {
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_PERIOD[] =                                       {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_FWDSLASH[] =                                     {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
-0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_0[] =                                            {
-0x00, 0xF8, 0xFE, 0x06, 0x03, 0x83, 0xC3, 0x63, 0x33, 0x1E, 0xFE, 0xF8,
-0x00, 0x07, 0x1F, 0x1E, 0x33, 0x31, 0x30, 0x30, 0x30, 0x18, 0x1F, 0x07        };
-const uint8_t TERMINAL_12X16_1[] =                                            {
-0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_2[] =                                            {
-0x00, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E, 0x1C,
-0x00, 0x30, 0x38, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, 0x30        };
-const uint8_t TERMINAL_12X16_3[] =                                            {
-0x00, 0x0C, 0x0E, 0x07, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,
-0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0E        };
-const uint8_t TERMINAL_12X16_4[] =                                            {
-0x00, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03        };
-const uint8_t TERMINAL_12X16_5[] =                                            {
-0x00, 0x3F, 0x7F, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xE3, 0xC3, 0x83,
-0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F        };
-const uint8_t TERMINAL_12X16_6[] =                                            {
-0x00, 0xC0, 0xF0, 0xF8, 0xDC, 0xCE, 0xC7, 0xC3, 0xC3, 0xC3, 0x80, 0x00,
-0x00, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F        };
-const uint8_t TERMINAL_12X16_7[] =                                            {
-0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xF3, 0x3F, 0x0F, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x30, 0x3C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_8[] =                                            {
-0x00, 0x00, 0xBC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xBC, 0x00,
-0x00, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F        };
-const uint8_t TERMINAL_12X16_9[] =                                            {
-0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xFC,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00        };
-const uint8_t TERMINAL_12X16_COLON[] =                                        {
-0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_SEMICOLON[] =                                    {
-0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x9C, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_LESS[] =                                         {
-0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_EQUALS[] =                                        {
-0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
-0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00        };
-const uint8_t TERMINAL_12X16_GREATER[] =                                      {
-0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x00, 0x00,
-0x00, 0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_QUESTION[] =                                     {
-0x00, 0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E, 0x1C, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_AT[] =                                           {
-0x00, 0xF8, 0xFE, 0x07, 0xF3, 0xFB, 0x1B, 0xFB, 0xFB, 0x07, 0xFE, 0xF8,
-0x00, 0x0F, 0x1F, 0x18, 0x33, 0x37, 0x36, 0x37, 0x37, 0x36, 0x03, 0x01        };
-const uint8_t TERMINAL_12X16_A[] =                                            {
-0x00, 0x00, 0x00, 0xE0, 0xFC, 0x1F, 0x1F, 0xFC, 0xE0, 0x00, 0x00, 0x00,
-0x00, 0x38, 0x3F, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x3F, 0x38, 0x00        };
-const uint8_t TERMINAL_12X16_B[] =                                            {
-0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xBC, 0x00, 0x00,
-0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x00        };
-const uint8_t TERMINAL_12X16_C[] =                                            {
-0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x0C, 0x00,
-0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0x00        };
-const uint8_t TERMINAL_12X16_D[] =                                            {
-0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
-0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x00        };
-const uint8_t TERMINAL_12X16_E[] =                                            {
-0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00,
-0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_F[] =                                            {
-0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_G[] =                                            {
-0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0xC3, 0xC3, 0xC3, 0xC7, 0xC6, 0x00,
-0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_H[] =                                            {
-0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_I[] =                                            {
-0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_J[] =                                            {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x0E, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x00        };
-const uint8_t TERMINAL_12X16_K[] =                                            {
-0x00, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_L[] =                                            {
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_M[] =                                            {
-0x00, 0xFF, 0xFF, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E, 0xFF, 0xFF, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_N[] =                                            {
-0x00, 0xFF, 0xFF, 0x0E, 0x38, 0xF0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1C, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_O[] =                                            {
-0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
-0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x00        };
-const uint8_t TERMINAL_12X16_P[] =                                            {
-0x00, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0xC7, 0xFE, 0x7C, 0x00,
-0x00, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_Q[] =                                            {
-0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
-0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x36, 0x3E, 0x1C, 0x3F, 0x33, 0x00        };
-const uint8_t TERMINAL_12X16_R[] =                                            {
-0x00, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0xC7, 0xFE, 0x7C, 0x00,
-0x00, 0x3F, 0x3F, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_S[] =                                            {
-0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x8E, 0x0C, 0x00,
-0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x00        };
-const uint8_t TERMINAL_12X16_T[] =                                            {
-0x00, 0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_U[] =                                            {
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x00        };
-const uint8_t TERMINAL_12X16_V[] =                                            {
-0x00, 0x07, 0x3F, 0xF8, 0xC0, 0x00, 0x00, 0xC0, 0xF8, 0x3F, 0x07, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x0F, 0x3E, 0x3E, 0x0F, 0x01, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_W[] =                                            {
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x3F, 0x3F, 0x1C, 0x06, 0x03, 0x03, 0x06, 0x1C, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_X[] =                                            {
-0x00, 0x03, 0x0F, 0x1C, 0x30, 0xE0, 0xE0, 0x30, 0x1C, 0x0F, 0x03, 0x00,
-0x00, 0x30, 0x3C, 0x0E, 0x03, 0x01, 0x01, 0x03, 0x0E, 0x3C, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_Y[] =                                            {
-0x00, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_Z[] =                                            {
-0x00, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xE3, 0x33, 0x1F, 0x0F, 0x03, 0x00,
-0x00, 0x30, 0x3C, 0x3E, 0x33, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00        };
-const uint8_t TERMINAL_12X16_OPENBRACKET[] =                                  {
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_BACKSLASH[] =                                    {
-0x00, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x18        };
-const uint8_t TERMINAL_12X16_CLOSEDBRACKET[] =                                 {
-0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_CARET[] =                                        {
-0x00, 0x60, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x60,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_UNDERSCORE[] =                                   {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0        };
-const uint8_t TERMINAL_12X16_GRAVE[] =                                        {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x4E, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_a[] =                                            {
-0x00, 0x00, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,
-0x00, 0x1C, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_b[] =                                            {
-0x00, 0xFF, 0xFF, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
-0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00        };
-const uint8_t TERMINAL_12X16_c[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,
-0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x08, 0x00        };
-const uint8_t TERMINAL_12X16_d[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0xFF, 0xFF, 0x00,
-0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_e[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,
-0x00, 0x0F, 0x1F, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x01, 0x00        };
-const uint8_t TERMINAL_12X16_f[] =                                            {
-0x00, 0xC0, 0xC0, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_g[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x00,
-0x00, 0x03, 0xC7, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xE6, 0x7F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_h[] =                                            {
-0x00, 0xFF, 0xFF, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_i[] =                                            {
-0x00, 0x00, 0x00, 0x00, 0x60, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_j[] =                                            {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xEC, 0xEC, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x60, 0xE0, 0xC0, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_k[] =                                            {
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x3F, 0x3F, 0x03, 0x07, 0x0F, 0x1C, 0x38, 0x30, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_l[] =                                            {
-0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_m[] =                                            {
-0x00, 0xE0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x00,
-0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_n[] =                                            {
-0x00, 0x00, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
-0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_o[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
-0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00        };
-const uint8_t TERMINAL_12X16_p[] =                                            {
-0x00, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
-0x00, 0xFF, 0xFF, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x07, 0x00        };
-const uint8_t TERMINAL_12X16_q[] =                                            {
-0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x00,
-0x00, 0x07, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x0C, 0xFF, 0xFF, 0x00        };
-const uint8_t TERMINAL_12X16_r[] =                                            {
-0x00, 0x00, 0xE0, 0xE0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,
-0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_s[] =                                            {
-0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x1E, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_t[] =                                            {
-0x00, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x1F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_u[] =                                            {
-0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00,
-0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x18, 0x3F, 0x3F, 0x00        };
-const uint8_t TERMINAL_12X16_v[] =                                            {
-0x00, 0x60, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00,
-0x00, 0x00, 0x01, 0x07, 0x1E, 0x38, 0x38, 0x1E, 0x07, 0x01, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_w[] =                                            {
-0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00,
-0x00, 0x07, 0x1F, 0x38, 0x1C, 0x0F, 0x0F, 0x1C, 0x38, 0x1F, 0x07, 0x00        };
-const uint8_t TERMINAL_12X16_x[] =                                            {
-0x00, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x00, 0x00,
-0x00, 0x30, 0x38, 0x1D, 0x0F, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_y[] =                                            {
-0x00, 0x00, 0x60, 0xE0, 0x80, 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x81, 0xE7, 0x7E, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_z[] =                                            {
-0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x00,
-0x00, 0x30, 0x38, 0x3C, 0x36, 0x33, 0x31, 0x30, 0x30, 0x30, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_OPENBRACE[] =                                    {
-0x00, 0x00, 0x80, 0xC0, 0xFC, 0x7E, 0x07, 0x03, 0x03, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_VERTBAR[] =                                      {
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_CLOSEDBRACE[] =                                  {
-0x00, 0x00, 0x03, 0x03, 0x03, 0x07, 0x7E, 0xFC, 0xC0, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x01, 0x00, 0x00, 0x00        };
-const uint8_t TERMINAL_12X16_TILDE[] =                                        {
-0x00, 0x10, 0x18, 0x0C, 0x04, 0x0C, 0x18, 0x10, 0x18, 0x0C, 0x04, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00        };
+#if (FONTS_USE_RLE == 0)
+// TERMINAL 12X16: ' ' (0x20) thru '~' (0x7E)
+static const uint8_t TERMINAL_12X16_ATLAS[][WIDTH_12X16 * HEIGHT_12X16] =
+{
+  { // ' '
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '!'
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '"'
+    0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '#'
+    0x00, 0x00, 0x10, 0x90, 0xF0, 0x7E, 0x1E, 0x90, 0xF0, 0x7E, 0x1E, 0x10,
+    0x00, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x00, 0x00
+  },
+  { // '$'
+    0x00, 0x00, 0x78, 0xFC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x0C, 0x0C, 0x3F, 0x3F, 0x0C, 0x0F, 0x07, 0x00, 0x00
+  },
+  { // '%'
+    0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+    0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x38, 0x38, 0x38, 0x00
+  },
+  { // '&'
+    0x00, 0x00, 0x00, 0xB8, 0xFC, 0xC6, 0xE2, 0x3E, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x3F, 0x31, 0x21, 0x37, 0x1E, 0x1C, 0x36, 0x22, 0x00
+  },
+  { // '\''
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '('
+    0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x38, 0x20, 0x20, 0x00, 0x00, 0x00
+  },
+  { // ')'
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x38, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00
+  },
+  { // '*'
+    0x00, 0x00, 0x98, 0xB8, 0xE0, 0xF8, 0xF8, 0xE0, 0xB8, 0x98, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x0E, 0x03, 0x0F, 0x0F, 0x03, 0x0E, 0x0C, 0x00, 0x00
+  },
+  { // '+'
+    0x00, 0x00, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x00, 0x00
+  },
+  { // ','
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '-'
+    0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00
+  },
+  { // '.'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '/'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+    0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '0'
+    0x00, 0xF8, 0xFE, 0x06, 0x03, 0x83, 0xC3, 0x63, 0x33, 0x1E, 0xFE, 0xF8,
+    0x00, 0x07, 0x1F, 0x1E, 0x33, 0x31, 0x30, 0x30, 0x30, 0x18, 0x1F, 0x07
+  },
+  { // '1'
+    0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x00
+  },
+  { // '2'
+    0x00, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E, 0x1C,
+    0x00, 0x30, 0x38, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, 0x30
+  },
+  { // '3'
+    0x00, 0x0C, 0x0E, 0x07, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,
+    0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0E
+  },
+  { // '4'
+    0x00, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03
+  },
+  { // '5'
+    0x00, 0x3F, 0x7F, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xE3, 0xC3, 0x83,
+    0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F
+  },
+  { // '6'
+    0x00, 0xC0, 0xF0, 0xF8, 0xDC, 0xCE, 0xC7, 0xC3, 0xC3, 0xC3, 0x80, 0x00,
+    0x00, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F
+  },
+  { // '7'
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xF3, 0x3F, 0x0F, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x3C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '8'
+    0x00, 0x00, 0xBC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xBC, 0x00,
+    0x00, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F
+  },
+  { // '9'
+    0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xFC,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00
+  },
+  { // ':'
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ';'
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9C, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '<'
+    0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x00, 0x00
+  },
+  { // '='
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00
+  },
+  { // '>'
+    0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00
+  },
+  { // '?'
+    0x00, 0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '@'
+    0x00, 0xF8, 0xFE, 0x07, 0xF3, 0xFB, 0x1B, 0xFB, 0xFB, 0x07, 0xFE, 0xF8,
+    0x00, 0x0F, 0x1F, 0x18, 0x33, 0x37, 0x36, 0x37, 0x37, 0x36, 0x03, 0x01
+  },
+  { // 'A'
+    0x00, 0x00, 0x00, 0xE0, 0xFC, 0x1F, 0x1F, 0xFC, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x3F, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x3F, 0x38, 0x00
+  },
+  { // 'B'
+    0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xBC, 0x00, 0x00,
+    0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x00
+  },
+  { // 'C'
+    0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x0C, 0x00,
+    0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0x00
+  },
+  { // 'D'
+    0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
+    0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x00
+  },
+  { // 'E'
+    0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00,
+    0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00
+  },
+  { // 'F'
+    0x00, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'G'
+    0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0xC3, 0xC3, 0xC3, 0xC7, 0xC6, 0x00,
+    0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00
+  },
+  { // 'H'
+    0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00
+  },
+  { // 'I'
+    0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00
+  },
+  { // 'J'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x0E, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x00
+  },
+  { // 'K'
+    0x00, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x00
+  },
+  { // 'L'
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00
+  },
+  { // 'M'
+    0x00, 0xFF, 0xFF, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x3F, 0x00
+  },
+  { // 'N'
+    0x00, 0xFF, 0xFF, 0x0E, 0x38, 0xF0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1C, 0x3F, 0x3F, 0x00
+  },
+  { // 'O'
+    0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
+    0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x00
+  },
+  { // 'P'
+    0x00, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0xC7, 0xFE, 0x7C, 0x00,
+    0x00, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00
+  },
+  { // 'Q'
+    0x00, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
+    0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x36, 0x3E, 0x1C, 0x3F, 0x33, 0x00
+  },
+  { // 'R'
+    0x00, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0xC7, 0xFE, 0x7C, 0x00,
+    0x00, 0x3F, 0x3F, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00
+  },
+  { // 'S'
+    0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x8E, 0x0C, 0x00,
+    0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x00
+  },
+  { // 'T'
+    0x00, 0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'U'
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x00
+  },
+  { // 'V'
+    0x00, 0x07, 0x3F, 0xF8, 0xC0, 0x00, 0x00, 0xC0, 0xF8, 0x3F, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x0F, 0x3E, 0x3E, 0x0F, 0x01, 0x00, 0x00, 0x00
+  },
+  { // 'W'
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x3F, 0x3F, 0x1C, 0x06, 0x03, 0x03, 0x06, 0x1C, 0x3F, 0x3F, 0x00
+  },
+  { // 'X'
+    0x00, 0x03, 0x0F, 0x1C, 0x30, 0xE0, 0xE0, 0x30, 0x1C, 0x0F, 0x03, 0x00,
+    0x00, 0x30, 0x3C, 0x0E, 0x03, 0x01, 0x01, 0x03, 0x0E, 0x3C, 0x30, 0x00
+  },
+  { // 'Y'
+    0x00, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Z'
+    0x00, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xE3, 0x33, 0x1F, 0x0F, 0x03, 0x00,
+    0x00, 0x30, 0x3C, 0x3E, 0x33, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00
+  },
+  { // '['
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00
+  },
+  { // '\\'
+    0x00, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x18
+  },
+  { // ']'
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00, 0x00, 0x00
+  },
+  { // '^'
+    0x00, 0x60, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '_'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0
+  },
+  { // '`'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x4E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'a'
+    0x00, 0x00, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,
+    0x00, 0x1C, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x00
+  },
+  { // 'b'
+    0x00, 0xFF, 0xFF, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
+    0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00
+  },
+  { // 'c'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,
+    0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x08, 0x00
+  },
+  { // 'd'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0xFF, 0xFF, 0x00,
+    0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00
+  },
+  { // 'e'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,
+    0x00, 0x0F, 0x1F, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x01, 0x00
+  },
+  { // 'f'
+    0x00, 0xC0, 0xC0, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'g'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x00,
+    0x00, 0x03, 0xC7, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xE6, 0x7F, 0x3F, 0x00
+  },
+  { // 'h'
+    0x00, 0xFF, 0xFF, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00
+  },
+  { // 'i'
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00
+  },
+  { // 'j'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xEC, 0xEC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xE0, 0xC0, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00
+  },
+  { // 'k'
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x3F, 0x03, 0x07, 0x0F, 0x1C, 0x38, 0x30, 0x00, 0x00
+  },
+  { // 'l'
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00
+  },
+  { // 'm'
+    0x00, 0xE0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x00,
+    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00
+  },
+  { // 'n'
+    0x00, 0x00, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00
+  },
+  { // 'o'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
+    0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00
+  },
+  { // 'p'
+    0x00, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,
+    0x00, 0xFF, 0xFF, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x07, 0x00
+  },
+  { // 'q'
+    0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x00,
+    0x00, 0x07, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x0C, 0xFF, 0xFF, 0x00
+  },
+  { // 'r'
+    0x00, 0x00, 0xE0, 0xE0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 's'
+    0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x1E, 0x00, 0x00, 0x00
+  },
+  { // 't'
+    0x00, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00
+  },
+  { // 'u'
+    0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00,
+    0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x18, 0x3F, 0x3F, 0x00
+  },
+  { // 'v'
+    0x00, 0x60, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00,
+    0x00, 0x00, 0x01, 0x07, 0x1E, 0x38, 0x38, 0x1E, 0x07, 0x01, 0x00, 0x00
+  },
+  { // 'w'
+    0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00,
+    0x00, 0x07, 0x1F, 0x38, 0x1C, 0x0F, 0x0F, 0x1C, 0x38, 0x1F, 0x07, 0x00
+  },
+  { // 'x'
+    0x00, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x00, 0x00,
+    0x00, 0x30, 0x38, 0x1D, 0x0F, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00, 0x00
+  },
+  { // 'y'
+    0x00, 0x00, 0x60, 0xE0, 0x80, 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x81, 0xE7, 0x7E, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00
+  },
+  { // 'z'
+    0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x00,
+    0x00, 0x30, 0x38, 0x3C, 0x36, 0x33, 0x31, 0x30, 0x30, 0x30, 0x00, 0x00
+  },
+  { // '{'
+    0x00, 0x00, 0x80, 0xC0, 0xFC, 0x7E, 0x07, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x00, 0x00
+  },
+  { // '|'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '}'
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x07, 0x7E, 0xFC, 0xC0, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x01, 0x00, 0x00, 0x00
+  },
+  { // '~'
+    0x00, 0x10, 0x18, 0x0C, 0x04, 0x0C, 0x18, 0x10, 0x18, 0x0C, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  }
+};
+#endif
 
 // BATTERY_18X8
 const uint8_t BATTERY_18X8_0[] =                        {
@@ -469,249 +589,243 @@ const uint8_t BATTERY_18X8_11[] =                       {
   0x00, 0x00, 0x18, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
   0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x00, 0x00  };
 
-// VERDANA 34X56
-const uint8_t VERDANA_34X56_SPACE[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_0[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFE, 0xFF,
-0x3F, 0x1F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x1F,
-0x3F, 0xFF, 0xFE, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8,
-0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3E, 0x3C, 0x7C, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_1[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
-0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0x3F,
-0x3F, 0x3F, 0x3F, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_2[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x0F, 0x0F, 0x07,
-0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x3F,
-0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC,
-0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC,
-0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_3[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F,
-0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F,
-0x1F, 0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F,
-0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-0x0F, 0x0E, 0x1E, 0x3E, 0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x1F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3C, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x7C, 0x3C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_4[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x7E, 0x3F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7F, 0x1F, 0x0F,
-0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFE, 0xBF,
-0x9F, 0x87, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_5[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
-0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
-0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0,
-0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1F, 0x1F, 0x3F, 0x3E, 0x3E, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_6[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8,
-0xFC, 0xFE, 0x3E, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x83, 0xC0, 0xC0, 0xC0, 0xE0,
-0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3E, 0x3C, 0x7C, 0x78, 0x78,
-0x78, 0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_7[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-0xC7, 0xE7, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF,
-0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0,
-0xF8, 0xFC, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x38, 0x3E, 0x3F, 0x3F, 0x3F, 0x0F, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_8[] =
-{
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x3F,
-0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07,
-0x0F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xFF, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0,
-0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFF, 0x7F, 0x3F,
-0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0,
-0xF8, 0xFC, 0x3D, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F,
-0x1F, 0x1F, 0x3F, 0x3F, 0x7D, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0x7C, 0x7C, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x78, 0x78, 0x3C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-const uint8_t VERDANA_34X56_9[] =
+#if (FONTS_USE_RLE == 0)
+// VERDANA 34X56: '0' (0x30) thru '9' (0x39), then ' '
+static const uint8_t VERDANA_34X56_ATLAS[][WIDTH_34X56 * HEIGHT_34X56] =
 {
-0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x1F,
-0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F,
-0x7F, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F,
-0x3F, 0x3F, 0x7E, 0x7C, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-0x70, 0x78, 0x78, 0x3C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF8, 0xFF,
-0xFF, 0x7F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x3C,
-0x3C, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  { // '0'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xF0, 0xFC, 0xFE, 0xFF, 0x3F, 0x1F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x07, 0x1F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF0, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3E,
+    0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x1F, 0x1F,
+    0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '1'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '2'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x07, 0x0F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3D, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '3'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0,
+    0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0E, 0x1E, 0x3E, 0x7C, 0xFC, 0xF8, 0xF0,
+    0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3C, 0x3C, 0x7C,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3C, 0x3E, 0x1F, 0x1F,
+    0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '4'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFC,
+    0x7E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0,
+    0xF8, 0xFC, 0x7F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xF8, 0xFC, 0xFE, 0xBF, 0x9F, 0x87, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '5'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0,
+    0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFE,
+    0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x3F, 0x3E, 0x3E, 0x3C, 0x7C,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x3E, 0x1F, 0x1F,
+    0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '6'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0x3E, 0x1F, 0x0F, 0x0F, 0x07, 0x07,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x83, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF,
+    0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F,
+    0x3E, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7C, 0x3C, 0x3E, 0x1F,
+    0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '7'
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xE7, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF,
+    0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x3E, 0x3F, 0x3F,
+    0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '8'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xF8, 0xFC, 0xFE, 0xFF, 0x3F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x07, 0x07, 0x0F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xFF, 0xFC,
+    0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC0,
+    0xE0, 0xF8, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x3D, 0x1F, 0x0F, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7D, 0xFC, 0xF8, 0xF0,
+    0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E,
+    0x7C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x3C, 0x3C, 0x3E, 0x1F,
+    0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // '9'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xF8, 0xFC, 0xFE, 0xFF, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7C, 0xF8, 0xF8, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x78, 0x78, 0x3C, 0x1C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xC0, 0xF8, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x3C, 0x3C, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F, 0x07, 0x03,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  },
+  { // ' '
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+  }
 };
+#endif
 
 //const uint8_t VERDANA_34X56_COLON[] =
 //{
@@ -822,4 +936,40 @@ const uint8_t VERDANA_34X56_9[] =
 //0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 //0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 //0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-//};
\ No newline at end of file
+//};
+
+
+// FONT DESCRIPTORS
+const font_t TERMINAL_6X8_FONT =
+{
+  WIDTH_6X8, HEIGHT_6X8,
+  ' ', '}',                               // atlas starts with ' ' thru '}'
+  (uint8_t)ENVELOPE_LEFT_CHAR,            // followed by envelope halves
+  (uint8_t)ENVELOPE_RIGHT_CHAR,
+  '?' - ' ',                              // unhandled characters shown as '?'
+  &TERMINAL_6X8_ATLAS[0][0], NULL
+};
+const font_t TERMINAL_12X16_FONT =
+{
+  WIDTH_12X16, HEIGHT_12X16,
+  ' ', '~',                               // atlas is ' ' thru '~'
+  1, 0,                                   // and nothing more
+  '?' - ' ',                              // unhandled characters shown as '?'
+#if (FONTS_USE_RLE == 1)
+  TERMINAL_12X16_RLE, TERMINAL_12X16_RLE_INDEX
+#else
+  &TERMINAL_12X16_ATLAS[0][0], NULL
+#endif
+};
+const font_t VERDANA_34X56_FONT =
+{
+  WIDTH_34X56, HEIGHT_34X56,
+  '0', '9',                               // atlas starts with '0' thru '9'
+  ' ', ' ',                               // followed by ' '
+  10,                                     // unhandled characters shown as ' '
+#if (FONTS_USE_RLE == 1)
+  VERDANA_34X56_RLE, VERDANA_34X56_RLE_INDEX
+#else
+  &VERDANA_34X56_ATLAS[0][0], NULL
+#endif
+};
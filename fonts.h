@@ -17,6 +17,7 @@
  * battery charge levels (i.e. fuel gauge) and an envelope icon.
  * Display BATTERY icons by calling LCDWriteFont.
  * Display ENVELOPE incon by calling LCDWriteStringTerminal6X8 w/ ENVELOPE_STR.
+ * Display TERMINAL and VERDANA strings by calling LCDWriteString w/ FONT.
  *
  * WIDTH, in pixels, when multiplied by (1 column / 1 pixel), reveals the number
  * of display columns, which translates to the number of bytes per page (row).
@@ -27,6 +28,11 @@
  *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add FONTS_USE_RLE switch, packed glyph format, and font_t index
+ *      Replace per-character TERMINAL_6X8_x, TERMINAL_12X16_x, VERDANA_34X56_x
+ *      declarations with font_t descriptors TERMINAL_6X8_FONT,
+ *      TERMINAL_12X16_FONT, and VERDANA_34X56_FONT
  *    2021/06/01, Robert Kirby, NSWC H12
  *      Add VERDANA_34X56_SPACE, stub out VERDANA_34X56_EQUALS
  *    2017/03/31, Robert Kirby, NSWC H12
@@ -62,202 +68,46 @@
 #define ENVELOPE_STR          "\xF9\xFA"
 
 
-// ENVELOPE 6X8
-extern const uint8_t ENVELOPE_6X8_LEFT[];   // Left-side unread msg icon
-extern const uint8_t ENVELOPE_6X8_RIGHT[];  // Right-side unread msg icon
+// 1: TERMINAL 12X16 and VERDANA 34X56 glyphs are stored packed (fonts_rle.h,
+//    generated from the plain glyphs in fonts.c by host/fontrle.c) and lcd.c
+//    unpacks them as it draws
+// 0: all glyphs are stored plain, (width * height) bytes each
+// FLASH: packed saves ~2,040 of 4,898 glyph bytes, ~1,020 instruction words
+#ifndef FONTS_USE_RLE
+#define FONTS_USE_RLE (1)
+#endif
 
-// TERMINAL 6X8
-extern const uint8_t TERMINAL_6X8_SPACE[];
-extern const uint8_t TERMINAL_6X8_EXCLAMATION[];
-extern const uint8_t TERMINAL_6X8_DOUBLEQUOTE[];
-extern const uint8_t TERMINAL_6X8_HASH[];
-extern const uint8_t TERMINAL_6X8_DOLLAR[];
-extern const uint8_t TERMINAL_6X8_PERCENT[];
-extern const uint8_t TERMINAL_6X8_AMPERSAND[];
-extern const uint8_t TERMINAL_6X8_SINGLEQUOTE[];
-extern const uint8_t TERMINAL_6X8_OPENPAREN[];
-extern const uint8_t TERMINAL_6X8_CLOSEPAREN[];
-extern const uint8_t TERMINAL_6X8_ASTERISK[];
-extern const uint8_t TERMINAL_6X8_PLUS[];
-extern const uint8_t TERMINAL_6X8_COMMA[];
-extern const uint8_t TERMINAL_6X8_MINUS[];
-extern const uint8_t TERMINAL_6X8_PERIOD[];
-extern const uint8_t TERMINAL_6X8_FWDSLASH[];
-extern const uint8_t TERMINAL_6X8_0[];
-extern const uint8_t TERMINAL_6X8_1[];
-extern const uint8_t TERMINAL_6X8_2[];
-extern const uint8_t TERMINAL_6X8_3[];
-extern const uint8_t TERMINAL_6X8_4[];
-extern const uint8_t TERMINAL_6X8_5[];
-extern const uint8_t TERMINAL_6X8_6[];
-extern const uint8_t TERMINAL_6X8_7[];
-extern const uint8_t TERMINAL_6X8_8[];
-extern const uint8_t TERMINAL_6X8_9[];
-extern const uint8_t TERMINAL_6X8_COLON[];
-extern const uint8_t TERMINAL_6X8_SEMICOLON[];
-extern const uint8_t TERMINAL_6X8_LESS[];
-extern const uint8_t TERMINAL_6X8_EQUALS[];
-extern const uint8_t TERMINAL_6X8_GREATER[];
-extern const uint8_t TERMINAL_6X8_QUESTION[];
-extern const uint8_t TERMINAL_6X8_AT[];
-extern const uint8_t TERMINAL_6X8_A[];
-extern const uint8_t TERMINAL_6X8_B[];
-extern const uint8_t TERMINAL_6X8_C[];
-extern const uint8_t TERMINAL_6X8_D[];
-extern const uint8_t TERMINAL_6X8_E[];
-extern const uint8_t TERMINAL_6X8_F[];
-extern const uint8_t TERMINAL_6X8_G[];
-extern const uint8_t TERMINAL_6X8_H[];
-extern const uint8_t TERMINAL_6X8_I[];
-extern const uint8_t TERMINAL_6X8_J[];
-extern const uint8_t TERMINAL_6X8_K[];
-extern const uint8_t TERMINAL_6X8_L[];
-extern const uint8_t TERMINAL_6X8_M[];
-extern const uint8_t TERMINAL_6X8_N[];
-extern const uint8_t TERMINAL_6X8_O[];
-extern const uint8_t TERMINAL_6X8_P[];
-extern const uint8_t TERMINAL_6X8_Q[];
-extern const uint8_t TERMINAL_6X8_R[];
-extern const uint8_t TERMINAL_6X8_S[];
-extern const uint8_t TERMINAL_6X8_T[];
-extern const uint8_t TERMINAL_6X8_U[];
-extern const uint8_t TERMINAL_6X8_V[];
-extern const uint8_t TERMINAL_6X8_W[];
-extern const uint8_t TERMINAL_6X8_X[];
-extern const uint8_t TERMINAL_6X8_Y[];
-extern const uint8_t TERMINAL_6X8_Z[];
-extern const uint8_t TERMINAL_6X8_OPENBRACKET[];
-extern const uint8_t TERMINAL_6X8_BACKSLASH[];
-extern const uint8_t TERMINAL_6X8_CLOSEDBRACKET[];
-extern const uint8_t TERMINAL_6X8_CARET[];
-extern const uint8_t TERMINAL_6X8_UNDERSCORE[];
-extern const uint8_t TERMINAL_6X8_GRAVE[];
-extern const uint8_t TERMINAL_6X8_a[];
-extern const uint8_t TERMINAL_6X8_b[];
-extern const uint8_t TERMINAL_6X8_c[];
-extern const uint8_t TERMINAL_6X8_d[];
-extern const uint8_t TERMINAL_6X8_e[];
-extern const uint8_t TERMINAL_6X8_f[];
-extern const uint8_t TERMINAL_6X8_g[];
-extern const uint8_t TERMINAL_6X8_h[];
-extern const uint8_t TERMINAL_6X8_i[];
-extern const uint8_t TERMINAL_6X8_j[];
-extern const uint8_t TERMINAL_6X8_k[];
-extern const uint8_t TERMINAL_6X8_l[];
-extern const uint8_t TERMINAL_6X8_m[];
-extern const uint8_t TERMINAL_6X8_n[];
-extern const uint8_t TERMINAL_6X8_o[];
-extern const uint8_t TERMINAL_6X8_p[];
-extern const uint8_t TERMINAL_6X8_q[];
-extern const uint8_t TERMINAL_6X8_r[];
-extern const uint8_t TERMINAL_6X8_s[];
-extern const uint8_t TERMINAL_6X8_t[];
-extern const uint8_t TERMINAL_6X8_u[];
-extern const uint8_t TERMINAL_6X8_v[];
-extern const uint8_t TERMINAL_6X8_w[];
-extern const uint8_t TERMINAL_6X8_x[];
-extern const uint8_t TERMINAL_6X8_y[];
-extern const uint8_t TERMINAL_6X8_z[];
-extern const uint8_t TERMINAL_6X8_OPENBRACE[];
-extern const uint8_t TERMINAL_6X8_CLOSEDBRACE[];
-extern const uint8_t TERMINAL_6X8_VERTBAR[];
+// Packed glyph: each page (row) of a glyph, top one first, is a sequence of
+// tokens that together give exactly width bytes; no token spans two rows.
+#define RLE_ZEROS     0x00            // 00nnnnnn: n+1 bytes of 0x00
+#define RLE_REPEAT    0x40            // 01nnnnnn v: n+1 bytes of v
+#define RLE_LITERAL   0x80            // 1nnnnnnn b0..bn: n+1 bytes as given
+#define RLE_RUN_MAX   64              // most bytes in a ZEROS or REPEAT token
+#define RLE_LIT_MAX   128             // most bytes in a LITERAL token
 
-// TERMINAL 12X16
-extern const uint8_t TERMINAL_12X16_SPACE[];
-extern const uint8_t TERMINAL_12X16_EXCLAMATION[];
-extern const uint8_t TERMINAL_12X16_DOUBLEQUOTE[];
-extern const uint8_t TERMINAL_12X16_HASH[];
-extern const uint8_t TERMINAL_12X16_DOLLAR[];
-extern const uint8_t TERMINAL_12X16_PERCENT[];
-extern const uint8_t TERMINAL_12X16_AMPERSAND[];
-extern const uint8_t TERMINAL_12X16_SINGLEQUOTE[];
-extern const uint8_t TERMINAL_12X16_OPENPAREN[];
-extern const uint8_t TERMINAL_12X16_CLOSEPAREN[];
-extern const uint8_t TERMINAL_12X16_ASTERISK[];
-extern const uint8_t TERMINAL_12X16_PLUS[];
-extern const uint8_t TERMINAL_12X16_COMMA[];
-extern const uint8_t TERMINAL_12X16_MINUS[];
-extern const uint8_t TERMINAL_12X16_PERIOD[];
-extern const uint8_t TERMINAL_12X16_FWDSLASH[];
-extern const uint8_t TERMINAL_12X16_0[];
-extern const uint8_t TERMINAL_12X16_1[];
-extern const uint8_t TERMINAL_12X16_2[];
-extern const uint8_t TERMINAL_12X16_3[];
-extern const uint8_t TERMINAL_12X16_4[];
-extern const uint8_t TERMINAL_12X16_5[];
-extern const uint8_t TERMINAL_12X16_6[];
-extern const uint8_t TERMINAL_12X16_7[];
-extern const uint8_t TERMINAL_12X16_8[];
-extern const uint8_t TERMINAL_12X16_9[];
-extern const uint8_t TERMINAL_12X16_COLON[];
-extern const uint8_t TERMINAL_12X16_SEMICOLON[];
-extern const uint8_t TERMINAL_12X16_LESS[];
-extern const uint8_t TERMINAL_12X16_EQUALS[];
-extern const uint8_t TERMINAL_12X16_GREATER[];
-extern const uint8_t TERMINAL_12X16_QUESTION[];
-extern const uint8_t TERMINAL_12X16_AT[];
-extern const uint8_t TERMINAL_12X16_A[];
-extern const uint8_t TERMINAL_12X16_B[];
-extern const uint8_t TERMINAL_12X16_C[];
-extern const uint8_t TERMINAL_12X16_D[];
-extern const uint8_t TERMINAL_12X16_E[];
-extern const uint8_t TERMINAL_12X16_F[];
-extern const uint8_t TERMINAL_12X16_G[];
-extern const uint8_t TERMINAL_12X16_H[];
-extern const uint8_t TERMINAL_12X16_I[];
-extern const uint8_t TERMINAL_12X16_J[];
-extern const uint8_t TERMINAL_12X16_K[];
-extern const uint8_t TERMINAL_12X16_L[];
-extern const uint8_t TERMINAL_12X16_M[];
-extern const uint8_t TERMINAL_12X16_N[];
-extern const uint8_t TERMINAL_12X16_O[];
-extern const uint8_t TERMINAL_12X16_P[];
-extern const uint8_t TERMINAL_12X16_Q[];
-extern const uint8_t TERMINAL_12X16_R[];
-extern const uint8_t TERMINAL_12X16_S[];
-extern const uint8_t TERMINAL_12X16_T[];
-extern const uint8_t TERMINAL_12X16_U[];
-extern const uint8_t TERMINAL_12X16_V[];
-extern const uint8_t TERMINAL_12X16_W[];
-extern const uint8_t TERMINAL_12X16_X[];
-extern const uint8_t TERMINAL_12X16_Y[];
-extern const uint8_t TERMINAL_12X16_Z[];
-extern const uint8_t TERMINAL_12X16_OPENBRACKET[];
-extern const uint8_t TERMINAL_12X16_BACKSLASH[];
-extern const uint8_t TERMINAL_12X16_CLOSEDBRACKET[];
-extern const uint8_t TERMINAL_12X16_CARET[];
-extern const uint8_t TERMINAL_12X16_UNDERSCORE[];
-extern const uint8_t TERMINAL_12X16_GRAVE[];
-extern const uint8_t TERMINAL_12X16_a[];
-extern const uint8_t TERMINAL_12X16_b[];
-extern const uint8_t TERMINAL_12X16_c[];
-extern const uint8_t TERMINAL_12X16_d[];
-extern const uint8_t TERMINAL_12X16_e[];
-extern const uint8_t TERMINAL_12X16_f[];
-extern const uint8_t TERMINAL_12X16_g[];
-extern const uint8_t TERMINAL_12X16_h[];
-extern const uint8_t TERMINAL_12X16_i[];
-extern const uint8_t TERMINAL_12X16_j[];
-extern const uint8_t TERMINAL_12X16_k[];
-extern const uint8_t TERMINAL_12X16_l[];
-extern const uint8_t TERMINAL_12X16_m[];
-extern const uint8_t TERMINAL_12X16_n[];
-extern const uint8_t TERMINAL_12X16_o[];
-extern const uint8_t TERMINAL_12X16_p[];
-extern const uint8_t TERMINAL_12X16_q[];
-extern const uint8_t TERMINAL_12X16_r[];
-extern const uint8_t TERMINAL_12X16_s[];
-extern const uint8_t TERMINAL_12X16_t[];
-extern const uint8_t TERMINAL_12X16_u[];
-extern const uint8_t TERMINAL_12X16_v[];
-extern const uint8_t TERMINAL_12X16_w[];
-extern const uint8_t TERMINAL_12X16_x[];
-extern const uint8_t TERMINAL_12X16_y[];
-extern const uint8_t TERMINAL_12X16_z[];
-extern const uint8_t TERMINAL_12X16_OPENBRACE[];
-extern const uint8_t TERMINAL_12X16_VERTBAR[];
-extern const uint8_t TERMINAL_12X16_CLOSEDBRACE[];
-extern const uint8_t TERMINAL_12X16_TILDE[];
+// Font descriptor: glyphs of a font are held contiguously in an atlas, in
+// order of character code from first thru last, optionally followed by glyphs
+// for a second run of codes extFirst thru extLast (e.g. ENVELOPE_LEFT_CHAR).
+// Plain glyphs (index NULL) are (width * height) bytes, page (row) by page;
+// packed glyphs start at atlas + index[glyph number].
+typedef struct tagFONT
+{
+  uint8_t width;                // columns (bytes) per page
+  uint8_t height;               // pages (rows)
+  uint8_t first;                // code of atlas[0]
+  uint8_t last;                 // code of last glyph in first run
+  uint8_t extFirst;             // code of 1st glyph after 'last' (if any)
+  uint8_t extLast;              // code of last glyph (extFirst > extLast: none)
+  uint8_t fallback;             // atlas index of glyph for codes not in font
+  const uint8_t * atlas;        // glyphs, plain or packed
+  const uint16_t * index;       // NULL, else offset of each packed glyph
+} font_t;
+
+// TERMINAL 6X8 (' ' thru '}', ENVELOPE_LEFT_CHAR, ENVELOPE_RIGHT_CHAR)
+extern const font_t TERMINAL_6X8_FONT;
+
+// TERMINAL 12X16 (' ' thru '~')
+extern const font_t TERMINAL_12X16_FONT;
 
 // BATTERY_18X8
 extern const uint8_t BATTERY_18X8_0[];
@@ -273,24 +123,9 @@ extern const uint8_t BATTERY_18X8_9[];
 extern const uint8_t BATTERY_18X8_10[];
 extern const uint8_t BATTERY_18X8_11[];
 
-// VERDANA 34X56
-extern const uint8_t VERDANA_34X56_SPACE[];
-extern const uint8_t VERDANA_34X56_0[];
-extern const uint8_t VERDANA_34X56_1[];
-extern const uint8_t VERDANA_34X56_2[];
-extern const uint8_t VERDANA_34X56_3[];
-extern const uint8_t VERDANA_34X56_4[];
-extern const uint8_t VERDANA_34X56_5[];
-extern const uint8_t VERDANA_34X56_6[];
-extern const uint8_t VERDANA_34X56_7[];
-extern const uint8_t VERDANA_34X56_8[];
-extern const uint8_t VERDANA_34X56_9[];
+// VERDANA 34X56 ('0' thru '9', ' ')
+extern const font_t VERDANA_34X56_FONT;
 // NRS 20160811: Colon, semicolon, less-than, equals, and greater-than are not
 // needed in the program right now.  Save program space by not defining them.
-//extern const uint8_t VERDANA_34X56_COLON[];
-//extern const uint8_t VERDANA_34X56_SEMICOLON[];
-//extern const uint8_t VERDANA_34X56_LESS[];
-//extern const uint8_t VERDANA_34X56_EQUALS[];
-//extern const uint8_t VERDANA_34X56_GREATER[];
 
 #endif /* FONTS_H */
@@ -0,0 +1,517 @@
+#ifndef FONTS_RLE_H
+#define FONTS_RLE_H
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : fonts_rle.h
+ *
+ *  DESCRIPTION   : Packed TERMINAL 12X16 and VERDANA 34X56 glyphs (format in
+ *    fonts.h) and offset of each glyph, included by fonts.c when FONTS_USE_RLE
+ *    is 1.  GENERATED by host/fontrle.c from the plain glyphs in fonts.c, do
+ *    not edit; run "make -f host/Makefile fonts" after changing those.
+ *
+ *    TERMINAL 12X16 :  95 glyphs, 2280 plain bytes packed in 1791 + 190 index
+ *    VERDANA 34X56  :  11 glyphs, 2618 plain bytes packed in  853 +  22 index
+ */
+#include <stdint.h>
+
+// TERMINAL 12X16: offset of each glyph in TERMINAL_12X16_RLE[]
+static const uint16_t TERMINAL_12X16_RLE_INDEX[] =
+{
+     0,   // 0x20
+     2,   // '!'
+    14,   // '"'
+    24,   // '#'
+    48,   // '$'
+    70,   // '%'
+    93,   // '&'
+   114,   // 0x27
+   121,   // '('
+   139,   // ')'
+   157,   // '*'
+   179,   // '+'
+   197,   // ','
+   204,   // '-'
+   212,   // '.'
+   217,   // '/'
+   235,   // '0'
+   261,   // '1'
+   278,   // '2'
+   302,   // '3'
+   324,   // '4'
+   344,   // '5'
+   365,   // '6'
+   389,   // '7'
+   405,   // '8'
+   428,   // '9'
+   449,   // ':'
+   457,   // ';'
+   467,   // '<'
+   488,   // '='
+   496,   // '>'
+   517,   // '?'
+   535,   // '@'
+   561,   // 'A'
+   582,   // 'B'
+   604,   // 'C'
+   630,   // 'D'
+   654,   // 'E'
+   671,   // 'F'
+   686,   // 'G'
+   711,   // 'H'
+   730,   // 'I'
+   748,   // 'J'
+   765,   // 'K'
+   792,   // 'L'
+   804,   // 'M'
+   830,   // 'N'
+   855,   // 'O'
+   881,   // 'P'
+   899,   // 'Q'
+   925,   // 'R'
+   949,   // 'S'
+   973,   // 'T'
+   987,   // 'U'
+  1008,   // 'V'
+  1030,   // 'W'
+  1056,   // 'X'
+  1082,   // 'Y'
+  1100,   // 'Z'
+  1121,   // '['
+  1135,   // 0x5C
+  1153,   // ']'
+  1167,   // '^'
+  1181,   // '_'
+  1185,   // '`'
+  1192,   // 'a'
+  1211,   // 'b'
+  1234,   // 'c'
+  1256,   // 'd'
+  1280,   // 'e'
+  1302,   // 'f'
+  1318,   // 'g'
+  1341,   // 'h'
+  1362,   // 'i'
+  1377,   // 'j'
+  1392,   // 'k'
+  1414,   // 'l'
+  1429,   // 'm'
+  1455,   // 'n'
+  1475,   // 'o'
+  1499,   // 'p'
+  1522,   // 'q'
+  1545,   // 'r'
+  1561,   // 's'
+  1579,   // 't'
+  1595,   // 'u'
+  1616,   // 'v'
+  1638,   // 'w'
+  1664,   // 'x'
+  1689,   // 'y'
+  1709,   // 'z'
+  1729,   // '{'
+  1748,   // '|'
+  1758,   // '}'
+  1777    // '~'
+};
+
+// TERMINAL 12X16: packed glyphs
+static const uint8_t TERMINAL_12X16_RLE[] =
+{
+  // 0x20
+  0x0B, 0x0B,
+  // '!'
+  0x03, 0x83, 0x7C, 0xFF, 0xFF, 0x7C, 0x03, 0x04, 0x81, 0x33, 0x33, 0x04,
+  // '"'
+  0x02, 0x81, 0x3C, 0x3C, 0x01, 0x81, 0x3C, 0x3C, 0x02, 0x0B,
+  // '#'
+  0x01, 0x89, 0x10, 0x90, 0xF0, 0x7E, 0x1E, 0x90, 0xF0, 0x7E, 0x1E, 0x10,
+  0x00, 0x88, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x1E, 0x1F, 0x03, 0x02, 0x01,
+  // '$'
+  0x01, 0x87, 0x78, 0xFC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x88, 0x01, 0x01,
+  0x87, 0x04, 0x0C, 0x0C, 0x3F, 0x3F, 0x0C, 0x0F, 0x07, 0x01,
+  // '%'
+  0x01, 0x42, 0x38, 0x00, 0x85, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x00,
+  0x86, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x42, 0x38, 0x00,
+  // '&'
+  0x02, 0x85, 0xB8, 0xFC, 0xC6, 0xE2, 0x3E, 0x1C, 0x02, 0x01, 0x88, 0x1F,
+  0x3F, 0x31, 0x21, 0x37, 0x1E, 0x1C, 0x36, 0x22, 0x00,
+  // 0x27
+  0x03, 0x82, 0x27, 0x3F, 0x1F, 0x04, 0x0B,
+  // '('
+  0x02, 0x85, 0xF0, 0xFC, 0xFE, 0x07, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03,
+  0x0F, 0x1F, 0x38, 0x20, 0x20, 0x02,
+  // ')'
+  0x02, 0x85, 0x01, 0x01, 0x07, 0xFE, 0xFC, 0xF0, 0x02, 0x02, 0x85, 0x20,
+  0x20, 0x38, 0x1F, 0x0F, 0x03, 0x02,
+  // '*'
+  0x01, 0x87, 0x98, 0xB8, 0xE0, 0xF8, 0xF8, 0xE0, 0xB8, 0x98, 0x01, 0x01,
+  0x87, 0x0C, 0x0E, 0x03, 0x0F, 0x0F, 0x03, 0x0E, 0x0C, 0x01,
+  // '+'
+  0x01, 0x42, 0x80, 0x81, 0xF0, 0xF0, 0x42, 0x80, 0x01, 0x01, 0x42, 0x01,
+  0x81, 0x0F, 0x0F, 0x42, 0x01, 0x01,
+  // ','
+  0x0B, 0x03, 0x82, 0xB8, 0xF8, 0x78, 0x04,
+  // '-'
+  0x01, 0x47, 0x80, 0x01, 0x01, 0x47, 0x01, 0x01,
+  // '.'
+  0x0B, 0x03, 0x42, 0x38, 0x04,
+  // '/'
+  0x04, 0x86, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x85, 0x18,
+  0x1C, 0x0E, 0x07, 0x03, 0x01, 0x04,
+  // '0'
+  0x00, 0x8A, 0xF8, 0xFE, 0x06, 0x03, 0x83, 0xC3, 0x63, 0x33, 0x1E, 0xFE,
+  0xF8, 0x00, 0x84, 0x07, 0x1F, 0x1E, 0x33, 0x31, 0x42, 0x30, 0x82, 0x18,
+  0x1F, 0x07,
+  // '1'
+  0x02, 0x84, 0x0C, 0x0C, 0x0E, 0xFF, 0xFF, 0x03, 0x02, 0x42, 0x30, 0x81,
+  0x3F, 0x3F, 0x42, 0x30, 0x00,
+  // '2'
+  0x00, 0x8A, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E,
+  0x1C, 0x00, 0x86, 0x30, 0x38, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x43, 0x30,
+  // '3'
+  0x00, 0x82, 0x0C, 0x0E, 0x07, 0x44, 0xC3, 0x82, 0xE7, 0x7E, 0x3C, 0x00,
+  0x82, 0x0C, 0x1C, 0x38, 0x44, 0x30, 0x82, 0x39, 0x1F, 0x0E,
+  // '4'
+  0x00, 0x88, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0xFF, 0xFF, 0x01,
+  0x00, 0x46, 0x03, 0x83, 0x3F, 0x3F, 0x03, 0x03,
+  // '5'
+  0x00, 0x81, 0x3F, 0x7F, 0x45, 0x63, 0x82, 0xE3, 0xC3, 0x83, 0x00, 0x82,
+  0x0C, 0x1C, 0x38, 0x44, 0x30, 0x82, 0x38, 0x1F, 0x0F,
+  // '6'
+  0x00, 0x85, 0xC0, 0xF0, 0xF8, 0xDC, 0xCE, 0xC7, 0x42, 0xC3, 0x80, 0x80,
+  0x00, 0x00, 0x82, 0x0F, 0x1F, 0x39, 0x44, 0x30, 0x82, 0x39, 0x1F, 0x0F,
+  // '7'
+  0x00, 0x45, 0x03, 0x84, 0xC3, 0xF3, 0x3F, 0x0F, 0x03, 0x03, 0x83, 0x30,
+  0x3C, 0x0F, 0x03, 0x03,
+  // '8'
+  0x01, 0x82, 0xBC, 0xFE, 0xE7, 0x42, 0xC3, 0x82, 0xE7, 0xFE, 0xBC, 0x00,
+  0x00, 0x82, 0x0F, 0x1F, 0x39, 0x44, 0x30, 0x82, 0x39, 0x1F, 0x0F,
+  // '9'
+  0x00, 0x82, 0x3C, 0x7E, 0xE7, 0x44, 0xC3, 0x82, 0xE7, 0xFE, 0xFC, 0x02,
+  0x42, 0x30, 0x84, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00,
+  // ':'
+  0x03, 0x42, 0x70, 0x04, 0x03, 0x42, 0x1C, 0x04,
+  // ';'
+  0x03, 0x42, 0x70, 0x04, 0x03, 0x82, 0x9C, 0xFC, 0x7C, 0x04,
+  // '<'
+  0x01, 0x87, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x02,
+  0x86, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x01,
+  // '='
+  0x01, 0x48, 0x60, 0x00, 0x01, 0x48, 0x06, 0x00,
+  // '>'
+  0x01, 0x87, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x01, 0x01,
+  0x86, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x02,
+  // '?'
+  0x00, 0x89, 0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC3, 0xE3, 0x77, 0x3E, 0x1C,
+  0x00, 0x04, 0x81, 0x37, 0x37, 0x04,
+  // '@'
+  0x00, 0x8A, 0xF8, 0xFE, 0x07, 0xF3, 0xFB, 0x1B, 0xFB, 0xFB, 0x07, 0xFE,
+  0xF8, 0x00, 0x8A, 0x0F, 0x1F, 0x18, 0x33, 0x37, 0x36, 0x37, 0x37, 0x36,
+  0x03, 0x01,
+  // 'A'
+  0x02, 0x85, 0xE0, 0xFC, 0x1F, 0x1F, 0xFC, 0xE0, 0x02, 0x00, 0x82, 0x38,
+  0x3F, 0x07, 0x43, 0x06, 0x82, 0x07, 0x3F, 0x38, 0x00,
+  // 'B'
+  0x00, 0x81, 0xFF, 0xFF, 0x43, 0xC3, 0x82, 0xE7, 0xFE, 0xBC, 0x01, 0x00,
+  0x81, 0x3F, 0x3F, 0x44, 0x30, 0x82, 0x39, 0x1F, 0x0F, 0x00,
+  // 'C'
+  0x00, 0x83, 0xF0, 0xFC, 0x0E, 0x07, 0x42, 0x03, 0x82, 0x07, 0x0E, 0x0C,
+  0x00, 0x00, 0x83, 0x03, 0x0F, 0x1C, 0x38, 0x42, 0x30, 0x82, 0x38, 0x1C,
+  0x0C, 0x00,
+  // 'D'
+  0x00, 0x81, 0xFF, 0xFF, 0x43, 0x03, 0x83, 0x07, 0x0E, 0xFC, 0xF0, 0x00,
+  0x00, 0x81, 0x3F, 0x3F, 0x43, 0x30, 0x83, 0x38, 0x1C, 0x0F, 0x03, 0x00,
+  // 'E'
+  0x00, 0x81, 0xFF, 0xFF, 0x45, 0xC3, 0x81, 0x03, 0x03, 0x00, 0x00, 0x81,
+  0x3F, 0x3F, 0x47, 0x30, 0x00,
+  // 'F'
+  0x00, 0x81, 0xFF, 0xFF, 0x45, 0xC3, 0x81, 0x03, 0x03, 0x00, 0x00, 0x81,
+  0x3F, 0x3F, 0x08,
+  // 'G'
+  0x00, 0x84, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x42, 0xC3, 0x81, 0xC7, 0xC6,
+  0x00, 0x00, 0x83, 0x03, 0x0F, 0x1C, 0x38, 0x43, 0x30, 0x81, 0x3F, 0x3F,
+  0x00,
+  // 'H'
+  0x00, 0x81, 0xFF, 0xFF, 0x45, 0xC0, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x81,
+  0x3F, 0x3F, 0x05, 0x81, 0x3F, 0x3F, 0x00,
+  // 'I'
+  0x02, 0x85, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x02, 0x02, 0x85, 0x30,
+  0x30, 0x3F, 0x3F, 0x30, 0x30, 0x02,
+  // 'J'
+  0x08, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x82, 0x0E, 0x1E, 0x38, 0x43, 0x30,
+  0x82, 0x38, 0x1F, 0x07, 0x00,
+  // 'K'
+  0x00, 0x89, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+  0x00, 0x00, 0x81, 0x3F, 0x3F, 0x00, 0x86, 0x01, 0x03, 0x07, 0x0E, 0x1C,
+  0x38, 0x30, 0x00,
+  // 'L'
+  0x00, 0x81, 0xFF, 0xFF, 0x08, 0x00, 0x81, 0x3F, 0x3F, 0x47, 0x30, 0x00,
+  // 'M'
+  0x00, 0x89, 0xFF, 0xFF, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E, 0xFF, 0xFF,
+  0x00, 0x00, 0x81, 0x3F, 0x3F, 0x01, 0x81, 0x01, 0x01, 0x01, 0x81, 0x3F,
+  0x3F, 0x00,
+  // 'N'
+  0x00, 0x85, 0xFF, 0xFF, 0x0E, 0x38, 0xF0, 0xC0, 0x01, 0x81, 0xFF, 0xFF,
+  0x00, 0x00, 0x81, 0x3F, 0x3F, 0x02, 0x84, 0x03, 0x07, 0x1C, 0x3F, 0x3F,
+  0x00,
+  // 'O'
+  0x00, 0x89, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0,
+  0x00, 0x00, 0x89, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1C, 0x0F,
+  0x03, 0x00,
+  // 'P'
+  0x00, 0x81, 0xFF, 0xFF, 0x44, 0x83, 0x82, 0xC7, 0xFE, 0x7C, 0x00, 0x00,
+  0x81, 0x3F, 0x3F, 0x45, 0x01, 0x02,
+  // 'Q'
+  0x00, 0x89, 0xF0, 0xFC, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0xFC, 0xF0,
+  0x00, 0x00, 0x89, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x36, 0x3E, 0x1C, 0x3F,
+  0x33, 0x00,
+  // 'R'
+  0x00, 0x81, 0xFF, 0xFF, 0x44, 0x83, 0x82, 0xC7, 0xFE, 0x7C, 0x00, 0x00,
+  0x89, 0x3F, 0x3F, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00,
+  // 'S'
+  0x00, 0x82, 0x3C, 0x7E, 0xE7, 0x43, 0xC3, 0x82, 0xC7, 0x8E, 0x0C, 0x00,
+  0x00, 0x82, 0x0C, 0x1C, 0x38, 0x43, 0x30, 0x82, 0x39, 0x1F, 0x0F, 0x00,
+  // 'T'
+  0x01, 0x42, 0x03, 0x81, 0xFF, 0xFF, 0x42, 0x03, 0x01, 0x04, 0x81, 0x3F,
+  0x3F, 0x04,
+  // 'U'
+  0x00, 0x81, 0xFF, 0xFF, 0x05, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x82, 0x07,
+  0x1F, 0x38, 0x43, 0x30, 0x82, 0x38, 0x1F, 0x07, 0x00,
+  // 'V'
+  0x00, 0x83, 0x07, 0x3F, 0xF8, 0xC0, 0x01, 0x83, 0xC0, 0xF8, 0x3F, 0x07,
+  0x00, 0x02, 0x85, 0x01, 0x0F, 0x3E, 0x3E, 0x0F, 0x01, 0x02,
+  // 'W'
+  0x00, 0x81, 0xFF, 0xFF, 0x01, 0x81, 0x80, 0x80, 0x01, 0x81, 0xFF, 0xFF,
+  0x00, 0x00, 0x89, 0x3F, 0x3F, 0x1C, 0x06, 0x03, 0x03, 0x06, 0x1C, 0x3F,
+  0x3F, 0x00,
+  // 'X'
+  0x00, 0x89, 0x03, 0x0F, 0x1C, 0x30, 0xE0, 0xE0, 0x30, 0x1C, 0x0F, 0x03,
+  0x00, 0x00, 0x89, 0x30, 0x3C, 0x0E, 0x03, 0x01, 0x01, 0x03, 0x0E, 0x3C,
+  0x30, 0x00,
+  // 'Y'
+  0x00, 0x89, 0x03, 0x0F, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0x00, 0x04, 0x81, 0x3F, 0x3F, 0x04,
+  // 'Z'
+  0x00, 0x43, 0x03, 0x85, 0xC3, 0xE3, 0x33, 0x1F, 0x0F, 0x03, 0x00, 0x00,
+  0x84, 0x30, 0x3C, 0x3E, 0x33, 0x31, 0x44, 0x30, 0x00,
+  // '['
+  0x02, 0x81, 0xFF, 0xFF, 0x43, 0x03, 0x02, 0x02, 0x81, 0x3F, 0x3F, 0x43,
+  0x30, 0x02,
+  // 0x5C
+  0x00, 0x86, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x03, 0x05, 0x85,
+  0x01, 0x03, 0x07, 0x0E, 0x1C, 0x18,
+  // ']'
+  0x02, 0x43, 0x03, 0x81, 0xFF, 0xFF, 0x02, 0x02, 0x43, 0x30, 0x81, 0x3F,
+  0x3F, 0x02,
+  // '^'
+  0x00, 0x8A, 0x60, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x0E, 0x1C, 0x38, 0x70,
+  0x60, 0x0B,
+  // '_'
+  0x0B, 0x00, 0x4A, 0xC0,
+  // '`'
+  0x04, 0x82, 0x3E, 0x7E, 0x4E, 0x03, 0x0B,
+  // 'a'
+  0x01, 0x80, 0x40, 0x45, 0x60, 0x81, 0xE0, 0xC0, 0x00, 0x00, 0x81, 0x1C,
+  0x3E, 0x45, 0x33, 0x81, 0x3F, 0x3F, 0x00,
+  // 'b'
+  0x00, 0x82, 0xFF, 0xFF, 0xC0, 0x43, 0x60, 0x82, 0xE0, 0xC0, 0x80, 0x00,
+  0x00, 0x81, 0x3F, 0x3F, 0x44, 0x30, 0x82, 0x38, 0x1F, 0x0F, 0x00,
+  // 'c'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x44, 0x60, 0x81, 0xC0, 0x80, 0x00, 0x00,
+  0x82, 0x0F, 0x1F, 0x38, 0x44, 0x30, 0x81, 0x18, 0x08, 0x00,
+  // 'd'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x42, 0x60, 0x83, 0xE0, 0xC0, 0xFF, 0xFF,
+  0x00, 0x00, 0x82, 0x0F, 0x1F, 0x38, 0x44, 0x30, 0x81, 0x3F, 0x3F, 0x00,
+  // 'e'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x44, 0x60, 0x81, 0xC0, 0x80, 0x00, 0x00,
+  0x82, 0x0F, 0x1F, 0x3B, 0x44, 0x33, 0x81, 0x13, 0x01, 0x00,
+  // 'f'
+  0x00, 0x87, 0xC0, 0xC0, 0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0x03, 0x02, 0x02,
+  0x81, 0x3F, 0x3F, 0x06,
+  // 'g'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x44, 0x60, 0x81, 0xE0, 0xE0, 0x00, 0x00,
+  0x82, 0x03, 0xC7, 0xCE, 0x43, 0xCC, 0x82, 0xE6, 0x7F, 0x3F, 0x00,
+  // 'h'
+  0x00, 0x82, 0xFF, 0xFF, 0xC0, 0x42, 0x60, 0x82, 0xE0, 0xC0, 0x80, 0x01,
+  0x00, 0x81, 0x3F, 0x3F, 0x04, 0x81, 0x3F, 0x3F, 0x01,
+  // 'i'
+  0x03, 0x82, 0x60, 0xEC, 0xEC, 0x04, 0x02, 0x85, 0x30, 0x30, 0x3F, 0x3F,
+  0x30, 0x30, 0x02,
+  // 'j'
+  0x05, 0x82, 0x60, 0xEC, 0xEC, 0x02, 0x02, 0x85, 0x60, 0xE0, 0xC0, 0xC0,
+  0xFF, 0x7F, 0x02,
+  // 'k'
+  0x01, 0x81, 0xFF, 0xFF, 0x00, 0x83, 0x80, 0xC0, 0xE0, 0x60, 0x02, 0x01,
+  0x87, 0x3F, 0x3F, 0x03, 0x07, 0x0F, 0x1C, 0x38, 0x30, 0x01,
+  // 'l'
+  0x03, 0x82, 0x03, 0xFF, 0xFF, 0x04, 0x02, 0x85, 0x30, 0x30, 0x3F, 0x3F,
+  0x30, 0x30, 0x02,
+  // 'm'
+  0x00, 0x89, 0xE0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x80,
+  0x00, 0x00, 0x81, 0x3F, 0x3F, 0x01, 0x81, 0x3F, 0x3F, 0x01, 0x81, 0x3F,
+  0x3F, 0x00,
+  // 'n'
+  0x01, 0x81, 0xE0, 0xE0, 0x43, 0x60, 0x82, 0xE0, 0xC0, 0x80, 0x00, 0x01,
+  0x81, 0x3F, 0x3F, 0x04, 0x81, 0x3F, 0x3F, 0x00,
+  // 'o'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x43, 0x60, 0x82, 0xE0, 0xC0, 0x80, 0x00,
+  0x00, 0x82, 0x0F, 0x1F, 0x38, 0x43, 0x30, 0x82, 0x38, 0x1F, 0x0F, 0x00,
+  // 'p'
+  0x00, 0x81, 0xE0, 0xE0, 0x44, 0x60, 0x82, 0xE0, 0xC0, 0x80, 0x00, 0x00,
+  0x82, 0xFF, 0xFF, 0x0C, 0x43, 0x18, 0x82, 0x1C, 0x0F, 0x07, 0x00,
+  // 'q'
+  0x00, 0x82, 0x80, 0xC0, 0xE0, 0x44, 0x60, 0x81, 0xE0, 0xE0, 0x00, 0x00,
+  0x82, 0x07, 0x0F, 0x1C, 0x43, 0x18, 0x82, 0x0C, 0xFF, 0xFF, 0x00,
+  // 'r'
+  0x01, 0x82, 0xE0, 0xE0, 0xC0, 0x43, 0x60, 0x81, 0xE0, 0xC0, 0x00, 0x01,
+  0x81, 0x3F, 0x3F, 0x07,
+  // 's'
+  0x00, 0x81, 0xC0, 0xE0, 0x44, 0x60, 0x80, 0x40, 0x02, 0x00, 0x80, 0x11,
+  0x44, 0x33, 0x81, 0x3F, 0x1E, 0x02,
+  // 't'
+  0x00, 0x83, 0x60, 0x60, 0xFE, 0xFE, 0x42, 0x60, 0x03, 0x02, 0x81, 0x1F,
+  0x3F, 0x43, 0x30, 0x02,
+  // 'u'
+  0x00, 0x81, 0xE0, 0xE0, 0x05, 0x81, 0xE0, 0xE0, 0x00, 0x00, 0x82, 0x0F,
+  0x1F, 0x38, 0x43, 0x30, 0x82, 0x18, 0x3F, 0x3F, 0x00,
+  // 'v'
+  0x00, 0x82, 0x60, 0xE0, 0x80, 0x03, 0x82, 0x80, 0xE0, 0x60, 0x00, 0x01,
+  0x87, 0x01, 0x07, 0x1E, 0x38, 0x38, 0x1E, 0x07, 0x01, 0x01,
+  // 'w'
+  0x00, 0x81, 0xE0, 0xE0, 0x01, 0x81, 0xE0, 0xE0, 0x01, 0x81, 0xE0, 0xE0,
+  0x00, 0x00, 0x89, 0x07, 0x1F, 0x38, 0x1C, 0x0F, 0x0F, 0x1C, 0x38, 0x1F,
+  0x07, 0x00,
+  // 'x'
+  0x00, 0x83, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x83, 0x80, 0xC0, 0xE0, 0x60,
+  0x01, 0x00, 0x88, 0x30, 0x38, 0x1D, 0x0F, 0x07, 0x0F, 0x1D, 0x38, 0x30,
+  0x01,
+  // 'y'
+  0x01, 0x82, 0x60, 0xE0, 0x80, 0x01, 0x82, 0x80, 0xE0, 0x60, 0x01, 0x02,
+  0x85, 0x81, 0xE7, 0x7E, 0x1E, 0x07, 0x01, 0x02,
+  // 'z'
+  0x00, 0x44, 0x60, 0x83, 0xE0, 0xE0, 0x60, 0x20, 0x01, 0x00, 0x85, 0x30,
+  0x38, 0x3C, 0x36, 0x33, 0x31, 0x42, 0x30, 0x01,
+  // '{'
+  0x01, 0x84, 0x80, 0xC0, 0xFC, 0x7E, 0x07, 0x42, 0x03, 0x01, 0x02, 0x83,
+  0x01, 0x1F, 0x3F, 0x70, 0x42, 0x60, 0x01,
+  // '|'
+  0x04, 0x81, 0xFF, 0xFF, 0x04, 0x04, 0x81, 0x3F, 0x3F, 0x04,
+  // '}'
+  0x01, 0x42, 0x03, 0x84, 0x07, 0x7E, 0xFC, 0xC0, 0x80, 0x01, 0x01, 0x42,
+  0x60, 0x83, 0x70, 0x3F, 0x1F, 0x01, 0x02,
+  // '~'
+  0x00, 0x89, 0x10, 0x18, 0x0C, 0x04, 0x0C, 0x18, 0x10, 0x18, 0x0C, 0x04,
+  0x00, 0x0B
+};
+
+// VERDANA 34X56: offset of each glyph in VERDANA_34X56_RLE[]
+static const uint16_t VERDANA_34X56_RLE_INDEX[] =
+{
+     0,   // '0'
+    98,   // '1'
+   134,   // '2'
+   214,   // '3'
+   309,   // '4'
+   373,   // '5'
+   446,   // '6'
+   553,   // '7'
+   618,   // '8'
+   746,   // '9'
+   846    // 0x20
+};
+
+// VERDANA 34X56: packed glyphs
+static const uint8_t VERDANA_34X56_RLE[] =
+{
+  // '0'
+  0x0A, 0x81, 0x80, 0x80, 0x47, 0xC0, 0x81, 0x80, 0x80, 0x0A, 0x04, 0x88,
+  0x80, 0xF0, 0xFC, 0xFE, 0xFF, 0x3F, 0x1F, 0x07, 0x07, 0x45, 0x03, 0x88,
+  0x07, 0x07, 0x1F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF0, 0x80, 0x04, 0x03, 0x80,
+  0xF8, 0x43, 0xFF, 0x80, 0x03, 0x0D, 0x80, 0x03, 0x43, 0xFF, 0x80, 0xF8,
+  0x03, 0x03, 0x44, 0xFF, 0x0F, 0x44, 0xFF, 0x03, 0x03, 0x81, 0x03, 0x3F,
+  0x42, 0xFF, 0x81, 0xF8, 0x80, 0x0B, 0x81, 0x80, 0xF8, 0x42, 0xFF, 0x81,
+  0x3F, 0x03, 0x03, 0x05, 0x87, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3E, 0x3C,
+  0x7C, 0x45, 0x78, 0x87, 0x7C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x01,
+  0x05, 0x21,
+  // '1'
+  0x0F, 0x43, 0x80, 0x0D, 0x06, 0x44, 0xF0, 0x83, 0xF8, 0xF8, 0xFC, 0xFE,
+  0x43, 0xFF, 0x0D, 0x0E, 0x44, 0xFF, 0x0D, 0x0E, 0x44, 0xFF, 0x0D, 0x0E,
+  0x44, 0xFF, 0x0D, 0x06, 0x47, 0x3C, 0x44, 0x3F, 0x47, 0x3C, 0x05, 0x21,
+  // '2'
+  0x06, 0x43, 0x80, 0x48, 0xC0, 0x42, 0x80, 0x0A, 0x04, 0x83, 0x3F, 0x1F,
+  0x0F, 0x0F, 0x42, 0x07, 0x46, 0x03, 0x88, 0x07, 0x07, 0x0F, 0x3F, 0xFF,
+  0xFE, 0xFC, 0xF8, 0xE0, 0x05, 0x14, 0x81, 0x80, 0xF0, 0x43, 0xFF, 0x80,
+  0x1F, 0x05, 0x0D, 0x8B, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7F, 0x3F,
+  0x1F, 0x0F, 0x07, 0x01, 0x07, 0x05, 0x8C, 0x80, 0xC0, 0xE0, 0xF0, 0xF8,
+  0xFC, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x0E, 0x03, 0x80, 0x3E,
+  0x44, 0x3F, 0x80, 0x3D, 0x52, 0x3C, 0x03, 0x21,
+  // '3'
+  0x06, 0x43, 0x80, 0x49, 0xC0, 0x42, 0x80, 0x09, 0x04, 0x86, 0x3F, 0x1F,
+  0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x47, 0x03, 0x88, 0x07, 0x07, 0x0F, 0x1F,
+  0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0x04, 0x0C, 0x45, 0x80, 0x89, 0xC0, 0xC0,
+  0xE0, 0xF0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x07, 0x04, 0x0C, 0x46, 0x07,
+  0x89, 0x0F, 0x0E, 0x1E, 0x3E, 0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x03,
+  0x03, 0x80, 0x80, 0x12, 0x80, 0xC0, 0x43, 0xFF, 0x80, 0x3F, 0x03, 0x03,
+  0x42, 0x1F, 0x84, 0x3E, 0x3E, 0x3C, 0x3C, 0x7C, 0x46, 0x78, 0x89, 0x7C,
+  0x3C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x04, 0x21,
+  // '4'
+  0x13, 0x44, 0x80, 0x08, 0x0C, 0x86, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x7E,
+  0x3F, 0x44, 0xFF, 0x08, 0x06, 0x8A, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7F,
+  0x1F, 0x0F, 0x07, 0x03, 0x01, 0x01, 0x44, 0xFF, 0x08, 0x01, 0x88, 0xF0,
+  0xF8, 0xFC, 0xFE, 0xBF, 0x9F, 0x87, 0x83, 0x81, 0x48, 0x80, 0x44, 0xFF,
+  0x45, 0x80, 0x02, 0x01, 0x51, 0x07, 0x44, 0xFF, 0x45, 0x07, 0x02, 0x13,
+  0x44, 0x3F, 0x08, 0x21,
+  // '5'
+  0x06, 0x56, 0xC0, 0x03, 0x06, 0x44, 0xFF, 0x51, 0x03, 0x03, 0x06, 0x44,
+  0xFF, 0x48, 0xE0, 0x42, 0xC0, 0x81, 0x80, 0x80, 0x07, 0x06, 0x42, 0x03,
+  0x48, 0x01, 0x42, 0x03, 0x87, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFE, 0xF8,
+  0xE0, 0x03, 0x04, 0x80, 0x80, 0x10, 0x81, 0x80, 0xE0, 0x43, 0xFF, 0x80,
+  0x1F, 0x03, 0x04, 0x86, 0x1F, 0x1F, 0x3F, 0x3E, 0x3E, 0x3C, 0x7C, 0x46,
+  0x78, 0x88, 0x7C, 0x3C, 0x3E, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x05,
+  0x21,
+  // '6'
+  0x0E, 0x42, 0x80, 0x48, 0xC0, 0x06, 0x06, 0x8A, 0xC0, 0xF0, 0xF8, 0xFC,
+  0xFE, 0x3E, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x46, 0x03, 0x81, 0x07, 0x07,
+  0x06, 0x03, 0x81, 0xC0, 0xFC, 0x42, 0xFF, 0x81, 0x1F, 0x83, 0x42, 0xC0,
+  0x48, 0xE0, 0x83, 0xC0, 0xC0, 0x80, 0x80, 0x06, 0x03, 0x44, 0xFF, 0x83,
+  0x07, 0x07, 0x03, 0x03, 0x47, 0x01, 0x89, 0x03, 0x03, 0x07, 0x0F, 0x3F,
+  0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x02, 0x03, 0x81, 0x07, 0x3F, 0x42, 0xFF,
+  0x81, 0xF8, 0xC0, 0x0D, 0x80, 0xE0, 0x43, 0xFF, 0x80, 0x1F, 0x02, 0x05,
+  0x88, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3E, 0x3C, 0x7C, 0x45, 0x78,
+  0x87, 0x7C, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x04, 0x21,
+  // '7'
+  0x03, 0x59, 0x80, 0x03, 0x03, 0x52, 0x07, 0x81, 0xC7, 0xE7, 0x42, 0xFF,
+  0x81, 0x7F, 0x1F, 0x03, 0x12, 0x88, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0x7F,
+  0x1F, 0x07, 0x01, 0x05, 0x0E, 0x88, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0x7F,
+  0x1F, 0x07, 0x01, 0x09, 0x09, 0x89, 0x80, 0xE0, 0xF8, 0xFC, 0xFF, 0xFF,
+  0x3F, 0x1F, 0x07, 0x01, 0x0D, 0x06, 0x82, 0x20, 0x38, 0x3E, 0x42, 0x3F,
+  0x81, 0x0F, 0x03, 0x12, 0x21,
+  // '8'
+  0x09, 0x42, 0x80, 0x48, 0xC0, 0x81, 0x80, 0x80, 0x09, 0x03, 0x88, 0xE0,
+  0xF8, 0xFC, 0xFE, 0xFF, 0x3F, 0x0F, 0x07, 0x07, 0x46, 0x03, 0x42, 0x07,
+  0x86, 0x0F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x03, 0x03, 0x88, 0x07,
+  0x1F, 0x3F, 0x7F, 0xFF, 0xFC, 0xF8, 0xF0, 0xE0, 0x42, 0xC0, 0x81, 0x80,
+  0x80, 0x02, 0x88, 0x80, 0xC0, 0xE0, 0xF8, 0xFF, 0x7F, 0x3F, 0x1F, 0x07,
+  0x03, 0x03, 0x87, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x3D, 0x1F, 0x0F, 0x44,
+  0x07, 0x42, 0x0F, 0x89, 0x1F, 0x1F, 0x3F, 0x3F, 0x7D, 0xFC, 0xF8, 0xF0,
+  0xE0, 0xC0, 0x03, 0x02, 0x80, 0x7F, 0x43, 0xFF, 0x80, 0xC0, 0x0F, 0x80,
+  0xC1, 0x43, 0xFF, 0x80, 0x7F, 0x02, 0x03, 0x89, 0x01, 0x03, 0x07, 0x0F,
+  0x1F, 0x1F, 0x3E, 0x3E, 0x7C, 0x7C, 0x46, 0x78, 0x88, 0x3C, 0x3C, 0x3E,
+  0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x03, 0x21,
+  // '9'
+  0x09, 0x81, 0x80, 0x80, 0x47, 0xC0, 0x42, 0x80, 0x0A, 0x03, 0x88, 0xE0,
+  0xF8, 0xFC, 0xFE, 0xFF, 0x1F, 0x0F, 0x07, 0x07, 0x45, 0x03, 0x89, 0x07,
+  0x07, 0x0F, 0x1F, 0x7F, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x04, 0x02, 0x44,
+  0xFF, 0x80, 0x80, 0x0E, 0x80, 0x03, 0x43, 0xFF, 0x80, 0xFC, 0x03, 0x03,
+  0x88, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7C, 0xF8, 0xF8, 0x46, 0xF0,
+  0x84, 0x70, 0x78, 0x78, 0x3C, 0x1C, 0x43, 0xFF, 0x80, 0x7F, 0x03, 0x14,
+  0x87, 0x80, 0xC0, 0xF8, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x04, 0x06, 0x81,
+  0x7C, 0x7C, 0x46, 0x78, 0x42, 0x3C, 0x86, 0x1E, 0x1F, 0x0F, 0x0F, 0x07,
+  0x03, 0x01, 0x07, 0x21,
+  // 0x20
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21
+};
+
+#endif // FONTS_RLE_H
@@ -13,18 +13,107 @@
  *  int16_t lon: 2's complement decimal degrees scaled so lsb = 180/32767 degree
  *  int16_t r2: radius squared in miles, so max radius is 181 miles
  *
- *  NOTE - TestInsideLlUrZone fail when zone both size 180+ degrees of longitude
- *         and crosses the Anti-Meridian (roughly the International Date Line).
+ *  NOTE - TestInsideLlUrZone zone runs east from LL to UR, crossing the Anti-
+ *         Meridian (roughly the International Date Line) when UR lon < LL lon.
  *
- *  NOTE: TestInsidePolygonZone has been seen to fail when PUT is -90,-180
+ *  NOTE - TestInsidePtRadiusZone scales lon miles by cos(mean lat) from table
+ *         COS_Q15[], takes lon difference the short way round, and so works
+ *         at any lat and across the Anti-Meridian, but not over a pole.
  *
- *    //(1) int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
- *    //(2) int16_t TestInsideLlUrZone(geopt16_t p, llurzone16_t z)
+ *  NOTE - TestInsidePolygonZone once noted as failing for PUT -90,-180 is
+ *         exact at every geopt16_t point, -32768 included (host/geocheck.c)
+ *
+ *       *  int32_t LonMilesQ16(int32_t lat)
+ *      (1) int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
+ *      (2) int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z)
  *       *  int32_t TestIsLeft(geopt16_t LP1, geopt16_t LP2, geopt16_t PUT)
  *      (3) int16_t TestInsidePolygonZone(geopt16_t p, const polyzone16_t * z)
+ *      (4) int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+ *                                         const polyslab16_t * s)
+ *       *  int16_t ClampGeo16(int32_t v)
+ *       *  int32_t LonDistance(int16_t lon1, int16_t lon2)
+ *      (5) void    GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox)
+ *      (6) int16_t GeofenceEvaluate(geopt16_t p)
+ *       *  int16_t BoxDistance(geopt16_t p, const llurzone16_t * b)
+ *       *  int16_t EdgeDistance(geopt16_t p, geopt16_t a, geopt16_t b,
+ *                               int16_t best)
+ *       *  int16_t ZoneMargin(geopt16_t p, int16_t i)
+ *      (7) int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin)
+ *      (8) void    GeofenceClearFix(geofix16_t * pFix)
+ *       *  uint16_t SqrtU32(uint32_t n)
+ *       *  void    ScheduleFix(geopt16_t p, geofix16_t * pFix, bool isHeld)
+ *      (9) int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix)
+ *     (10) int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs)
+ *       *  int16_t TestIsBelow32(geopt32_t LP1, geopt32_t LP2, geopt32_t PUT)
+ *     (11) int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z)
+ *
+ *  GEOBOXES[] (geozones.h) holds the bounding box of each zone of GEOZONES[],
+ *  worked out by GeofenceZoneBox() when host/geozonec.c generated the table:
+ *  the least and greatest lat and lon at which the zone's own test can pass.
+ *  For a polygon that's the span of its vertex values, as the winding number
+ *  is 0 beyond them; for a point & radius it's the center +/- radius converted
+ *  by the same factors the test uses; and an LL-UR zone crossing the Anti-
+ *  Meridian spans all longitudes.  Boxes are in the same raw geopt16_t values
+ *  the tests use, so filtering by box never changes a result, it only saves
+ *  the test.
+ *
+ *  GEOSLABS[] (geozones_slab.h) holds the slab index of each polygon zone of
+ *  GEOZONES[] with GEOSLAB_MIN_EDGES or more edges, otherwise NULL.  An edge
+ *  can only count toward the winding number when the point's lon is in its
+ *  lon span, so with the vertex lons as slab bounds each slab lists exactly
+ *  the edges the full walk would have tested, and results are the same.
+ *
+ *  Margins are distances in raw geopt16_t lsbs, lower bounds on the straight
+ *  line (L2) distance to any zone boundary, which is never more than how far
+ *  a fix moved as |dLat| + |dLon|, lons always taken the short way round (a
+ *  track may cross the Anti-Meridian).  So a fix that moved less than the
+ *  margin can't have crossed a boundary and is in the same zones.  A zone's
+ *  margin is the distance to its box when outside the box; inside, a bound on
+ *  the least distance to a polygon's edges (integer math, see EdgeDistance()),
+ *  or to the lat and lon lines of an LL-UR zone, or 0 for a point & radius
+ *  zone (its truncated miles don't give an easy bound).
+ *
+ *  TestInsidePolygonZone32() only asks TestIsBelow32() about edges crossing
+ *  the point's lon, and then only whether the point is below (south of) the
+ *  edge there, which is all the sign of TestIsLeft() was used for.  That's
+ *  settled by compares when the point is outside the edge's lat span; inside
+ *  it, the point is in the edge's box, so its deltas are no bigger than the
+ *  edge's and fit 16 bits when the edge does (GEOPT32_EDGE_MAX), making each
+ *  product a single 16x16 signed multiply (MUL.SS) rather than the __muldi3
+ *  library call of a 64-bit multiply.
  *
  *  WRITTEN BY    : Robert Kirby, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      GeofenceTrack() hysteresis only delays leaving a zone; entering one, or
+ *      moving to another, is taken at once
+ *      ScheduleFix() times by integer math (SqrtU32()), no float in geofence.c
+ *      Lon differences in margins, moves, and fix schedule are taken the short
+ *      way round (LonDistance()), so tracks crossing the Anti-Meridian work
+ *      EdgeDistance() bounds distance to an edge in integer math (cross product
+ *      over an over-estimate of edge length), no float or sqrt() per margin
+ *      GeofenceTrack() estimates velocity between tracked fixes and, bounded by
+ *      GEOFENCE_VMAX and GEOFENCE_AMAX, schedules when a fix could next be past
+ *      the margin (ScheduleFix()); add GeofenceIsDue() to skip fixes till then
+ *      Polygon test -90,-180 failure note dropped, host/geocheck.c sweep is exact
+ *      Bounding boxes are const GEOBOXES[] generated into geozones.h (by
+ *      host/geozonec.c) rather than worked out into RAM, so drop GeofenceInit()
+ *      TestInsidePtRadiusZone() in Q16 integer math w/lon miles by cos(lat)
+ *      from COS_Q15[] rather than 40N or latitude-band LON_FACTORs, lon taken
+ *      the short way round (Anti-Meridian); TestInsideLlUrZone() crosses the
+ *      Anti-Meridian whenever UR lon < LL lon, so also for zones 180+ wide;
+ *      both verified over the full geopt16_t lattice by host/geocheck.c
+ *      Split GeofenceZoneBox() out of GeofenceInit()
+ *      Add TestInsidePolygonZone32() with TestIsBelow32() kernel
+ *      Add GeofenceLocate() giving zone and margin to nearest zone boundary,
+ *      and GeofenceTrack() reusing a decision until a fix moves past its
+ *      margin, with GEOFENCE_HYST hysteresis, plus GeofenceClearFix()
+ *      Add TestInsidePolySlabZone(), used by GeofenceEvaluate() for polygons
+ *      that have a slab index in GEOSLABS[] (geozones_slab.h)
+ *      Add GeofenceInit() and GeofenceEvaluate() to test a point against each
+ *      zone of GEOZONES[], skipping zones whose bounding box excludes it
+ *      Restore TestInsidePtRadiusZone() (40N factors) and TestInsideLlUrZone(),
+ *      the latter with zone passed by reference
  *    2021/06/03, Robert Kirby, NSWC H12
  *      adapted from Asp code base 2019/02/19
  *      Move inline TestIsLeft() from .h to .c (due to compiler differences)
@@ -37,10 +126,60 @@
  *    1. www.softsurfer.com (copyright 2001... may be freely used & modified...)
  */
 #include <xc.h>             // required for Nop();
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>                 // for labs()
 #include "geofence.h"
+#include "geozones.h"               // for GEOZONES[], GEOBOXES[]
+#if (GEOFENCE_USE_SLABS == 1)
+#include "geozones_slab.h"          // for GEOSLABS[]
+#endif
+
+
+//----- MODULE DEFINES ---------------------------------------------------------
+#define PR_LAT_MILES_Q16  (12438L)  // 69.1 miles/deg LAT * 90/32767 deg/lsb
+#define PR_LON_MILES_Q16  (24877L)  // 69.1 miles/deg LON @ equator * 180/32767
+#define PR_RADIUS_MAX     (181)     // miles, as r2 is int16_t
+#define PR_COS_SHIFT      (10)      // COS_Q15[] has entry per 1024 lsbs of lat
+#define PR_COS_MASK       ((1 << PR_COS_SHIFT) - 1)
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+// cos(lat) at lat 0, 1024, 2048, ... 32768 lsbs (0 to 90 degrees), Q15
+static const uint16_t COS_Q15[] =
+{
+  32768, 32729, 32610, 32413, 32138, 31786, 31357, 30852, 30274, 29622,
+  28899, 28106, 27245, 26319, 25330, 24279, 23170, 22005, 20787, 19519,
+  18204, 16845, 15446, 14009, 12539, 11038,  9511,  7961,  6391,  4807,
+   3210,  1606,     0
+};
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int32_t LonMilesQ16(int32_t lat)
+//  Gives miles per lsb of lon at a latitude, as 69.1 miles/deg LON at the
+//  equator times cos(lat), cos linearly interpolated from COS_Q15[].
+//
+//  INPUT : int32_t lat - latitude (geopt16_t scaling), may be a mean of two
+//  OUTPUT: int32_t - miles per lsb of lon, Q16 (65536 = 1 mile)
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t LonMilesQ16(int32_t lat)
+{
+  uint16_t a = (uint16_t)((0 > lat) ? -lat : lat);
+  uint16_t i;
+  uint16_t cosQ15;
+
+  if (a > 32767)  {
+    a = 32767;    }
+  i      = a >> PR_COS_SHIFT;
+  cosQ15 = COS_Q15[i] - (uint16_t)(((uint32_t)(COS_Q15[i] - COS_Q15[i+1]) *
+                                    (a & PR_COS_MASK)) >> PR_COS_SHIFT);
+  return (PR_LON_MILES_Q16 * cosQ15) >> 15;
+} // end function LonMilesQ16
+
 
-/*
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
 //  Performs an approximation check to see if a point is within a geozone
@@ -58,118 +197,74 @@
 //           lat & lon are in 2's complement decimal degrees (S&W are negative)
 //           x = 69.1 * (lat2 - lat1)   [NOTE 69.1 ~= miles/deg LAT]
 //        and
-//           y = 53.0 * (lon2 - lon1)   [NOTE 53.0 ~= miles/deg LON @ 40N]
+//           y = 69.1 * cos((lat1 + lat2) / 2) * (lon2 - lon1)
+//                                      [NOTE miles/deg LON shrinks w/ cos LAT]
+//
+//  lon2 - lon1 is taken the short way round, so zones may cross the Anti-
+//  Meridian.  x and y are worked out in Q16 integer math (16x16 multiplies),
+//  and either one over 181 miles is outside whatever r2 is.
 //
 //  For this application to minimize microprocessor computations compare
 //     r2 to (x*x + y*y) instead of actual distance of radius
 //
+//  NOTE - zone must not reach a pole, where flat earth doesn't hold.
+//
 //  INPUT : geopt16_t pt - the point-under-test
 //          const ptradzone16_t *z - geozone defined by a point & radius
 //  OUTPUT: int16_t - returns 1 if approximately inside zone, otherwise 0
-//  CALLS : none
+//  CALLS : LonMilesQ16
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
-#ifdef ASP_GLOBALSTAR
-//  NOTE - this has been optimized for a particular embedded application focused
-//  about 40N, but is most easily modified to be generic for lat/lon and radius.
 {
-  // modify the following two factors according to data packing & scaling
-  #define LAT_FACTOR   (69.1 *  90.0 / 32767.0)
-  #define LON_FACTOR   (53.0 * 180.0 / 32767.0)
-
-  register int16_t  x, y;               // deltas x & y
-           int32_t d2;                  // distance squared
+  int32_t dLat = labs((int32_t)pt.lat - z->pt.lat);
+  int32_t dLon = labs((int32_t)pt.lon - z->pt.lon);
+  int16_t x, y;                         // delta miles x & y
 
-  x   = (int16_t)(LAT_FACTOR * (pt.lat - z->pt.lat));
-  y   = (int16_t)(LON_FACTOR * (pt.lon - z->pt.lon));
-  d2  = (int32_t)x*x + (int32_t)y*y;
+  if (32767 < dLon)
+  { // Shorter way round is across the Anti-Meridian (+/-32767 is 180)
+    dLon = labs(65534 - dLon);
+  }
+  x = (int16_t)((dLat * PR_LAT_MILES_Q16) >> 16);
+  if (PR_RADIUS_MAX < x)  {
+    return 0;             }
+  y = (int16_t)((dLon *
+                 LonMilesQ16(((int32_t)pt.lat + z->pt.lat) / 2)) >> 16);
+  if (PR_RADIUS_MAX < y)  {
+    return 0;             }
 
-  return (d2  < z->r2 ) ? 1 : 0;
-} // end function TestInsidePtRadiusZone
-#elif NEEDS_TESTING // S latitudes, extreme difLat or difLon, cross lon 180, etc
-{
-  // modify the following two factors according to data packing & scaling
-  #define LAT_FACTOR   (69.1 *  90.0 / 32767.0) // 69.1 miles/deg LAT
-  #define LON_FACTOR80 (12.0 * 180.0 / 32767.0) // miles/deg LON @ 80N
-  #define LON_FACTOR70 (23.6 * 180.0 / 32767.0) // miles/deg LON @ 70N
-  #define LON_FACTOR60 (34.6 * 180.0 / 32767.0) // miles/deg LON @ 60N
-  #define LON_FACTOR50 (44.4 * 180.0 / 32767.0) // miles/deg LON @ 50N
-  #define LON_FACTOR40 (53.0 * 180.0 / 32767.0) // 52.9 miles/deg LON @ 40N
-  #define LON_FACTOR30 (59.8 * 180.0 / 32767.0) // miles/deg LON @ 30N
-  #define LON_FACTOR20 (64.9 * 180.0 / 32767.0) // miles/deg LON @ 20N
-  #define LON_FACTOR10 (68.1 * 180.0 / 32767.0) // miles/deg LON @ 10N
-  #define LON_FACTOREQ (69.0 * 180.0 / 32767.0) // miles/deg LON @ equator
-
-  register int16_t  x, y;               // delta miles x & y
-           int32_t  sumLat;             // sum of latitudes
-           int16_t  difLat;             // difference of latitudes
-           int16_t  difLon;             // difference of longitudes
-           int32_t  d2;                 // distance squared
-
-  difLat = pt.lat - z->pt.lat;
-  difLon = pt.lon - z->pt.lon;
-
-  x = (int16_t)(LAT_FACTOR * difLat);
-
-  sumLat = pt.lat + z->pt.lat;
-  if ((150 < sumLat) || (-150 > sumLat))        { // avg lat > 75
-    y = (int16_t)(LON_FACTOR80 * difLon);       }
-  else if ((130 < sumLat) || (-130 > sumLat))   { // avg lat > 65
-    y = (int16_t)(LON_FACTOR70 * difLon);       }
-  else if ((110 < sumLat) || (-110 > sumLat))   { // avg lat > 55
-    y = (int16_t)(LON_FACTOR60 * difLon);       }
-  else if ((90 < sumLat) || (-90 > sumLat))     { // avg lat > 45
-    y = (int16_t)(LON_FACTOR50 * difLon);       }
-  else if ((70 < sumLat) || (-70 > sumLat))     { // avg lat > 35
-    y = (int16_t)(LON_FACTOR40 * difLon);       }
-  else if ((50 < sumLat) || (-50 > sumLat))     { // avg lat > 25
-    y = (int16_t)(LON_FACTOR30 * difLon);       }
-  else if ((30 < sumLat) || (-30 > sumLat))     { // avg lat > 15
-    y = (int16_t)(LON_FACTOR20 * difLon);       }
-  else if ((14 < sumLat) || (-14 > sumLat))     { // avg lat >  7
-    y = (int16_t)(LON_FACTOR10 * difLon);       }
-  else                                          { // avg lat <= 7
-    y = (int16_t)(LON_FACTOREQ * difLon);       }
-
-  d2  = (int32_t)x*x + (int32_t)y*y;
-
-  return (d2  < z->r2 ) ? 1 : 0;
+  return (((int32_t)x*x + (int32_t)y*y) < z->r2) ? 1 : 0;
 } // end function TestInsidePtRadiusZone
-#endif  // NEEDS_TESTING
-*/
-/*
+
+
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-//  int16_t TestInsideLlUrZone(geopt16_t p, llurzone16_t z)
+//  int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z)
 //  Test for point in a Lower-Left Upper-Right (south-west north-east) geozone.
+//  Zone runs east from LL's lon to UR's, so it crosses the Anti-Meridian when
+//  UR's lon is less than LL's, whatever its width.
 //
-//  NOTE - this will fail cases when zone both size 180+ degrees of longitude
-//         and crosses the Anti-Meridian (roughly the International Date Line).
-//
-//  INPUT : geopt32_t p - the point-under-test
-//          llurzone32_t z - a LL-UR zone that defines geozone boundary
+//  INPUT : geopt16_t p - the point-under-test
+//          const llurzone16_t * z - a LL-UR zone that defines geozone boundary
 //  OUTPUT: int16_t - returns 1 if inside zone, otherwise 0
 //  CALLS : none
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-int16_t TestInsideLlUrZone(geopt16_t p, llurzone16_t z)
+int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z)
 {
-  if ((z.ll.lat < p.lat) && (p.lat < z.ur.lat))
+  if ((z->ll.lat < p.lat) && (p.lat < z->ur.lat))
   { // When point inside the latitude boundaries check its longitude
-    if ((0 >= z.ur.lon) && (0 <= z.ll.lon))
-    { // When zone's longitudes obviously span the International Date Line
-      if (((p.lon >= 0) && (p.lon > z.ll.lon)) ||
-          ((p.lon <= 0) && (p.lon < z.ur.lon)))
-      { // pt w/E lon between LL and IDL or pt w/W lon between IDL and UR
-        return 1;
-      }
+    if (z->ll.lon <= z->ur.lon)
+    { // When zone doesn't cross the Anti-Meridian
+      if ((z->ll.lon < p.lon) && (p.lon < z->ur.lon)) {
+        return 1;                                     }
     }
-    else if ((z.ll.lon < p.lon) && (p.lon < z.ur.lon))
-    { // When zone's longitudes are less complicated (doesn't cross IDL)
-      return 1;
+    else if (((z->ll.lon < p.lon) &&
+              ((32767 != p.lon) || (-32767 != z->ur.lon))) ||
+             (p.lon < z->ur.lon))
+    { // pt w/lon east of LL up to 180 (180 is on UR when UR's lon is -180)
+      return 1;   // or pt w/lon from -180 west of UR
     }
   }
   return 0;
 } // end function TestInsideLlUrZone
-*/
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  int64_t TestIsLeft(geopt16_t LP1, geopt16_t LP2, geopt16_t PUT)
@@ -198,7 +293,7 @@ static inline int64_t TestIsLeft(geopt16_t LP1, geopt16_t LP2, geopt16_t PUT)
 //  Performs winding number test for point in a multi-vertex (polygon) geozone.
 //  Copyright 2001, softSurfer.com, ...may be freely used & modified...
 //
-//  NOTE: has been seen to fail when PUT is -90,-180
+//  NOTE: exact at every geopt16_t point, e.g. -90,-180 (see host/geocheck.c)
 //
 //  INPUT : geopt16_t p - the point-under-test
 //          polyzone16_t* - adrs of polygon zone that defines geozone boundary
@@ -232,3 +327,656 @@ int16_t TestInsidePolygonZone(geopt16_t p, const polyzone16_t * z)
   }
   return wn;
 } // end function TestInsidePolygonZone
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+//                                 const polyslab16_t * s)
+//  Performs TestInsidePolygonZone() winding number test over only the edges
+//  that span the longitude slab holding the point, found by binary search of
+//  the slab bounds, so cost is ~log2(slabs) compares plus the slab's edges.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          polyzone16_t* - adrs of polygon zone that defines geozone boundary
+//          polyslab16_t* - adrs of slab index of z (geozones_slab.h)
+//  OUTPUT: int16_t - the winding number (=0 only if P is outside z[])
+//  CALLS : TestIsLeft
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+                               const polyslab16_t * s)
+{
+  int16_t  wn = 0;                                // winding number counter
+  int16_t  lo = 0;                                // slab lon[lo] <= p.lon
+  int16_t  hi = s->n;                             //  and p.lon < lon[hi]
+  int16_t  mid;
+  uint16_t j;
+  uint16_t i;
+
+  if ((p.lon < s->lon[0]) || (p.lon >= s->lon[s->n])) {
+    return 0;                                         } // no edge spans p.lon
+  while ((hi - lo) > 1)
+  {
+    mid = (lo + hi) / 2;
+    if (s->lon[mid] <= p.lon) {
+      lo = mid;               }
+    else                      {
+      hi = mid;               }
+  }
+  for (j = s->first[lo]; j < s->first[lo + 1]; j++)
+  {                                               // Each edge in slab crosses
+    i = s->edge[j];                               // p.lon, up or down
+    if (z->v[i-1].lon < z->v[i].lon)
+    {                                             // an upward crossing
+      if (TestIsLeft(z->v[i-1],z->v[i],p) > 0){   // Points is left of edge
+        ++wn;                                 }   // have a valid up intersect
+    }
+    else
+    {                                             // a downward crossing
+      if (TestIsLeft(z->v[i-1],z->v[i],p) < 0){   // Point is right of edge
+        --wn;                                 }   // have a valid down intersect
+    }
+  }
+  return wn;
+} // end function TestInsidePolySlabZone
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int16_t ClampGeo16(int32_t v)
+//  Limits a lat or lon value worked out in 32 bits to the geopt16_t range.
+//
+//  INPUT : int32_t v - value that may be beyond int16_t
+//  OUTPUT: int16_t - v limited to INT16_MIN thru INT16_MAX
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int16_t ClampGeo16(int32_t v)
+{
+  if (INT16_MAX < v)  {
+    return INT16_MAX; }
+  if (INT16_MIN > v)  {
+    return INT16_MIN; }
+  return (int16_t)v;
+} // end function ClampGeo16
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int32_t LonDistance(int16_t lon1, int16_t lon2)
+//  Gives how far apart two lons are, taken the short way round, so across the
+//  Anti-Meridian when that's shorter (+/-32767 is 180, 65534 lsbs round).
+//
+//  INPUT : int16_t lon1, lon2 - longitudes (geopt16_t scaling)
+//  OUTPUT: int32_t - |lon1 - lon2| the short way round, 0 to 32767 lsbs
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int32_t LonDistance(int16_t lon1, int16_t lon2)
+{
+  int32_t d = labs((int32_t)lon1 - lon2);
+
+  if (32767 < d)          {
+    d = labs(65534 - d);  }             // across the Anti-Meridian
+  return d;
+} // end function LonDistance
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox)
+//  Works out bounding box of a zone, i.e. the least LL-UR rectangle outside
+//  of which the zone's test can't pass.
+//
+//  INPUT : const geozone16_t * pZone - the zone
+//          llurzone16_t * pBox - where to put its box
+//  OUTPUT: NONE but sets *pBox
+//  CALLS : ClampGeo16
+//          LonMilesQ16
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox)
+{
+  const geopt16_t *   pV;
+  int16_t             r;                  // radius rounded down, in miles
+  int32_t             lonQ16;             // least miles per lsb of lon
+  int16_t             dLat;               // half of box's height and width
+  int16_t             dLon;
+  int16_t             i;
+
+  switch (pZone->cat)
+  {
+    case GC_PTRAD:
+      for (r = 0; ((int32_t)(r + 1) * (r + 1)) < pZone->z.ptRad->r2; r++) {
+        ;                                                                 }
+      // Inside needs x and y, truncated from the Q16 products, at most r
+      // miles, so deltas must be under (r+1)/factor (plus 1 lsb); lon
+      // factor is least at the most poleward lat of the box
+      dLat = (int16_t)(((int32_t)(r + 1) << 16) / PR_LAT_MILES_Q16) + 1;
+      lonQ16 = LonMilesQ16(labs((int32_t)pZone->z.ptRad->pt.lat) + dLat);
+      pBox->ll.lat = ClampGeo16((int32_t)pZone->z.ptRad->pt.lat - dLat);
+      pBox->ur.lat = ClampGeo16((int32_t)pZone->z.ptRad->pt.lat + dLat);
+      pBox->ll.lon = INT16_MIN;         // any lon may be in it, unless
+      pBox->ur.lon = INT16_MAX;         // box has lon span w/o wrapping
+      if ((0 < lonQ16) &&
+          ((((int32_t)(r + 1) << 16) / lonQ16) < (32767L - 1)))
+      {
+        dLon = (int16_t)((((int32_t)(r + 1) << 16) / lonQ16) + 1);
+        if (((pZone->z.ptRad->pt.lon - dLon) >= -32765) &&
+            ((pZone->z.ptRad->pt.lon + dLon) <=  32765))
+        { // Clear of +/-180 (where -32768 is 32766), so no wrap in box
+          pBox->ll.lon = pZone->z.ptRad->pt.lon - dLon;
+          pBox->ur.lon = pZone->z.ptRad->pt.lon + dLon;
+        }
+      }
+      break;
+    case GC_LLUR:
+      *pBox = *pZone->z.llUr;
+      if (pBox->ur.lon < pBox->ll.lon)
+      { // When zone crosses the Anti-Meridian any lon may be in it
+        pBox->ll.lon = INT16_MIN;
+        pBox->ur.lon = INT16_MAX;
+      }
+      break;
+    case GC_POLY:
+      pV   = pZone->z.poly->v;
+      pBox->ll = pBox->ur = *pV;
+      for (i = pZone->z.poly->n; i > 0; i--)
+      {
+        pV++;
+        if (pV->lat < pBox->ll.lat)   {
+          pBox->ll.lat = pV->lat;     }
+        if (pV->lat > pBox->ur.lat)   {
+          pBox->ur.lat = pV->lat;     }
+        if (pV->lon < pBox->ll.lon)   {
+          pBox->ll.lon = pV->lon;     }
+        if (pV->lon > pBox->ur.lon)   {
+          pBox->ur.lon = pV->lon;     }
+      }
+      break;
+    default:                            // GC_UNUSED: box nothing can be in
+      pBox->ll.lat = pBox->ll.lon = INT16_MAX;
+      pBox->ur.lat = pBox->ur.lon = INT16_MIN;
+      break;
+  }
+} // end routine GeofenceZoneBox
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t GeofenceEvaluate(geopt16_t p)
+//  Tests a point against each zone in GEOZONES[] (geozones.h) in turn until
+//  one contains it.  A zone whose bounding box excludes the point costs four
+//  compares at most; only when the point is in the box is the zone's own test
+//  (e.g. polygon's edge walk) run.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//  OUTPUT: int16_t - index in GEOZONES[] of 1st zone containing p, otherwise
+//                    GZ_NONE
+//  CALLS : TestInsidePtRadiusZone
+//          TestInsideLlUrZone
+//          TestInsidePolygonZone
+//          TestInsidePolySlabZone
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t GeofenceEvaluate(geopt16_t p)
+{
+  const llurzone16_t * pBox = GEOBOXES;
+  int16_t              inside;
+  int16_t              i;
+
+  for (i = 0; i < (int16_t)GEOZONE_CNT; i++, pBox++)
+  {
+    if ((p.lat < pBox->ll.lat) || (p.lat > pBox->ur.lat) ||
+        (p.lon < pBox->ll.lon) || (p.lon > pBox->ur.lon))
+    {                                     // Outside zone's box so outside
+      continue;                           // of zone
+    }
+    switch (GEOZONES[i].cat)
+    {
+      case GC_PTRAD:
+        inside = TestInsidePtRadiusZone(p, GEOZONES[i].z.ptRad);
+        break;
+      case GC_LLUR:
+        inside = TestInsideLlUrZone(p, GEOZONES[i].z.llUr);
+        break;
+      case GC_POLY:
+#if (GEOFENCE_USE_SLABS == 1)
+        if (NULL != GEOSLABS[i])
+        {                                 // Long polygon, so test only edges
+          inside =                        // of slab holding p's lon
+            TestInsidePolySlabZone(p, GEOZONES[i].z.poly, GEOSLABS[i]);
+          break;
+        }
+#endif
+        inside = TestInsidePolygonZone(p, GEOZONES[i].z.poly);
+        break;
+      default:
+        inside = 0;
+        break;
+    }
+    if (0 != inside)  {
+      return i;       }
+  }
+  return GZ_NONE;
+} // end function GeofenceEvaluate
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int16_t BoxDistance(geopt16_t p, const llurzone16_t * b)
+//  Gives how far a point is outside a box in lat or lon, whichever is more,
+//  which is never more than its distance to any point in the box.  Lon is to
+//  the nearer of the box's lon lines, the short way round.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          const llurzone16_t * b - box, ll.lat <= ur.lat and ll.lon <= ur.lon
+//  OUTPUT: int16_t - lsbs p is outside b (0 if inside), at most INT16_MAX
+//  CALLS : ClampGeo16
+//          LonDistance
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int16_t BoxDistance(geopt16_t p, const llurzone16_t * b)
+{
+  int32_t dLat = 0;
+  int32_t dLon = 0;
+
+  if (p.lat < b->ll.lat)        {
+    dLat = (int32_t)b->ll.lat - p.lat; }
+  else if (p.lat > b->ur.lat)   {
+    dLat = (int32_t)p.lat - b->ur.lat; }
+  if ((p.lon < b->ll.lon) || (p.lon > b->ur.lon))
+  {
+    dLon = LonDistance(p.lon, b->ll.lon);
+    if (LonDistance(p.lon, b->ur.lon) < dLon) {
+      dLon = LonDistance(p.lon, b->ur.lon);   }
+  }
+  return ClampGeo16((dLat > dLon) ? dLat : dLon);
+} // end function BoxDistance
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int16_t EdgeDistance(geopt16_t p, geopt16_t a, geopt16_t b,
+//                              int16_t best)
+//  Gives the lesser of best and a lower bound on the distance from a point to
+//  edge a-b:  the more of the distance to the edge's box and to the line
+//  through it, |cross product| over an over-estimate of the edge's length
+//  (max + min/2 of its |dLat| and |dLon|, rounded up, within 12%), rounded
+//  down.  All integer math, 16x16 products when the deltas fit 16 bits.  The
+//  line is skipped when the edge's box is already best or more away.  The
+//  point's lon is taken the short way round from the edge's middle; the other
+//  way round it's at least 32767 less half the edge's lon span from the edge,
+//  which caps the line's bound.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          geopt16_t a, b - ends of edge
+//          int16_t best - least distance to other edges so far
+//  OUTPUT: int16_t - lesser of best and distance from p to edge, lsbs
+//  CALLS : BoxDistance
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int16_t EdgeDistance(geopt16_t p, geopt16_t a, geopt16_t b,
+                            int16_t best)
+{
+  llurzone16_t box;
+  int32_t      eLat, eLon;              // edge a to b
+  int32_t      pLat, pLon;              // a to point
+  int32_t      len;                     // edge length, or more
+  int32_t      d;
+  int64_t      dLine;                   // to line through edge
+
+  box.ll.lat = (a.lat < b.lat) ? a.lat : b.lat;
+  box.ur.lat = (a.lat < b.lat) ? b.lat : a.lat;
+  box.ll.lon = (a.lon < b.lon) ? a.lon : b.lon;
+  box.ur.lon = (a.lon < b.lon) ? b.lon : a.lon;
+  d = BoxDistance(p, &box);
+  if (d >= best)  {
+    return best;  }                     // can't be nearer than best
+
+  eLat = (int32_t)b.lat - a.lat;
+  eLon = (int32_t)b.lon - a.lon;
+  pLat = (int32_t)p.lat - a.lat;
+  pLon = (int32_t)p.lon - a.lon;
+  if (32767 < (pLon - eLon / 2))        {
+    pLon -= 65534;                      }   // across the Anti-Meridian
+  else if (-32767 > (pLon - eLon / 2))  {
+    pLon += 65534;                      }
+  len  = (labs(eLat) > labs(eLon)) ? (labs(eLat) + (labs(eLon) + 1) / 2) :
+                                     (labs(eLon) + (labs(eLat) + 1) / 2);
+  if (0 == len)         {
+    return (int16_t)d;  }               // a point, its box is the distance
+  if ((INT16_MAX >= labs(eLat)) && (INT16_MAX >= labs(eLon)) &&
+      (INT16_MAX >= labs(pLat)) && (INT16_MAX >= labs(pLon)))
+  {                                     // 16x16 products, each under 2^30
+    dLine = labs((int32_t)(int16_t)eLat * (int16_t)pLon -
+                 (int32_t)(int16_t)pLat * (int16_t)eLon) / len;
+  }
+  else
+  {
+    dLine = (((int64_t)eLat * pLon) - ((int64_t)pLat * eLon)) / len;
+    if (0 > dLine)    {
+      dLine = -dLine; }
+  }
+  if ((32767 - (labs(eLon) + 1) / 2) < dLine)   {
+    dLine = 32767 - (labs(eLon) + 1) / 2;       }   // nearer the other way round
+  if (dLine > d)                                          {
+    d = (INT16_MAX < dLine) ? INT16_MAX : (int32_t)dLine; } // line is farther
+  return (d < best) ? (int16_t)d : best;
+} // end function EdgeDistance
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static int16_t ZoneMargin(geopt16_t p, int16_t i)
+//  Gives lower bound on distance from a point to the boundary of GEOZONES[i].
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          int16_t i - index in GEOZONES[] (and GEOBOXES[])
+//  OUTPUT: int16_t - margin, lsbs
+//  CALLS : BoxDistance
+//          EdgeDistance
+//          LonDistance
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static int16_t ZoneMargin(geopt16_t p, int16_t i)
+{
+  const llurzone16_t * pZ;
+  const polyzone16_t * pPoly;
+  int16_t              margin = BoxDistance(p, &GEOBOXES[i]);
+  int32_t              d;
+  int16_t              j;
+
+  if (0 != margin)        {
+    return margin;        }             // outside zone's box
+
+  switch (GEOZONES[i].cat)
+  {
+    case GC_LLUR:                       // nearest of its lat and lon lines
+      pZ = GEOZONES[i].z.llUr;
+      d  = labs((int32_t)p.lat - pZ->ll.lat);
+      if (labs((int32_t)p.lat - pZ->ur.lat) < d)  {
+        d = labs((int32_t)p.lat - pZ->ur.lat);    }
+      if (LonDistance(p.lon, pZ->ll.lon) < d)     {
+        d = LonDistance(p.lon, pZ->ll.lon);       }
+      if (LonDistance(p.lon, pZ->ur.lon) < d)     {
+        d = LonDistance(p.lon, pZ->ur.lon);       }
+      return ClampGeo16(d);
+    case GC_POLY:                       // nearest of its edges
+      pPoly  = GEOZONES[i].z.poly;
+      margin = INT16_MAX;
+      for (j = pPoly->n; (j > 0) && (0 < margin); j--)  {
+        margin = EdgeDistance(p, pPoly->v[j-1], pPoly->v[j], margin); }
+      return margin;
+    case GC_UNUSED:
+      return INT16_MAX;
+    default:                            // GC_PTRAD
+      return 0;
+  }
+} // end function ZoneMargin
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin)
+//  Tests a point against every zone in GEOZONES[] as GeofenceEvaluate() does,
+//  and gives the least of the zones' margins.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          int16_t * pMargin - where to put margin, lsbs
+//  OUTPUT: int16_t - index in GEOZONES[] of 1st zone containing p, otherwise
+//                    GZ_NONE
+//  CALLS : ZoneMargin
+//          GeofenceEvaluate
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin)
+{
+  int16_t margin = INT16_MAX;
+  int16_t d;
+  int16_t i;
+
+  for (i = 0; (i < (int16_t)GEOZONE_CNT) && (0 < margin); i++)
+  {
+    d = ZoneMargin(p, i);
+    if (d < margin) {
+      margin = d;   }
+  }
+  *pMargin = margin;
+  return GeofenceEvaluate(p);
+} // end function GeofenceLocate
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void GeofenceClearFix(geofix16_t * pFix)
+//  Forgets decision held by pFix, so GeofenceTrack() next runs zone tests and
+//  takes their decision whatever it is.
+//
+//  INPUT : geofix16_t * pFix - cached decision to clear
+//  OUTPUT: NONE but updates pFix
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void GeofenceClearFix(geofix16_t * pFix)
+{
+  pFix->pt.lat   = 0;
+  pFix->pt.lon   = 0;
+  pFix->zone     = GZ_UNKNOWN;
+  pFix->margin   = 0;
+  pFix->last.lat = 0;
+  pFix->last.lon = 0;
+  pFix->vLat     = 0;
+  pFix->vLon     = 0;
+  pFix->age      = 0;
+  pFix->due      = 0;
+} // end routine GeofenceClearFix
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static uint16_t SqrtU32(uint32_t n)
+//  Gives the integer square root of n, rounded down, by the bit-by-bit method
+//  (shifts, adds, and compares, no float).
+//
+//  INPUT : uint32_t n - value to take root of
+//  OUTPUT: uint16_t - floor(sqrt(n))
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static uint16_t SqrtU32(uint32_t n)
+{
+  uint32_t root = 0;
+  uint32_t bit  = 1UL << 30;            // highest power of 4 in a uint32_t
+
+  while (bit > n) {
+    bit >>= 2;    }
+  while (0 != bit)
+  {
+    if (n >= (root + bit))
+    {
+      n   -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)root;
+} // end function SqrtU32
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void ScheduleFix(geopt16_t p, geofix16_t * pFix, bool isHeld)
+//  Takes p as the last fix tracked, estimating velocity from the prior one, and
+//  works out when a later fix could first be past the held decision's margin.
+//  The unit's speed at p is bounded by the velocity plus what fix error and
+//  GEOFENCE_AMAX over the interval could hide, then it's taken to speed up at
+//  GEOFENCE_AMAX to GEOFENCE_VMAX.  Times are in integer math and round down,
+//  so a fix is never scheduled later than it could be past the margin.
+//
+//  INPUT : geopt16_t p - the fix just tracked
+//          geofix16_t * pFix - decision held, with last fix, velocity, and age
+//          bool isHeld - pFix held a decision before p (so last is valid)
+//  OUTPUT: NONE but updates pFix last, velocity, age, and due
+//  CALLS : ClampGeo16
+//          LonDistance
+//          SqrtU32
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void ScheduleFix(geopt16_t p, geofix16_t * pFix, bool isHeld)
+{
+  int32_t  dt = pFix->age;
+  int32_t  v  = GEOFENCE_VMAX;          // speed bound at p, 1/256 lsb/s
+  int32_t  r;                           // distance left to margin, 1/256 lsb
+  uint32_t t;                           // earliest time past margin, seconds
+  uint32_t tA;
+
+  pFix->vLat = 0;
+  pFix->vLon = 0;
+  if (isHeld && (0 < dt))
+  { // lon difference taken the short way round
+    pFix->vLat = ClampGeo16((((int32_t)p.lat - pFix->last.lat) * 256) / dt);
+    pFix->vLon = ClampGeo16(((int32_t)(int16_t)(p.lon - pFix->last.lon) * 256) /
+                            dt);
+    v = labs(pFix->vLat) + labs(pFix->vLon) +
+        ((2 * GEOFENCE_FIX_ERR * 256) / dt) + (GEOFENCE_AMAX * dt);
+    if (GEOFENCE_VMAX < v)  {
+      v = GEOFENCE_VMAX;    }
+  }
+  pFix->last = p;
+  pFix->age  = 0;
+
+  r = (int32_t)pFix->margin - 2 * GEOFENCE_FIX_ERR -
+      (labs((int32_t)p.lat - pFix->pt.lat) + LonDistance(p.lon, pFix->pt.lon));
+  if ((0 >= r) || (GEOFENCE_DUE_LAT < labs(p.lat)))
+  { // Any fix might be past margin
+    pFix->due = 0;
+    return;
+  }
+  r *= 256;
+  t  = (uint32_t)r / GEOFENCE_VMAX;     // at top speed throughout, or
+  tA = (SqrtU32(((uint32_t)v * v) + (2UL * GEOFENCE_AMAX * r)) - v) /
+       GEOFENCE_AMAX;
+  if (tA > t)   {                       // speeding up from v, whichever later
+    t = tA;     }
+  pFix->due = (t < UINT16_MAX) ? (uint16_t)t : UINT16_MAX;
+} // end routine ScheduleFix
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix)
+//  Gives zone decision for a new fix.  When the fix moved less than the held
+//  decision's margin it is reused, costing no zone tests.  Otherwise zones are
+//  tested.  A decision of inside a zone (entering one, or a move to another)
+//  is taken at once, as muting must stay conservative; one of outside every
+//  zone, after inside, only when the fix is GEOFENCE_HYST or more from every
+//  boundary, so a fix jittering about a boundary stays muted (hysteresis).
+//  Either way the fix is scheduled, see ScheduleFix() and GeofenceIsDue().
+//
+//  INPUT : geopt16_t p - the new fix
+//          geofix16_t * pFix - decision cached with prior fix
+//  OUTPUT: int16_t - index in GEOZONES[] of zone p is taken to be in, otherwise
+//                    GZ_NONE; and updates pFix
+//  CALLS : GeofenceLocate
+//          LonDistance
+//          ScheduleFix
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix)
+{
+  int32_t moved = labs((int32_t)p.lat - pFix->pt.lat) +
+                  LonDistance(p.lon, pFix->pt.lon);
+  bool    isHeld = (GZ_UNKNOWN != pFix->zone);
+  int16_t margin;
+  int16_t zone;
+
+  if (!isHeld || (moved >= pFix->margin))
+  { // Could be past a boundary, so test zones
+    zone = GeofenceLocate(p, &margin);
+    if (!isHeld || (zone == pFix->zone) || (GZ_NONE != zone) ||
+        (margin >= GEOFENCE_HYST))
+    { // else too near boundary to leave zone, keep held decision & fix/margin
+      pFix->pt     = p;
+      pFix->zone   = zone;
+      pFix->margin = margin;
+    }
+  }
+  ScheduleFix(p, pFix, isHeld);
+  return pFix->zone;
+} // end function GeofenceTrack
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs)
+//  Adds secs to the age of the last fix tracked and tells if a new fix could
+//  be past the held decision's margin, as scheduled by GeofenceTrack().  If
+//  not the fix needn't be converted to geopt16_t nor tracked.
+//
+//  INPUT : geofix16_t * pFix - decision cached with last fix tracked
+//          uint16_t secs - seconds since the prior fix (tracked or not)
+//  OUTPUT: int16_t - 1 if new fix must go to GeofenceTrack(), otherwise 0;
+//                    and updates pFix age
+//  CALLS : none
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs)
+{
+  if (secs < (UINT16_MAX - pFix->age))  {
+    pFix->age += secs;                  }
+  else                                  {
+    pFix->age  = UINT16_MAX;            }
+  return (GZ_UNKNOWN == pFix->zone) || (pFix->age >= pFix->due);
+} // end function GeofenceIsDue
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static inline int16_t TestIsBelow32(geopt32_t LP1, geopt32_t LP2,
+//                                      geopt32_t PUT)
+//  Tests if a point is below (south of) an edge that crosses the point's lon,
+//  i.e. LP1.lon <= PUT.lon < LP2.lon or LP2.lon <= PUT.lon < LP1.lon.  Same as
+//  TestIsLeft() > 0 for an upward edge or < 0 for a downward one.
+//
+//  INPUT:  geopt32_t LP1, LP2 - ends of edge
+//          geopt32_t PUT - the Point Under Test
+//  OUTPUT: 1 if PUT's lat is less than edge's lat at PUT's lon, otherwise 0
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static inline int16_t TestIsBelow32(geopt32_t LP1, geopt32_t LP2, geopt32_t PUT)
+{
+  int32_t eLat = LP2.lat - LP1.lat;               // edge deltas
+  int32_t eLon = LP2.lon - LP1.lon;
+  int32_t dLat = PUT.lat - LP1.lat;               // point deltas, within edge
+  int32_t dLon = PUT.lon - LP1.lon;               //  box when lat in its span
+  int32_t cross;
+
+  if ((PUT.lat < LP1.lat) && (PUT.lat < LP2.lat)) {
+    return 1;                                     } // below both ends
+  if ((PUT.lat >= LP1.lat) && (PUT.lat >= LP2.lat)) {
+    return 0;                                       } // not below either end
+
+  if ((eLat <= GEOPT32_EDGE_MAX) && (eLat >= -GEOPT32_EDGE_MAX) &&
+      (eLon <= GEOPT32_EDGE_MAX) && (eLon >= -GEOPT32_EDGE_MAX))
+  {                                               // Short edge: 16x16 products
+    cross = (int32_t)(int16_t)eLat * (int16_t)dLon -
+            (int32_t)(int16_t)dLat * (int16_t)eLon;
+    return (0 < eLon) ? (0 < cross) : (0 > cross);
+  }
+  return (0 < eLon) ? (((int64_t)eLat * dLon) > ((int64_t)dLat * eLon))
+                    : (((int64_t)eLat * dLon) < ((int64_t)dLat * eLon));
+} // end function TestIsBelow32
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z)
+//  Performs winding number test for point in a polygon geozone of geopt32_t
+//  vertices, as TestInsidePolygonZone() does for geopt16_t.
+//
+//  INPUT : geopt32_t p - the point-under-test
+//          polyzone32_t* - adrs of polygon zone that defines geozone boundary
+//  OUTPUT: int16_t - the winding number (=0 only if P is outside z[])
+//  CALLS : TestIsBelow32
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z)
+{
+  int16_t wn = 0;                                 // winding number counter
+  int16_t i;
+
+  for (i = z->n; i > 0; i--)                      // Have n+1 vertices, so i = n
+  {                                               // Edge z->v[i-1] to z->v[i]
+    if (z->v[i-1].lon <= p.lon)
+    {
+      if (z->v[i].lon > p.lon)
+      {                                           // an upward crossing
+        if (TestIsBelow32(z->v[i-1],z->v[i],p)) { // Point is below edge
+          ++wn;                                 } // have a valid up intersect
+      }
+    }
+    else  // (z->v[i-1].lon > p.lon)
+    {
+      if (z->v[i].lon <= p.lon)
+      {                                           // a downward crossing
+        if (TestIsBelow32(z->v[i-1],z->v[i],p)) { // Point is below edge
+          --wn;                                 } // have a valid down intersect
+      }
+    }
+  }
+  return wn;
+} // end function TestInsidePolygonZone32
@@ -10,22 +10,84 @@
  *    point is within a geozone, which may be a 'point & radius' (estimated), a
  *    'rectangle' (using lower left & upper right corners), or a polygon.
  *
- *    //(1) int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
- *    //(2) int16_t TestInsideLlUrZone(geopt16_t p, llurzone16_t z)
+ *      (1) int16_t TestInsidePtRadiusZone(geopt16_t pt, const ptradzone16_t *z)
+ *      (2) int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z)
  *      (3) int16_t TestInsidePolygonZone(geopt16_t p, const polyzone16_t * z)
+ *      (4) int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+ *                                         const polyslab16_t * s)
+ *      (5) void    GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox)
+ *      (6) int16_t GeofenceEvaluate(geopt16_t p)
+ *      (7) int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin)
+ *      (8) void    GeofenceClearFix(geofix16_t * pFix)
+ *      (9) int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix)
+ *     (10) int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs)
+ *     (11) int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z)
+ *
+ *  The zones GeofenceEvaluate() tests a point against are the GEOZONES[] table
+ *  of geozones.h, any mix of the three kinds, generated from geozones.csv by
+ *  host/geozonec.c along with the bounding box of each zone, GEOBOXES[], so a
+ *  point outside a zone's box is rejected with a few compares rather than the
+ *  zone's full test (e.g. polygon edges).
+ *  A polygon of GEOSLAB_MIN_EDGES or more edges also has a longitude slab
+ *  index (polyslab16_t, in geozones_slab.h generated by host/geoslab.c), so
+ *  only the edges crossing the point's slab are tested.
+ *
+ *  GeofenceLocate() also gives a margin, a lower bound on the distance from the
+ *  point to the nearest zone boundary.  GeofenceTrack() keeps the decision with
+ *  the fix (geofix16_t) and reuses it, with no zone tests at all, for a later
+ *  fix that moved less than the margin.  It takes a fix inside a zone at once
+ *  (muting must stay conservative), but leaves a zone only once a fix is
+ *  GEOFENCE_HYST or more past every boundary, so fixes jittering about a
+ *  boundary can't flip the decision back and forth.
+ *  GeofenceTrack() also estimates the velocity between tracked fixes, and from
+ *  it, bounded by worst-case speed and acceleration (GEOFENCE_VMAX and
+ *  GEOFENCE_AMAX), the earliest time a fix could reach the margin:  until
+ *  then GeofenceIsDue() says a fix needn't be converted or tracked at all.
+ *
+ *  geopt32_t and polyzone32_t are for borders that need better than the ~300 m
+ *  (lat) by ~600 m (lon) lsbs of geopt16_t:  lat and lon are 0.00001 degree
+ *  (~1 m) lsbs, the resolution of the D.GLL +DDD.ddddd text.  Their winding
+ *  test decides most edges by compares alone and the rest by 16x16-bit
+ *  multiplies, only going to 64-bit math for edges longer than 32767 lsbs.
  *
  *  NOTE:  When checking a point & radius zone, scaling must be as follows:
  *  int16_t lat: 2's complement decimal degrees scaled so lsb =  90/32767 degree
  *  int16_t lon: 2's complement decimal degrees scaled so lsb = 180/32767 degree
  *  int16_t r2: radius squared in miles, so max radius is 181 miles
  *
- *  NOTE - TestInsideLlUrZone fail when zone both size 180+ degrees of longitude
- *         and crosses the Anti-Meridian (roughly the International Date Line).
+ *  NOTE - TestInsideLlUrZone zone runs east from LL to UR, crossing the Anti-
+ *         Meridian (roughly the International Date Line) when UR lon < LL lon.
  *
- *  NOTE: TestInsidePolygonZone has been seen to fail when PUT is -90,-180
+ *  NOTE - TestInsidePtRadiusZone works at any lat and across the Anti-Meridian
+ *         but a zone must not reach a pole.
+ *
+ *  Both, the polygon tests (16-bit, slab, and 32-bit), and GeofenceEvaluate()
+ *  are checked at every geopt16_t point against exact references by host tool
+ *  host/geocheck.c ("make -f host/Makefile geocheck"); the failure once noted
+ *  for TestInsidePolygonZone at -90,-180 is not seen, even for vertices there.
  *
  *  WRITTEN BY    : Robert Kirby, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      GEOFENCE_HYST only delays leaving a zone, not entering one
+ *      geofix16_t also holds last fix tracked, velocity, and time due; add
+ *      GEOFENCE_VMAX, GEOFENCE_AMAX, GEOFENCE_FIX_ERR, GEOFENCE_DUE_LAT, and
+ *      GeofenceIsDue() to skip fixes that can't yet have reached a boundary
+ *      Polygon test -90,-180 failure note dropped, host/geocheck.c sweep is exact
+ *      Drop GeofenceInit(), zone boxes are GEOBOXES[] generated into geozones.h
+ *      TestInsidePtRadiusZone() scales lon by cos(lat) at any lat and crosses
+ *      the Anti-Meridian; TestInsideLlUrZone() crosses it whatever zone width
+ *      Add GeofenceZoneBox()
+ *      Add geopt32_t, polyzone32_t, and TestInsidePolygonZone32()
+ *      Add geofix16_t, GEOFENCE_HYST, GeofenceLocate(), GeofenceClearFix(), and
+ *      GeofenceTrack() to reuse a decision for fixes within its margin
+ *      Add polyslab16_t longitude slab index of a polygon zone, GEOSLAB_MIN_EDGES,
+ *      GEOFENCE_USE_SLABS, and TestInsidePolySlabZone()
+ *      Add geozone16_t table entry, GeofenceInit(), and GeofenceEvaluate() to
+ *      test a point against every zone in GEOZONES[] (geozones.h), rejecting
+ *      zones by bounding box first
+ *      Restore TestInsidePtRadiusZone() and TestInsideLlUrZone(), the latter
+ *      with zone passed by reference
  *    2021/06/02, Robert Kirby, NSWC H12
  *      adapted from Asp code base 2019/02/19
  *      Move inline TestIsLeft() from .h to .c (due to compiler differences)
@@ -43,8 +105,10 @@
 //  Performs an approximation check to see if a point is within a geozone
 //  defined by a point-radius where max radius is 181 miles.
 //
-//  NOTE - this has been optimized for a particular embedded application focused
-//  about 40N, but is most easily modified to be generic for lat/lon and radius.
+//  Miles per degree of lon are 69.1 * cos(lat) at the mean lat of point and
+//  zone center, and lon difference is taken the short way round.
+//
+//  NOTE - zone must not reach a pole, where flat earth doesn't hold.
 //
 //  int16_t lat: 2's complement decimal degrees scaled so lsb =  90/32767 degree
 //  int16_t lon: 2's complement decimal degrees scaled so lsb = 180/32767 degree
@@ -58,7 +122,7 @@
 //           lat & lon are in 2's complement decimal degrees (S&W are negative)
 //           x = 69.1 * (lat2 - lat1)   [NOTE 69.1 ~= miles/deg LAT]
 //        and
-//           y = 53.0 * (lon2 - lon1)   [NOTE 53.0 ~= miles/deg LON @ 40N]
+//           y = 69.1 * cos((lat1 + lat2) / 2) * (lon2 - lon1)
 //
 //  For this application to minimize microprocessor computations compare
 //     r2 to (x*x + y*y) instead of actual distance of radius
@@ -67,14 +131,13 @@
 //          const ptradzone16_t *z - geozone defined by a point & radius
 //  OUTPUT: int16_t - returns 1 if approximately inside fence, otherwise 0
 //******************************************************************************
-//  int16_t TestInsideLlUrZone(geopt16_t p, llurzone16_t z)
+//  int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z)
 //  Test for point in a Lower-Left Upper-Right (south-west north-east) geozone.
-//
-//  NOTE - this will fail cases when zone both size 180+ degrees of longitude
-//         and crosses the Anti-Meridian (roughly the International Date Line).
+//  Zone runs east from LL's lon to UR's, so it crosses the Anti-Meridian when
+//  UR's lon is less than LL's, whatever its width.
 //
 //  INPUT : geopt16_t p - the point-under-test
-//          llurzone16_t z - a LL-UR zone that defines geozone boundary
+//          const llurzone16_t * z - a LL-UR zone that defines geozone boundary
 //  OUTPUT: int16_t - returns 1 if inside zone, otherwise 0
 //******************************************************************************
 //  int16_t TestInsidePolygonZone(geopt16_t p, const polyzone16_t * z)
@@ -85,6 +148,80 @@
 //          const polyzone16_t - a polygon zone that defines geozone boundary
 //  OUTPUT: int16_t - the winding number (=0 only if P is outside z[])
 //******************************************************************************
+//  int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+//                                 const polyslab16_t * s)
+//  Same winding number test as TestInsidePolygonZone(), but only for the edges
+//  of the slab of s holding p's longitude, found by binary search.
+//
+//  INPUT : geopt16_t p - the point-under-test
+//          const polyzone16_t * z - a polygon zone that defines geozone boundary
+//          const polyslab16_t * s - slab index of z (geozones_slab.h)
+//  OUTPUT: int16_t - the winding number (=0 only if P is outside z[])
+//******************************************************************************
+//  void GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox)
+//  Works out the bounding box of a zone, i.e. the least LL-UR rectangle
+//  (never crossing the Anti-Meridian) outside of which the zone's test can't
+//  pass.  host/geozonec.c generates GEOBOXES[] of geozones.h by it.
+//
+//  INPUT : const geozone16_t * pZone - the zone
+//          llurzone16_t * pBox - where to put its box
+//  OUTPUT: NONE but sets *pBox
+//******************************************************************************
+//  int16_t GeofenceEvaluate(geopt16_t p)
+//  Tests a point against each zone in GEOZONES[] in turn until one contains
+//  it.  A zone is only given its full test when the point is in its box.
+//
+//  INPUT : geopt16_t p - the point-under-test (scaled as CoordsToGeopt16())
+//  OUTPUT: int16_t - index in GEOZONES[] of 1st zone containing p, otherwise
+//                    GZ_NONE
+//******************************************************************************
+//  int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin)
+//  Same as GeofenceEvaluate(), but tests every zone so as to also give margin,
+//  a lower bound on the distance (lsbs, |dLat| + |dLon|) p must move before
+//  it can reach the boundary of any zone (0 when near a point & radius zone).
+//
+//  INPUT : geopt16_t p - the point-under-test (scaled as CoordsToGeopt16())
+//          int16_t * pMargin - where to put margin
+//  OUTPUT: int16_t - index in GEOZONES[] of 1st zone containing p, otherwise
+//                    GZ_NONE
+//******************************************************************************
+//  void GeofenceClearFix(geofix16_t * pFix)
+//  Forgets decision held by pFix, so GeofenceTrack() next runs zone tests.
+//
+//  INPUT : geofix16_t * pFix - cached decision to clear
+//  OUTPUT: NONE but updates pFix
+//******************************************************************************
+//  int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix)
+//  Gives the zone decision for a new fix p, reusing that held by pFix when p
+//  is within its margin, otherwise by GeofenceLocate() with hysteresis:  a
+//  decision of inside a zone is taken at once, but of outside every zone,
+//  after inside, not while less than GEOFENCE_HYST from a boundary, the held
+//  one is kept.  Also estimates velocity from the prior fix tracked and schedules
+//  when a fix could next be past the margin, for GeofenceIsDue().
+//
+//  INPUT : geopt16_t p - the new fix (scaled as CoordsToGeopt16())
+//          geofix16_t * pFix - decision cached with prior fix
+//  OUTPUT: int16_t - index in GEOZONES[] of zone p is taken to be in, otherwise
+//                    GZ_NONE; and updates pFix
+//******************************************************************************
+//  int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs)
+//  Counts secs since the prior fix toward the time the held decision is due,
+//  i.e. when a fix could first be past its margin.  Until then a new fix
+//  needn't go to GeofenceTrack(), the held decision stands.
+//
+//  INPUT : geofix16_t * pFix - decision cached with prior fix tracked
+//          uint16_t secs - seconds since the prior fix (tracked or not)
+//  OUTPUT: int16_t - 1 if new fix must go to GeofenceTrack(), otherwise 0
+//******************************************************************************
+//  int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z)
+//  Performs winding number test for point in a polygon geozone of 32-bit
+//  (0.00001 degree) vertices.  Same result as TestInsidePolygonZone() would
+//  give with exact math, but 64-bit math is only used for long edges.
+//
+//  INPUT : geopt32_t p - the point-under-test
+//          const polyzone32_t * z - a polygon zone that defines geozone boundary
+//  OUTPUT: int16_t - the winding number (=0 only if P is outside z[])
+//******************************************************************************
 #include <stdint.h>
 
 //----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
@@ -120,12 +257,95 @@ typedef struct tagPOLYZONE16
   geopt16_t  v[];     // points to (n+1) vertex zone (polygon) w/ v[n] == v[0]
 } polyzone16_t;       // packing/scaling of geopt values not specified here
 
+typedef struct tagGEOPT32
+{                     // 32-bit based storage for geographical point
+  int32_t lat;        // latitude, lsb = 1/GEOPT32_PER_DEG degree (~1.1 m)
+  int32_t lon;        // longitude, lsb = 1/GEOPT32_PER_DEG degree
+} geopt32_t;          // i.e. D.GLL's +DDD.ddddd without the '.'
+
+#define GEOPT32_PER_DEG   (100000L)     // geopt32_t lsbs per degree
+#define GEOPT32_EDGE_MAX  (32767L)      // longest edge extent for 16x16 math
+
+typedef struct tagPOLYZONE32
+{                     // 32-bit based storage for geographical zone
+  int16_t    n;       // # of points that make zone (but v[] has n+1 points)
+  geopt32_t  v[];     // points to (n+1) vertex zone (polygon) w/ v[n] == v[0]
+} polyzone32_t;
+
+typedef struct tagGEOZONE16
+{                     // entry of GEOZONES[] table (geozones.h)
+  geocat_t   cat;     // kind of zone, selects member of z
+  union
+  {
+    const ptradzone16_t * ptRad;
+    const llurzone16_t *  llUr;
+    const polyzone16_t *  poly;
+  } z;
+} geozone16_t;
+
+// Longitude slab index of a polygon zone:  the distinct vertex longitudes, in
+// ascending order, bound slabs in each of which the same edges span the whole
+// slab, and only those edges can count toward a winding number there.
+typedef struct tagPOLYSLAB16
+{                     // generated by host/geoslab.c into geozones_slab.h
+  int16_t          n;     // # of slabs (but lon[] & first[] have n+1 values)
+  const int16_t *  lon;   // slab k is lon[k] <= lon < lon[k+1]
+  const uint16_t * first; // slab k's edges are edge[first[k]] thru
+  const uint16_t * edge;  //   edge[first[k+1]-1], edge i is v[i-1] to v[i]
+} polyslab16_t;
+
+#define GZ_NONE   (-1)  // GeofenceEvaluate(): point in no zone
+#define GZ_UNKNOWN (-2) // geofix16_t: no decision held
+
+typedef struct tagGEOFIX16
+{                     // zone decision cached with a fix by GeofenceTrack()
+  geopt16_t pt;       // fix decision was made at
+  int16_t   zone;     // GEOZONES[] index, GZ_NONE, or GZ_UNKNOWN
+  int16_t   margin;   // |dLat| + |dLon| a fix must move to need zone tests
+  geopt16_t last;     // latest fix tracked
+  int16_t   vLat;     // velocity from fix tracked before last to last,
+  int16_t   vLon;     //   1/256 lsbs per second
+  uint16_t  age;      // seconds since last fix tracked
+  uint16_t  due;      // age at which a fix could be past margin
+} geofix16_t;
+
+// lsbs past a boundary a fix must be to leave a held zone (~0.6 km)
+#define GEOFENCE_HYST      (2)
+
+// Worst-case motion of a unit as |dLat| + |dLon| lsbs:  40 m/s (~90 mph) and
+// 3 m/s/s at up to GEOFENCE_DUE_LAT, where a lon lsb is 106 m.  Any faster
+// and GeofenceIsDue() may skip a fix whose decision would have changed.
+#define GEOFENCE_VMAX      (102)    // 1/256 lsb per second
+#define GEOFENCE_AMAX      (8)      // 1/256 lsb per second per second
+#define GEOFENCE_DUE_LAT   (29127)  // 80 degrees, fixes nearer a pole are due
+// |dLat| + |dLon| a fix may be off the unit:  < 2 for truncation to lsbs, and
+// GPS error under 1 lsb (~100 m)
+#define GEOFENCE_FIX_ERR   (3)
+
+// 1: polygon zones of GEOSLAB_MIN_EDGES or more edges are tested by their slab
+//    index in geozones_slab.h (generated from geozones.h by host/geoslab.c)
+// 0: all polygon zones are tested edge by edge
+// FLASH: index is 4 bytes per distinct vertex lon + 2 per edge in each slab
+#ifndef GEOFENCE_USE_SLABS
+#define GEOFENCE_USE_SLABS (1)
+#endif
+#define GEOSLAB_MIN_EDGES  (12) // fewer edges are quicker walked, see geobench
+
 //----- EXPOSED ATTRIBUTES -----------------------------------------------------
 
 //----- EXPOSED PROCEDURES -----------------------------------------------------
-//int16_t TestInsidePtRadiusZone(geopt16_t p, const ptradzone16_t *z);
-//int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t z);
+int16_t TestInsidePtRadiusZone(geopt16_t p, const ptradzone16_t *z);
+int16_t TestInsideLlUrZone(geopt16_t p, const llurzone16_t * z);
 int16_t TestInsidePolygonZone(geopt16_t p, const polyzone16_t * z);
+int16_t TestInsidePolySlabZone(geopt16_t p, const polyzone16_t * z,
+                               const polyslab16_t * s);
+void    GeofenceZoneBox(const geozone16_t * pZone, llurzone16_t * pBox);
+int16_t GeofenceEvaluate(geopt16_t p);
+int16_t GeofenceLocate(geopt16_t p, int16_t * pMargin);
+void    GeofenceClearFix(geofix16_t * pFix);
+int16_t GeofenceTrack(geopt16_t p, geofix16_t * pFix);
+int16_t GeofenceIsDue(geofix16_t * pFix, uint16_t secs);
+int16_t TestInsidePolygonZone32(geopt32_t p, const polyzone32_t * z);
 
 //----- MACROS -----------------------------------------------------------------
 
@@ -0,0 +1,75 @@
+#ifndef GEOZONES_H__
+#define GEOZONES_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geozones.h
+ *
+ *  DESCRIPTION   : Define the geozones D.GLL fixes are checked against for
+ *    geo-muting, as table GEOZONES[] of point-radius, LL-UR, and polygon zones
+ *    (geozone16_t in geofence.h), and the bounding box of each, GEOBOXES[].
+ *    Included by geofence.c only.  GeofenceEvaluate() tries zones in order.
+ *
+ *    GENERATED by host/geozonec.c from geozones.csv, do not edit; change
+ *    that and run "make -f host/Makefile geozones", which also regenerates
+ *    geozones_slab.h.  Polygons crossing the Anti-Meridian are split at 180,
+ *    repeated and collinear vertices dropped.
+ *
+ *  NOTE: geopt16_t scaling as CoordsToGeopt16(), i.e.
+ *  int16_t lat: 2's complement decimal degrees scaled so lsb =  90/32767 degree
+ *  int16_t lon: 2's complement decimal degrees scaled so lsb = 180/32767 degree
+ */
+#include "geofence.h"
+
+// USA, part west of 180 (geozones.csv:13)
+#define USA_1_NUM_PTS 3  // # of points that make zone (but v[] has n+1 points)
+#define USA_1_VERTICES                                                        \
+{                       /* LAT LSB = 0.002746666, LON LSB = 0.005493332   */  \
+  {0x535C, 0x7FFF},     /*  58.6143,  180.0000 split at Anti-Meridian     */  \
+  {0x4AEE, 0x78EC},     /*  52.6863,  170.0500 Follow Int'l Date Line     */  \
+  {0x4408, 0x7FFF},     /*  47.8353,  180.0000 split at Anti-Meridian     */  \
+  {0x535C, 0x7FFF}      /*  58.6143,  180.0000 Back to first point        */  \
+}                       /* Note that first & last points must be the same */
+static const polyzone16_t USA_1_POLYZONE16 = {.n = USA_1_NUM_PTS, .v = USA_1_VERTICES};
+
+// USA, part east of 180 (geozones.csv:13)
+#define USA_2_NUM_PTS 15  // # of points that make zone (but v[] has n+1 points)
+#define USA_2_VERTICES                                                        \
+{                       /* LAT LSB = 0.002746666, LON LSB = 0.005493332   */  \
+  {0x71C6, 0xE38E},     /*  80.0000,  -40.0000 Polar region above N.Am    */  \
+  {0x71C6, 0x87A6},     /*  80.0000, -169.2500 n.Greenland to nw of Alaska*/  \
+  {0x5C78, 0x87A6},     /*  65.0189, -169.2500 Tap onto Int'l Date Line   */  \
+  {0x535C, 0x8001},     /*  58.6143, -180.0000 split at Anti-Meridian     */  \
+  {0x4408, 0x8001},     /*  47.8353, -180.0000 Follow Int'l Date Line     */  \
+  {0x4408, 0x98E4},     /*  47.8353, -145.0000 Cut back toward coast to   */  \
+  {0x31C7, 0x98E4},     /*  35.0000, -145.0000 uncover off WA, OR, & n.CA */  \
+  {0x31C7, 0x8001},     /*  35.0000, -180.0000 Cut back west to cover     */  \
+  {0x1C72, 0x8001},     /*  20.0000, -180.0000 area around Midway Island  */  \
+  {0x071C, 0x91C8},     /*   5.0000, -155.0000 and dip south of Hawaii    */  \
+  {0x1555, 0x9C73},     /*  15.0000, -140.0000 Bump back north a tad to   */  \
+  {0x1555, 0xDC72},     /*  15.0000,  -50.0000 go east thru Caribbean     */  \
+  {0x238E, 0xD1C7},     /*  25.0000,  -65.0000 Cover PR as zig toward FL  */  \
+  {0x31C7, 0xD8E4},     /*  35.0000,  -55.0000 and zag from NC as continue*/  \
+  {0x4000, 0xE38E},     /*  45.0000,  -40.0000 n.e. past Nova Scotia      */  \
+  {0x71C6, 0xE38E}      /*  80.0000,  -40.0000 Back to first point        */  \
+}                       /* Note that first & last points must be the same */
+static const polyzone16_t USA_2_POLYZONE16 = {.n = USA_2_NUM_PTS, .v = USA_2_VERTICES};
+
+// Geozones, tested in this order
+static const geozone16_t GEOZONES[] =
+{
+  { GC_POLY,   { .poly  = &USA_1_POLYZONE16 } },
+  { GC_POLY,   { .poly  = &USA_2_POLYZONE16 } }
+};
+#define GEOZONE_CNT (sizeof(GEOZONES) / sizeof(GEOZONES[0]))
+
+// Bounding box of each zone of GEOZONES[], as GeofenceZoneBox()
+static const llurzone16_t GEOBOXES[GEOZONE_CNT] =
+{
+  { {0x4408,0x78EC}, {0x535C,0x7FFF} },  /* USA_1 */
+  { {0x071C,0x8001}, {0x71C6,0xE38E} }   /* USA_2 */
+};
+
+
+#endif  // GEOZONES_H__
@@ -0,0 +1,44 @@
+#ifndef GEOZONES_SLAB_H__
+#define GEOZONES_SLAB_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geozones_slab.h
+ *
+ *  DESCRIPTION   : Longitude slab index (polyslab16_t in geofence.h) of each
+ *    polygon zone of GEOZONES[] with GEOSLAB_MIN_EDGES or more edges, as
+ *    GEOSLABS[], included by geofence.c when GEOFENCE_USE_SLABS is 1.
+ *    GENERATED by host/geoslab.c from geozones.h, do not edit; run
+ *    "make -f host/Makefile geoslabs" after changing GEOZONES[].
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include "geofence.h"
+
+// GEOZONES[1]: 8 slabs, 26 edge entries, at most 4 in a slab
+static const int16_t GZ1_SLAB_LON[] =
+{
+  -32767, -30810, -28216, -26396, -25485, -11833, -10012,  -9102,  -7282
+};
+static const uint16_t GZ1_SLAB_FIRST[] =
+{
+      0,     4,     8,    12,    14,    16,    20,    24,    26
+};
+static const uint16_t GZ1_SLAB_EDGE[] =
+{
+      3,     5,     7,     9,     1,     5,     7,     9,     1,     5,
+      7,    10,     1,    10,     1,    11,     1,    11,    12,    13,
+      1,    11,    12,    14,     1,    14
+};
+static const polyslab16_t GZ1_SLAB =
+  { 8, GZ1_SLAB_LON, GZ1_SLAB_FIRST, GZ1_SLAB_EDGE };
+
+// Slab index of each zone of GEOZONES[], NULL when not indexed
+static const polyslab16_t * const GEOSLABS[GEOZONE_CNT] =
+{
+  NULL,     // GEOZONES[0]
+  &GZ1_SLAB      // GEOZONES[1]
+};
+
+#endif // GEOZONES_SLAB_H__
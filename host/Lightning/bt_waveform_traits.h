@@ -0,0 +1,113 @@
+#ifndef BT_WAVEFORM_TRAITS_H__
+#define BT_WAVEFORM_TRAITS_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : bt_waveform_traits.h  (host build stand-in)
+ *
+ *  DESCRIPTION   : The ESD shares this header with the sibling Lightning tree
+ *    (../Lightning), which is not part of the ESD repository.  This stand-in
+ *    declares only what main.c uses so that the host build links without it.
+ *    When ../Lightning is checked out next to the ESD its real header is found
+ *    first (quoted includes search the including file's directory first) and
+ *    this file is ignored.
+ *
+ *    Values are the ASCII characters exchanged with the Lightning per the BOLT
+ *    ICD wherever main.c treats them as such (slots, duty cycles, etc.).
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial stand-in for the Linux host build
+ */
+#include <stdint.h>
+
+
+//----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
+#define BOOT_MUTE         1       // ESD boots with exfil MUTE duty cycle
+#define TEMP_SCHED_CTDN   3       // squawks in a temporary MUTE-mode schedule
+
+#define WF_NAME_LEN       6       // characters in a D.WFI waveform name
+#define WF_TXID_LEN       6       // characters in a D.WFI transmitter ID
+#define MAX_WF            WF_SLOT4
+
+typedef uint8_t wfn_t[WF_NAME_LEN];
+
+typedef enum tagWAVEFORM_SLOT
+{
+  WF_SLOT0 = '0',
+  WF_SLOT1,
+  WF_SLOT2,
+  WF_SLOT3,
+  WF_SLOT4,
+} ws_t;
+
+typedef enum tagWAVEFORM_CLASS
+{ // waveform family reported as character D.WFI family field
+  WC_NA       = '@',
+  WC_TEST,
+  WC_AME6_1,  WC_AME6_2,  WC_AME6_3,
+  WC_AME8_1,  WC_AME8_2,  WC_AME8_3,
+  WC_UWRL_1,  WC_UWRL_2,  WC_UWRL_3,
+  WC_SHLN_1,  WC_SHLN_2,  WC_SHLN_3,
+  WC_PWRL_1,  WC_PWRL_2,  WC_PWRL_3,
+  WC_AME6_1G, WC_AME6_2G, WC_AME6_3G,
+  WC_AME8_1G, WC_AME8_2G, WC_AME8_3G,
+  WC_UWRL_1G, WC_UWRL_2G, WC_UWRL_3G,
+  WC_SHLN_1G, WC_SHLN_2G, WC_SHLN_3G,
+  WC_PWRL_1G, WC_PWRL_2G, WC_PWRL_3G,
+  WC_GTMAX,
+} wc_t;
+
+typedef struct tagWAVEFORM_INFO
+{ // overlays "<slot>,<family>,<name>,<txId>" following "D.WFI,"
+  uint8_t slot;
+  uint8_t sep1;
+  uint8_t family;
+  uint8_t sep2;
+  uint8_t name[WF_NAME_LEN];
+  uint8_t sep3;
+  uint8_t txId[WF_TXID_LEN];
+} wi_t;
+
+typedef enum tagWAVEFORM_BREVITY_RANGE
+{
+  WBR_NC = 0,                     // no codes
+  WBR_0T14,                       // 000..014
+  WBR_1T253,                      // 001..253
+  WBR_1T48_241T253,               // 001..048 and 241..253
+} wbr_t;
+
+typedef enum tagWAVEFORM_DUTY_CYCLE
+{
+  WDC_4 = 0,                      // 4/4 only
+  WDC_4_8_32,                     // 4/4, 4/8, 4/32
+  WDC_4_8_40,                     // 1/1, 1/2, 1/10
+} wdc_t;
+
+typedef enum tagWAVEFORM_TX_POWER
+{
+  WTP_N = 0,                      // normal only
+  WTP_A,                          // all of min, low, normal, max
+} wtp_t;
+
+typedef enum tagWAVEFORM_GEO_MUTING
+{ // ordering matters: main.c compares against WGM_NEVER and WGM_OVRDN
+  WGM_NA    = -1,                 // not applicable (erased NVMEM is 0xFFFF)
+  WGM_NEVER = 0,                  // waveform never geo-mutes
+  WGM_OVRDN,                      // geo-muting overridden by administrator
+  WGM_OUTGZ,                      // geo-muting used, outside of geozone
+  WGM_ACTVD,                      // geo-muting used, inside geozone (muted)
+} wgm_t;
+
+typedef enum tagTRANSMIT_DUTY_CYCLE
+{ // values from BOLT ICD used in C.TDC to Ltng
+  TDC_MUTE = '0',
+  TDC_SLOW,
+  TDC_NORM,
+  TDC_HIGH,
+} txdtycy_t;
+
+
+#endif  // BT_WAVEFORM_TRAITS_H__
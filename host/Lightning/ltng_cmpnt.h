@@ -0,0 +1,56 @@
+#ifndef LTNG_CMPNT_H__
+#define LTNG_CMPNT_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : ltng_cmpnt.h  (host build stand-in)
+ *
+ *  DESCRIPTION   : Stand-in for the sibling Lightning tree's component status
+ *    header; see bt_waveform_traits.h in this directory for how it is found.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial stand-in for the Linux host build
+ */
+#include <stdint.h>
+
+
+//----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
+typedef union tagLIGHTNING_COMPONENT_FLAGS
+{ // D.BIT report from Lightning, each field from a pair of hextext digits
+  struct
+  {
+    uint32_t exF  :8;             // Exfil (BOLT transmit) flags
+    uint32_t inF  :8;             // Infil (GDB receive) flags
+    uint32_t hwF  :8;             // Lightning hardware flags
+    uint32_t fwF  :8;             // Lightning firmware flags
+  };
+  struct                          // individual components named on BIT screen
+  {
+    uint32_t bolt   :1;           // exF BIT0: BOLT transmitter
+    uint32_t ota    :1;           // exF BIT1: over-the-air path
+    uint32_t rsvdE  :6;
+    uint32_t gdb    :1;           // inF BIT0: GDB receiver
+    uint32_t rsvdI  :7;
+    uint32_t rtcc   :1;           // hwF BIT0: real-time clock/calendar
+    uint32_t vbat   :1;           // hwF BIT1: battery voltage
+    uint32_t vmain  :1;           // hwF BIT2: main supply voltage
+    uint32_t vboost :1;           // hwF BIT3: boost supply voltage
+    uint32_t uc     :1;           // hwF BIT4: critical uC features
+    uint32_t ltsnsr :1;           // hwF BIT5: light sensor
+    uint32_t adc    :1;           // hwF BIT6: analog-to-digital converter
+    uint32_t brd    :1;           // hwF BIT7: board
+    uint32_t fw     :1;           // fwF BIT0: generic firmware
+    uint32_t esd    :1;           // fwF BIT1: ESD interface
+    uint32_t comx   :1;           // fwF BIT2: other serial comms
+    uint32_t i2c    :1;           // fwF BIT3: I2C bus
+    uint32_t nvmem  :1;           // fwF BIT4: non-volatile memory
+    uint32_t rsvdF  :3;
+  };
+  uint32_t val;
+} ltng_t;
+
+
+#endif  // LTNG_CMPNT_H__
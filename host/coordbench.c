@@ -0,0 +1,369 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordbench.c
+ *
+ *  DESCRIPTION   : Host tool that checks and times DblLatLonToMGRS() against
+ *    the reference (pre-rework) MGRS code of host/coordref.c over a vector set:
+ *    a 0.25 x 0.35 degree lattice over the globe, every lat band and UTM zone
+ *    edge (and the Norway/Svalbard lons and lats) at offsets of 1e-7 to 1e-3
+ *    degree either side, and random points.
+ *
+ *    MGRS strings (10 m) must match the golden ones, those of the reference
+ *    built with 64-bit double.  Built as coordbench_f, with XC16's 32-bit
+ *    double (host/include/short_double.h), both the reference and coords.c run
+ *    in float, as on the PIC24, and each is compared with the golden strings.
+ *    coordbench_c is coordbench_f with coords.c's COORDS_CORDIC_UTM opt-in,
+ *    its sines, cosines, atan2 and square root by cordic.c.
+ *
+ *    Both MGRS standards (SetMgrsStd()) and the reference are also classed
+ *    against the true strings of host/coordtrue.c (long double):  exact, off
+ *    by 10 m, off by more, wrong 100 km square letters, or wrong zone/band.
+ *    The 64-bit MGRS_2014 strings must be exact or off 10 m at most.
+ *
+ *    Host ns per call only rank the code.  The count of math library calls
+ *    per call (linker --wrap) carries over to the PIC24, where each is a
+ *    soft-float routine of hundreds to thousands of cycles.
+ *
+ *    Run by "make -f host/Makefile coordbench" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Name the CORDIC opt-in build (coordbench_c)
+ *      Read MGRS lines from coords_t memo
+ *      Compare both MGRS standards with host/coordtrue.c
+ *      Initial implementation
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "coords.h"
+#include "coordref.h"
+#include "coordtrue.h"
+
+#define VECTORS_MAX   1200000
+#define EXAMPLES_MAX  5
+
+typedef struct tagVECTOR
+{
+  int32_t lat;                    // 1e-7 degrees
+  int32_t lon;
+} vector_t;
+
+typedef enum
+{
+  LM_SIN, LM_COS, LM_TAN, LM_ATAN, LM_ATAN2, LM_SQRT, LM_POW, LM_FLOOR,
+  LM_LOG, LM_EXP, LM_SINCOS, LM_CNT
+} libm_t;
+
+typedef struct tagCONFORM
+{ // MGRS strings against the true ones
+  uint32_t exact;
+  uint32_t cell1;                 // easting and/or northing off by 10 m
+  uint32_t cells;                 // off by more than 10 m
+  uint32_t square;                // 100 km square letters only are wrong
+  uint32_t zone;                  // UTM zone or band is wrong
+} conform_t;
+
+typedef struct tagBENCH
+{
+  double   ns;                    // per call
+  uint64_t calls[LM_CNT];         // math library calls, all vectors
+} bench_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static const char * const LIBM_NAMES[LM_CNT] =
+{
+  "sin", "cos", "tan", "atan", "atan2", "sqrt", "pow", "floor", "log", "exp",
+  "sincos"
+};
+static uint64_t libmCalls[LM_CNT];
+static vector_t vectors[VECTORS_MAX];
+static uint32_t nVectors;
+static uint32_t rng = 0x2014A5A5;
+
+
+// Math library calls are counted by wrapping them (-Wl,--wrap=name), double
+// and float versions alike
+#define WRAP1(name, T, idx)                                                   \
+  T __real_##name(T x);                                                       \
+  T __wrap_##name(T x) { libmCalls[idx]++; return __real_##name(x); }
+#define WRAP2(name, T, idx)                                                   \
+  T __real_##name(T x, T y);                                                  \
+  T __wrap_##name(T x, T y) { libmCalls[idx]++; return __real_##name(x, y); }
+#define WRAPSC(name, T, idx)                                                  \
+  void __real_##name(T x, T * s, T * c);                                      \
+  void __wrap_##name(T x, T * s, T * c)                                       \
+  { libmCalls[idx]++; __real_##name(x, s, c); }
+
+#undef sin
+#undef cos
+#undef tan
+#undef atan
+#undef atan2
+#undef sqrt
+#undef pow
+#undef floor
+#undef log
+#undef exp
+#undef double
+WRAP1(sin,   double, LM_SIN)    WRAP1(sinf,   float, LM_SIN)
+WRAP1(cos,   double, LM_COS)    WRAP1(cosf,   float, LM_COS)
+WRAP1(tan,   double, LM_TAN)    WRAP1(tanf,   float, LM_TAN)
+WRAP1(atan,  double, LM_ATAN)   WRAP1(atanf,  float, LM_ATAN)
+WRAP2(atan2, double, LM_ATAN2)  WRAP2(atan2f, float, LM_ATAN2)
+WRAP1(sqrt,  double, LM_SQRT)   WRAP1(sqrtf,  float, LM_SQRT)
+WRAP2(pow,   double, LM_POW)    WRAP2(powf,   float, LM_POW)
+WRAP1(floor, double, LM_FLOOR)  WRAP1(floorf, float, LM_FLOOR)
+WRAP1(log,   double, LM_LOG)    WRAP1(logf,   float, LM_LOG)
+WRAP1(exp,   double, LM_EXP)    WRAP1(expf,   float, LM_EXP)
+WRAPSC(sincos, double, LM_SINCOS) WRAPSC(sincosf, float, LM_SINCOS)
+#ifdef COORDREF_SHORT_DOUBLE
+#define double float
+#endif
+
+
+static void AddVector(double lat, double lon)
+{
+  if ((nVectors < VECTORS_MAX) && (-90.0 <= lat) && (90.0 >= lat) &&
+      (-180.0 <= lon) && (180.0 >= lon))
+  {
+    vectors[nVectors].lat = (int32_t)(lat * 1e7 + ((lat < 0) ? -0.5 : 0.5));
+    vectors[nVectors].lon = (int32_t)(lon * 1e7 + ((lon < 0) ? -0.5 : 0.5));
+    nVectors++;
+  }
+} // end routine AddVector
+
+
+static void MakeVectors(void)
+{
+  static const int16_t EDGE_LATS[] = { 56, 64, 72 };
+  static const int16_t EDGE_LONS[] = { 3, 9, 21, 33 };
+  static const int32_t OFFSETS[] = { -10000, -100, -1, 0, 1, 100, 10000 };
+  int32_t i, j, a, b;
+
+  for (i = -360; i <= 360; i++)
+  { // lattice, clear of exact band and zone edges
+    for (j = -514; j <= 514; j++) {
+      AddVector(i * 0.25 + 0.0012345, j * 0.35 + 0.0023456); }
+  }
+  for (i = -80; i <= 88; i += 8)
+  { // band edges (84 for UPS) by zone edges, Norway & Svalbard included
+    for (j = -180; j <= 186; j++)
+    {
+      for (a = 0; (a < 4) && (EDGE_LONS[a] != j); a++) {}
+      if ((0 != (j % 6)) && (4 == a)) {
+        continue;                     }   // neither zone edge nor Norway's
+      for (a = 0; a < 7; a++)
+      {
+        for (b = 0; b < 7; b++)
+        {
+          AddVector(((88 == i) ? 84 : i) + OFFSETS[a] / 1e7, j + OFFSETS[b] / 1e7);
+        }
+      }
+    }
+  }
+  for (i = 0; i < 3; i++)
+  { // zone 32V / 31X-37X lat limits at every 3 degrees of lon
+    for (j = 0; j <= 42; j += 3)
+    {
+      for (a = 0; a < 7; a++)  {
+        AddVector(EDGE_LATS[i] + OFFSETS[a] / 1e7, j + 0.5); }
+    }
+  }
+  while (nVectors < VECTORS_MAX)
+  {
+    rng = rng * 1664525u + 1013904223u;
+    a   = (int32_t)(rng % 1800000001u) - 900000000;
+    rng = rng * 1664525u + 1013904223u;
+    b   = (int32_t)(rng % 3600000001u) - 1800000000;
+    AddVector(a / 1e7, b / 1e7);
+  }
+} // end routine MakeVectors
+
+
+static void NewMGRS(const vector_t * pV, char * gzd, char * m10)
+{
+  coords_t coord;
+
+  coord.dblLat = pV->lat / 1e7;
+  coord.dblLon = pV->lon / 1e7;
+  DblLatLonToMGRS(&coord);
+  memcpy(gzd, coord.memo.line[0], COORD_LEN + 1);
+  memcpy(m10, coord.memo.line[1], COORD_LEN + 1);
+} // end routine NewMGRS
+
+
+static void NewMGRS1989(const vector_t * pV, char * gzd, char * m10)
+{
+  SetMgrsStd(MGRS_1989);
+  NewMGRS(pV, gzd, m10);
+} // end routine NewMGRS1989
+
+
+static void NewMGRS2014(const vector_t * pV, char * gzd, char * m10)
+{
+  SetMgrsStd(MGRS_2014);
+  NewMGRS(pV, gzd, m10);
+} // end routine NewMGRS2014
+
+
+static void RefMGRS(const vector_t * pV, char * gzd, char * m10)
+{
+  REF_LAT_LON_TO_MGRS(pV->lat, pV->lon, gzd, m10);
+} // end routine RefMGRS
+
+
+// Classify an MGRS string pair against the true one
+static void Conform(const char * gzd, const char * m10, const char * gzdTrue,
+                    const char * m10True, conform_t * pC)
+{
+  int16_t east, north, eastTrue, northTrue, dE, dN;
+
+  if ((0 == strcmp(gzd, gzdTrue)) && (0 == strcmp(m10, m10True)))
+  {
+    pC->exact++;
+    return;
+  }
+  if ((' ' != gzdTrue[0]) && (0 != strncmp(gzd, gzdTrue, 3)))
+  {
+    pC->zone++;
+    return;
+  }
+  sscanf(m10, "%hd %hd", &east, &north);
+  sscanf(m10True, "%hd %hd", &eastTrue, &northTrue);
+  dE = abs(east - eastTrue);                // 10 m cells, within 100 km square
+  dN = abs(north - northTrue);
+  dE = (5000 < dE) ? (10000 - dE) : dE;
+  dN = (5000 < dN) ? (10000 - dN) : dN;
+  if ((0 == dE) && (0 == dN))  {
+    pC->square++;              }
+  else if ((1 >= dE) && (1 >= dN)) {
+    pC->cell1++;               }
+  else                         {
+    pC->cells++;               }
+} // end routine Conform
+
+
+static void Bench(void (*pFn)(const vector_t *, char *, char *), bench_t * pB)
+{
+  struct timespec t0, t1;
+  char            gzd[COORD_LEN + 1];
+  char            m10[COORD_LEN + 1];
+  uint32_t        i;
+
+  memset(libmCalls, 0, sizeof(libmCalls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (i = 0; i < nVectors; i++)  {
+    pFn(&vectors[i], gzd, m10);   }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  memcpy(pB->calls, libmCalls, sizeof(libmCalls));
+  pB->ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) /
+           nVectors;
+} // end routine Bench
+
+
+static void PrintBench(const char * name, const bench_t * pB,
+                       const conform_t * pC)
+{
+  uint64_t total = 0;
+  int16_t  i;
+
+  for (i = 0; i < LM_CNT; i++)  {
+    total += pB->calls[i];      }
+  total += pB->calls[LM_SINCOS];  // XC16 has no sincos(), it's sin() & cos()
+  printf("  %-10s %5.0f ns %8u %7u %7u %7u %7u  %5.2f libm:", name, pB->ns,
+         pC->exact, pC->cell1, pC->cells, pC->square, pC->zone,
+         (float)total / nVectors);
+  for (i = 0; i < LM_CNT; i++)
+  {
+    if (0 != pB->calls[i])  {
+      printf(" %s %.2f", LIBM_NAMES[i], (float)pB->calls[i] / nVectors); }
+  }
+  printf("\n");
+} // end routine PrintBench
+
+
+static void PrintExample(const char * what, const vector_t * pV,
+                         const char * gzdTrue, const char * m10True,
+                         const char * gzd, const char * m10)
+{
+  printf("    %12.7f %13.7f  true %s %s  %s %s %s\n", pV->lat / 1e7,
+         pV->lon / 1e7, gzdTrue, m10True, what, gzd, m10);
+} // end routine PrintExample
+
+
+int main(void)
+{
+  char      gzdGold[COORD_LEN + 1], m10Gold[COORD_LEN + 1];
+  char      gzdTrue[COORD_LEN + 1], m10True[COORD_LEN + 1];
+  char      gzdRef[COORD_LEN + 1],  m10Ref[COORD_LEN + 1];
+  char      gzd89[COORD_LEN + 1],   m1089[COORD_LEN + 1];
+  char      gzd14[COORD_LEN + 1],   m1014[COORD_LEN + 1];
+  bench_t   ref, std89, std14;
+  conform_t cRef = { 0 }, c89 = { 0 }, c14 = { 0 };
+  uint32_t  refWrong = 0;
+  uint32_t  newWrong = 0;
+  uint32_t  differ = 0;
+  uint16_t  nExamples = 0;
+  uint16_t  nExamples14 = 0;
+  uint32_t  cells14;
+  uint32_t  i;
+
+  MakeVectors();
+#ifdef COORDREF_SHORT_DOUBLE
+  printf("MGRS, 32-bit double (XC16)%s, %u vectors\n",
+         (1 == COORDS_CORDIC_UTM) ? ", CORDIC UTM & UPS" : "", nVectors);
+#else
+  printf("MGRS, 64-bit double%s, %u vectors\n",
+         (1 == COORDS_CORDIC_UTM) ? ", CORDIC UTM & UPS" : "", nVectors);
+#endif
+  for (i = 0; i < nVectors; i++)
+  {
+    RefLatLonToMGRS(vectors[i].lat, vectors[i].lon, gzdGold, m10Gold);
+    TrueLatLonToMGRS(vectors[i].lat, vectors[i].lon, gzdTrue, m10True);
+    RefMGRS(&vectors[i], gzdRef, m10Ref);
+    NewMGRS1989(&vectors[i], gzd89, m1089);
+    NewMGRS2014(&vectors[i], gzd14, m1014);
+    refWrong += (0 != strcmp(gzdRef, gzdGold)) || (0 != strcmp(m10Ref, m10Gold));
+    newWrong += (0 != strcmp(gzd89, gzdGold)) || (0 != strcmp(m1089, m10Gold));
+    if ((0 != strcmp(gzd89, gzdRef)) || (0 != strcmp(m1089, m10Ref)))
+    {
+      differ++;
+      if (nExamples++ < EXAMPLES_MAX)
+      {
+        printf("    %12.7f %13.7f  golden %s %s  reference %s %s  now %s %s\n",
+               vectors[i].lat / 1e7, vectors[i].lon / 1e7, gzdGold, m10Gold,
+               gzdRef, m10Ref, gzd89, m1089);
+      }
+    }
+    Conform(gzdRef, m10Ref, gzdTrue, m10True, &cRef);
+    Conform(gzd89, m1089, gzdTrue, m10True, &c89);
+    cells14 = c14.cells + c14.square;
+    Conform(gzd14, m1014, gzdTrue, m10True, &c14);
+    if ((cells14 != c14.cells + c14.square) && (nExamples14++ < EXAMPLES_MAX)) {
+      PrintExample("2014", &vectors[i], gzdTrue, m10True, gzd14, m1014);      }
+  }
+  Bench(RefMGRS, &ref);
+  Bench(NewMGRS1989, &std89);
+  Bench(NewMGRS2014, &std14);
+  SetMgrsStd(MGRS_STD);
+  printf("  vs true:      time    exact   10 m   >10 m  square    zone   calls\n");
+  PrintBench("reference", &ref, &cRef);
+  PrintBench("1989", &std89, &c89);
+  PrintBench("2014", &std14, &c14);
+  printf("  1989 not golden at 10 m:  reference %u, coords.c %u;  differ %u\n",
+         refWrong, newWrong, differ);
+#ifdef COORDREF_SHORT_DOUBLE
+  return EXIT_SUCCESS;            // float misses golden, count for comparison
+#else
+  return ((0 == newWrong) &&
+          (nVectors == c14.exact + c14.cell1)) ? EXIT_SUCCESS : EXIT_FAILURE;
+#endif
+} // end function main
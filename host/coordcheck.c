@@ -0,0 +1,765 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordcheck.c
+ *
+ *  DESCRIPTION   : Host tool that checks and times coords.c against the
+ *    reference vectors of host/coordvec.csv (written by host/coordvec.c):
+ *
+ *      DblLatLonToMGRS()   both standards, classed as host/coordbench.c does:
+ *                          exact, off by 10 m, off by more, wrong 100 km
+ *                          square letters, or wrong zone/band
+ *      RenderCoords()      CF_DMS and CF_DEC lines of SetCoordsFromDecLatLon()
+ *                          input, which must be exact
+ *      CoordsToGeopt16()   geopt16_t of D and R points, which must be exact
+ *      HexDegToPt32()      0.00001 degrees, or COORD_ERR_PT
+ *      CalcRngBrg()        range and bearing text (SetGeoTrig() of each point)
+ *
+ *    Degrees, range, and bearing are wrong by how far the exact value lies
+ *    outside what the result shows (a 3-char range from "123" meters covers
+ *    122.5 up to 123.5 m), and pass within the tolerances below:  those of
+ *    64-bit double, or with XC16's 32-bit double (coordcheck_f, built with
+ *    host/include/short_double.h) what float input and math allow.  MGRS of
+ *    either standard must be exact or off 10 m with 64-bit double; with 32-bit
+ *    double the 100 km square letters must be right, and the zone and band
+ *    but within float resolution of a zone or band edge.  Exits with failure
+ *    otherwise.  coordcheck_c is the 32-bit double
+ *    build with both COORDS_CORDIC_* opt-ins (coords.h), to the same
+ *    tolerances.
+ *
+ *    Host ns per call only rank the code, for comparing a change with the
+ *    code before it.  "fix pipeline" times what a fix and a PLI cost together
+ *    (D.GLL text to fix & trig, CoordsToGeopt16(), PLI hex to geopt32_t &
+ *    trig, and their CalcRngBrg()).
+ *
+ *    Run by "make -f host/Makefile coordcheck" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      MGRS_1989 checked as strictly as MGRS_2014; wrong square letters fail
+ *      at either double
+ *      Title names the COORDS_CORDIC_* opt-ins built in (coordcheck_c)
+ *      Check CoordsToGeopt16() and HexDegToPt32() (was HexDegToDblDeg()),
+ *      CalcRngBrg() of geopt32_t to its fixed-point tolerances, the same at
+ *      either double; time the per-fix pipeline
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "coords.h"
+
+#ifdef COORDREF_SHORT_DOUBLE
+#undef double                     // long double for the exact values, and
+typedef long double exact_t;
+#define double float              // double as XC16's for calls to coords.c
+#else
+typedef long double exact_t;
+#endif
+
+#define VEC_PATH     "host/coordvec.csv"
+#define VECTORS_MAX  4000         // of each kind
+#define EXAMPLES_MAX 3
+#define TIME_NS_MIN  20000000     // each function timed over its vectors
+                                  // until this long
+#define DEG_M        111195.0L    // meters per degree of great circle
+#define PI_L         3.141592653589793238L
+#define BRG_MAX_M    100          // bearing max error over ranges this long
+
+// HexDegToPt32() and CalcRngBrg() are fixed point, the same at either double
+#define HEX_TOL_DEG  0.0000050001L  // rounded to 0.00001 degree
+#define RNG_TOL_M    0.02L        // Q30 sines & cosines, a few ~6 mm lsbs
+#define BRG_TOL_M    0.02L        // as meters across the range (so any
+                                  // bearing is within it of a closer point)
+#define RNG_TOL_REL  1e-8L
+#define BRG_TOL_DEG  0.000001L
+#ifdef COORDREF_SHORT_DOUBLE
+#define EDGE_DEG     0.00002L     // float resolution at 180 degrees (x1.3)
+#define MGRS_STRICT  false        // MGRS exact or off 10 m
+#else
+#define EDGE_DEG     0.0L
+#define MGRS_STRICT  true
+#endif
+
+typedef struct tagMGRS_VECTOR
+{
+  int32_t lat;                    // 1e-7 degrees
+  int32_t lon;
+  char    gzd[COORD_LEN + 1];     // trailing ' ' trimmed
+  char    m10[COORD_LEN + 1];
+} mgrsvec_t;
+
+typedef struct tagDMS_VECTOR
+{
+  int32_t lat;                    // 1e-5 degrees
+  int32_t lon;
+  char    line[4][COORD_LEN + 1]; // DMS lat & lon, DEC lat & lon
+} dmsvec_t;
+
+typedef struct tagHEX_VECTOR
+{
+  char        hex[12];
+  bool        isLat;
+  bool        isErr;
+  exact_t deg;
+} hexvec_t;
+
+typedef struct tagRNG_BRG_VECTOR
+{
+  int32_t     fr[2];              // lat & lon, 1e-5 degrees
+  int32_t     to[2];
+  exact_t m;
+  exact_t deg;
+} rbvec_t;
+
+typedef struct tagCHECK
+{ // results of one function
+  uint32_t    n;
+  uint32_t    exact;              // MGRS classes as conform_t of coordbench.c
+  uint32_t    cell1;
+  uint32_t    cells;
+  uint32_t    square;
+  uint32_t    zone;
+  uint32_t    edge;               // zone/band wrong within EDGE_DEG of edge
+  uint32_t    wrong;              // outside tolerance
+  exact_t maxErr;             // beyond what is shown
+  double      ns;
+  uint16_t    examples;
+} check_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static mgrsvec_t mgrsVecs[VECTORS_MAX];
+static dmsvec_t  dmsVecs[VECTORS_MAX];
+static hexvec_t  hexVecs[VECTORS_MAX];
+static rbvec_t   rbVecs[VECTORS_MAX];
+static uint32_t  nMgrs, nDms, nHex, nRb;
+static volatile int32_t sink;     // keeps timed calls from being dropped
+
+typedef struct tagFIX_TEXT
+{ // R vector as the pipeline receives it:  D.GLL fr, PLI hex to
+  char        dec[2][16];
+  char        hex[2][12];
+} fixtext_t;
+static fixtext_t fixTexts[VECTORS_MAX];
+
+
+// Copy field, up to ',' or end of line (at most size - 1 chars), returning
+// the next one
+static char * Field(char * p, char * dst, size_t size)
+{
+  size_t n = 0;
+
+  while (*p && (',' != *p) && ('\n' != *p))
+  {
+    if (n + 1 < size)  {
+      dst[n++] = *p;   }
+    p++;
+  }
+  dst[n] = '\0';
+  return (',' == *p) ? (p + 1) : p;
+} // end routine Field
+
+
+static bool LoadVectors(const char * path)
+{
+  FILE * pF = fopen(path, "r");
+  char   line[256], f[8][32];
+  char * p;
+  int    i;
+
+  if (NULL == pF)
+  {
+    fprintf(stderr, "coordcheck: can't open %s\n", path);
+    return false;
+  }
+  while (fgets(line, sizeof(line), pF))
+  {
+    for (p = line, i = 0; i < 8; i++)  {
+      p = Field(p, f[i], sizeof(f[i])); }
+    if (('M' == f[0][0]) && (nMgrs < VECTORS_MAX))
+    {
+      mgrsvec_t * pV = &mgrsVecs[nMgrs++];
+      pV->lat = strtol(f[1], NULL, 10);
+      pV->lon = strtol(f[2], NULL, 10);
+      Field(f[3], pV->gzd, sizeof(pV->gzd));
+      Field(f[4], pV->m10, sizeof(pV->m10));
+    }
+    else if (('D' == f[0][0]) && (nDms < VECTORS_MAX))
+    {
+      dmsvec_t * pV = &dmsVecs[nDms++];
+      pV->lat = strtol(f[1], NULL, 10);
+      pV->lon = strtol(f[2], NULL, 10);
+      for (i = 0; i < 4; i++)  {
+        Field(f[3 + i], pV->line[i], sizeof(pV->line[i])); }
+    }
+    else if (('H' == f[0][0]) && (nHex < VECTORS_MAX))
+    {
+      hexvec_t * pV = &hexVecs[nHex++];
+      Field(f[1], pV->hex, sizeof(pV->hex));
+      pV->isLat = ('1' == f[2][0]);
+      pV->isErr = (0 == strcmp(f[3], "ERR"));
+      pV->deg   = pV->isErr ? 0 : strtold(f[3], NULL);
+    }
+    else if (('R' == f[0][0]) && (nRb < VECTORS_MAX))
+    {
+      rbvec_t * pV = &rbVecs[nRb++];
+      for (i = 0; i < 2; i++)
+      {
+        pV->fr[i] = strtol(f[1 + i], NULL, 10);
+        pV->to[i] = strtol(f[3 + i], NULL, 10);
+      }
+      pV->m   = strtold(f[5], NULL);
+      pV->deg = strtold(f[6], NULL);
+    }
+  }
+  fclose(pF);
+  return (0 != nMgrs) && (0 != nDms) && (0 != nHex) && (0 != nRb);
+} // end routine LoadVectors
+
+
+static double NsPerCall(struct timespec * pT0, uint32_t calls)
+{
+  struct timespec t1;
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  return ((t1.tv_sec - pT0->tv_sec) * 1e9 + (t1.tv_nsec - pT0->tv_nsec)) /
+         calls;
+} // end routine NsPerCall
+
+
+static void TrimCopy(char * dst, const char * src)
+{
+  int n;
+
+  strcpy(dst, src);
+  for (n = strlen(dst); n && (' ' == dst[n - 1]); n--) {}
+  dst[n] = '\0';
+} // end routine TrimCopy
+
+
+//----- MGRS -------------------------------------------------------------------
+static void MgrsOf(const mgrsvec_t * pV, char * gzd, char * m10)
+{
+  coords_t coord;
+
+  coord.dblLat = pV->lat / 1e7;
+  coord.dblLon = pV->lon / 1e7;
+  DblLatLonToMGRS(&coord);
+  TrimCopy(gzd, coord.memo.line[0]);
+  TrimCopy(m10, coord.memo.line[1]);
+} // end routine MgrsOf
+
+
+// Within float resolution of a band or zone edge (Norway & Svalbard, UPS too)
+static bool NearEdge(const mgrsvec_t * pV)
+{
+  static const exact_t EDGE_LONS[] = { 3, 9, 21, 33 };
+  exact_t lat = pV->lat / 1e7L;
+  exact_t lon = pV->lon / 1e7L;
+  int         i;
+
+  if ((EDGE_DEG >= fabsl(lat - 8 * roundl(lat / 8))) ||
+      (EDGE_DEG >= fabsl(lat - 84)) ||
+      (EDGE_DEG >= fabsl(lon - 6 * roundl(lon / 6))))  {
+    return true;                                       }
+  for (i = 0; i < 4; i++)
+  {
+    if (EDGE_DEG >= fabsl(lon - EDGE_LONS[i]))  {
+      return true;                              }
+  }
+  return false;
+} // end routine NearEdge
+
+
+// isStrict:  only exact or off 10 m pass, else only wrong square letters or a
+// wrong zone/band fail
+static void CheckMgrs(uint16_t std, bool isStrict, check_t * pC)
+{
+  struct timespec t0;
+  char     gzd[COORD_LEN + 1], m10[COORD_LEN + 1];
+  int16_t  east, north, eastTrue, northTrue, dE, dN;
+  uint32_t i, calls;
+
+  memset(pC, 0, sizeof(*pC));
+  SetMgrsStd(std);
+  for (i = 0; i < nMgrs; i++)
+  {
+    const mgrsvec_t * pV = &mgrsVecs[i];
+    bool              isWrong = isStrict;
+
+    pC->n++;
+    MgrsOf(pV, gzd, m10);
+    if ((0 == strcmp(gzd, pV->gzd)) && (0 == strcmp(m10, pV->m10)))
+    {
+      pC->exact++;
+      continue;
+    }
+    if ((' ' == pV->gzd[0]) ? (('B' >= gzd[2]) != ('B' >= pV->gzd[2]))
+                            : (0 != strncmp(gzd, pV->gzd, 3)))
+    { // UPS zones A & B, or Y & Z, meet at the pole
+      if (NearEdge(pV))
+      {
+        pC->edge++;
+        continue;
+      }
+      pC->zone++;
+      isWrong = true;
+    }
+    else
+    {
+      sscanf(m10, "%hd %hd", &east, &north);
+      sscanf(pV->m10, "%hd %hd", &eastTrue, &northTrue);
+      dE = abs(east - eastTrue);            // 10 m cells, within 100 km square
+      dN = abs(north - northTrue);
+      dE = (5000 < dE) ? (10000 - dE) : dE;
+      dN = (5000 < dN) ? (10000 - dN) : dN;
+      if ((0 == dE) && (0 == dN))       {
+        pC->square++; isWrong = true;   }
+      else if ((1 >= dE) && (1 >= dN))  {
+        pC->cell1++;  isWrong = false;  }
+      else                              {
+        pC->cells++;                    }
+    }
+    if (isWrong && (pC->examples++ < EXAMPLES_MAX))
+    {
+      printf("    %12.7f %13.7f  true %s %s  MGRS_%u %s %s\n", pV->lat / 1e7,
+             pV->lon / 1e7, pV->gzd, pV->m10, std, gzd, m10);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nMgrs)
+  {
+    for (i = 0; i < nMgrs; i++)  {
+      MgrsOf(&mgrsVecs[i], gzd, m10); }
+  }
+  pC->ns = NsPerCall(&t0, calls);
+  SetMgrsStd(MGRS_STD);
+} // end routine CheckMgrs
+
+
+//----- DMS & DEC --------------------------------------------------------------
+static void RenderOf(const dmsvec_t * pV, coordfmt_t fmt, coords_t * pCoord)
+{
+  char lat[16], lon[16];
+
+  sprintf(lat, "%c%03ld.%05ld", (0 > pV->lat) ? '-' : '+',
+          labs(pV->lat) / 100000, labs(pV->lat) % 100000);
+  sprintf(lon, "%c%03ld.%05ld", (0 > pV->lon) ? '-' : '+',
+          labs(pV->lon) / 100000, labs(pV->lon) % 100000);
+  ClearCoords(pCoord);
+  SetCoordsFromDecLatLon(pCoord, lat, lon);
+  RenderCoords(pCoord, fmt);
+} // end routine RenderOf
+
+
+static void CheckRender(coordfmt_t fmt, check_t * pC)
+{
+  struct timespec t0;
+  coords_t coord;
+  uint32_t i, calls;
+  int      j = (CF_DMS == fmt) ? 0 : 2;
+
+  memset(pC, 0, sizeof(*pC));
+  for (i = 0; i < nDms; i++)
+  {
+    const dmsvec_t * pV = &dmsVecs[i];
+
+    pC->n++;
+    RenderOf(pV, fmt, &coord);
+    if ((0 == strcmp(coord.memo.line[0], pV->line[j])) &&
+        (0 == strcmp(coord.memo.line[1], pV->line[j + 1])))
+    {
+      pC->exact++;
+      continue;
+    }
+    pC->wrong++;
+    if (pC->examples++ < EXAMPLES_MAX)
+    {
+      printf("    %9.5f %10.5f  true %s %s  got %s %s\n", pV->lat / 1e5,
+             pV->lon / 1e5, pV->line[j], pV->line[j + 1], coord.memo.line[0],
+             coord.memo.line[1]);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nDms)
+  {
+    for (i = 0; i < nDms; i++)  {
+      RenderOf(&dmsVecs[i], fmt, &coord); }
+  }
+  pC->ns = NsPerCall(&t0, calls);
+} // end routine CheckRender
+
+
+//----- geopt16_t -------------------------------------------------------------
+// Exact truncation toward 0 of deg * 32767 / (90 or 180)
+static bool Geopt16Is(geopt32_t pt, check_t * pC)
+{
+  coords_t  coord;
+  geopt16_t p16;
+
+  pC->n++;
+  coord.pt = pt;
+  CoordsToGeopt16(&coord, &p16);
+  if ((p16.lat == (int16_t)(pt.lat * 32767LL /  (90 * GEOPT32_PER_DEG))) &&
+      (p16.lon == (int16_t)(pt.lon * 32767LL / (180 * GEOPT32_PER_DEG))))
+  {
+    pC->exact++;
+    return true;
+  }
+  pC->wrong++;
+  if (pC->examples++ < EXAMPLES_MAX)
+  {
+    printf("    %9.5f %10.5f  got %d %d\n", pt.lat / 1e5, pt.lon / 1e5,
+           p16.lat, p16.lon);
+  }
+  return false;
+} // end routine Geopt16Is
+
+
+static void CheckGeopt16(check_t * pC)
+{
+  struct timespec t0;
+  coords_t  coord;
+  geopt16_t p16;
+  geopt32_t pt;
+  uint32_t  i, calls;
+
+  memset(pC, 0, sizeof(*pC));
+  for (i = 0; i < nDms; i++)
+  {
+    pt.lat = dmsVecs[i].lat;   pt.lon = dmsVecs[i].lon;
+    Geopt16Is(pt, pC);
+  }
+  for (i = 0; i < nRb; i++)
+  {
+    pt.lat = rbVecs[i].fr[0];  pt.lon = rbVecs[i].fr[1];
+    Geopt16Is(pt, pC);
+    pt.lat = rbVecs[i].to[0];  pt.lon = rbVecs[i].to[1];
+    Geopt16Is(pt, pC);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nRb)
+  {
+    for (i = 0; i < nRb; i++)
+    {
+      coord.pt.lat = rbVecs[i].to[0];  coord.pt.lon = rbVecs[i].to[1];
+      CoordsToGeopt16(&coord, &p16);
+      sink = p16.lat;
+    }
+  }
+  pC->ns = NsPerCall(&t0, calls);
+} // end routine CheckGeopt16
+
+
+//----- hex degrees ------------------------------------------------------------
+static void CheckHex(check_t * pC)
+{
+  struct timespec t0;
+  exact_t     tol, err;
+  int32_t     pt;
+  uint32_t    i, calls;
+
+  memset(pC, 0, sizeof(*pC));
+  for (i = 0; i < nHex; i++)
+  {
+    hexvec_t * pV = &hexVecs[i];
+    bool       isErr;
+
+    pC->n++;
+    pt    = HexDegToPt32(pV->hex, pV->isLat);
+    isErr = (COORD_ERR_PT == pt);
+    tol   = HEX_TOL_DEG;
+    err   = (isErr || pV->isErr) ? 0 : fabsl(pt / 1e5L - pV->deg);
+    if ((isErr != pV->isErr) && (8 == strlen(pV->hex)))
+    { // error or not within tol of the range limit may be either
+      exact_t limit = pV->isLat ? 90 : 180;
+      exact_t exact = (int32_t)strtoul(pV->hex, NULL, 16) * 360.0L /
+                          4294967295.0L;
+      err = fabsl(fabsl(exact) - limit);
+      if (tol < err)  {
+        err = 360;    }                     // wrong by error alone
+    }
+    if (pC->maxErr < err)  {
+      pC->maxErr = err;    }
+    if (0 == err)      {
+      pC->exact++;     }
+    else if (tol >= err)  {
+      pC->cell1++;     }
+    else
+    {
+      pC->wrong++;
+      if (pC->examples++ < EXAMPLES_MAX)
+      {
+        printf("    %s %s  true %.12Lf%s  got %d\n", pV->hex,
+               pV->isLat ? "lat" : "lon", pV->deg, pV->isErr ? " ERR" : "",
+               pt);
+      }
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nHex)
+  {
+    for (i = 0; i < nHex; i++)  {
+      sink = HexDegToPt32(hexVecs[i].hex, hexVecs[i].isLat); }
+  }
+  pC->ns = NsPerCall(&t0, calls);
+} // end routine CheckHex
+
+
+//----- range & bearing --------------------------------------------------------
+// Meters shown by CalcRngBrg() range text as [lo, hi), false if not a range
+static bool RangeShown(const char * rng, bool isKm, exact_t * pLo,
+                       exact_t * pHi)
+{
+  exact_t v;
+
+  if (0 == strncmp(rng, "###", 3))
+  {
+    *pLo = 999500;
+    *pHi = INFINITY;
+    return isKm;
+  }
+  if (('.' == rng[1]) && isKm)
+  { // K.m, up to 9.9495 km (10.0 shows as 010)
+    v    = (rng[0] - '0') + (rng[2] - '0') / 10.0L;
+    *pLo = (v - 0.05L) * 1000;
+    *pHi = fminl(v + 0.05L, 9.9495L) * 1000;
+    return (0 <= rng[0] - '0') && (9 >= rng[0] - '0');
+  }
+  v    = strtol(rng, NULL, 10);
+  *pLo = (v - 0.5L) * (isKm ? 1000 : 1);
+  *pHi = (v + ((999 == v) ? 1 : 0.5L)) * (isKm ? 1000 : 1); // 999 rounds down
+  if (isKm && (10 == v))  {
+    *pLo = 9949.5L;       }
+  return isKm ? (10 <= v) : (1000 > v);
+} // end routine RangeShown
+
+
+static void RngBrgOf(const rbvec_t * pV, char * rng, char * brg, bool * pIsKm)
+{
+  geopt32_t fr, to;
+  geotrig_t frTrig, toTrig;
+
+  fr.lat = pV->fr[0];   fr.lon = pV->fr[1];
+  to.lat = pV->to[0];   to.lon = pV->to[1];
+  SetGeoTrig(fr, &frTrig);
+  SetGeoTrig(to, &toTrig);
+  *pIsKm = CalcRngBrg(fr, &frTrig, to, &toTrig, rng, brg);
+} // end routine RngBrgOf
+
+
+static void CheckRngBrg(check_t * pRng, check_t * pBrg)
+{
+  struct timespec t0;
+  char        rng[8], brg[8];
+  bool        isKm;
+  exact_t lo, hi, err, tol, d;
+  uint32_t    i, calls;
+
+  memset(pRng, 0, sizeof(*pRng));
+  memset(pBrg, 0, sizeof(*pBrg));
+  for (i = 0; i < nRb; i++)
+  {
+    const rbvec_t * pV = &rbVecs[i];
+
+    memset(rng, 0, sizeof(rng));
+    memset(brg, 0, sizeof(brg));
+    RngBrgOf(pV, rng, brg, &isKm);
+
+    pRng->n++;                                // range
+    tol = RNG_TOL_M + RNG_TOL_REL * pV->m;
+    err = RangeShown(rng, isKm, &lo, &hi) ?
+          ((pV->m < lo) ? (lo - pV->m) : (pV->m >= hi) ? (pV->m - hi) : 0) :
+          INFINITY;
+    if (pRng->maxErr < err)  {
+      pRng->maxErr = err;    }
+    if (0 == err)            {
+      pRng->exact++;         }
+    else if (tol >= err)     {
+      pRng->cell1++;         }
+    else
+    {
+      pRng->wrong++;
+      if (pRng->examples++ < EXAMPLES_MAX)
+      {
+        printf("    %9.5f %10.5f to %9.5f %10.5f  true %.4Lf m  got %.3s%s\n",
+               pV->fr[0] / 1e5, pV->fr[1] / 1e5, pV->to[0] / 1e5,
+               pV->to[1] / 1e5, pV->m, rng, isKm ? " km" : " m");
+      }
+    }
+
+    pBrg->n++;                                // bearing, 0.5 degree either side
+    tol = (BRG_TOL_M < pV->m) ? (asinl(BRG_TOL_M / pV->m) * 180 / PI_L) : 180;
+    tol += BRG_TOL_DEG;
+    d   = pV->deg - strtol(brg, NULL, 10);
+    d  -= 360 * roundl(d / 360);
+    err = (0.5L > fabsl(d)) || (0.5L == d) ? 0 : (fabsl(d) - 0.5L);
+    if ((BRG_MAX_M <= pV->m) && (pBrg->maxErr < err))  {
+      pBrg->maxErr = err;                              }
+    if (0 == err)            {
+      pBrg->exact++;         }
+    else if (tol >= err)     {
+      pBrg->cell1++;         }
+    else
+    {
+      pBrg->wrong++;
+      if (pBrg->examples++ < EXAMPLES_MAX)
+      {
+        printf("    %9.5f %10.5f to %9.5f %10.5f  true %.6Lf deg  got %.3s\n",
+               pV->fr[0] / 1e5, pV->fr[1] / 1e5, pV->to[0] / 1e5,
+               pV->to[1] / 1e5, pV->deg, brg);
+      }
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nRb)
+  {
+    for (i = 0; i < nRb; i++)  {
+      RngBrgOf(&rbVecs[i], rng, brg, &isKm); }
+  }
+  pRng->ns = pBrg->ns = NsPerCall(&t0, calls);
+} // end routine CheckRngBrg
+
+
+//----- per-fix pipeline -------------------------------------------------------
+// D.GLL fix to fix & trig and geopt16_t, and PLI hex to geopt32_t & trig, then
+// their range & bearing:  what main.c does with each
+static void FixOf(fixtext_t * pT, char * rng, char * brg)
+{
+  coords_t  loc;
+  geopt16_t p16;
+  geopt32_t pli;
+  geotrig_t pliTrig;
+
+  SetCoordsFromDecLatLon(&loc, pT->dec[0], pT->dec[1]);
+  CoordsToGeopt16(&loc, &p16);
+  pli.lat = HexDegToPt32(pT->hex[0], true);
+  pli.lon = HexDegToPt32(pT->hex[1], false);
+  SetGeoTrig(pli, &pliTrig);
+  sink = CalcRngBrg(loc.pt, &loc.trig, pli, &pliTrig, rng, brg) + p16.lat;
+} // end routine FixOf
+
+
+static void CheckFix(check_t * pC)
+{
+  struct timespec t0;
+  char     rng[8], brg[8], rngR[8], brgR[8];
+  bool     isKm;
+  uint32_t i, calls;
+
+  memset(pC, 0, sizeof(*pC));
+  for (i = 0; i < nRb; i++)
+  { // text of fr as D.GLL, to as PLI 8-hex (rounded, so within 0.5 lsb)
+    const rbvec_t * pV = &rbVecs[i];
+    fixtext_t *     pT = &fixTexts[i];
+    int             j;
+
+    for (j = 0; j < 2; j++)
+    {
+      sprintf(pT->dec[j], "%c%03ld.%05ld", (0 > pV->fr[j]) ? '-' : '+',
+              labs(pV->fr[j]) / 100000, labs(pV->fr[j]) % 100000);
+      sprintf(pT->hex[j], "%08X", (uint32_t)(int32_t)llroundl(pV->to[j] *
+              (4294967295.0L / 36000000.0L)));
+    }
+    pC->n++;
+    memset(rng, 0, sizeof(rng));   memset(brg, 0, sizeof(brg));
+    memset(rngR, 0, sizeof(rngR)); memset(brgR, 0, sizeof(brgR));
+    FixOf(pT, rng, brg);
+    RngBrgOf(pV, rngR, brgR, &isKm);
+    if ((0 == strcmp(rng, rngR)) && (0 == strcmp(brg, brgR)))  {
+      pC->exact++;                                              }
+    else
+    { // text parsed to other than the vector's geopt32_t
+      pC->wrong++;
+      if (pC->examples++ < EXAMPLES_MAX)
+      {
+        printf("    %s %s to %s %s  got %s %s, not %s %s\n", pT->dec[0],
+               pT->dec[1], pT->hex[0], pT->hex[1], rng, brg, rngR, brgR);
+      }
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += nRb)
+  {
+    for (i = 0; i < nRb; i++)  {
+      FixOf(&fixTexts[i], rng, brg); }
+  }
+  pC->ns = NsPerCall(&t0, calls);
+} // end routine CheckFix
+
+
+static void PrintCheck(const char * name, const char * unit, exact_t scale,
+                       const check_t * pC)
+{
+  printf("  %-16s %5u %6u %6u %6u %7.0f ns", name, pC->n, pC->exact,
+         pC->cell1, pC->wrong, pC->ns);
+  if (NULL != unit)  {
+    printf("  max %.3Lg %s", pC->maxErr * scale, unit); }
+  printf("\n");
+} // end routine PrintCheck
+
+
+static void PrintMgrs(const char * name, const check_t * pC)
+{
+  printf("  %-16s %5u %6u %6u %6u %7.0f ns  >10 m %u, square %u, zone %u"
+         " (%u more at edges)\n", name, pC->n, pC->exact, pC->cell1,
+         pC->cells + pC->square + pC->zone, pC->ns, pC->cells, pC->square,
+         pC->zone, pC->edge);
+} // end routine PrintMgrs
+
+
+int main(int argc, char * argv[])
+{
+  check_t m14, m89, dms, dec, g16, hex, rng, brg, fix;
+  bool    ok;
+
+  if (!LoadVectors((1 < argc) ? argv[1] : VEC_PATH))  {
+    return EXIT_FAILURE;                               }
+#ifdef COORDREF_SHORT_DOUBLE
+  printf("coords.c vs reference vectors, 32-bit double (XC16)");
+#else
+  printf("coords.c vs reference vectors, 64-bit double");
+#endif
+  printf("%s%s\n", (1 == COORDS_CORDIC_RNGBRG) ? ", CORDIC range & bearing" : "",
+         (1 == COORDS_CORDIC_UTM) ? ", CORDIC UTM & UPS" : "");
+  CheckMgrs(MGRS_2014, MGRS_STRICT, &m14);
+  CheckMgrs(MGRS_1989, MGRS_STRICT, &m89);
+  CheckRender(CF_DMS, &dms);
+  CheckRender(CF_DEC, &dec);
+  CheckGeopt16(&g16);
+  CheckHex(&hex);
+  CheckRngBrg(&rng, &brg);
+  CheckFix(&fix);
+
+  printf("  function       vectors  exact  within  wrong   time\n");
+  PrintMgrs("MGRS_2014", &m14);
+  PrintMgrs("MGRS_1989", &m89);
+  PrintCheck("RenderCoords DMS", NULL, 0, &dms);
+  PrintCheck("RenderCoords DEC", NULL, 0, &dec);
+  PrintCheck("CoordsToGeopt16", NULL, 0, &g16);
+  PrintCheck("HexDegToPt32", "m", DEG_M, &hex);
+  PrintCheck("CalcRngBrg range", "m", 1, &rng);
+  PrintCheck("CalcRngBrg brg", "deg (100 m or more)", 1, &brg);
+  PrintCheck("fix pipeline", NULL, 0, &fix);
+
+  ok = (0 == m14.zone) && (0 == m89.zone) && (0 == m14.square) &&
+       (0 == m89.square) && (0 == dms.wrong) && (0 == dec.wrong) &&
+       (0 == g16.wrong) && (0 == hex.wrong) && (0 == rng.wrong) &&
+       (0 == brg.wrong) && (0 == fix.wrong) &&
+       (!MGRS_STRICT || ((m14.n == m14.exact + m14.cell1) &&
+                         (m89.n == m89.exact + m89.cell1)));
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+} // end function main
@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordref.c
+ *
+ *  DESCRIPTION   : Reference MGRS conversion for host tool host/coordbench.c:
+ *    the MGRS_1989_STD LatLonToUTM(), LatLonToUPS(), and DblLatLonToMGRS() of
+ *    coords.c as they were before their 2026 rework (series by pow(), etc.),
+ *    copied unchanged but for names (and the band, lon 180, and 100 km
+ *    letter fixes coords.c got later, so only the rework itself is
+ *    measured).  Built plain (64-bit double) it gives the golden MGRS
+ *    strings; built as XC16 would (host/include/short_double.h) it times and
+ *    checks the old code in 32-bit double.
+ *
+ *    Lat/lon are passed in 1e-7 degree units so callers built either way
+ *    share the one interface.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Size local MGRS strings for any sprintf() output (-Wformat-overflow)
+ *      100 km row letter by long division of northing, as coords.c now
+ *      100 km column letter by abs(zone) % 3 (southern zones), as coords.c now
+ *      Band of lats on a band's south edge is that band, lon 180 is -180, as
+ *      coords.c now
+ *      Initial implementation
+ */
+#include <dsp.h>                // for PI optimized to XC16 double
+#include <math.h>               // for trig functions
+#include <stdint.h>
+#include <stdio.h>              // for sprintf
+#include <stdlib.h>             // for abs
+#include <string.h>
+#include "coordref.h"
+
+#define COORD_LEN 10
+// Room for the copied sprintf()s at any int/long value (%02d, %04ld), not
+// just in-range ones, so -Wformat-overflow can't flag them; gzd/m10 still get
+// only COORD_LEN chars
+#define REF_LEN   (2 * 20 + 1)
+
+#define WGS_84_SEMI_MAJOR_AXIS 6378137  // WGS-84 Equatorial radius
+#define e  0.081819190842621494335
+#define e2 0.0066943799901413169961
+#define K0_UTM 0.9996
+#define K0_UPS 0.994
+#define alpha WGS_84_SEMI_MAJOR_AXIS
+
+
+static void LatLonToUTM(double latitude, double longitude, char* mgrsZones, char* mgrsCoords)
+{
+  if(latitude < -80 || latitude >= 84) {
+    mgrsZones = " ";
+    mgrsCoords = " ";
+    return; //needs to use UPS instead
+  }
+
+  int zone = (int)((longitude + 180) / 6) + 1;
+  if(latitude < 0)
+  {
+    zone = -zone;
+  }
+
+  if(zone == 31 && 56 <= latitude && latitude < 64 && longitude >= 3)
+  {
+    zone = 32;
+  }
+  else if(zone == 32 && latitude >= 72)
+  {
+    if(longitude < 9)
+    {
+      zone = 31;
+    }
+    else
+    {
+      zone = 33;
+    }
+  }
+  else if(zone == 34 && latitude >= 72)
+  {
+    if(longitude < 21)
+    {
+      zone = 33;
+    }
+    else
+    {
+      zone = 35;
+    }
+  }
+  else if(zone == 36 && latitude >= 72)
+  {
+    if(longitude < 33)
+    {
+      zone = 35;
+    }
+    else
+    {
+      zone = 37;
+    }
+  }
+
+  char *letters = "CDEFGHJKLMNPQRSTUVWXX";
+  int latBandIndex = (int)(latitude / 8);
+  if(latitude < 8 * latBandIndex)
+  {
+    latBandIndex--;
+  }
+  latBandIndex += 10;
+
+  char latitudeBandLetter = letters[latBandIndex];
+
+  double phi = latitude * PI / 180;
+  double lamda0 = (-183 + (6 * abs(zone))) * PI / 180;
+
+
+  double ePrimeSquared = e * e / (1 - e * e); //eccentricity prime squared
+
+  double N = alpha / sqrt(1 - pow(e * sin(phi), 2));
+  double T = pow(tan(phi), 2);
+  double C = ePrimeSquared * pow(cos(phi), 2);
+  //double A = ((longitude * PI / 180) - (lamda0 * PI / 180)) * cos(phi);
+  double A = ((longitude * PI / 180) - lamda0) * cos(phi);
+
+  double M = (1 - (e2 / 4) - (3 * pow(e2, 2) / 64) - (5 * pow(e2, 3) / 256)) * phi;
+  M -= ((3 * e2 / 8) + (3 * pow(e2, 2) / 32) + (45 * pow(e2, 3) / 1024)) * sin(2 * phi);
+  M += ((15 * pow(e2, 2) / 256) + (45 * pow(e2, 3) / 1024)) * sin(4 * phi);
+  M -= (35 * pow(e2, 3) / 3072) * sin(6 * phi);
+  M *= alpha;
+
+  //easting relative to central meridian
+  double east = (K0_UTM * N * (A + (1.0 - T + C) * pow(A, 3) / 6.0
+              + (5.0 - (18.0 * T) + pow(T, 2)
+              + (72.0 * C) - (58.0 * ePrimeSquared)) * pow(A, 5) / 120.0));
+
+  east += 500000.0; //add false easting
+
+  long easting = floor(east);
+
+  //northing from equator
+  double north = (K0_UTM * (M + N * tan(phi)
+               * (pow(A, 2) / 2 + (5 - T + 9 * C + 4 * pow(C, 2))
+               * pow(A, 4) / 24 + (61 - 58 * T + pow(T, 2)
+               + 600 * C - 330 * ePrimeSquared) * pow(A, 6) / 720)));
+
+  if(north < 0)                   {     //if southern hemisphere
+    north += 10000000.0;          }     //add false northing
+
+  long northing = floor(north);
+
+  if(latitude < 0)
+  {
+    northing = 10000000 + northing;
+  }
+
+  int slicesFromOrigin = (int)(northing / 100000L); // in long, float rounds up
+
+  if(!(zone % 2)) //if zone is not odd
+  {
+    slicesFromOrigin += 5; //start w/ 'F'
+  }
+
+  letters = "ABCDEFGHJKLMNPQRSTUVWXYZ";
+  int sliceId;
+  char eastingLetter;
+
+  if(easting > 800000)                        {
+    sliceId = 7;                              }
+  else                                        {
+    sliceId = ((easting / 100000.0) - 1.0);   }
+
+  if((abs(zone) % 3) == 0)                    {
+    eastingLetter = letters[16 + sliceId];    }
+  else if((abs(zone) % 3) == 1)               {
+    eastingLetter = letters[sliceId];         }
+  else                                        {
+    eastingLetter = letters[8 + sliceId];     }
+
+  char northingLetter = letters[(int)(slicesFromOrigin - 20 * floor(slicesFromOrigin / 20))]; //start with 'A'
+
+  easting = (easting % 100000) / 10;
+  northing = (northing % 100000) /10;
+
+  sprintf(mgrsZones,  "%02d%c %c%c", abs(zone), latitudeBandLetter, eastingLetter, northingLetter);
+  sprintf(mgrsCoords, "%04ld %04ld", easting, northing);
+} // end LatLonToUTM MGRS_1989_STD
+
+
+static double ComputeUpsX(double lamda, double phi, double k90)
+{
+  double sinPhi = sin(phi);
+
+  double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
+  //chi (X) is "conformal latitude"
+  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+  double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+
+  return ((2 * alpha * sin(lamda) * cosChi) / (k90 * (1 + sinChi)));
+} // end ComputeUpsX
+
+
+/*
+ * ComputeUpsY
+ * Inputs: lamda (radians)
+ *         phi (radians)
+ * Outputs: y value
+ * Function: Calculates y of the Krueger series based conversion
+ *           from latitude/longitude to Universal Polar Stereographic (UPS)
+ */
+static double ComputeUpsY(double lamda, double phi, double k90)
+{
+  double sinPhi = sin(phi);
+
+  double P = pow(((1 + (e * sinPhi)) / (1 - (e * sinPhi))), (e / 2)); // exp(e * Atanh(e * sinPhi))
+  //chi (X) is "conformal latitude"
+  double cosChi = 2 * cos(phi) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+  double sinChi = ((1 + sinPhi) / P - (1 - sinPhi) / P) / ((1 + sinPhi) / P + (1 - sinPhi) / P);
+
+  return ((-2 * alpha * cos(lamda) * cosChi) / (k90 * (1 + sinChi)));
+} // end ComputeUpsY
+
+
+/*
+ * LatLonToUPS
+ * Inputs: latitude (decimal degrees)
+ *         longitude (decimal degrees)
+ * Outputs: MGRS strings
+ * Function: Converts the latitude longitude to UPS
+ *           and then formats for Military Grid Reference System (MGRS)
+ */
+static void LatLonToUPS(double latitude, double longitude,
+                        char* mgrsZones, char* mgrsCoords)
+{
+  int zone = 0; //denote error
+  if(latitude >= 84)
+  {
+    zone = 1;
+  }
+  else if(latitude < -80)
+  {
+    zone = -1;
+  }
+
+  if(zone == 0)
+  {
+    mgrsZones = " ";
+    mgrsCoords = " ";
+    return; //needs to use UTM instead
+  }
+
+  double phi = latitude * PI / 180;
+  double lamda = longitude * PI / 180;
+  double lamda0 = 0;
+  double x_pole = 2000000;
+  double y_pole = 2000000;
+  double x, y;
+
+  char* eastingStr = "";
+  char northingLetter;
+
+  double k90 = sqrt(pow((1 + e), (1 + e)) * pow((1 - e), (1 - e)));
+
+  if(zone == -1) //south pole
+  {
+    x = K0_UPS * ComputeUpsX(lamda - lamda0, (-1 * phi), k90) + x_pole;
+    y = (-1 * K0_UPS) * ComputeUpsY(lamda - lamda0, (-1 * phi), k90) + y_pole;
+
+    char* eastingLetters[24] = { "AJ", "AK", "AL", "AP", "AQ", "AR", "AS", "AT", "AU", "AX", "AY", "AZ", "BA", "BB", "BC", "BF", "BG", "BH", "BJ", "BK", "BL", "BP", "BQ", "BR" };
+    char* northingLetters = "ABCDEFGHJKLMNPQRSTUVWXYZ";
+
+    eastingStr = eastingLetters[(int)(x / 100000) - 8];
+    northingLetter = northingLetters[(int)(y / 100000) - 8];
+  }
+  else //north pole
+  {
+    x = K0_UPS * ComputeUpsX(lamda - lamda0, phi, k90) + x_pole;
+    y = K0_UPS * ComputeUpsY(lamda - lamda0, phi, k90) + y_pole;
+
+    char* eastingLetters[14] = { "YR", "YS", "YT", "YU", "YX", "YY", "YZ", "ZA", "ZB", "ZC", "ZF", "ZG", "ZH", "ZJ" };
+    char* northingLetters = "ABCDEFGHJKLMNP";
+
+    eastingStr = eastingLetters[(int)(x / 100000) - 13];
+    northingLetter = northingLetters[(int)(y / 100000) - 13];
+  }
+
+  long easting = (long)x % 100000 / 10; //floor(mod(x, 10^5) / 10^(5-4))
+  long northing = (long)y % 100000 / 10; //floor(mod(y, 10^5) / 10^(5-4))
+
+  sprintf(mgrsZones,  "  %s %c", eastingStr, northingLetter);
+  sprintf(mgrsCoords, "%04ld %04ld", easting, northing);
+} // end LatLonToUPS
+
+
+void REF_LAT_LON_TO_MGRS(int32_t latE7, int32_t lonE7, char * gzd, char * m10)
+{
+  char   mgrsZones[REF_LEN+1]  = "";
+  char   mgrsCoords[REF_LEN+1] = "";
+  double lat = latE7 / 1e7;
+  double lon = lonE7 / 1e7;
+
+  if (( -90.0 <= lat) && ( 90.0 >= lat) &&
+      (-180.0 <= lon) && (180.0 >= lon))
+  {
+    double lclDblLon = lon;
+    if(lclDblLon == 180.0)
+    { //adjust edge case: the anti-meridian is zone 1's west edge, not zone 61
+      lclDblLon = -180.0;
+    }
+
+    if(lat >= 84 || lat < -80)
+    {
+      LatLonToUPS(lat, lclDblLon, mgrsZones, mgrsCoords);
+    }
+    else
+    {
+      LatLonToUTM(lat, lclDblLon, mgrsZones, mgrsCoords);
+    }
+  }
+  sprintf(gzd, "%-10.10s", mgrsZones);
+  sprintf(m10, "%-10.10s", mgrsCoords);
+} // end routine REF_LAT_LON_TO_MGRS
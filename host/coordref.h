@@ -0,0 +1,30 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordref.h
+ *
+ *  DESCRIPTION   : Reference MGRS conversion (host/coordref.c), built as
+ *    RefLatLonToMGRS() with 64-bit double and RefLatLonToMGRSf() with XC16's
+ *    32-bit double (COORDREF_SHORT_DOUBLE)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#ifndef COORDREF_H
+#define COORDREF_H
+#include <stdint.h>
+
+#ifdef COORDREF_SHORT_DOUBLE
+#define REF_LAT_LON_TO_MGRS RefLatLonToMGRSf
+#else
+#define REF_LAT_LON_TO_MGRS RefLatLonToMGRS
+#endif
+
+// gzd and m10 get the 10-char (plus NUL) strings DblLatLonToMGRS() would give
+void RefLatLonToMGRS(int32_t latE7, int32_t lonE7, char * gzd, char * m10);
+void RefLatLonToMGRSf(int32_t latE7, int32_t lonE7, char * gzd, char * m10);
+
+#endif // COORDREF_H
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordtrue.c
+ *
+ *  DESCRIPTION   : True MGRS conversion for host tool host/coordbench.c, which
+ *    both MGRS standards of coords.c are measured against.  In long double:
+ *    Karney's (2011) form of the Krueger series to 6th order in n (error under
+ *    5 nm within 4000 km of the central meridian), from the exact conformal
+ *    latitude, and the exact polar stereographic for UPS.  Zone, band, and
+ *    100 km square letters are assigned as coords.c does, from the truncated
+ *    easting and northing, so only the projection differs.
+ *
+ *    Always built plain, never with host/include/short_double.h (long double).
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Band of lats on a band's south edge is that band, lon 180 is -180,
+ *      poles are UPS origin
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "coordtrue.h"
+
+#define A_MAJOR 6378137.0L                  // WGS-84 semi-major axis
+#define F_INV   298.257223563L              // WGS-84 inverse flattening
+#define K0_UTM  0.9996L
+#define K0_UPS  0.994L
+#define PI_L    3.141592653589793238462643383279503L
+
+// n = f/(2-f) series to n^6 (Karney 2011): rectifying radius and alpha_1..6
+#define A_RECT  6367449.145823415309285116852L
+static const long double ALPHA[6] =
+{
+  8.37731820624469823324691772138e-4L,  7.60852777357230862439268654572e-7L,
+  1.19764550332945263425564354613e-9L,  2.42917060720135883849315391886e-12L,
+  5.71175767786580381830232631717e-15L, 1.49111773125838934811967038519e-17L
+};
+
+
+// tan of conformal latitude from tan(phi), Karney (2011) eq. 7-9
+static long double TauPrime(long double tau)
+{
+  long double e2    = (2.0L - 1.0L / F_INV) / F_INV;
+  long double e     = sqrtl(e2);
+  long double tau1  = sqrtl(1.0L + tau * tau);
+  long double sigma = sinhl(e * atanhl(e * tau / tau1));
+
+  return tau * sqrtl(1.0L + sigma * sigma) - sigma * tau1;
+} // end function TauPrime
+
+
+static void TrueUTM(long double lat, long double lon, char * gzd, char * m10)
+{
+  static const char BANDS[] = "CDEFGHJKLMNPQRSTUVWXX";
+  long double phi, lam, tauP, xiP, etaP, xi, eta, x, y;
+  long   east, north;
+  int    zone, j;
+  char   band;
+  const char * eastLetters;
+  const char * northLetters;
+
+  zone = (int)((lon + 180) / 6) + 1;
+  if ((31 == zone) && (56 <= lat) && (64 > lat) && (3 <= lon)) {
+    zone = 32;                                                 }
+  else if ((72 <= lat) && ((32 == zone) || (34 == zone) || (36 == zone)))
+  { // Svalbard: 31X, 33X, 35X, 37X
+    zone += (lon < 6 * zone - 183) ? -1 : 1;
+  }
+  band = BANDS[(int)floorl(lat / 8) + 10];
+
+  phi  = lat * PI_L / 180;
+  lam  = (lon - (6 * zone - 183)) * PI_L / 180;
+  tauP = TauPrime(tanl(phi));
+  xiP  = atan2l(tauP, cosl(lam));
+  etaP = asinhl(sinl(lam) / sqrtl(tauP * tauP + cosl(lam) * cosl(lam)));
+  xi   = xiP;
+  eta  = etaP;
+  for (j = 1; j <= 6; j++)
+  {
+    xi  += ALPHA[j - 1] * sinl(2 * j * xiP) * coshl(2 * j * etaP);
+    eta += ALPHA[j - 1] * cosl(2 * j * xiP) * sinhl(2 * j * etaP);
+  }
+  x = K0_UTM * A_RECT * eta + 500000;
+  y = K0_UTM * A_RECT * xi + ((0 > lat) ? 10000000 : 0);
+  east  = (long)floorl(x);
+  north = (long)floorl(y);
+
+  eastLetters = ((1 == zone % 3) ? "ABCDEFGH" :
+                 (2 == zone % 3) ? "JKLMNPQR" : "STUVWXYZ");
+  northLetters = (zone % 2) ? "ABCDEFGHJKLMNPQRSTUV" : "FGHJKLMNPQRSTUVABCDE";
+  sprintf(gzd, "%02d%c %c%c", zone, band, eastLetters[east / 100000 - 1],
+          northLetters[north % 2000000 / 100000]);
+  sprintf(m10, "%04ld %04ld ", east % 100000 / 10, north % 100000 / 10);
+} // end routine TrueUTM
+
+
+static void TrueUPS(long double lat, long double lon, char * gzd, char * m10)
+{
+  static const char * const SOUTH_E[24] =
+  {
+    "AJ", "AK", "AL", "AP", "AQ", "AR", "AS", "AT", "AU", "AX", "AY", "AZ",
+    "BA", "BB", "BC", "BF", "BG", "BH", "BJ", "BK", "BL", "BP", "BQ", "BR"
+  };
+  static const char * const NORTH_E[14] =
+  {
+    "YR", "YS", "YT", "YU", "YX", "YY", "YZ", "ZA", "ZB", "ZC", "ZF", "ZG",
+    "ZH", "ZJ"
+  };
+  long double e2  = (2.0L - 1.0L / F_INV) / F_INV;
+  long double e   = sqrtl(e2);
+  long double k90 = sqrtl(powl(1 + e, 1 + e) * powl(1 - e, 1 - e));
+  long double pole = (0 < lat) ? 1 : -1;
+  long double tauP, rho, lam;
+  long   east, north;
+
+  // rho = 2*a*k0/k90 * tan(pi/4 - chi/2),  tan(pi/4 - chi/2) = 1/(tau' + sec chi)
+  tauP  = TauPrime(tanl(pole * lat * PI_L / 180));
+  rho   = 2 * A_MAJOR * K0_UPS / k90 / (tauP + sqrtl(1 + tauP * tauP));
+  if (90 == pole * lat)  {
+    rho = 0;             }              // tan(90 degrees) is no number
+  lam   = lon * PI_L / 180;
+  east  = (long)floorl(rho * sinl(lam) + 2000000);
+  north = (long)floorl(-pole * rho * cosl(lam) + 2000000);
+  if (0 < pole)  {
+    sprintf(gzd, "  %s %c", NORTH_E[east / 100000 - 13],
+            "ABCDEFGHJKLMNP"[north / 100000 - 13]);  }
+  else           {
+    sprintf(gzd, "  %s %c", SOUTH_E[east / 100000 - 8],
+            "ABCDEFGHJKLMNPQRSTUVWXYZ"[north / 100000 - 8]);  }
+  sprintf(m10, "%04ld %04ld ", east % 100000 / 10, north % 100000 / 10);
+} // end routine TrueUPS
+
+
+void TrueLatLonToMGRS(int32_t latE7, int32_t lonE7, char * gzd, char * m10)
+{
+  long double lat = latE7 / 1e7L;
+  long double lon = lonE7 / 1e7L;
+  char        pad[COORDTRUE_LEN + 1];
+
+  if (1800000000 == lonE7)
+  { // as DblLatLonToMGRS() "edge case":  zone 1's west edge
+    lon = -180;
+  }
+  if ((84 <= lat) || (-80 > lat))  {
+    TrueUPS(lat, lon, gzd, m10);   }
+  else                             {
+    TrueUTM(lat, lon, gzd, m10);   }
+  sprintf(gzd, "%-10s", strcpy(pad, gzd));
+} // end routine TrueLatLonToMGRS
@@ -0,0 +1,24 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordtrue.h
+ *
+ *  DESCRIPTION   : True MGRS conversion (host/coordtrue.c, long double), which
+ *    host/coordbench.c measures both MGRS standards of coords.c against
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#ifndef COORDTRUE_H
+#define COORDTRUE_H
+#include <stdint.h>
+
+#define COORDTRUE_LEN 10
+
+// gzd and m10 get the 10-char (plus NUL) strings DblLatLonToMGRS() would give
+void TrueLatLonToMGRS(int32_t latE7, int32_t lonE7, char * gzd, char * m10);
+
+#endif // COORDTRUE_H
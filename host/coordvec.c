@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : coordvec.c
+ *
+ *  DESCRIPTION   : Host tool that writes the reference vectors which
+ *    host/coordcheck.c checks coords.c against (host/coordvec.csv, committed),
+ *    one per line:
+ *
+ *      M,latE7,lonE7,gzd,m10         DblLatLonToMGRS() true lines (trailing
+ *                                    ' ' trimmed), from host/coordtrue.c
+ *      D,latE5,lonE5,dms0,dms1,dec0,dec1
+ *                                    RenderCoords() CF_DMS and CF_DEC lines
+ *                                    of SetCoordsFromDecLatLon() input
+ *      H,hex,isLat,deg               HexDegToPt32() exact degrees, or ERR
+ *      R,frLatE5,frLonE5,toLatE5,toLonE5,meters,degrees
+ *                                    CalcRngBrg() exact great circle range
+ *                                    (WGS-84 mean radius sphere) and initial
+ *                                    bearing, by its pole & same point rules
+ *
+ *    MGRS is Karney's Krueger series to n^6, the TransverseMercator of
+ *    GeographicLib, and exact polar stereographic (host/coordtrue.c); the
+ *    great circle is GeographicLib's Geodesic on a sphere (flattening 0) in
+ *    closed form.  All long double; DMS & DEC and hex degrees in integer math.
+ *
+ *    Vectors cover every lat band edge and UTM zone edge (Norway & Svalbard
+ *    included) at 0 and +-1e-5 degree, the UPS caps and poles, the
+ *    anti-meridian, both hemispheres, and random points (fixed seed), so the
+ *    file only changes when this tool or host/coordtrue.c does.
+ *
+ *    Run by "make -f host/Makefile coordvec" from the repository root, and
+ *    checked current by the default target.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "coordtrue.h"
+
+#define PI_L      3.141592653589793238462643383279503L
+#define MER_M     6371008.7714L           // as coords.c
+#define POLE_DEG  0.0000135L              // CalcRngBrg() snaps to the pole
+
+static uint32_t rng = 0x2023C0DE;
+
+
+static int32_t Rand(int32_t lo, int32_t hi)
+{
+  rng = rng * 1664525u + 1013904223u;
+  return (int32_t)(lo + (int64_t)((rng >> 4) %
+                                  (uint32_t)((int64_t)hi - lo + 1)));
+} // end routine Rand
+
+
+//----- MGRS -------------------------------------------------------------------
+static void PutMGRS(int32_t latE7, int32_t lonE7)
+{
+  char gzd[COORDTRUE_LEN + 1], m10[COORDTRUE_LEN + 1];
+  int  n;
+
+  if ((-900000000 > latE7) || (900000000 < latE7) ||
+      (-1800000000 > lonE7) || (1800000000 < lonE7))  {
+    return;                                           }
+  TrueLatLonToMGRS(latE7, lonE7, gzd, m10);
+  for (n = strlen(gzd); n && (' ' == gzd[n - 1]); n--) {}
+  gzd[n] = '\0';
+  for (n = strlen(m10); n && (' ' == m10[n - 1]); n--) {}
+  m10[n] = '\0';
+  printf("M,%d,%d,%s,%s\n", latE7, lonE7, gzd, m10);
+} // end routine PutMGRS
+
+
+static void MakeMGRS(void)
+{
+  static const int32_t BAND_LATS[] =
+  { -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 8, 16, 24, 32, 40, 48,
+    56, 64, 72, 80, 84 };
+  static const int32_t SPREAD_LONS[] =              // 1e-5 degree
+  { -17750000, -12030000, -4520000, 350000, 1010000, 9670000, 17990000 };
+  static const int32_t ZONE_LATS[] =                // 1e-5 degree
+  { -7990000, -3330000, -50000, 50000, 6000000, 7500000 };
+  static const int32_t NORWAY_LONS[] = { 3, 9, 21, 33 };
+  static const int32_t CAP_LATS[] =                 // 1e-5 degree
+  { 8400001, 8500000, 8800000, 8999999, 9000000,
+    -8000001, -8100000, -8500000, -8999999, -9000000 };
+  static const int32_t OFF[] = { -100, 0, 100 };    // 1e-7 degree
+  int32_t i, j, a, b;
+
+  for (i = 0; i < (int32_t)(sizeof(BAND_LATS) / sizeof(BAND_LATS[0])); i++)
+  { // lat band edges, and UTM/UPS
+    for (j = 0; j < (int32_t)(sizeof(SPREAD_LONS) / sizeof(SPREAD_LONS[0]));
+         j++)
+    {
+      for (a = 0; a < 3; a++)  {
+        PutMGRS(BAND_LATS[i] * 10000000 + OFF[a], SPREAD_LONS[j] * 100); }
+    }
+  }
+  for (i = -180; i <= 180; i++)
+  { // UTM zone edges, Norway & Svalbard included, and the anti-meridian
+    for (a = 0; (a < 4) && (NORWAY_LONS[a] != i); a++) {}
+    if ((0 != (i % 6)) && (4 == a)) {
+      continue;                     }
+    for (j = 0; j < (int32_t)(sizeof(ZONE_LATS) / sizeof(ZONE_LATS[0])); j++)
+    {
+      for (a = 0; a < 3; a++)  {
+        PutMGRS(ZONE_LATS[j] * 100, i * 10000000 + OFF[a]); }
+    }
+  }
+  for (i = 0; i < (int32_t)(sizeof(CAP_LATS) / sizeof(CAP_LATS[0])); i++)
+  { // UPS caps, poles
+    for (j = -180; j < 180; j += 15)  {
+      PutMGRS(CAP_LATS[i] * 100, j * 10000000 + 1234567); }
+  }
+  for (i = -88; i <= 88; i += 4)
+  { // either side of the anti-meridian
+    for (a = 0; a < 2; a++)
+    {
+      for (b = -1; b <= 1; b += 2)  {
+        PutMGRS(i * 10000000 + 123456, b * (1800000000 - a * 100)); }
+    }
+  }
+  for (i = 0; i < 1500; i++)
+  { // random, both hemispheres
+    PutMGRS(Rand(-900000000, 900000000), Rand(-1800000000, 1800000000));
+  }
+} // end routine MakeMGRS
+
+
+//----- DMS & DEC --------------------------------------------------------------
+// DMS lat or lon in milliseconds of arc (1e-5 degree is 36 ms exactly)
+static void DmsStr(int32_t e5, const char * hemi, char * str)
+{
+  int64_t ms = (int64_t)llabs(e5) * 36;
+  int32_t d  = (int32_t)(ms / 3600000);
+  int32_t m  = (int32_t)(ms / 60000 % 60);
+  int32_t s  = (int32_t)((ms % 60000 + 500) / 1000);  // 0.5 s rounds up
+
+  sprintf(str, "%c%03d.%02d.%02d", hemi[0 > e5], d, m, s);
+} // end routine DmsStr
+
+
+static void PutDMS(int32_t latE5, int32_t lonE5)
+{
+  char dms0[16], dms1[16];
+
+  DmsStr(latE5, "NS", dms0);
+  DmsStr(lonE5, "EW", dms1);
+  printf("D,%d,%d,%s,%s,%c%03d.%05d,%c%03d.%05d\n", latE5, lonE5, dms0, dms1,
+         (0 > latE5) ? '-' : '+', abs(latE5) / 100000, abs(latE5) % 100000,
+         (0 > lonE5) ? '-' : '+', abs(lonE5) / 100000, abs(lonE5) % 100000);
+} // end routine PutDMS
+
+
+static void MakeDMS(void)
+{
+  static const int32_t EDGES[] =
+  { // 0, least, seconds rounding 0.5 & 59.5 (1e-5 degree is 0.036 s), minute
+    // and degree carries, greatest
+    0, 1, 13, 14, 1375, 1376, 1388, 1389, 1666, 1667, 99986, 99987, 99999,
+    100000, 100001, 899999, 9000000, 17999999, 18000000
+  };
+  int32_t i, j;
+
+  for (i = 0; i < (int32_t)(sizeof(EDGES) / sizeof(EDGES[0])); i++)
+  {
+    for (j = -1; j <= 1; j += 2)
+    {
+      PutDMS(j * ((9000000 < EDGES[i]) ? 9000000 : EDGES[i]), -j * EDGES[i]);
+    }
+  }
+  for (i = 0; i < 500; i++)  {
+    PutDMS(Rand(-9000000, 9000000), Rand(-18000000, 18000000)); }
+} // end routine MakeDMS
+
+
+//----- hex degrees ------------------------------------------------------------
+// Degrees of a 2's complement 32-bit hex value, scaled by 360 / UINT32_MAX as
+// HexDegToPt32() documents; ERR if out of range for isLat
+static void PutHex(const char * hex, bool isLat)
+{
+  char *      end;
+  uint32_t    u = strtoul(hex, &end, 16);
+  long double deg = (int32_t)u * 360.0L / 4294967295.0L;
+
+  if ((hex + 8 != end) || (isLat && (90.0L < fabsl(deg))) ||
+      (180.0L < fabsl(deg)))                                       {
+    printf("H,%s,%d,ERR\n", hex, isLat);                           }
+  else                                                             {
+    printf("H,%s,%d,%.15Lf\n", hex, isLat, deg);                   }
+} // end routine PutHex
+
+
+static void MakeHex(void)
+{
+  static const uint32_t EDGES[] =
+  { // 0, +-least, +-90 and +-180 either side, +-greatest
+    0x00000000, 0x00000001, 0xFFFFFFFF, 0x3FFFFFFF, 0x40000000, 0x40000001,
+    0xC0000000, 0xBFFFFFFF, 0xC0000001, 0x7FFFFFFF, 0x80000000, 0x80000001,
+    0x12345678, 0xEDCBA988
+  };
+  static const char * const BAD[] =
+  { // wrong length, not hex
+    "1234567", "123456789", "1234G678", "-1234567", " 1234567", ""
+  };
+  char    hex[9];
+  int32_t i;
+
+  for (i = 0; i < (int32_t)(sizeof(EDGES) / sizeof(EDGES[0])); i++)
+  {
+    sprintf(hex, "%08X", EDGES[i]);
+    PutHex(hex, true);
+    PutHex(hex, false);
+    sprintf(hex, "%08x", EDGES[i]);
+    PutHex(hex, false);
+  }
+  for (i = 0; i < (int32_t)(sizeof(BAD) / sizeof(BAD[0])); i++)  {
+    PutHex(BAD[i], false);                                       }
+  for (i = 0; i < 400; i++)
+  {
+    sprintf(hex, "%08X", (uint32_t)Rand(INT32_MIN / 2, INT32_MAX / 2) * 2u +
+                         (uint32_t)Rand(0, 1));
+    PutHex(hex, 0 == (i & 1));
+  }
+} // end routine MakeHex
+
+
+//----- range & bearing --------------------------------------------------------
+static void PutRngBrg(int32_t frLatE5, int32_t frLonE5, int32_t toLatE5,
+                      int32_t toLonE5)
+{
+  long double frLat = frLatE5 / 1e5L, frLon = frLonE5 / 1e5L;
+  long double toLat = toLatE5 / 1e5L, toLon = toLonE5 / 1e5L;
+  long double range = fabsl(toLat - frLat) * MER_M * PI_L / 180;
+  long double brg, pf, pt, dl, f, g, h;
+
+  if ((-9000000 > toLatE5) || (9000000 < toLatE5))  {
+    return;                                         }
+  if ((-18000000 > toLonE5) || (18000000 < toLonE5))
+  {
+    toLonE5 += (0 > toLonE5) ? 36000000 : -36000000;
+    toLon    = toLonE5 / 1e5L;
+  }
+  if (POLE_DEG > 90 - fabsl(frLat))  {
+    frLat = (0 < frLat) ? 90 : -90;  }
+  if (POLE_DEG > 90 - fabsl(toLat))  {
+    toLat = (0 < toLat) ? 90 : -90;  }
+
+  if ((frLat == toLat) && (frLon == toLon))  {
+    brg = 0;                                 }
+  else if (90 == fabsl(frLat))               {
+    brg = (0 > frLat) ? 0 : 180;             }
+  else if (90 == fabsl(toLat))               {
+    brg = (0 < toLat) ? 0 : 180;             }
+  else
+  {
+    pf = frLat * PI_L / 180;
+    pt = toLat * PI_L / 180;
+    dl = (toLon - frLon) * PI_L / 180;
+    f  = cosl(pt) * sinl(dl);
+    g  = cosl(pf) * sinl(pt) - sinl(pf) * cosl(pt) * cosl(dl);
+    h  = sinl(pf) * sinl(pt) + cosl(pf) * cosl(pt) * cosl(dl);
+    brg   = atan2l(f, g) * 180 / PI_L;
+    range = atan2l(sqrtl(f * f + g * g), h) * MER_M;
+  }
+  if (0 > brg)    {
+    brg += 360;   }
+  printf("R,%d,%d,%d,%d,%.4Lf,%.6Lf\n", frLatE5, frLonE5, toLatE5, toLonE5,
+         range, brg);
+} // end routine PutRngBrg
+
+
+static void MakeRngBrg(void)
+{
+  static const int32_t FROM[][2] =                  // 1e-5 degree
+  { // equator, mid lats both hemispheres, anti-meridian, near & at poles
+    { 0, 0 }, { 3845678, -7712345 }, { -3345678, 15112345 },
+    { 6012345, 17999000 }, { -4512345, -17999500 }, { 8999000, 4500000 },
+    { -8999000, -4500000 }, { 8999999, 0 }, { 9000000, 0 }, { -9000000, 0 }
+  };
+  static const int32_t DIST[] =                     // 1e-5 degree of lat
+  { // about 1, 10, 100, 999, 1000, 9949, 9950, 10000, 999000, 1000000 meters
+    // and display roll-overs either side
+    1, 9, 90, 897, 898, 899, 900, 8948, 8949, 8950, 8951, 8990, 8993, 8998,
+    898400, 898500, 898900, 899400, 899500, 1800000
+  };
+  int32_t i, j, d, la, lo;
+
+  for (i = 0; i < (int32_t)(sizeof(FROM) / sizeof(FROM[0])); i++)
+  {
+    PutRngBrg(FROM[i][0], FROM[i][1], FROM[i][0], FROM[i][1]);  // same point
+    for (j = 0; j < (int32_t)(sizeof(DIST) / sizeof(DIST[0])); j++)
+    {
+      for (d = 0; d < 8; d++)
+      { // 8 directions, lon steps widened by lat so about the same meters
+        la = (int32_t[]){ 1, 1, 0, -1, -1, -1, 0, 1 }[d] * DIST[j];
+        lo = (int32_t[]){ 0, 1, 1, 1, 0, -1, -1, -1 }[d] * DIST[j];
+        lo = (int32_t)(lo / fmaxl(0.05L, cosl(FROM[i][0] / 1e5L * PI_L / 180)));
+        PutRngBrg(FROM[i][0], FROM[i][1], FROM[i][0] + la, FROM[i][1] + lo);
+      }
+    }
+  }
+  for (i = 0; i < 800; i++)
+  { // random, mostly within display range (999 km)
+    la = Rand(-8990000, 8990000);
+    lo = Rand(-18000000, 18000000);
+    d  = (i & 1) ? 1000 : 1000000;
+    PutRngBrg(la, lo, la + Rand(-d, d), lo + Rand(-d, d));
+  }
+} // end routine MakeRngBrg
+
+
+int main(void)
+{
+  printf("# coords.c reference vectors, written by host/coordvec.c "
+         "(make -f host/Makefile coordvec)\n");
+  MakeMGRS();
+  MakeDMS();
+  MakeHex();
+  MakeRngBrg();
+  return EXIT_SUCCESS;
+} // end function main
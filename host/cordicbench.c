@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : cordicbench.c
+ *
+ *  DESCRIPTION   : Host tool that sweeps cordic.c against long double math and
+ *    prints error histograms, then times it against the math library:
+ *
+ *      CordicSinCos()      Q29 angles evenly over +-PI and at random, sine &
+ *                          cosine error in Q30 lsbs
+ *      CordicAtan2()       vectors at random angles and magnitudes 1 to 2^31
+ *                          (tiny ratios too), angle error in Q29 lsbs, and
+ *                          magnitude error beyond 1/2 unit of x & y, in 1e-9
+ *                          of the magnitude
+ *
+ *    and the largest of each as meters of great circle and degrees, against
+ *    the 10 m MGRS digit and 1 degree bearing shown.  Exits with failure if
+ *    any error is past the bounds cordic.h states.
+ *
+ *    Host ns per call only rank the code; on the PIC24, with no FPU, each
+ *    libm call is a soft-float routine, and a CORDIC pass 16 iterations of
+ *    32-bit shifts and adds.
+ *
+ *    Run by "make -f host/Makefile cordicbench" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cordic.h"
+
+#define SWEEP_N       4000000     // angles, and vectors, checked
+#define TIME_N        4096        // inputs cycled through when timing
+#define TIME_NS_MIN   20000000    // each timed until this long
+#define BINS          8           // lsbs 0 to 1, ... 6 to 7, 7 up
+#define PI_L          3.141592653589793238L
+#define Q29_L         536870912.0L
+#define Q30_L         1073741824.0L
+#define MER_M         6371008.7714L   // as coords.c, mean earth radius
+#define MGRS_RAD      (10.0L / MER_M) // a 10 m MGRS digit
+#define BRG_RAD       (PI_L / 180)    // a 1 degree bearing
+
+// Bounds stated in cordic.h
+#define SINCOS_TOL    7.0L        // Q30 lsbs
+#define ATAN_TOL      4.5L        // Q29 lsbs
+#define MAG_TOL       7.0L        // 1e-9 of the magnitude, past 1/2 unit
+
+typedef struct tagHISTOGRAM
+{
+  const char *name;
+  uint32_t    bin[BINS];
+  long double max;
+  long double tol;
+} hist_t;
+
+static uint32_t rngState = 2463534242UL;
+static volatile int32_t sink;     // keeps timed calls from being dropped
+static volatile float   sinkF;
+static volatile double  sinkD;
+
+
+static uint32_t Rand32(void)
+{ // xorshift32, the same sequence every run
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+} // end function Rand32
+
+
+static void Tally(hist_t *pH, long double err)
+{
+  int i = (int)err;
+
+  pH->bin[(BINS - 1 < i) ? (BINS - 1) : i]++;
+  if (pH->max < err)  {
+    pH->max = err;    }
+} // end routine Tally
+
+
+static void SweepSinCos(int32_t ang, hist_t *pH)
+{
+  int32_t     s, c;
+  long double r = ang / Q29_L;
+  long double es, ec;
+
+  CordicSinCos(ang, &s, &c);
+  es = fabsl(s - (sinl(r) * Q30_L));
+  ec = fabsl(c - (cosl(r) * Q30_L));
+  Tally(pH, (es > ec) ? es : ec);
+} // end routine SweepSinCos
+
+
+static void SweepAtan2(int32_t y, int32_t x, hist_t *pAng, hist_t *pMag)
+{
+  uint32_t    m;
+  int32_t     a = CordicAtan2(y, x, &m);
+  long double h = hypotl(x, y);
+  long double ea = fabsl(a - (atan2l(y, x) * Q29_L));
+  long double em = fabsl(m - h) - 0.5L;
+
+  if (PI_L * Q29_L < ea)        {     // -PI and PI are the same angle
+    ea = fabsl(ea - (2 * PI_L * Q29_L)); }
+  Tally(pAng, ea);
+  Tally(pMag, (0 < em) ? (em / h * 1e9L) : 0);
+} // end routine SweepAtan2
+
+
+static int32_t RandVector(void)
+{ // magnitude 2^0 to 2^31, either sign
+  int32_t v = (int32_t)(Rand32() >> (Rand32() % 32));
+
+  return (Rand32() & 1) ? -v : v;
+} // end function RandVector
+
+
+static void PrintHist(const hist_t *pH, const char *unit)
+{
+  int i;
+
+  printf("  %-22s", pH->name);
+  for (i = 0; i < BINS; i++)  {
+    printf(" %8u", pH->bin[i]); }
+  printf("  max %.2Lf %s\n", pH->max, unit);
+} // end routine PrintHist
+
+
+static double NsPerCall(struct timespec *pT0, uint32_t calls)
+{
+  struct timespec t1;
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  return ((t1.tv_sec - pT0->tv_sec) * 1e9 + (t1.tv_nsec - pT0->tv_nsec)) /
+         calls;
+} // end routine NsPerCall
+
+
+int main(void)
+{
+  static int32_t angs[TIME_N], ys[TIME_N], xs[TIME_N];
+  static double  radsD[TIME_N], ysD[TIME_N], xsD[TIME_N];
+  static float   radsF[TIME_N], ysF[TIME_N], xsF[TIME_N];
+  hist_t   sc  = { "CordicSinCos sin/cos" };
+  hist_t   ang = { "CordicAtan2 angle" };
+  hist_t   mag = { "CordicAtan2 magnitude" };
+  struct timespec t0;
+  uint32_t calls, i, j;
+  int32_t  s, c;
+  uint32_t m;
+  bool     ok;
+
+  sc.tol = SINCOS_TOL;
+  ang.tol = ATAN_TOL;
+  mag.tol = MAG_TOL;
+  for (i = 0; i < SWEEP_N / 2; i++)
+  {
+    SweepSinCos((int32_t)((2 * CORDIC_PI * (long double)i / (SWEEP_N / 2)) -
+                          CORDIC_PI), &sc);
+    SweepSinCos((int32_t)Rand32(), &sc);
+  }
+  for (i = 0; i < SWEEP_N; i++)
+  {
+    if (i & 1)
+    { // tiny ratio:  one meter's central angle and less, off either axis
+      int32_t big = (int32_t)(0x40000000UL | Rand32()) >> (Rand32() % 8);
+      int32_t tiny = RandVector() >> 24;
+      if (Rand32() & 1) {
+        SweepAtan2(tiny, big, &ang, &mag); }
+      else              {
+        SweepAtan2(big, tiny, &ang, &mag); }
+    }
+    else                {
+      SweepAtan2(RandVector(), RandVector(), &ang, &mag); }
+  }
+
+  printf("cordic.c (%d iterations) vs long double, %u of each\n",
+         CORDIC_ITERS, SWEEP_N);
+  printf("  %-22s", "error (lsbs or e-9)");
+  for (i = 1; i < BINS; i++)  {
+    printf("       <%u", i);  }
+  printf(" %5u up\n", BINS - 1);
+  PrintHist(&sc, "Q30 lsbs");
+  PrintHist(&ang, "Q29 lsbs");
+  PrintHist(&mag, "e-9");
+  printf("  sin/cos %.1Le, %.3Lf m of great circle:  10 m MGRS digit %.0Lf x\n",
+         sc.max / Q30_L, sc.max / Q30_L * MER_M, MGRS_RAD / (sc.max / Q30_L));
+  printf("  angle   %.1Le rad, %.1Le deg, %.3Lf m:  1 deg bearing %.0Lf x\n",
+         ang.max / Q29_L, ang.max / Q29_L * 180 / PI_L,
+         ang.max / Q29_L * MER_M, BRG_RAD / (ang.max / Q29_L));
+
+  for (i = 0; i < TIME_N; i++)
+  {
+    angs[i]  = (int32_t)((2 * CORDIC_PI * (long double)i / TIME_N) - CORDIC_PI);
+    radsD[i] = angs[i] / (double)Q29_L;
+    radsF[i] = (float)radsD[i];
+    ys[i]    = RandVector();
+    xs[i]    = RandVector();
+    ysD[i]   = ys[i];
+    xsD[i]   = xs[i];
+    ysF[i]   = (float)ys[i];
+    xsF[i]   = (float)xs[i];
+  }
+  printf("  %-22s   CORDIC   double    float\n", "time, ns per call");
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                    {
+      CordicSinCos(angs[j], &s, &c);  sink = s + c; }
+  }
+  printf("  %-22s %8.1f", "sin & cos", NsPerCall(&t0, calls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                    {
+      sinkD = sin(radsD[j]) + cos(radsD[j]);        }
+  }
+  printf(" %8.1f", NsPerCall(&t0, calls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                    {
+      sinkF = sinf(radsF[j]) + cosf(radsF[j]);      }
+  }
+  printf(" %8.1f\n", NsPerCall(&t0, calls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                            {
+      sink = CordicAtan2(ys[j], xs[j], &m) + (int32_t)m;    }
+  }
+  printf("  %-22s %8.1f", "atan2 & sqrt", NsPerCall(&t0, calls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                            {
+      sinkD = atan2(ysD[j], xsD[j]) +
+              sqrt(ysD[j] * ysD[j] + xsD[j] * xsD[j]);      }
+  }
+  printf(" %8.1f", NsPerCall(&t0, calls));
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (calls = 0; NsPerCall(&t0, 1) < TIME_NS_MIN; calls += TIME_N)
+  {
+    for (j = 0; j < TIME_N; j++)                            {
+      sinkF = atan2f(ysF[j], xsF[j]) +
+              sqrtf(ysF[j] * ysF[j] + xsF[j] * xsF[j]);     }
+  }
+  printf(" %8.1f\n", NsPerCall(&t0, calls));
+
+  ok = (sc.max < sc.tol) && (ang.max < ang.tol) && (mag.max < mag.tol);
+  if (!ok)                                                {
+    printf("  FAIL: error past the bounds of cordic.h\n");  }
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+} // end function main
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : crc_sim.c
+ *
+ *  DESCRIPTION   : Define software CRC (crc.h) for the host build in place of
+ *    the PIC24 CRC peripheral: 32-bit polynomial 0x04C11DB7, 16-bit data words
+ *    shifted in MSb first, register preset by the seed, and result flushed
+ *    with 32 zero bits, as crc.c configures the peripheral.  Program memory
+ *    does not exist on host, so a program memory CRC ends in error.
+ *
+ *      (1) void InitializeCrc(void)
+ *      (2) void SetCrcSeed(uint32_t seed)
+ *      (3) void StartCrcOnDataMemBfr(uint16_t *buffer, uint32_t sizeBytes)
+ *      (4) void StartCrcOnPrgmMemBfr(uint32_t startAddr, uint32_t sizeBytes)
+ *      (5) void PerformCrcTask(void)
+ *      (6) bool GetIsCrcCalcDone(void)
+ *      (7) crc_t GetCrcCalcResult(void)
+ *      (8) crc_t GetDataMemCrc(uint16_t *buffer, uint32_t sizeBytes)
+ *      (9) crc_t GetPrgmMemCrc(uint32_t startAddr, uint32_t sizeBytes)
+ *     (10) bool GetIsCrcInErr(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "crc.h"
+
+#define CRC_POLY    0x04C11DB7UL
+
+
+static crc_t  crcReg  = 0;
+static bool   isErr   = false;
+
+
+static void ShiftInBits(uint32_t data, int nBits)
+{
+  while (nBits--)
+  {
+    bool msb = (crcReg & 0x80000000UL) ? true : false;
+    crcReg = (crcReg << 1) | ((data >> nBits) & 1UL);
+    if (msb)                {
+      crcReg ^= CRC_POLY;   }
+  }
+} // end routine ShiftInBits
+
+
+void InitializeCrc(void)
+{
+  crcReg  = 0;
+  isErr   = false;
+} // end routine InitializeCrc
+
+
+void SetCrcSeed(uint32_t seed)
+{
+  crcReg  = seed;
+} // end routine SetCrcSeed
+
+
+void StartCrcOnDataMemBfr(uint16_t *buffer, uint32_t sizeBytes)
+{
+  if (0x0001 & (uintptr_t)buffer)
+  {                                     // odd address hangs the peripheral
+    isErr = true;
+    return;
+  }
+  for ( ; sizeBytes >= 2; sizeBytes -= 2) {
+    ShiftInBits(*buffer++, 16);           }
+  if (sizeBytes)                          {
+    ShiftInBits(*buffer & 0x00FF, 16);    }
+  ShiftInBits(0, 32);                   // flush
+} // end routine StartCrcOnDataMemBfr
+
+
+void StartCrcOnPrgmMemBfr(uint32_t startAddr, uint32_t sizeBytes)
+{
+  (void)startAddr;
+  (void)sizeBytes;
+  isErr = true;
+} // end routine StartCrcOnPrgmMemBfr
+
+
+void PerformCrcTask(void)
+{
+} // end routine PerformCrcTask
+
+
+bool GetIsCrcCalcDone(void)
+{
+  return true;
+} // end function GetIsCrcCalcDone
+
+
+crc_t GetCrcCalcResult(void)
+{
+  return isErr ? 0 : crcReg;
+} // end function GetCrcCalcResult
+
+
+crc_t GetDataMemCrc(uint16_t *buffer, uint32_t sizeBytes)
+{
+  InitializeCrc();
+  SetCrcSeed(CRC_INITIALIZE_SEED);
+  StartCrcOnDataMemBfr(buffer, sizeBytes);
+  return GetCrcCalcResult();
+} // end function GetDataMemCrc
+
+
+crc_t GetPrgmMemCrc(uint32_t startAddr, uint32_t sizeBytes)
+{
+  InitializeCrc();
+  SetCrcSeed(CRC_INITIALIZE_SEED);
+  StartCrcOnPrgmMemBfr(startAddr, sizeBytes);
+  return GetCrcCalcResult();
+} // end function GetPrgmMemCrc
+
+
+bool GetIsCrcInErr(void)
+{
+  return isErr;
+} // end function GetIsCrcInErr
@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : fmtbench.c
+ *
+ *  DESCRIPTION   : Host tool that checks numfmt.c text against the sprintf()
+ *    formats it replaced in main.c and coords.c, over every value each call
+ *    site can show (sampled beyond 16 bits), then times each firmware use both
+ *    ways.  Exits with failure on any text that differs, but for K.m range,
+ *    whose rounding (+0.5 as the rest of CalcRngBrg) is counted against
+ *    "%01.1f" apart from the others.
+ *
+ *    Run by "make -f host/Makefile fmtbench" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "numfmt.h"
+
+#define TIME_REPS  2000000UL
+
+typedef struct tagFMT_USE
+{
+  const char * name;
+  void (*viaSprintf)(char * dst, uint32_t v);
+  void (*viaFmt)(char * dst, uint32_t v);
+  uint32_t     lo;                // values checked, every one from lo to hi
+  uint32_t     hi;
+} fmtuse_t;
+
+static uint32_t failures = 0;
+static volatile char sink;        // keeps timed calls from being dropped
+
+
+//----- Firmware uses: sprintf as was, numfmt as now ---------------------------
+static void SpTime(char * d, uint32_t v)
+{
+  sprintf(d, "%02u:%02u:%02u", (unsigned)(v / 3600), (unsigned)(v / 60 % 60),
+          (unsigned)(v % 60));
+}
+static void FmTime(char * d, uint32_t v)
+{
+  d    = FmtUDec(d, v / 3600, 2, '0');
+  *d++ = ':';
+  d    = FmtUDec(d, v / 60 % 60, 2, '0');
+  *d++ = ':';
+  FmtUDec(d, v % 60, 2, '0');
+}
+static void SpHex(char * d, uint32_t v)   { sprintf(d, "%02X", (unsigned)v); }
+static void FmHex(char * d, uint32_t v)   { FmtHex2(d, (uint8_t)v); }
+static void SpCtdn(char * d, uint32_t v)  { sprintf(d, "%02d", (int)v); }
+static void FmCtdn(char * d, uint32_t v)  { FmtUDec(d, v, 2, '0'); }
+static void SpTx(char * d, uint32_t v)    { sprintf(d, "TX: %d", (int)v); }
+static void FmTx(char * d, uint32_t v)
+{
+  strcpy(d, "TX: ");
+  FmtUDec(&d[4], v, 0, ' ');
+}
+static void SpPct(char * d, uint32_t v)   { sprintf(d, "%3u%%", (unsigned)v); }
+static void FmPct(char * d, uint32_t v)
+{
+  d    = FmtUDec(d, v, 3, ' ');
+  *d++ = '%';
+  *d   = '\0';
+}
+static void SpCnt(char * d, uint32_t v)   { sprintf(d, "%2u", (unsigned)v); }
+static void FmCnt(char * d, uint32_t v)   { FmtUDec(d, v, 2, ' '); }
+static void SpAof(char * d, uint32_t v)
+{
+  sprintf(d, "aof%2u%c", (unsigned)(v / 3), "smh"[v % 3]);
+}
+static void FmAof(char * d, uint32_t v)
+{
+  strcpy(d, "aof");
+  d    = FmtUDec(&d[3], v / 3, 2, ' ');
+  *d++ = "smh"[v % 3];
+  *d   = '\0';
+}
+static void SpNbe(char * d, uint32_t v)   { sprintf(d, "X  %02us", (unsigned)v); }
+static void FmNbe(char * d, uint32_t v)
+{
+  strcpy(d, "X  ");
+  d    = FmtUDec(&d[3], v, 2, '0');
+  *d++ = 's';
+  *d   = '\0';
+}
+static void SpXY(char * d, uint32_t v)
+{
+  sprintf(d, "%02u/%02u", (unsigned)(v / 100), (unsigned)(v % 100));
+}
+static void FmXY(char * d, uint32_t v)
+{
+  d    = FmtUDec(d, v / 100, 2, '0');
+  *d++ = '/';
+  FmtUDec(d, v % 100, 2, '0');
+}
+static void SpFset(char * d, uint32_t v)  { sprintf(d, "Fset: %d", (int)v); }
+static void FmFset(char * d, uint32_t v)
+{
+  strcpy(d, "Fset: ");
+  FmtUDec(&d[6], v, 0, ' ');
+}
+static void SpDms(char * d, uint32_t v)
+{
+  sprintf(d, "%c%03u.%02u.%02u", "NS"[v & 1], (unsigned)(v / 2 / 10000),
+          (unsigned)(v / 2 / 100 % 100), (unsigned)(v / 2 % 100));
+}
+static void FmDms(char * d, uint32_t v)
+{
+  *d++ = "NS"[v & 1];
+  d    = FmtUDec(d, v / 2 / 10000, 3, '0');
+  *d++ = '.';
+  d    = FmtUDec(d, v / 2 / 100 % 100, 2, '0');
+  *d++ = '.';
+  FmtUDec(d, v / 2 % 100, 2, '0');
+}
+static void SpDec(char * d, uint32_t v)
+{
+  sprintf(d, "%c%03u.%05lu", (v & 1) ? '-' : '+', (unsigned)(v / 2 / 100000),
+          (unsigned long)(v / 2 % 100000));
+}
+static void FmDec(char * d, uint32_t v)
+{
+  *d++ = (v & 1) ? '-' : '+';
+  FmtFixed(d, v / 2, 3, 5);
+}
+static void SpGzd(char * d, uint32_t v)
+{
+  sprintf(d, "%02d%c %c%c", (int)(v % 60 + 1), 'C' + (char)(v / 60 % 20), 'J',
+          'K');
+}
+static void FmGzd(char * d, uint32_t v)
+{
+  d    = FmtUDec(d, v % 60 + 1, 2, '0');
+  *d++ = 'C' + (char)(v / 60 % 20);
+  *d++ = ' ';
+  *d++ = 'J';
+  *d++ = 'K';
+  *d   = '\0';
+}
+static void SpGrid(char * d, uint32_t v)
+{
+  sprintf(d, "%04ld %04ld", (long)(v / 10000), (long)(v % 10000));
+}
+static void FmGrid(char * d, uint32_t v)
+{
+  FmtGrid(d, (uint16_t)(v / 10000), (uint16_t)(v % 10000));
+}
+static void SpPad(char * d, uint32_t v)
+{
+  sprintf(d, "%-10s", &"0123456789"[v % 11]);
+}
+static void FmPad(char * d, uint32_t v)
+{
+  FmtPadRight(d, &"0123456789"[v % 11], 10);
+}
+static void SpRng(char * d, uint32_t v)   { sprintf(d, "%03d", (int)v); }
+static void FmRng(char * d, uint32_t v)   { FmtUDec(d, v, 3, '0'); }
+
+static const fmtuse_t USES[] =
+{
+  { "clock %02u:%02u:%02u",  SpTime, FmTime, 0, 99 * 3600 + 3599 },
+  { "BIT code %02X",         SpHex,  FmHex,  0, 255 },
+  { "countdown %02d",        SpCtdn, FmCtdn, 0, 99 },
+  { "TX: %d",                SpTx,   FmTx,   0, 65535 },
+  { "battery %3u%%",         SpPct,  FmPct,  0, 100 },
+  { "GDB unread %2u",        SpCnt,  FmCnt,  0, 99 },
+  { "aof%2u%c",              SpAof,  FmAof,  0, 3 * 99 + 2 },
+  { "X  %02us",              SpNbe,  FmNbe,  0, 99 },
+  { "GDB %02u/%02u",         SpXY,   FmXY,   0, 9999 },
+  { "Fset: %d",              SpFset, FmFset, 0, 65535 },
+  { "DMS %c%03u.%02u.%02u",  SpDms,  FmDms,  0, 2 * 1800060 + 1 },
+  { "DEC %c%03u.%05lu",      SpDec,  FmDec,  0, 2 * 18000000 + 1 },
+  { "MGRS %02d%c %c%c",      SpGzd,  FmGzd,  0, 60 * 20 - 1 },
+  { "MGRS %04ld %04ld",      SpGrid, FmGrid, 0, 99999999 },
+  { "MGRS %-10s",            SpPad,  FmPad,  0, 10 },
+  { "range/bearing %03d",    SpRng,  FmRng,  0, 999 },
+};
+#define USE_CNT (sizeof(USES) / sizeof(USES[0]))
+
+
+static bool Same(const char * what, const char * a, const char * b)
+{
+  if (0 == strcmp(a, b))  {
+    return true;          }
+  if (10 > failures++)    {
+    printf("  %-22s sprintf \"%s\"  numfmt \"%s\"\n", what, a, b); }
+  return false;
+} // end function Same
+
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+} // end function Now
+
+
+// ns per call of fn over values lo..hi repeated
+static double TimeUse(void (*fn)(char *, uint32_t), uint32_t lo, uint32_t hi)
+{
+  char     buf[32];
+  uint32_t span = hi - lo + 1;
+  uint32_t step = (span > TIME_REPS) ? (span / TIME_REPS) : 1;
+  uint32_t i, v = lo;
+  double   t0 = Now();
+
+  for (i = 0; i < TIME_REPS; i++)
+  {
+    fn(buf, v);
+    sink ^= buf[1];
+    v += step;
+    if (hi < v)   {
+      v = lo;     }
+  }
+  return (Now() - t0) * 1e9 / TIME_REPS;
+} // end function TimeUse
+
+
+// Generic forms over 16-bit values, widths, pads, and sampled 32-bit values
+static void CheckGeneric(void)
+{
+  char     a[32], b[32], what[32];
+  uint32_t rng = 0x12345678;
+  int32_t  s;
+  uint32_t v;
+  int      i, w;
+
+  for (w = 0; w <= 6; w++)
+  {
+    for (v = 0; v <= 70000; v++)
+    {
+      sprintf(a, "%0*lu", w, (unsigned long)v);   FmtUDec(b, v, w, '0');
+      sprintf(what, "%%0%dlu", w);                Same(what, a, b);
+      sprintf(a, "%*lu", w, (unsigned long)v);    FmtUDec(b, v, w, ' ');
+      sprintf(what, "%%%dlu", w);                 Same(what, a, b);
+      s = (int32_t)v - 35000;
+      sprintf(a, "%0*ld", w, (long)s);            FmtSDec(b, s, w, '0');
+      sprintf(what, "%%0%dld", w);                Same(what, a, b);
+      sprintf(a, "%*ld", w, (long)s);             FmtSDec(b, s, w, ' ');
+      sprintf(what, "%%%dld", w);                 Same(what, a, b);
+    }
+  }
+  for (i = 0; i < 1000000; i++)
+  {
+    rng = rng * 1664525u + 1013904223u;
+    v   = rng >> (i % 32);
+    sprintf(a, "%lu", (unsigned long)v);          FmtUDec(b, v, 0, ' ');
+    Same("%lu", a, b);
+    s   = (int32_t)rng;
+    sprintf(a, "%012ld", (long)s);                FmtSDec(b, s, 12, '0');
+    Same("%012ld", a, b);
+    sprintf(a, "%03lu.%05lu", (unsigned long)(v / 100000),
+            (unsigned long)(v % 100000));         FmtFixed(b, v, 3, 5);
+    Same("fixed 3.5", a, b);
+  }
+  sprintf(a, "%ld", (long)INT32_MIN);             FmtSDec(b, INT32_MIN, 0, ' ');
+  Same("%ld", a, b);
+  sprintf(a, "%lu", (unsigned long)UINT32_MAX);   FmtUDec(b, UINT32_MAX, 0, '0');
+  Same("%lu", a, b);
+} // end routine CheckGeneric
+
+
+int main(void)
+{
+  char     a[32], b[32];
+  uint32_t v, kmDiffer = 0, kmN = 0;
+  size_t   i;
+  double   tSp, tFm, sumSp = 0.0, sumFm = 0.0;
+
+  CheckGeneric();
+  for (i = 0; i < USE_CNT; i++)
+  {
+    for (v = USES[i].lo; ; v++)
+    {
+      USES[i].viaSprintf(a, v);
+      USES[i].viaFmt(b, v);
+      Same(USES[i].name, a, b);
+      if (USES[i].hi == v)  {
+        break;              }
+    }
+  }
+  for (v = 100000; v <= 994950; v++)
+  { // CalcRngBrg K.m: range 1.00000 to 9.94950 km
+    double km = v / 100000.0;
+
+    sprintf(a, "%01.1f", km);
+    FmtFixed(b, (uint16_t)(km * 10 + 0.5), 1, 1);
+    kmN++;
+    if (strcmp(a, b))   {
+      kmDiffer++;       }
+  }
+  printf("numfmt vs sprintf text: %s (%u differ); K.m range rounding differs"
+         " at %u of %u (ties)\n", failures ? "FAIL" : "same", failures,
+         kmDiffer, kmN);
+
+  printf("%-24s %9s %9s %7s\n", "firmware use", "sprintf", "numfmt", "ratio");
+  for (i = 0; i < USE_CNT; i++)
+  {
+    tSp = TimeUse(USES[i].viaSprintf, USES[i].lo, USES[i].hi);
+    tFm = TimeUse(USES[i].viaFmt, USES[i].lo, USES[i].hi);
+    sumSp += tSp;
+    sumFm += tFm;
+    printf("%-24s %6.1f ns %6.1f ns %6.1fx\n", USES[i].name, tSp, tFm,
+           tSp / tFm);
+  }
+  printf("%-24s %6.1f ns %6.1f ns %6.1fx\n", "mean", sumSp / USE_CNT,
+         sumFm / USE_CNT, sumSp / sumFm);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+} // end function main
@@ -0,0 +1,316 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : fontrle.c
+ *
+ *  DESCRIPTION   : Host tool that packs the TERMINAL 12X16 and VERDANA 34X56
+ *    glyphs of fonts.c (built with FONTS_USE_RLE 0) into the token format of
+ *    fonts.h (RLE_ZEROS, RLE_REPEAT, RLE_LITERAL) and writes fonts_rle.h to
+ *    stdout.  Each packed glyph is unpacked again and compared with its plain
+ *    glyph before anything is written.  A size report goes to stderr:  plain
+ *    vs packed bytes and PIC24 instruction words (2 bytes of const data per
+ *    24-bit word), and the most tokens lcd.c decodes for any one glyph.
+ *
+ *    Run by "make -f host/Makefile fonts" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fonts.h"
+
+#define PACKED_MAX      8192      // room for packed glyphs of one font
+#define GLYPHS_MAX      256
+#define REPEAT_MIN      3         // shorter runs of a non-zero byte stay literal
+#define ZEROS_MIN       1         // any 0x00 ends a literal
+#define VALUES_PER_LINE 12
+
+typedef struct tagPACK_FONT
+{
+  const font_t * pFont;
+  const char *   name;            // prefix of generated arrays
+  const char *   title;           // as in fonts.c comments
+  uint16_t       nGlyphs;
+  uint16_t       len;             // bytes of packed glyphs
+  uint16_t       worst;           // most tokens in one glyph
+  uint16_t       index[GLYPHS_MAX];
+  uint8_t        packed[PACKED_MAX];
+} packfont_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static packfont_t packFonts[] =
+{
+  { &TERMINAL_12X16_FONT, "TERMINAL_12X16", "TERMINAL 12X16" },
+  { &VERDANA_34X56_FONT,  "VERDANA_34X56",  "VERDANA 34X56"  }
+};
+#define PACK_FONTS (sizeof(packFonts) / sizeof(packFonts[0]))
+
+
+static uint16_t GlyphCount(const font_t * pFont)
+{
+  uint16_t n = pFont->last - pFont->first + 1;
+
+  if (pFont->extFirst <= pFont->extLast)  {
+    n += pFont->extLast - pFont->extFirst + 1; }
+  return n;
+} // end function GlyphCount
+
+
+static uint8_t GlyphCode(const font_t * pFont, uint16_t glyph)
+{
+  uint16_t n = pFont->last - pFont->first + 1;
+
+  return (glyph < n) ? (pFont->first + glyph) : (pFont->extFirst + glyph - n);
+} // end function GlyphCode
+
+
+static uint8_t RunLen(const uint8_t * row, uint8_t at, uint8_t width)
+{
+  uint8_t n = 1;
+
+  while (((at + n) < width) && (row[at + n] == row[at]) && (n < RLE_RUN_MAX)) {
+    n++;                                                                      }
+  return n;
+} // end function RunLen
+
+
+static bool IsRunStart(const uint8_t * row, uint8_t at, uint8_t width)
+{
+  return RunLen(row, at, width) >= ((0 == row[at]) ? ZEROS_MIN : REPEAT_MIN);
+} // end function IsRunStart
+
+
+// Pack one page row of a glyph, return bytes written at pOut
+static uint16_t PackRow(const uint8_t * row, uint8_t width, uint8_t * pOut,
+                        uint16_t * pTokens)
+{
+  uint8_t * p  = pOut;
+  uint8_t   at = 0;
+  uint8_t   n;
+
+  while (at < width)
+  {
+    (*pTokens)++;
+    if (IsRunStart(row, at, width))
+    {
+      n = RunLen(row, at, width);
+      if (0 == row[at])
+      {
+        *p++ = RLE_ZEROS | (n - 1);
+      }
+      else
+      {
+        *p++ = RLE_REPEAT | (n - 1);
+        *p++ = row[at];
+      }
+    }
+    else
+    {                             // Literal ends where a run worth a token
+      n = 1;                      // starts
+      while (((at + n) < width) && (n < RLE_LIT_MAX) &&
+             !IsRunStart(row, at + n, width)) {
+        n++;                                   }
+      *p++ = RLE_LITERAL | (n - 1);
+      memcpy(p, &row[at], n);
+      p += n;
+    }
+    at += n;
+  }
+  return p - pOut;
+} // end function PackRow
+
+
+// Unpack one page row as lcd.c does, return bytes consumed or 0 if malformed
+static uint16_t UnpackRow(const uint8_t * pIn, uint8_t width, uint8_t * row)
+{
+  const uint8_t * p  = pIn;
+  uint8_t         at = 0;
+  uint8_t         token;
+  uint8_t         n;
+
+  while (at < width)
+  {
+    token = *p++;
+    n = (token & ((token & RLE_LITERAL) ? 0x7F : 0x3F)) + 1;
+    if ((at + n) > width)   {
+      return 0;             }
+    if (token & RLE_LITERAL)
+    {
+      memcpy(&row[at], p, n);
+      p += n;
+    }
+    else
+    {
+      memset(&row[at], (token & RLE_REPEAT) ? *p++ : 0x00, n);
+    }
+    at += n;
+  }
+  return p - pIn;
+} // end function UnpackRow
+
+
+static uint32_t PlainBytes(const packfont_t * pPack)
+{
+  return (uint32_t)pPack->nGlyphs * pPack->pFont->width * pPack->pFont->height;
+} // end function PlainBytes
+
+
+static void PrintCode(const char * lead, uint8_t code)
+{
+  if ((' ' < code) && (code < 0x7F) && ('\\' != code) && ('\'' != code))
+  {
+    printf("%s// '%c'\n", lead, code);
+  }
+  else
+  {
+    printf("%s// 0x%02X\n", lead, code);
+  }
+} // end routine PrintCode
+
+
+static void PrintFont(const packfont_t * pPack)
+{
+  uint16_t g;
+  uint16_t i;
+  uint16_t end;
+  uint8_t  col;
+
+  printf("\n// %s: offset of each glyph in %s_RLE[]\n", pPack->title, pPack->name);
+  printf("static const uint16_t %s_RLE_INDEX[] =\n{\n", pPack->name);
+  for (g = 0; g < pPack->nGlyphs; g++)
+  {
+    printf("  %4u%c", pPack->index[g], ((g + 1) < pPack->nGlyphs) ? ',' : ' ');
+    PrintCode("   ", GlyphCode(pPack->pFont, g));
+  }
+  printf("};\n");
+
+  printf("\n// %s: packed glyphs\n", pPack->title);
+  printf("static const uint8_t %s_RLE[] =\n{\n", pPack->name);
+  for (g = 0; g < pPack->nGlyphs; g++)
+  {
+    PrintCode("  ", GlyphCode(pPack->pFont, g));
+    end = ((g + 1) < pPack->nGlyphs) ? pPack->index[g + 1] : pPack->len;
+    for (i = pPack->index[g], col = 0; i < end; i++)
+    {
+      printf("%s0x%02X%s", (0 == col) ? "  " : " ", pPack->packed[i],
+             ((i + 1) < pPack->len) ? "," : "");
+      if ((++col == VALUES_PER_LINE) || ((i + 1) == end))
+      {
+        putchar('\n');
+        col = 0;
+      }
+    }
+  }
+  printf("};\n");
+} // end routine PrintFont
+
+
+// Pack every glyph of a font and check each unpacks to its plain glyph
+static bool PackFont(packfont_t * pPack)
+{
+  const font_t *  pFont = pPack->pFont;
+  const uint8_t * pPlain;
+  uint8_t         row[RLE_LIT_MAX];
+  uint16_t        ctTokens;
+  uint16_t        used;
+  uint16_t        g;
+  uint8_t         page;
+
+  pPack->nGlyphs = GlyphCount(pFont);
+  if ((pFont->width > RLE_LIT_MAX) || (pPack->nGlyphs > GLYPHS_MAX) ||
+      (NULL != pFont->index))
+  {
+    fprintf(stderr, "fontrle: %s must be plain and at most %u wide\n",
+            pPack->title, RLE_LIT_MAX);
+    return false;
+  }
+  for (g = 0; g < pPack->nGlyphs; g++)
+  {
+    pPlain          = pFont->atlas + (uint32_t)g * pFont->width * pFont->height;
+    pPack->index[g] = pPack->len;
+    ctTokens        = 0;
+    for (page = 0; page < pFont->height; page++)
+    {
+      if ((pPack->len + 2u * pFont->width) > PACKED_MAX)
+      {
+        fprintf(stderr, "fontrle: %s too big\n", pPack->title);
+        return false;
+      }
+      pPack->len += PackRow(pPlain + page * pFont->width, pFont->width,
+                            &pPack->packed[pPack->len], &ctTokens);
+    }
+    if (ctTokens > pPack->worst)  {
+      pPack->worst = ctTokens;    }
+
+    for (page = 0, used = pPack->index[g]; page < pFont->height; page++)
+    {
+      used += UnpackRow(&pPack->packed[used], pFont->width, row);
+      if (0 != memcmp(row, pPlain + page * pFont->width, pFont->width))
+      {
+        fprintf(stderr, "fontrle: %s glyph %u row %u does not unpack\n",
+                pPack->title, g, page);
+        return false;
+      }
+    }
+  }
+  return true;
+} // end function PackFont
+
+
+int main(void)
+{
+  const packfont_t * pPack;
+  uint32_t           plainWords;
+  uint32_t           packedWords;
+  uint32_t           savedWords = 0;
+  size_t             f;
+
+  for (f = 0; f < PACK_FONTS; f++)
+  {
+    if (!PackFont(&packFonts[f])) {
+      return EXIT_FAILURE;        }
+  }
+
+  printf("#ifndef FONTS_RLE_H\n#define FONTS_RLE_H\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"//        Property of United States of America - For Official Use Only        //\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"/*\n"
+" *  FILE NAME     : fonts_rle.h\n"
+" *\n"
+" *  DESCRIPTION   : Packed TERMINAL 12X16 and VERDANA 34X56 glyphs (format in\n"
+" *    fonts.h) and offset of each glyph, included by fonts.c when FONTS_USE_RLE\n"
+" *    is 1.  GENERATED by host/fontrle.c from the plain glyphs in fonts.c, do\n"
+" *    not edit; run \"make -f host/Makefile fonts\" after changing those.\n"
+" *\n");
+  for (f = 0; f < PACK_FONTS; f++)
+  {
+    pPack       = &packFonts[f];
+    plainWords  = (PlainBytes(pPack) + 1) / 2;
+    packedWords = (pPack->len + 1) / 2 + pPack->nGlyphs;
+    savedWords += plainWords - packedWords;
+    printf(" *    %-15s: %3u glyphs, %4u plain bytes packed in %4u + %3u index\n",
+           pPack->title, pPack->nGlyphs, PlainBytes(pPack), pPack->len,
+           2 * pPack->nGlyphs);
+    fprintf(stderr, "%-15s: plain %4u bytes (%4u words), packed %4u + %3u index"
+            " bytes (%4u words), at most %3u tokens per glyph\n",
+            pPack->title, PlainBytes(pPack), plainWords, pPack->len,
+            2 * pPack->nGlyphs, packedWords, pPack->worst);
+  }
+  fprintf(stderr, "fonts_rle.h saves %u instruction words (%u bytes of const"
+          " data)\n", savedWords, 2 * savedWords);
+  printf(" */\n#include <stdint.h>\n");
+  for (f = 0; f < PACK_FONTS; f++)  {
+    PrintFont(&packFonts[f]);       }
+  printf("\n#endif // FONTS_RLE_H\n");
+
+  return EXIT_SUCCESS;
+} // end function main
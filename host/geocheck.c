@@ -0,0 +1,788 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geocheck.c
+ *
+ *  DESCRIPTION   : Host tool that checks the zone tests at every one of the
+ *    2^32 geopt16_t points against references, rows of the lattice shared
+ *    among one thread per core.  Exits non-zero on any failure.
+ *
+ *    Test zones:  TestInsideLlUrZone() and TestInsidePtRadiusZone() for a set
+ *    of zones (incl. ones crossing the Anti-Meridian, 180+ degrees wide, and
+ *    at high lat), and that every point found inside is also inside the
+ *    zone's GeofenceZoneBox() box (so the box prefilter never changes a
+ *    result).
+ *
+ *    LL-UR reference:  lat strictly between LL's and UR's, and lon strictly
+ *    inside the arc going east from LL's lon to UR's.  Must match exactly.
+ *
+ *    Point & radius reference:  great circle (haversine) distance on a sphere
+ *    of 69.1 miles/degree.  As the zone test is a flat earth estimate, a point
+ *    found inside may be up to PR_TOL miles beyond the radius, and one found
+ *    outside up to PR_TOL miles short of it; the worst of each is reported.
+ *
+ *    Polygon sweep:  each polygon of GEOZONES[] (geozones.h) and of TEST_POLYS
+ *    (extremes of the lattice, e.g. a vertex at -90,-180, and edges too long
+ *    for 16x16 math) by TestInsidePolygonZone(), TestInsidePolySlabZone() when
+ *    it has a slab index, and TestInsidePolygonZone32() given the same raw
+ *    values.  The reference is exact rational math along each lat row:  the
+ *    lon at which each edge crosses the row is a fraction, compared with each
+ *    lattice lon by cross-multiplying in 64 bits, so a point is inside when
+ *    the signed crossings west of it don't sum to 0, and on the border when it
+ *    is exactly on an edge.  Off the border results must match; on it either
+ *    is taken (counted).  Each lattice row costs the reference a sort of its
+ *    few crossings, not a test per point, so a sweep takes minutes.  Also
+ *    GeofenceEvaluate() (boxes, slab indexes) must agree with the zone tests
+ *    run on their own.
+ *
+ *    With -o dir, the sweep also writes into dir:  geocheck_cover.pgm, share
+ *    of each 0.35 x 0.35 degree block GeofenceEvaluate() finds in a zone;
+ *    geocheck_diff.ppm, the same dimmed with border points green and blocks
+ *    with any mismatch red; and geocheck_diff.txt listing each mismatch.
+ *
+ *    usage: geocheck [-t | -p] [-o dir]    -t test zones only, -p sweep only
+ *
+ *    Run by "make -f host/Makefile geocheck" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add polygon sweep against an exact rational reference, with coverage
+ *      and discrepancy images
+ *      Initial implementation
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "geofence.h"
+#include "geozones.h"
+#if (GEOFENCE_USE_SLABS == 1)
+#include "geozones_slab.h"
+#endif
+
+#define LAT_DEG(d)    ((int16_t)((d) * 32767.0 /  90.0))
+#define LON_DEG(d)    ((int16_t)((d) * 32767.0 / 180.0))
+#define MILES_PER_DEG (69.1)
+#define PR_TOL(r)     (1.0 + 0.01 * (r))  // miles either way of radius r
+#define THREADS_MAX   64
+#define EXAMPLES_MAX  4
+#define POLYS_MAX     16          // GEOZONES[] polygons + TEST_POLYS
+#define KERNEL_CNT    3           // 16-bit, slab, 32-bit polygon tests
+#define IMG_W         1024        // image pixel is 64 lon by 128 lat lsbs
+#define IMG_H         512
+#define DIFF_LINES_MAX 100000     // geocheck_diff.txt
+
+typedef struct tagCHECK_ZONE
+{
+  const char *  name;
+  geozone16_t   zone;
+} checkzone_t;
+
+typedef struct tagCHECK_RESULT
+{
+  uint64_t      inside;           // points zone test found inside
+  uint64_t      wrong;            // LL-UR mismatches, pt&rad beyond PR_TOL
+  uint64_t      outOfBox;         // inside points outside GeofenceZoneBox()
+  double        worstIn;          // pt&rad: most miles inside pt is past r
+  double        worstOut;         // pt&rad: most miles outside pt is short
+  geopt16_t     example[EXAMPLES_MAX];
+  uint16_t      nExamples;
+} checkresult_t;
+
+typedef struct tagSWEEP_POLY
+{
+  char                 name[24];
+  const polyzone16_t * z;
+  const polyslab16_t * s;         // slab index, if any
+  polyzone32_t *       z32;       // z's raw values as geopt32_t
+} sweeppoly_t;
+
+typedef struct tagCROSSING
+{
+  int64_t num;                    // edge crosses row at lon num/den
+  int64_t den;                    //  den > 0
+  int16_t dir;                    // +1 going north, -1 south
+} crossing_t;
+
+typedef struct tagSWEEP_RESULT
+{
+  uint64_t   inside[POLYS_MAX];   // reference inside, off border
+  uint64_t   border[POLYS_MAX];   // points on border
+  uint64_t   wrong[POLYS_MAX][KERNEL_CNT];
+  uint64_t   evalWrong;           // GeofenceEvaluate() vs zone tests
+  uint64_t   covered;             // GeofenceEvaluate() found in a zone
+  uint8_t *  ref[POLYS_MAX];      // reference of row, by lon + 32768
+  uint16_t * cover;               // per image pixel, covered points
+  uint16_t * edge;                //  border points
+  uint16_t * bad;                 //  mismatches
+} sweepresult_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static const llurzone16_t LLUR_ZONES[] =
+{
+  { { LAT_DEG(  5.0), LON_DEG( 170.05) }, { LAT_DEG( 80.0), LON_DEG( -40.0) } },
+  { { LAT_DEG(-10.0), LON_DEG( 175.0)  }, { LAT_DEG( 10.0), LON_DEG(-175.0) } },
+  { { LAT_DEG( 10.0), LON_DEG(  10.0)  }, { LAT_DEG( 20.0), LON_DEG(   5.0) } },
+  { { LAT_DEG(-30.0), LON_DEG(-170.0)  }, { LAT_DEG( 30.0), LON_DEG( 170.0) } },
+  { { LAT_DEG(-90.0), LON_DEG(-180.0)  }, { LAT_DEG( 90.0), LON_DEG(-179.0) } },
+  { { LAT_DEG( 30.0), LON_DEG(  90.0)  }, { LAT_DEG( 40.0), LON_DEG(-180.0) } }
+};
+
+static const ptradzone16_t PTRAD_ZONES[] =
+{
+  { { LAT_DEG( 38.9),  LON_DEG( -77.0)  }, 181 * 181 },
+  { { LAT_DEG(  0.0),  LON_DEG(   0.0)  },  50 *  50 },
+  { { LAT_DEG( 70.0),  LON_DEG(  20.0)  }, 100 * 100 },
+  { { LAT_DEG(-60.0),  LON_DEG( 179.5)  }, 120 * 120 },
+  { { LAT_DEG( 80.0),  LON_DEG(   0.0)  }, 181 * 181 },
+  { { LAT_DEG(-10.0),  LON_DEG(-179.95) },   5 *   5 }
+};
+
+static const checkzone_t CHECK_ZONES[] =
+{
+  { "LLUR USA box, crosses 180",   { GC_LLUR,  { .llUr  = &LLUR_ZONES[0]  } } },
+  { "LLUR 10 wide, crosses 180",   { GC_LLUR,  { .llUr  = &LLUR_ZONES[1]  } } },
+  { "LLUR 355 wide, crosses 180",  { GC_LLUR,  { .llUr  = &LLUR_ZONES[2]  } } },
+  { "LLUR 340 wide",               { GC_LLUR,  { .llUr  = &LLUR_ZONES[3]  } } },
+  { "LLUR pole to pole at -180",   { GC_LLUR,  { .llUr  = &LLUR_ZONES[4]  } } },
+  { "LLUR 90E east to 180",        { GC_LLUR,  { .llUr  = &LLUR_ZONES[5]  } } },
+  { "PTRAD 38.9N 77W r181",        { GC_PTRAD, { .ptRad = &PTRAD_ZONES[0] } } },
+  { "PTRAD 0N 0E r50",             { GC_PTRAD, { .ptRad = &PTRAD_ZONES[1] } } },
+  { "PTRAD 70N 20E r100",          { GC_PTRAD, { .ptRad = &PTRAD_ZONES[2] } } },
+  { "PTRAD 60S 179.5E r120",       { GC_PTRAD, { .ptRad = &PTRAD_ZONES[3] } } },
+  { "PTRAD 80N 0E r181",           { GC_PTRAD, { .ptRad = &PTRAD_ZONES[4] } } },
+  { "PTRAD 10S 179.95W r5",        { GC_PTRAD, { .ptRad = &PTRAD_ZONES[5] } } }
+};
+#define CHECK_ZONE_CNT (sizeof(CHECK_ZONES) / sizeof(CHECK_ZONES[0]))
+
+static const polyzone16_t TEST_POLY_WORLD = { 4,  // all but lattice's rim
+  { {-32767,-32767}, {-32767, 32767}, { 32767, 32767}, { 32767,-32767},
+    {-32767,-32767} } };
+static const polyzone16_t TEST_POLY_CORNER = { 3, // vertex at -90,-180
+  { {-32767,-32767}, {-20000,-32767}, {-32767,-20000}, {-32767,-32767} } };
+static const polyzone16_t TEST_POLY_RIM = { 4,    // vertex at -32768,-32768
+  { {-32768,-32768}, {-32768, 32767}, {  1000,   -50}, { 32767,-32768},
+    {-32768,-32768} } };
+static const polyzone16_t TEST_POLY_STAR = { 10,  // long edges, concave
+  { {  30000,     0}, {   7000, 12000}, {  9000, 31000}, {  -4000, 14000},
+    { -25000, 20000}, { -12000,     0}, { -25000,-20000}, {  -4000,-14000},
+    {   9000,-31000}, {   7000,-12000}, {  30000,     0} } };
+static const polyzone16_t TEST_POLY_BOWTIE = { 4, // self-crossing, winding 0/+-1
+  { { -5000, -9000}, {  5000,  9000}, {  5000, -9000}, { -5000,  9000},
+    { -5000, -9000} } };
+
+static const struct { const char * name; const polyzone16_t * z; } TEST_POLYS[] =
+{
+  { "TEST world",  &TEST_POLY_WORLD  },
+  { "TEST corner", &TEST_POLY_CORNER },
+  { "TEST rim",    &TEST_POLY_RIM    },
+  { "TEST star",   &TEST_POLY_STAR   },
+  { "TEST bowtie", &TEST_POLY_BOWTIE }
+};
+#define TEST_POLY_CNT (sizeof(TEST_POLYS) / sizeof(TEST_POLYS[0]))
+
+static const checkzone_t * pCheck;        // zone being checked
+static llurzone16_t        checkBox;      // its GeofenceZoneBox()
+static bool                refLat[65536]; // LL-UR reference by lat + 32768
+static bool                refLon[65536]; //  and by lon + 32768
+static int32_t             nextRow;       // next lat row to check
+static pthread_mutex_t     rowLock = PTHREAD_MUTEX_INITIALIZER;
+static sweeppoly_t         polys[POLYS_MAX];
+static int16_t             nPolys;
+static FILE *              pDiff;         // geocheck_diff.txt, if -o
+static uint32_t            nDiffLines;
+
+
+static double LatDeg(int32_t lat)
+{
+  return lat * 90.0 / 32767.0;
+} // end function LatDeg
+
+
+static double LonDeg(int32_t lon)
+{
+  return lon * 180.0 / 32767.0;
+} // end function LonDeg
+
+
+// Degrees going east from lon a to lon b, 0 thru <360
+static double EastDeg(double a, double b)
+{
+  double d = fmod(b - a, 360.0);
+
+  return (d < 0.0) ? (d + 360.0) : d;
+} // end function EastDeg
+
+
+static void FillLlUrRef(const llurzone16_t * z)
+{
+  double  span = EastDeg(LonDeg(z->ll.lon), LonDeg(z->ur.lon));
+  double  east;
+  int32_t v;
+
+  for (v = INT16_MIN; v <= INT16_MAX; v++)
+  {
+    refLat[v + 32768] = (LatDeg(z->ll.lat) < LatDeg(v)) &&
+                        (LatDeg(v) < LatDeg(z->ur.lat));
+    east = EastDeg(LonDeg(z->ll.lon), LonDeg(v));
+    refLon[v + 32768] = (0.0 < east) && (east < span);
+  }
+} // end routine FillLlUrRef
+
+
+static double HaversineMiles(geopt16_t a, geopt16_t b)
+{
+  double lat1 = LatDeg(a.lat) * M_PI / 180.0;
+  double lat2 = LatDeg(b.lat) * M_PI / 180.0;
+  double dLat = lat2 - lat1;
+  double dLon = (LonDeg(b.lon) - LonDeg(a.lon)) * M_PI / 180.0;
+  double h    = sin(dLat / 2) * sin(dLat / 2) +
+                cos(lat1) * cos(lat2) * sin(dLon / 2) * sin(dLon / 2);
+
+  return 2.0 * asin(sqrt((h < 1.0) ? h : 1.0)) * MILES_PER_DEG * 180.0 / M_PI;
+} // end function HaversineMiles
+
+
+static void Note(checkresult_t * pRes, geopt16_t p)
+{
+  pRes->wrong++;
+  if (pRes->nExamples < EXAMPLES_MAX) {
+    pRes->example[pRes->nExamples++] = p; }
+} // end routine Note
+
+
+static void CheckRow(int16_t lat, checkresult_t * pRes)
+{
+  const ptradzone16_t * z = pCheck->zone.z.ptRad;  // if GC_PTRAD
+  double                r = 0.0;
+  double                latMiles = 0.0;
+  double                d;
+  geopt16_t             p;
+  int32_t               lon;
+  int16_t               in;
+
+  p.lat = lat;
+  if (GC_PTRAD == pCheck->zone.cat)
+  {
+    r        = sqrt(z->r2);
+    latMiles = fabs(LatDeg(lat) - LatDeg(z->pt.lat)) * MILES_PER_DEG;
+  }
+  for (lon = INT16_MIN; lon <= INT16_MAX; lon++)
+  {
+    p.lon = lon;
+    if (GC_LLUR == pCheck->zone.cat)
+    {
+      in = TestInsideLlUrZone(p, pCheck->zone.z.llUr);
+      if (in != (refLat[lat + 32768] && refLon[lon + 32768])) {
+        Note(pRes, p);                                        }
+    }
+    else
+    {
+      in = TestInsidePtRadiusZone(p, z);
+      if (in || (latMiles < (r - PR_TOL(r))))
+      { // Reference distance is at least latMiles, so only work it out
+        d = HaversineMiles(z->pt, p); // when zone test may be wrong
+        if (in && ((d - r) > pRes->worstIn))          {
+          pRes->worstIn  = d - r;                     }
+        if (!in && ((r - d) > pRes->worstOut))        {
+          pRes->worstOut = r - d;                     }
+        if ((in && (d > (r + PR_TOL(r)))) || (!in && (d < (r - PR_TOL(r))))) {
+          Note(pRes, p);                                                     }
+      }
+    }
+    if (in)
+    {
+      pRes->inside++;
+      if ((lat < checkBox.ll.lat) || (lat > checkBox.ur.lat) ||
+          (lon < checkBox.ll.lon) || (lon > checkBox.ur.lon)) {
+        pRes->outOfBox++;                                     }
+    }
+  }
+} // end routine CheckRow
+
+
+// Next lat row for a thread to check, or > INT16_MAX when all are taken
+static int32_t NextRow(void)
+{
+  int32_t row;
+
+  pthread_mutex_lock(&rowLock);
+  row = nextRow++;
+  pthread_mutex_unlock(&rowLock);
+  if (0 == (row & 0x0FFF))  {
+    fprintf(stderr, "  lat %6d\r", row); }
+  return row;
+} // end function NextRow
+
+
+static void * CheckThread(void * arg)
+{
+  checkresult_t * pRes = arg;
+  int32_t         row;
+
+  while ((row = NextRow()) <= INT16_MAX)  {
+    CheckRow((int16_t)row, pRes);         }
+  return NULL;
+} // end function CheckThread
+
+
+// Exact reference for polygon z along lat row:  ref[lon + 32768] is 1 when
+// inside, 2 when on its border, otherwise 0
+static void PolyRowRef(const polyzone16_t * z, int32_t lat, uint8_t * ref)
+{
+  crossing_t        cross[POLYS_MAX * 64];
+  crossing_t        c;
+  const geopt16_t * a;
+  const geopt16_t * b;
+  int64_t           dLat;
+  int32_t           lon;
+  int32_t           lo;
+  int32_t           hi;
+  int16_t           nCross = 0;
+  int16_t           wn = 0;
+  int16_t           i;
+  int16_t           j;
+
+  for (i = 1; i <= z->n; i++)
+  { // Edges whose lat span [lo, hi) holds the row cross it once
+    a = &z->v[i-1];
+    b = &z->v[i];
+    if ((a->lat == b->lat) || (lat < ((a->lat < b->lat) ? a->lat : b->lat)) ||
+        (lat >= ((a->lat < b->lat) ? b->lat : a->lat)))
+    {
+      continue;
+    }
+    dLat  = (int64_t)b->lat - a->lat;
+    c.den = (dLat < 0) ? -dLat : dLat;
+    c.num = (int64_t)a->lon * c.den +
+            ((int64_t)lat - a->lat) * ((int64_t)b->lon - a->lon) *
+            ((dLat < 0) ? -1 : 1);
+    c.dir = (dLat < 0) ? -1 : 1;
+    for (j = nCross; (j > 0) && ((cross[j-1].num * c.den) > (c.num * cross[j-1].den));
+         j--)
+    {
+      cross[j] = cross[j-1];
+    }
+    cross[j] = c;
+    nCross++;
+  }
+  for (i = 0, lon = INT16_MIN; lon <= INT16_MAX; lon++)
+  { // Sum crossings west of lon
+    while ((i < nCross) && (cross[i].num < ((int64_t)lon * cross[i].den)))  {
+      wn += cross[i++].dir;                                                 }
+    ref[lon + 32768] = (0 != wn) ? 1 : 0;
+  }
+  for (i = 1; i <= z->n; i++)
+  { // Points exactly on an edge (incl. its ends) are on the border
+    a = &z->v[i-1];
+    b = &z->v[i];
+    if ((lat < ((a->lat < b->lat) ? a->lat : b->lat)) ||
+        (lat > ((a->lat < b->lat) ? b->lat : a->lat)))
+    {
+      continue;
+    }
+    if (a->lat == b->lat)
+    {
+      lo = (a->lon < b->lon) ? a->lon : b->lon;
+      hi = (a->lon < b->lon) ? b->lon : a->lon;
+      memset(&ref[lo + 32768], 2, hi - lo + 1);
+      continue;
+    }
+    dLat  = (int64_t)b->lat - a->lat;
+    c.num = (int64_t)a->lon * dLat + ((int64_t)lat - a->lat) * ((int64_t)b->lon - a->lon);
+    if (0 == (c.num % dLat)) {
+      ref[c.num / dLat + 32768] = 2; }
+  }
+} // end routine PolyRowRef
+
+
+static void NoteDiff(const char * name, const char * test, geopt16_t p,
+                     int16_t got, uint8_t ref)
+{
+  if (NULL == pDiff)  {
+    return;           }
+  pthread_mutex_lock(&rowLock);
+  if (nDiffLines++ < DIFF_LINES_MAX)
+  {
+    fprintf(pDiff, "%-16s %-8s %6d,%6d (%9.5f, %10.5f) test %d, reference %s\n",
+            name, test, p.lat, p.lon, LatDeg(p.lat), LonDeg(p.lon), got,
+            ref ? "inside" : "outside");
+  }
+  pthread_mutex_unlock(&rowLock);
+} // end routine NoteDiff
+
+
+static void SweepRow(int16_t lat, sweepresult_t * pRes)
+{
+  static const char * TESTS[KERNEL_CNT] = { "16-bit", "slab", "32-bit" };
+  geopt16_t           p;
+  geopt32_t           p32;
+  int16_t             got[KERNEL_CNT];
+  int32_t             lon;
+  uint32_t            pixel;
+  uint8_t             ref;
+  bool                isInAny;
+  bool                isInEval;
+  int16_t             i;
+  int16_t             k;
+
+  for (i = 0; i < nPolys; i++)  {
+    PolyRowRef(polys[i].z, lat, pRes->ref[i]); }
+  p.lat   = lat;
+  p32.lat = lat;
+  for (lon = INT16_MIN; lon <= INT16_MAX; lon++)
+  {
+    p.lon   = lon;
+    p32.lon = lon;
+    pixel   = (((uint32_t)(INT16_MAX - lat) >> 7) * IMG_W) +
+              ((uint32_t)(lon + 32768) >> 6);
+    for (i = 0; i < nPolys; i++)
+    {
+      ref    = pRes->ref[i][lon + 32768];
+      got[0] = TestInsidePolygonZone(p, polys[i].z);
+      got[1] = (NULL != polys[i].s) ?
+               TestInsidePolySlabZone(p, polys[i].z, polys[i].s) : got[0];
+      got[2] = TestInsidePolygonZone32(p32, polys[i].z32);
+      if (2 == ref)
+      {
+        pRes->border[i]++;
+        pRes->edge[pixel]++;
+        continue;
+      }
+      pRes->inside[i] += ref;
+      for (k = 0; k < KERNEL_CNT; k++)
+      {
+        if ((0 != got[k]) != ref)
+        {
+          pRes->wrong[i][k]++;
+          pRes->bad[pixel]++;
+          NoteDiff(polys[i].name, TESTS[k], p, got[k], ref);
+        }
+      }
+    }
+    for (isInAny = false, i = 0; (i < (int16_t)GEOZONE_CNT) && !isInAny; i++)
+    {
+      switch (GEOZONES[i].cat)
+      {
+        case GC_PTRAD:
+          isInAny = TestInsidePtRadiusZone(p, GEOZONES[i].z.ptRad);
+          break;
+        case GC_LLUR:
+          isInAny = TestInsideLlUrZone(p, GEOZONES[i].z.llUr);
+          break;
+        case GC_POLY:
+          isInAny = TestInsidePolygonZone(p, GEOZONES[i].z.poly);
+          break;
+        default:
+          break;
+      }
+    }
+    isInEval = (GZ_NONE != GeofenceEvaluate(p));
+    if (isInEval)
+    {
+      pRes->covered++;
+      pRes->cover[pixel]++;
+    }
+    if (isInEval != isInAny)
+    {
+      pRes->evalWrong++;
+      pRes->bad[pixel]++;
+      NoteDiff("GEOZONES[]", "Evaluate", p, !isInAny, isInAny);
+    }
+  }
+} // end routine SweepRow
+
+
+static void * SweepThread(void * arg)
+{
+  sweepresult_t * pRes = arg;
+  int32_t         row;
+
+  while ((row = NextRow()) <= INT16_MAX)  {
+    SweepRow((int16_t)row, pRes);         }
+  return NULL;
+} // end function SweepThread
+
+
+// Coverage image, and discrepancy image (coverage dimmed, border green, any
+// mismatch red), one pixel per 64 x 128 lsb block
+static bool WriteImages(const char * dir, const sweepresult_t * pSum)
+{
+  char     path[512];
+  FILE *   pCover;
+  FILE *   pMap;
+  uint32_t i;
+  uint8_t  grey;
+
+  snprintf(path, sizeof(path), "%s/geocheck_cover.pgm", dir);
+  pCover = fopen(path, "wb");
+  snprintf(path, sizeof(path), "%s/geocheck_diff.ppm", dir);
+  pMap   = fopen(path, "wb");
+  if ((NULL == pCover) || (NULL == pMap))
+  {
+    perror(path);
+    return false;
+  }
+  fprintf(pCover, "P5\n%d %d\n255\n", IMG_W, IMG_H);
+  fprintf(pMap,   "P6\n%d %d\n255\n", IMG_W, IMG_H);
+  for (i = 0; i < (IMG_W * IMG_H); i++)
+  {
+    grey = (uint8_t)((pSum->cover[i] * 255u) / (64u * 128u));
+    fputc(grey, pCover);
+    if (0 != pSum->bad[i])
+    {
+      fputc(255, pMap); fputc(0,   pMap); fputc(0, pMap);
+    }
+    else if (0 != pSum->edge[i])
+    {
+      fputc(0,   pMap); fputc(255, pMap); fputc(0, pMap);
+    }
+    else
+    {
+      fputc(grey / 3, pMap); fputc(grey / 3, pMap); fputc(grey / 3, pMap);
+    }
+  }
+  fclose(pCover);
+  fclose(pMap);
+  return true;
+} // end function WriteImages
+
+
+static bool CheckTestZones(long nThreads)
+{
+  static checkresult_t results[THREADS_MAX];
+  pthread_t            threads[THREADS_MAX];
+  checkresult_t        sum;
+  struct timespec      t0, t1;
+  bool                 isOk = true;
+  size_t               zone;
+  long                 t;
+  uint16_t             e;
+
+  printf("Test zones, pt&rad tolerance %.1f + 1%% of r miles\n", PR_TOL(0));
+  printf("%-28s %10s %8s %6s %8s %8s %6s\n", "zone", "inside", "wrong", "!box",
+         "in past", "out shy", "sec");
+  for (zone = 0; zone < CHECK_ZONE_CNT; zone++)
+  {
+    pCheck  = &CHECK_ZONES[zone];
+    nextRow = INT16_MIN;
+    GeofenceZoneBox(&pCheck->zone, &checkBox);
+    if (GC_LLUR == pCheck->zone.cat)  {
+      FillLlUrRef(pCheck->zone.z.llUr); }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (t = 0; t < nThreads; t++)
+    {
+      results[t] = (checkresult_t){ 0 };
+      pthread_create(&threads[t], NULL, CheckThread, &results[t]);
+    }
+    sum = (checkresult_t){ 0 };
+    for (t = 0; t < nThreads; t++)
+    {
+      pthread_join(threads[t], NULL);
+      sum.inside   += results[t].inside;
+      sum.wrong    += results[t].wrong;
+      sum.outOfBox += results[t].outOfBox;
+      sum.worstIn   = fmax(sum.worstIn,  results[t].worstIn);
+      sum.worstOut  = fmax(sum.worstOut, results[t].worstOut);
+      for (e = 0; (e < results[t].nExamples) && (sum.nExamples < EXAMPLES_MAX);
+           e++)
+      {
+        sum.example[sum.nExamples++] = results[t].example[e];
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("%-28s %10llu %8llu %6llu %8.2f %8.2f %6.1f\n", pCheck->name,
+           (unsigned long long)sum.inside, (unsigned long long)sum.wrong,
+           (unsigned long long)sum.outOfBox, sum.worstIn, sum.worstOut,
+           (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+    for (e = 0; e < sum.nExamples; e++)
+    {
+      printf("    e.g. %d,%d (%.5f, %.5f)\n", sum.example[e].lat,
+             sum.example[e].lon, LatDeg(sum.example[e].lat),
+             LonDeg(sum.example[e].lon));
+    }
+    if ((0 != sum.wrong) || (0 != sum.outOfBox) || (0 == sum.inside)) {
+      isOk = false;                                                   }
+  }
+  return isOk;
+} // end function CheckTestZones
+
+
+static void AddSweepPoly(const char * name, const polyzone16_t * z,
+                         const polyslab16_t * s)
+{
+  sweeppoly_t * pPoly = &polys[nPolys++];
+  int16_t       i;
+
+  snprintf(pPoly->name, sizeof(pPoly->name), "%s", name);
+  pPoly->z      = z;
+  pPoly->s      = s;
+  pPoly->z32    = malloc(sizeof(polyzone32_t) + sizeof(geopt32_t) * (z->n + 1));
+  pPoly->z32->n = z->n;
+  for (i = 0; i <= z->n; i++)
+  {
+    pPoly->z32->v[i].lat = z->v[i].lat;
+    pPoly->z32->v[i].lon = z->v[i].lon;
+  }
+} // end routine AddSweepPoly
+
+
+static bool SweepPolygons(long nThreads, const char * dir)
+{
+  static sweepresult_t results[THREADS_MAX];
+  pthread_t            threads[THREADS_MAX];
+  sweepresult_t        sum;
+  struct timespec      t0, t1;
+  char                 name[24];
+  char                 path[512];
+  bool                 isOk = true;
+  uint32_t             j;
+  long                 t;
+  int16_t              i;
+  int16_t              k;
+
+  for (i = 0; (i < (int16_t)GEOZONE_CNT) && (nPolys < POLYS_MAX); i++)
+  {
+    if (GC_POLY != GEOZONES[i].cat) {
+      continue;                     }
+    snprintf(name, sizeof(name), "GEOZONES[%d]", i);
+#if (GEOFENCE_USE_SLABS == 1)
+    AddSweepPoly(name, GEOZONES[i].z.poly, GEOSLABS[i]);
+#else
+    AddSweepPoly(name, GEOZONES[i].z.poly, NULL);
+#endif
+  }
+  for (i = 0; (i < (int16_t)TEST_POLY_CNT) && (nPolys < POLYS_MAX); i++)  {
+    AddSweepPoly(TEST_POLYS[i].name, TEST_POLYS[i].z, NULL);             }
+  if (NULL != dir)
+  {
+    snprintf(path, sizeof(path), "%s/geocheck_diff.txt", dir);
+    if (NULL == (pDiff = fopen(path, "w")))
+    {
+      perror(path);
+      return false;
+    }
+  }
+
+  nextRow = INT16_MIN;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (t = 0; t < nThreads; t++)
+  {
+    memset(&results[t], 0, sizeof(results[t]));
+    for (i = 0; i < nPolys; i++)  {
+      results[t].ref[i] = malloc(65536); }
+    results[t].cover = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+    results[t].edge  = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+    results[t].bad   = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+    pthread_create(&threads[t], NULL, SweepThread, &results[t]);
+  }
+  memset(&sum, 0, sizeof(sum));
+  sum.cover = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+  sum.edge  = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+  sum.bad   = calloc(IMG_W * IMG_H, sizeof(uint16_t));
+  for (t = 0; t < nThreads; t++)
+  {
+    pthread_join(threads[t], NULL);
+    for (i = 0; i < nPolys; i++)
+    {
+      sum.inside[i] += results[t].inside[i];
+      sum.border[i] += results[t].border[i];
+      for (k = 0; k < KERNEL_CNT; k++)  {
+        sum.wrong[i][k] += results[t].wrong[i][k]; }
+      free(results[t].ref[i]);
+    }
+    sum.evalWrong += results[t].evalWrong;
+    sum.covered   += results[t].covered;
+    for (j = 0; j < (IMG_W * IMG_H); j++)
+    {
+      sum.cover[j] += results[t].cover[j];
+      sum.edge[j]  += results[t].edge[j];
+      sum.bad[j]   += results[t].bad[j];
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+
+  printf("Polygon sweep, exact reference, %.1f sec\n",
+         (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+  printf("%-16s %5s %10s %8s %8s %8s %8s\n", "polygon", "edges", "inside",
+         "border", "16 wrong", "slab wr", "32 wrong");
+  for (i = 0; i < nPolys; i++)
+  {
+    if (NULL != polys[i].s)  {
+      snprintf(path, sizeof(path), "%llu", (unsigned long long)sum.wrong[i][1]); }
+    else                     {
+      snprintf(path, sizeof(path), "-");                                         }
+    printf("%-16s %5d %10llu %8llu %8llu %8s %8llu\n", polys[i].name,
+           polys[i].z->n, (unsigned long long)sum.inside[i],
+           (unsigned long long)sum.border[i],
+           (unsigned long long)sum.wrong[i][0], path,
+           (unsigned long long)sum.wrong[i][2]);
+    for (k = 0; k < KERNEL_CNT; k++)
+    {
+      if (0 != sum.wrong[i][k]) {
+        isOk = false;           }
+    }
+  }
+  printf("GeofenceEvaluate() in a zone at %llu points, %llu differ from zone"
+         " tests\n", (unsigned long long)sum.covered,
+         (unsigned long long)sum.evalWrong);
+  if (0 != sum.evalWrong) {
+    isOk = false;         }
+  if (NULL != pDiff)
+  {
+    fclose(pDiff);
+    printf("%u mismatches listed in %s/geocheck_diff.txt\n",
+           (nDiffLines < DIFF_LINES_MAX) ? nDiffLines : DIFF_LINES_MAX, dir);
+    isOk = WriteImages(dir, &sum) && isOk;
+  }
+  return isOk;
+} // end function SweepPolygons
+
+
+int main(int argc, char * argv[])
+{
+  long         nThreads = sysconf(_SC_NPROCESSORS_ONLN);
+  const char * dir = NULL;
+  bool         isTestZones = true;
+  bool         isSweep = true;
+  bool         isOk = true;
+  int          i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (0 == strcmp(argv[i], "-t"))
+    {
+      isSweep = false;
+    }
+    else if (0 == strcmp(argv[i], "-p"))
+    {
+      isTestZones = false;
+    }
+    else if ((0 == strcmp(argv[i], "-o")) && ((i + 1) < argc))
+    {
+      dir = argv[++i];
+    }
+    else
+    {
+      fprintf(stderr, "usage: geocheck [-t | -p] [-o dir]\n");
+      return EXIT_FAILURE;
+    }
+  }
+  if ((nThreads < 1) || (nThreads > THREADS_MAX)) {
+    nThreads = (nThreads < 1) ? 1 : THREADS_MAX;  }
+  printf("%ld threads, 2^32 points per zone\n", nThreads);
+  if (isTestZones)  {
+    isOk = CheckTestZones(nThreads); }
+  if (isSweep)      {
+    isOk = SweepPolygons(nThreads, dir) && isOk; }
+  printf("%s\n", isOk ? "PASS" : "FAIL");
+  return isOk ? EXIT_SUCCESS : EXIT_FAILURE;
+} // end function main
@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geokernel.c
+ *
+ *  DESCRIPTION   : Host tool that benchmarks the polygon winding tests per
+ *    edge:  TestInsidePolygonZone() (geopt16_t, 64-bit TestIsLeft()) against
+ *    TestInsidePolygonZone32() (geopt32_t, TestIsBelow32()) and against a plain
+ *    geopt32_t walk that takes every crossing edge's sign from 64-bit products,
+ *    for random star polygons (a range's border, ~1 degree across) of 16 to
+ *    1024 edges, and for the GEOZONES[] polygons scaled to geopt32_t (long
+ *    edges).  TestInsidePolygonZone32() is first checked against the plain
+ *    walk at every benchmark point.
+ *
+ *    Host times only rank the tests.  The 'by cmp / 16x16 / 64' columns, how
+ *    crossing edges were decided per test, carry over to the PIC24, where a
+ *    16x16 product is one MUL.SS but a 64-bit one is a __muldi3 library call.
+ *
+ *    Run by "make -f host/Makefile geobench" from the repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "geofence.h"
+#include "geozones.h"
+
+#define BENCH_POINTS    4096      // random points per benchmark polygon
+#define BENCH_MIN_NS    20000000  // least time spent on each test, ns
+#define BENCH_MAX_EDGES 1024
+
+typedef struct tagBENCH_POLY16
+{
+  int16_t   n;
+  geopt16_t v[BENCH_MAX_EDGES + 1];
+} benchpoly16_t;                  // same layout as polyzone16_t
+
+typedef struct tagBENCH_POLY32
+{
+  int16_t   n;
+  geopt32_t v[BENCH_MAX_EDGES + 1];
+} benchpoly32_t;                  // same layout as polyzone32_t
+
+typedef struct tagEDGE_MIX
+{
+  double cmp;                     // crossing edges decided by compares
+  double mul16;                   //  by 16x16 products
+  double mul64;                   //  by 64-bit products
+} edgemix_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static benchpoly16_t poly16;
+static benchpoly32_t poly32;
+static geopt16_t     pts16[BENCH_POINTS];
+static geopt32_t     pts32[BENCH_POINTS];
+
+
+// Winding number of a geopt32_t polygon, every crossing edge by 64-bit math
+static int16_t PlainWalk32(geopt32_t p, const polyzone32_t * z)
+{
+  int16_t wn = 0;
+  int64_t isLeft;
+  int16_t i;
+
+  for (i = z->n; i > 0; i--)
+  {
+    isLeft = ((int64_t)z->v[i].lat - z->v[i-1].lat) *
+             ((int64_t)p.lon - z->v[i-1].lon) -
+             ((int64_t)p.lat - z->v[i-1].lat) *
+             ((int64_t)z->v[i].lon - z->v[i-1].lon);
+    if (z->v[i-1].lon <= p.lon)
+    {
+      if ((z->v[i].lon > p.lon) && (isLeft > 0))  {
+        ++wn;                                     }
+    }
+    else if ((z->v[i].lon <= p.lon) && (isLeft < 0))
+    {
+      --wn;
+    }
+  }
+  return wn;
+} // end function PlainWalk32
+
+
+// How TestIsBelow32() decides each edge crossing p's lon, summed into pMix
+static void CountMix(geopt32_t p, const polyzone32_t * z, edgemix_t * pMix)
+{
+  const geopt32_t * a;
+  const geopt32_t * b;
+  int16_t           i;
+
+  for (i = z->n; i > 0; i--)
+  {
+    a = &z->v[i-1];
+    b = &z->v[i];
+    if (!(((a->lon <= p.lon) && (b->lon > p.lon)) ||
+          ((a->lon > p.lon) && (b->lon <= p.lon)))) {
+      continue;                                     }
+    if (((p.lat < a->lat) && (p.lat < b->lat)) ||
+        ((p.lat >= a->lat) && (p.lat >= b->lat)))
+    {
+      pMix->cmp++;
+    }
+    else if ((labs(b->lat - a->lat) <= GEOPT32_EDGE_MAX) &&
+             (labs(b->lon - a->lon) <= GEOPT32_EDGE_MAX))
+    {
+      pMix->mul16++;
+    }
+    else
+    {
+      pMix->mul64++;
+    }
+  }
+} // end routine CountMix
+
+
+static uint64_t NowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+} // end function NowNs
+
+
+// ns per edge of test 0 (16-bit), 1 (32-bit kernel), or 2 (32-bit plain)
+static double TimeTest(int16_t test)
+{
+  volatile int32_t sum = 0;
+  uint64_t         start = NowNs();
+  uint64_t         ns;
+  uint32_t         reps = 0;
+  uint16_t         j;
+
+  do
+  {
+    for (j = 0; j < BENCH_POINTS; j++)
+    {
+      switch (test)
+      {
+        case 0:
+          sum += TestInsidePolygonZone(pts16[j], (polyzone16_t *)&poly16);
+          break;
+        case 1:
+          sum += TestInsidePolygonZone32(pts32[j], (polyzone32_t *)&poly32);
+          break;
+        default:
+          sum += PlainWalk32(pts32[j], (polyzone32_t *)&poly32);
+          break;
+      }
+    }
+    reps++;
+    ns = NowNs() - start;
+  } while (ns < BENCH_MIN_NS);
+  return (double)ns / ((double)reps * BENCH_POINTS * poly32.n);
+} // end function TimeTest
+
+
+// geopt32_t to geopt16_t, as CoordsToGeopt16() would
+static geopt16_t To16(geopt32_t p)
+{
+  geopt16_t q;
+
+  q.lat = (int16_t)(p.lat * (32767.0 /  90.0) / GEOPT32_PER_DEG);
+  q.lon = (int16_t)(p.lon * (32767.0 / 180.0) / GEOPT32_PER_DEG);
+  return q;
+} // end function To16
+
+
+// Random points in poly32's box, and poly16 & pts16 from poly32 & pts32
+static void FillPoints(void)
+{
+  int32_t latLo = INT32_MAX, latHi = INT32_MIN;
+  int32_t lonLo = INT32_MAX, lonHi = INT32_MIN;
+  int16_t i;
+
+  for (i = 0; i < poly32.n; i++)
+  {
+    if (poly32.v[i].lat < latLo) { latLo = poly32.v[i].lat; }
+    if (poly32.v[i].lat > latHi) { latHi = poly32.v[i].lat; }
+    if (poly32.v[i].lon < lonLo) { lonLo = poly32.v[i].lon; }
+    if (poly32.v[i].lon > lonHi) { lonHi = poly32.v[i].lon; }
+  }
+  for (i = 0; i < BENCH_POINTS; i++)
+  {
+    pts32[i].lat = latLo + (int32_t)(((uint32_t)rand() << 8 ^ rand()) %
+                                     (uint32_t)(latHi - latLo + 1));
+    pts32[i].lon = lonLo + (int32_t)(((uint32_t)rand() << 8 ^ rand()) %
+                                     (uint32_t)(lonHi - lonLo + 1));
+    pts16[i]     = To16(pts32[i]);
+  }
+  poly16.n = poly32.n;
+  for (i = 0; i <= poly32.n; i++)   {
+    poly16.v[i] = To16(poly32.v[i]); }
+} // end routine FillPoints
+
+
+// Benchmark poly32 (and its geopt16_t twin), return false if kernel is wrong
+static bool BenchPoly(const char * title)
+{
+  edgemix_t mix = { 0.0, 0.0, 0.0 };
+  uint16_t  j;
+
+  FillPoints();
+  for (j = 0; j < BENCH_POINTS; j++)
+  {
+    if (TestInsidePolygonZone32(pts32[j], (polyzone32_t *)&poly32) !=
+        PlainWalk32(pts32[j], (polyzone32_t *)&poly32))
+    {
+      fprintf(stderr, "geokernel: %s TestInsidePolygonZone32() wrong at"
+              " %ld,%ld\n", title, (long)pts32[j].lat, (long)pts32[j].lon);
+      return false;
+    }
+    CountMix(pts32[j], (polyzone32_t *)&poly32, &mix);
+  }
+  printf("%-10s %5d %7.2f %7.2f %7.2f %7.2f %6.2f %6.2f\n", title, poly32.n,
+         TimeTest(0), TimeTest(1), TimeTest(2), mix.cmp / BENCH_POINTS,
+         mix.mul16 / BENCH_POINTS, mix.mul64 / BENCH_POINTS);
+  return true;
+} // end function BenchPoly
+
+
+// Star polygon of n edges, ~0.5 degree radius about 38.9N 77.0W, jittered
+static void StarPoly(int16_t n)
+{
+  double  a;
+  double  r;
+  int16_t i;
+
+  poly32.n = n;
+  for (i = 0; i < n; i++)
+  {
+    a = 2.0 * 3.14159265358979 * i / n;
+    r = 0.4 + (rand() % 2000) / 10000.0;
+    poly32.v[i].lat = (int32_t)(( 38.9 + r * sin(a)) * GEOPT32_PER_DEG);
+    poly32.v[i].lon = (int32_t)((-77.0 + r * cos(a)) * GEOPT32_PER_DEG);
+  }
+  poly32.v[n] = poly32.v[0];
+} // end routine StarPoly
+
+
+int main(void)
+{
+  static const int16_t SIZES[] = { 16, 32, 64, 128, 256, 512, 1024 };
+  const polyzone16_t * pZone;
+  char                 title[16];
+  size_t               i;
+  int16_t              j;
+
+  srand(1);
+  printf("ns per edge:                               crossing edges decided"
+         " per test\n");
+  printf("%-10s %5s %7s %7s %7s %7s %6s %6s\n", "polygon", "edges", "16-bit",
+         "32-bit", "32 pln", "by cmp", "16x16", "64-bit");
+  for (i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+  {
+    StarPoly(SIZES[i]);
+    if (!BenchPoly("star")) {
+      return EXIT_FAILURE;  }
+  }
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    pZone = GEOZONES[i].z.poly;
+    if ((GC_POLY != GEOZONES[i].cat) || (pZone->n > BENCH_MAX_EDGES)) {
+      continue;                                                       }
+    poly32.n = pZone->n;
+    for (j = 0; j <= pZone->n; j++)
+    {
+      poly32.v[j].lat = (int32_t)(pZone->v[j].lat * ( 90.0 / 32767.0) *
+                                  GEOPT32_PER_DEG);
+      poly32.v[j].lon = (int32_t)(pZone->v[j].lon * (180.0 / 32767.0) *
+                                  GEOPT32_PER_DEG);
+    }
+    snprintf(title, sizeof(title), "GEOZONES%u", (unsigned)i);
+    if (!BenchPoly(title))  {
+      return EXIT_FAILURE;  }
+  }
+  return EXIT_SUCCESS;
+} // end function main
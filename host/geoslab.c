@@ -0,0 +1,461 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geoslab.c
+ *
+ *  DESCRIPTION   : Host tool that builds the longitude slab index (polyslab16_t
+ *    in geofence.h) of each polygon zone of GEOZONES[] (geozones.h) having
+ *    GEOSLAB_MIN_EDGES or more edges, and writes geozones_slab.h to stdout.
+ *    Each index is checked against TestInsidePolygonZone() over a lattice of
+ *    points covering the zone's box, and at every vertex lon, before anything
+ *    is written.  A size report goes to stderr.
+ *
+ *    With argument -b it instead benchmarks TestInsidePolygonZone() against
+ *    TestInsidePolySlabZone() for random star polygons of 4 to 512 edges (and
+ *    the GEOZONES[] polygons) and reports the crossover, i.e. the fewest edges
+ *    at which the slab test is quicker.  Host times only rank the two tests;
+ *    'edges' (edges looked at per test, incl. binary search steps) carries
+ *    over to the PIC24, where either test costs about the same per edge.
+ *
+ *    Run by "make -f host/Makefile geoslabs" and "... geobench" from the
+ *    repository root.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "geofence.h"
+#include "geozones.h"
+
+#define VALUES_PER_LINE 10
+#define CHECK_STEP      61        // lattice spacing of index check, lsbs
+#define BENCH_POINTS    4096      // random points per benchmark polygon
+#define BENCH_MIN_NS    20000000  // least time spent on each test, ns
+#define BENCH_MAX_EDGES 512
+
+typedef struct tagSLAB_BUILD
+{
+  polyslab16_t s;
+  int16_t *    lon;               // n+1 slab bounds
+  uint16_t *   first;             // n+1 offsets into edge[]
+  uint16_t *   edge;
+  uint32_t     nEdges;            // edge[] entries, all slabs
+  uint16_t     most;              // most edges in any one slab
+} slabbuild_t;
+
+typedef struct tagBENCH_POLY
+{
+  int16_t   n;
+  geopt16_t v[BENCH_MAX_EDGES + 1];
+} benchpoly_t;                    // same layout as polyzone16_t
+
+
+static int CompareLon(const void * a, const void * b)
+{
+  return *(const int16_t *)a - *(const int16_t *)b;
+} // end function CompareLon
+
+
+static int16_t MinLon(const polyzone16_t * z, uint16_t i)
+{
+  return (z->v[i-1].lon < z->v[i].lon) ? z->v[i-1].lon : z->v[i].lon;
+} // end function MinLon
+
+
+static int16_t MaxLon(const polyzone16_t * z, uint16_t i)
+{
+  return (z->v[i-1].lon > z->v[i].lon) ? z->v[i-1].lon : z->v[i].lon;
+} // end function MaxLon
+
+
+// Build slab index of z:  slab bounds are its distinct vertex lons, and edge
+// i is in slab k when its lon span [min, max) holds lon[k] (and so the slab)
+static bool BuildSlabs(const polyzone16_t * z, slabbuild_t * pB)
+{
+  uint16_t m = 0;
+  uint16_t i;
+  uint16_t k;
+
+  memset(pB, 0, sizeof(*pB));
+  pB->lon = malloc(sizeof(int16_t) * (z->n + 1));
+  for (i = 0; i < z->n; i++)  {
+    pB->lon[i] = z->v[i].lon; }
+  qsort(pB->lon, z->n, sizeof(int16_t), CompareLon);
+  for (i = 0; i < z->n; i++)
+  {
+    if ((0 == m) || (pB->lon[i] != pB->lon[m - 1])) {
+      pB->lon[m++] = pB->lon[i];                    }
+  }
+  if (m < 2)
+  {
+    fprintf(stderr, "geoslab: polygon of %d edges spans no lon\n", z->n);
+    return false;
+  }
+  pB->s.n   = m - 1;
+  pB->first = malloc(sizeof(uint16_t) * m);
+  pB->edge  = malloc(sizeof(uint16_t) * (uint32_t)z->n * (m - 1));
+  for (k = 0; k < (m - 1); k++)
+  {
+    pB->first[k] = pB->nEdges;
+    for (i = 1; i <= z->n; i++)
+    {
+      if ((MinLon(z, i) <= pB->lon[k]) && (pB->lon[k] < MaxLon(z, i))) {
+        pB->edge[pB->nEdges++] = i;                                    }
+    }
+    if ((pB->nEdges - pB->first[k]) > pB->most) {
+      pB->most = pB->nEdges - pB->first[k];     }
+    if (pB->nEdges > UINT16_MAX)
+    {
+      fprintf(stderr, "geoslab: polygon of %d edges has too big an index\n",
+              z->n);
+      return false;
+    }
+  }
+  pB->first[m - 1] = pB->nEdges;
+  pB->s.lon   = pB->lon;
+  pB->s.first = pB->first;
+  pB->s.edge  = pB->edge;
+  return true;
+} // end function BuildSlabs
+
+
+static void FreeSlabs(slabbuild_t * pB)
+{
+  free(pB->lon);
+  free(pB->first);
+  free(pB->edge);
+} // end routine FreeSlabs
+
+
+// Bytes of const data of an index, as PIC24 stores it
+static uint32_t SlabBytes(const slabbuild_t * pB)
+{
+  return 4u * (pB->s.n + 1) + 2u * pB->nEdges + sizeof(polyslab16_t);
+} // end function SlabBytes
+
+
+static bool CheckPoint(const polyzone16_t * z, const slabbuild_t * pB,
+                       int32_t lat, int32_t lon)
+{
+  geopt16_t p;
+
+  if ((lat < INT16_MIN) || (lat > INT16_MAX) ||
+      (lon < INT16_MIN) || (lon > INT16_MAX)) {
+    return true;                              }
+  p.lat = lat;
+  p.lon = lon;
+  if (TestInsidePolygonZone(p, z) != TestInsidePolySlabZone(p, z, &pB->s))
+  {
+    fprintf(stderr, "geoslab: index differs from edge walk at %d,%d\n",
+            p.lat, p.lon);
+    return false;
+  }
+  return true;
+} // end function CheckPoint
+
+
+// Check index gives the same winding number as the edge walk, over a lattice
+// covering the polygon's box and along every slab bound and its neighbors
+static bool CheckSlabs(const polyzone16_t * z, const slabbuild_t * pB)
+{
+  int32_t latLo = INT16_MAX;
+  int32_t latHi = INT16_MIN;
+  int32_t lat;
+  int32_t lon;
+  int16_t i;
+
+  for (i = 0; i < z->n; i++)
+  {
+    if (z->v[i].lat < latLo)  {
+      latLo = z->v[i].lat;    }
+    if (z->v[i].lat > latHi)  {
+      latHi = z->v[i].lat;    }
+  }
+  for (lat = latLo - 1; lat <= (latHi + 1); lat += CHECK_STEP)
+  {
+    for (lon = pB->lon[0] - 1; lon <= (pB->lon[pB->s.n] + 1); lon += CHECK_STEP)
+    {
+      if (!CheckPoint(z, pB, lat, lon)) {
+        return false;                   }
+    }
+    for (i = 0; i <= pB->s.n; i++)
+    {
+      if (!CheckPoint(z, pB, lat, pB->lon[i] - 1) ||
+          !CheckPoint(z, pB, lat, pB->lon[i])     ||
+          !CheckPoint(z, pB, lat, pB->lon[i] + 1)) {
+        return false;                              }
+    }
+  }
+  for (i = 0; i < z->n; i++)
+  {
+    if (!CheckPoint(z, pB, z->v[i].lat, z->v[i].lon)) {
+      return false;                                   }
+  }
+  return true;
+} // end function CheckSlabs
+
+
+static void PrintValues(const char * type, const char * name, uint16_t zone,
+                        const void * values, bool isSigned, uint32_t n)
+{
+  uint32_t i;
+
+  printf("static const %s GZ%u_SLAB_%s[] =\n{\n", type, zone, name);
+  for (i = 0; i < n; i++)
+  {
+    if (isSigned) {
+      printf("%s%6d", (0 == (i % VALUES_PER_LINE)) ? "  " : " ",
+             ((const int16_t *)values)[i]);                       }
+    else          {
+      printf("%s%5u", (0 == (i % VALUES_PER_LINE)) ? "  " : " ",
+             ((const uint16_t *)values)[i]);                      }
+    printf("%s", ((i + 1) < n) ? "," : "");
+    if ((((i + 1) % VALUES_PER_LINE) == 0) || ((i + 1) == n)) {
+      putchar('\n');                                          }
+  }
+  printf("};\n");
+} // end routine PrintValues
+
+
+static void PrintSlabs(uint16_t zone, const slabbuild_t * pB)
+{
+  printf("\n// GEOZONES[%u]: %u slabs, %u edge entries, at most %u in a slab\n",
+         zone, pB->s.n, pB->nEdges, pB->most);
+  PrintValues("int16_t",  "LON",   zone, pB->lon,   true,  pB->s.n + 1);
+  PrintValues("uint16_t", "FIRST", zone, pB->first, false, pB->s.n + 1);
+  PrintValues("uint16_t", "EDGE",  zone, pB->edge,  false, pB->nEdges);
+  printf("static const polyslab16_t GZ%u_SLAB =\n", zone);
+  printf("  { %u, GZ%u_SLAB_LON, GZ%u_SLAB_FIRST, GZ%u_SLAB_EDGE };\n",
+         pB->s.n, zone, zone, zone);
+} // end routine PrintSlabs
+
+
+static uint64_t NowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+} // end function NowNs
+
+
+// ns per test of TestInsidePolygonZone() (s NULL) or TestInsidePolySlabZone()
+static double TimeTest(const polyzone16_t * z, const polyslab16_t * s,
+                       const geopt16_t * pts)
+{
+  volatile int32_t sum = 0;
+  uint64_t         start = NowNs();
+  uint64_t         ns;
+  uint32_t         reps = 0;
+  uint16_t         j;
+
+  do
+  {
+    for (j = 0; j < BENCH_POINTS; j++)
+    {
+      sum += (NULL == s) ? TestInsidePolygonZone(pts[j], z)
+                         : TestInsidePolySlabZone(pts[j], z, s);
+    }
+    reps++;
+    ns = NowNs() - start;
+  } while (ns < BENCH_MIN_NS);
+  return (double)ns / ((double)reps * BENCH_POINTS);
+} // end function TimeTest
+
+
+// Average edges looked at per slab test, counting each binary search step
+static double SlabEdges(const slabbuild_t * pB, const geopt16_t * pts)
+{
+  uint32_t visits = 0;
+  uint16_t j;
+  int16_t  k;
+
+  for (j = 0; j < BENCH_POINTS; j++)
+  {
+    if ((pts[j].lon < pB->lon[0]) || (pts[j].lon >= pB->lon[pB->s.n])) {
+      continue;                                                        }
+    for (k = 1; k < pB->s.n; k <<= 1) {
+      visits++;                       }
+    for (k = 0; (k < pB->s.n) && (pB->lon[k + 1] <= pts[j].lon); k++) {
+      ;                                                               }
+    visits += pB->first[k + 1] - pB->first[k];
+  }
+  return (double)visits / BENCH_POINTS;
+} // end function SlabEdges
+
+
+// Random points in polygon's box, as GeofenceEvaluate() only tests those
+static void BenchPoints(const polyzone16_t * z, geopt16_t * pts)
+{
+  int32_t latLo = INT16_MAX, latHi = INT16_MIN;
+  int32_t lonLo = INT16_MAX, lonHi = INT16_MIN;
+  int16_t i;
+
+  for (i = 0; i < z->n; i++)
+  {
+    if (z->v[i].lat < latLo)  { latLo = z->v[i].lat; }
+    if (z->v[i].lat > latHi)  { latHi = z->v[i].lat; }
+    if (z->v[i].lon < lonLo)  { lonLo = z->v[i].lon; }
+    if (z->v[i].lon > lonHi)  { lonHi = z->v[i].lon; }
+  }
+  for (i = 0; i < BENCH_POINTS; i++)
+  {
+    pts[i].lat = latLo + rand() % (latHi - latLo + 1);
+    pts[i].lon = lonLo + rand() % (lonHi - lonLo + 1);
+  }
+} // end routine BenchPoints
+
+
+// Benchmark one polygon, return true if slab test was quicker
+static bool BenchPoly(const char * title, const polyzone16_t * z)
+{
+  static geopt16_t pts[BENCH_POINTS];
+  slabbuild_t      b;
+  double           walkNs;
+  double           slabNs;
+
+  if (!BuildSlabs(z, &b)) {
+    return false;         }
+  BenchPoints(z, pts);
+  walkNs = TimeTest(z, NULL, pts);
+  slabNs = TimeTest(z, &b.s, pts);
+  printf("%-10s %5d %8.1f %8.1f %8.1f %8.1f %7u %5u\n", title, z->n, walkNs,
+         slabNs, (double)z->n, SlabEdges(&b, pts), SlabBytes(&b), b.most);
+  FreeSlabs(&b);
+  return slabNs < walkNs;
+} // end function BenchPoly
+
+
+// Star polygon of n edges about 40N 100W, radius jittered like a coastline
+static void StarPoly(benchpoly_t * pPoly, int16_t n)
+{
+  double  a;
+  double  r;
+  int16_t i;
+
+  pPoly->n = n;
+  for (i = 0; i < n; i++)
+  {
+    a = 2.0 * 3.14159265358979 * i / n;
+    r = 2000.0 + rand() % 3000;
+    pPoly->v[i].lat = (int16_t)(14563 + r * sin(a));
+    pPoly->v[i].lon = (int16_t)(-18204 + r * cos(a));
+  }
+  pPoly->v[n] = pPoly->v[0];
+} // end routine StarPoly
+
+
+static int Bench(void)
+{
+  static const int16_t SIZES[] =
+    { 4, 6, 8, 12, 16, 20, 24, 32, 48, 64, 96, 128, 256, 512 };
+  static benchpoly_t poly;
+  char               title[16];
+  int16_t            crossover = 0;
+  size_t             i;
+
+  srand(1);
+  printf("%-10s %5s %8s %8s %8s %8s %7s %5s\n", "polygon", "edges", "walk ns",
+         "slab ns", "walk ed", "slab ed", "bytes", "most");
+  for (i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+  {
+    StarPoly(&poly, SIZES[i]);
+    if (BenchPoly("star", (const polyzone16_t *)&poly))
+    {
+      if (0 == crossover)         {
+        crossover = SIZES[i];     }
+    }
+    else
+    {
+      crossover = 0;
+    }
+  }
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    if (GC_POLY == GEOZONES[i].cat)
+    {
+      snprintf(title, sizeof(title), "GEOZONES%u", (unsigned)i);
+      BenchPoly(title, GEOZONES[i].z.poly);
+    }
+  }
+  printf("slab test quicker from %d edges (GEOSLAB_MIN_EDGES %d)\n", crossover,
+         GEOSLAB_MIN_EDGES);
+  return EXIT_SUCCESS;
+} // end function Bench
+
+
+int main(int argc, char * argv[])
+{
+  static slabbuild_t builds[GEOZONE_CNT];
+  bool               isIndexed[GEOZONE_CNT] = { false };
+  uint32_t           bytes = 0;
+  uint16_t           i;
+
+  if ((argc > 1) && (0 == strcmp(argv[1], "-b"))) {
+    return Bench();                               }
+
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    if ((GC_POLY != GEOZONES[i].cat) ||
+        (GEOZONES[i].z.poly->n < GEOSLAB_MIN_EDGES)) {
+      continue;                                      }
+    if (!BuildSlabs(GEOZONES[i].z.poly, &builds[i]) ||
+        !CheckSlabs(GEOZONES[i].z.poly, &builds[i]))  {
+      return EXIT_FAILURE;                            }
+    isIndexed[i] = true;
+    bytes += SlabBytes(&builds[i]);
+    fprintf(stderr, "GEOZONES[%u]: %4d edges, %4u slabs, %5u edge entries"
+            " (at most %u per slab), %6u bytes\n", i, GEOZONES[i].z.poly->n,
+            builds[i].s.n, builds[i].nEdges, builds[i].most,
+            SlabBytes(&builds[i]));
+  }
+  fprintf(stderr, "geozones_slab.h holds %u bytes of const data (%u instruction"
+          " words)\n", bytes, (bytes + 1) / 2);
+
+  printf("#ifndef GEOZONES_SLAB_H__\n#define GEOZONES_SLAB_H__\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"//        Property of United States of America - For Official Use Only        //\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"/*\n"
+" *  FILE NAME     : geozones_slab.h\n"
+" *\n"
+" *  DESCRIPTION   : Longitude slab index (polyslab16_t in geofence.h) of each\n"
+" *    polygon zone of GEOZONES[] with GEOSLAB_MIN_EDGES or more edges, as\n"
+" *    GEOSLABS[], included by geofence.c when GEOFENCE_USE_SLABS is 1.\n"
+" *    GENERATED by host/geoslab.c from geozones.h, do not edit; run\n"
+" *    \"make -f host/Makefile geoslabs\" after changing GEOZONES[].\n"
+" */\n"
+"#include <stddef.h>\n#include <stdint.h>\n#include \"geofence.h\"\n");
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    if (isIndexed[i]) {
+      PrintSlabs(i, &builds[i]); }
+  }
+  printf("\n// Slab index of each zone of GEOZONES[], NULL when not indexed\n");
+  printf("static const polyslab16_t * const GEOSLABS[GEOZONE_CNT] =\n{\n");
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    if (isIndexed[i]) {
+      printf("  &GZ%u_SLAB", i); }
+    else              {
+      printf("  NULL");          }
+    printf("%s     // GEOZONES[%u]\n", ((i + 1) < GEOZONE_CNT) ? "," : " ", i);
+  }
+  printf("};\n\n#endif // GEOZONES_SLAB_H__\n");
+
+  for (i = 0; i < GEOZONE_CNT; i++)
+  {
+    if (isIndexed[i]) {
+      FreeSlabs(&builds[i]); }
+  }
+  return EXIT_SUCCESS;
+} // end function main
@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geotrack.c
+ *
+ *  DESCRIPTION   : Host tool that replays simulated patrol tracks, as D.GLL
+ *    fixes (GPS noise, truncated to geopt16_t as CoordsToGeopt16()), through
+ *    the geozone decision three ways, as main.c has checked fixes over time:
+ *      every fix  - GeofenceEvaluate() per fix
+ *      margin     - GeofenceTrack() per fix, zone tests only once a fix moved
+ *                   past the held decision's margin
+ *      scheduled  - GeofenceIsDue() per fix, GeofenceTrack() only for fixes
+ *                   that could be past the margin at worst-case speed
+ *    and counts fixes converted and zone tests (GeofenceLocate()) run.  The
+ *    scheduled decision is checked against the margin one at every fix, and
+ *    both against GeofenceLocate() of the fix away from boundaries (closer,
+ *    hysteresis may hold the prior decision).  Mean speed estimated from
+ *    tracked fixes at least 30 s apart is shown against the true speed.
+ *
+ *    Run by "make -f host/Makefile geotrack" from the repository root:
+ *      geotrack [-s secs]     secs between fixes (default 1)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Count a missed zone entry as wrong at any margin
+ *      Add ship track across the Anti-Meridian into USA_2, lons wrapped
+ *      Initial implementation
+ */
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "geofence.h"
+
+#define M_PER_DEG    111320.0     // meters per degree of lat (and lon at 0)
+#define GPS_SIGMA_M  5.0          // GPS error, meters (1 sigma) per axis
+#define WAYPTS_MAX   12
+#define EST_MIN_SEC  30           // least interval for a speed estimate shown
+#define LSB_PER_M    0.01         // |dLat| + |dLon| per meter, worst at 80N
+
+typedef struct tagWAYPT
+{
+  double   lat;                   // degrees
+  double   lon;
+  double   speed;                 // m/s on the leg to this waypoint
+  uint16_t pause;                 // seconds stopped on reaching it
+} waypt_t;
+
+typedef struct tagTRACK
+{
+  const char * name;
+  uint32_t     secs;              // duration, looping the waypoints
+  int16_t      n;
+  waypt_t      wp[WAYPTS_MAX];    // wp[0] is start (its speed unused)
+} track_t;
+
+typedef struct tagTRACK_RESULT
+{
+  uint32_t fixes;
+  uint32_t marginTests;           // GeofenceLocate() run by margin tracking
+  uint32_t dueFixes;              // fixes converted and tracked when scheduled
+  uint32_t dueTests;              // GeofenceLocate() run when scheduled
+  uint32_t differ;                // scheduled decision != margin decision
+  uint32_t wrong;                 // != GeofenceLocate(), inside or HYST+ out
+  uint32_t flips;                 // scheduled decision changes
+  uint32_t nEst;
+  double   estSum;                // estimated speed, m/s
+  double   trueSum;               // true speed at those fixes, m/s
+} trackresult_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+// Patrol paths about the USA zone's 15N border in the Caribbean, across 180
+// into USA_2 at 25N, and well inside it on the Big Island and in Texas
+static const track_t TRACKS[] =
+{
+  { "foot, Martinique N.", 4 * 3600, 6,
+    { { 14.8400, -61.2100, 0.0,  0 }, { 14.8700, -61.1800, 1.4, 300 },
+      { 14.8800, -61.1400, 1.4,  0 }, { 14.8550, -61.1000, 1.2, 600 },
+      { 14.8300, -61.1300, 1.4,  0 }, { 14.8400, -61.2100, 1.4, 900 } } },
+  { "boat, Dominica chan.", 3 * 3600, 5,
+    { { 14.9000, -61.3000, 0.0,  0 }, { 15.1000, -61.2500, 12.0, 60 },
+      { 14.9200, -61.1500, 12.0, 60 }, { 15.0800, -61.0500, 12.0, 60 },
+      { 14.9000, -61.3000, 12.0, 120 } } },
+  { "ship, across 180",   3 * 3600, 3,
+    { { 25.0000, 179.8000, 0.0,  0 }, { 25.0000, -179.4000, 20.0, 300 },
+      { 25.0000, 179.8000, 20.0, 300 } } },
+  { "sentry, on 15N",     8 * 3600, 2,
+    { { 15.0000, -61.4000, 0.0,  0 }, { 15.0000, -61.4000, 0.0, 3600 } } },
+  { "vehicle, Big Island", 3 * 3600, 5,
+    { { 19.7200, -155.0800, 0.0, 0 }, { 19.6400, -155.5300, 20.0, 300 },
+      { 19.6400, -155.9900, 18.0, 600 }, { 20.0200, -155.6700, 20.0, 300 },
+      { 19.7200, -155.0800, 22.0, 900 } } },
+  { "convoy, Texas",      3 * 3600, 4,
+    { { 31.0000, -100.0000, 0.0, 0 }, { 31.4500, -100.4400, 27.0, 600 },
+      { 31.8000, -99.9000, 25.0, 300 }, { 31.0000, -100.0000, 27.0, 1200 } } },
+};
+#define TRACK_CNT (sizeof(TRACKS) / sizeof(TRACKS[0]))
+
+static uint32_t rng = 0x12345678;
+
+
+// Uniform in (0, 1), fixed sequence so runs compare
+static double Uniform(void)
+{
+  rng = rng * 1664525u + 1013904223u;
+  return ((rng >> 8) + 0.5) / 16777216.0;
+} // end function Uniform
+
+
+static double Gauss(void)
+{
+  return sqrt(-2.0 * log(Uniform())) * cos(2.0 * M_PI * Uniform());
+} // end function Gauss
+
+
+// Lon taken within -180 to 180 (so a difference the short way round)
+static double WrapLon(double lon)
+{
+  if (180.0 < lon)        {
+    lon -= 360.0;         }
+  else if (-180.0 > lon)  {
+    lon += 360.0;         }
+  return lon;
+} // end function WrapLon
+
+
+// Truncated as CoordsToGeopt16() does
+static geopt16_t ToGeopt16(double lat, double lon)
+{
+  geopt16_t p;
+
+  lon   = WrapLon(lon);
+  p.lat = (int16_t)(lat * 32767.0 /  90.0);
+  p.lon = (int16_t)(lon * 32767.0 / 180.0);
+  return p;
+} // end function ToGeopt16
+
+
+// Speed of fix's velocity estimate, m/s
+static double EstSpeed(const geofix16_t * pFix)
+{
+  double north = pFix->vLat / 256.0 *  90.0 / 32767.0 * M_PER_DEG;
+  double east  = pFix->vLon / 256.0 * 180.0 / 32767.0 * M_PER_DEG *
+                 cos(pFix->last.lat * 90.0 / 32767.0 * M_PI / 180.0);
+
+  return sqrt(north * north + east * east);
+} // end function EstSpeed
+
+
+// Would GeofenceTrack() run zone tests for p (lon the short way round)
+static bool WillTest(geopt16_t p, const geofix16_t * pFix)
+{
+  int32_t dLon = labs((int32_t)p.lon - pFix->pt.lon);
+
+  if (32767 < dLon)         {
+    dLon = labs(65534 - dLon);  }
+  return (GZ_UNKNOWN == pFix->zone) ||
+         ((labs((int32_t)p.lat - pFix->pt.lat) + dLon) >= pFix->margin);
+} // end function WillTest
+
+
+static void Replay(const track_t * pTrack, uint16_t fixSecs,
+                   trackresult_t * pRes)
+{
+  geofix16_t fixMargin;
+  geofix16_t fixDue;
+  geopt16_t  p;
+  double     lat = pTrack->wp[0].lat;
+  double     lon = pTrack->wp[0].lon;
+  double     speed;
+  double     dN, dE, d, step;
+  uint32_t   t;
+  uint32_t   pause = 0;
+  uint16_t   secs = 0;
+  int16_t    next = 1;
+  int16_t    zone;
+  int16_t    margin;
+  int16_t    held;
+  bool       isEst;
+
+  memset(pRes, 0, sizeof(*pRes));
+  GeofenceClearFix(&fixMargin);
+  GeofenceClearFix(&fixDue);
+  for (t = 0; t < pTrack->secs; t++)
+  { // Move the unit 1 second toward next waypoint, or wait there
+    speed = 0.0;
+    if (0 < pause)
+    {
+      pause--;
+    }
+    else
+    {
+      dN   = (pTrack->wp[next].lat - lat) * M_PER_DEG;
+      dE   = WrapLon(pTrack->wp[next].lon - lon) * M_PER_DEG *
+             cos(lat * M_PI / 180.0);
+      d    = sqrt(dN * dN + dE * dE);
+      step = pTrack->wp[next].speed;
+      if (d <= step)
+      {
+        lat   = pTrack->wp[next].lat;
+        lon   = pTrack->wp[next].lon;
+        pause = pTrack->wp[next].pause;
+        next  = (next + 1 < pTrack->n) ? (next + 1) : 1;
+        speed = d;
+      }
+      else if (0.0 < d)
+      {
+        lat  += dN / d * step / M_PER_DEG;
+        lon   = WrapLon(lon + dE / d * step /
+                              (M_PER_DEG * cos(lat * M_PI / 180.0)));
+        speed = step;
+      }
+    }
+    if (0 != (++secs % fixSecs))  {
+      continue;                   }
+
+    // A D.GLL fix
+    p = ToGeopt16(lat + GPS_SIGMA_M * Gauss() / M_PER_DEG,
+                  lon + GPS_SIGMA_M * Gauss() /
+                        (M_PER_DEG * cos(lat * M_PI / 180.0)));
+    pRes->fixes++;
+    zone = GeofenceLocate(p, &margin);
+
+    if (WillTest(p, &fixMargin))  {
+      pRes->marginTests++;        }
+    GeofenceTrack(p, &fixMargin);
+
+    held = fixDue.zone;
+    if (GeofenceIsDue(&fixDue, secs))
+    {
+      pRes->dueFixes++;
+      if (WillTest(p, &fixDue)) {
+        pRes->dueTests++;       }
+      isEst = (EST_MIN_SEC <= fixDue.age) && (GZ_UNKNOWN != fixDue.zone);
+      GeofenceTrack(p, &fixDue);
+      if (isEst)
+      {
+        pRes->nEst++;
+        pRes->estSum  += EstSpeed(&fixDue);
+        pRes->trueSum += speed;
+      }
+    }
+    secs = 0;
+    if ((GZ_UNKNOWN != held) && (fixDue.zone != held))  {
+      pRes->flips++;                                    }
+    if (fixDue.zone != fixMargin.zone)  {
+      pRes->differ++;                   }
+    if ((fixDue.zone != zone) &&
+        ((GZ_NONE != zone) || (GEOFENCE_HYST <= margin)))  {
+      pRes->wrong++;                                       }
+  }
+} // end routine Replay
+
+
+int main(int argc, char * argv[])
+{
+  trackresult_t res;
+  trackresult_t sum = { 0 };
+  uint16_t      fixSecs = 1;
+  size_t        i;
+
+  if ((3 == argc) && (0 == strcmp(argv[1], "-s")) && (0 < atoi(argv[2])))
+  {
+    fixSecs = (uint16_t)atoi(argv[2]);
+  }
+  else if (1 != argc)
+  {
+    fprintf(stderr, "usage: geotrack [-s secs]\n");
+    return EXIT_FAILURE;
+  }
+  printf("Fix every %u s, GPS error %.0f m, worst case %.1f m/s, %.1f m/s/s\n",
+         fixSecs, GPS_SIGMA_M, GEOFENCE_VMAX / 256.0 / LSB_PER_M,
+         GEOFENCE_AMAX / 256.0 / LSB_PER_M);
+  printf("%-20s %7s %8s %8s %8s %6s %6s %5s %6s %6s\n", "track", "fixes",
+         "margin", "due", "tested", "differ", "wrong", "flips", "v est",
+         "v true");
+  for (i = 0; i < TRACK_CNT; i++)
+  {
+    Replay(&TRACKS[i], fixSecs, &res);
+    printf("%-20s %7u %8u %8u %8u %6u %6u %5u %6.1f %6.1f\n", TRACKS[i].name,
+           res.fixes, res.marginTests, res.dueFixes, res.dueTests, res.differ,
+           res.wrong, res.flips,
+           res.nEst ? (res.estSum / res.nEst) : 0.0,
+           res.nEst ? (res.trueSum / res.nEst) : 0.0);
+    sum.fixes       += res.fixes;
+    sum.marginTests += res.marginTests;
+    sum.dueFixes    += res.dueFixes;
+    sum.dueTests    += res.dueTests;
+    sum.differ      += res.differ;
+    sum.wrong       += res.wrong;
+  }
+  printf("%-20s %7u %8u %8u %8u %6u %6u\n", "all", sum.fixes, sum.marginTests,
+         sum.dueFixes, sum.dueTests, sum.differ, sum.wrong);
+  printf("Zone tests vs every fix: margin %.2f%%, scheduled %.2f%%;"
+         " fixes tracked when scheduled %.2f%%\n",
+         100.0 * sum.marginTests / sum.fixes, 100.0 * sum.dueTests / sum.fixes,
+         100.0 * sum.dueFixes / sum.fixes);
+  return ((0 == sum.differ) && (0 == sum.wrong)) ? EXIT_SUCCESS : EXIT_FAILURE;
+} // end function main
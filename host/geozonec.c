@@ -0,0 +1,972 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : geozonec.c
+ *
+ *  DESCRIPTION   : Host tool (geozone compiler) that reads zones in decimal
+ *    degrees from CSV files (e.g. geozones.csv, as "Geo-Mute Zone.xlsx" saves
+ *    it) or KML files (each Placemark's Polygon outer boundary), and writes
+ *    geozones.h to stdout:  the zone table GEOZONES[] and the bounding box of
+ *    each zone, GEOBOXES[], as GeofenceZoneBox() works it out.  A report of
+ *    each zone goes to stderr.
+ *
+ *    A polygon's edges each run the short way round, so a polygon may cross
+ *    the Anti-Meridian; as TestInsidePolygonZone() works in raw lons, such a
+ *    polygon is split at 180 into a zone east and a zone west of it.  Vertices
+ *    are rounded to geopt16_t, and then repeated and collinear vertices (those
+ *    adding no area) are dropped, so the winding test walks fewer edges.  Each
+ *    polygon is then checked against a winding test of its source vertices in
+ *    doubles at a lattice of points over its box:  results may only differ
+ *    within CHECK_TOL lsbs of the source border, i.e. by the rounding.
+ *
+ *    Point & radius zones (radius at most 181 miles, clear of the poles) and
+ *    LL-UR zones (which TestInsideLlUrZone() takes across 180 as they are) are
+ *    rounded to geopt16_t.
+ *
+ *    With option -32 each polygon is also written as a polyzone32_t (0.00001
+ *    degree lsbs) for TestInsidePolygonZone32(), likewise cleaned.
+ *
+ *    Run by "make -f host/Makefile geozones" from the repository root, which
+ *    then regenerates geozones_slab.h (host/geoslab.c) from the new GEOZONES[].
+ *
+ *    usage: geozonec [-32] file.csv|file.kml ...
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>               // for strcasecmp()
+#include "geofence.h"
+
+#define NAME_LEN      24          // longest zone name
+#define NOTE_LEN      27          // vertex note columns in geozones.h
+#define LINE_LEN      512
+#define FIELDS_MAX    8
+#define CHECK_STEP    13          // lattice spacing of polygon check, lsbs
+#define CHECK_TOL     (1.0)       // lsbs from source border results may differ
+#define LAT_LSB_DEG   (90.0  / 32767.0)
+#define LON_LSB_DEG   (180.0 / 32767.0)
+#define MILES_PER_DEG (69.1)      // as TestInsidePtRadiusZone()
+
+typedef struct tagSRC_PT
+{
+  double lat;                     // degrees
+  double lon;                     // degrees, unwrapped along a polygon
+  char   note[NOTE_LEN + 1];
+} srcpt_t;
+
+typedef struct tagSRC_ZONE
+{
+  char      name[NAME_LEN + 1];
+  char      where[LINE_LEN];      // file:line zone starts at
+  geocat_t  cat;
+  srcpt_t * v;
+  int       n;
+  double    radius;               // GC_PTRAD, miles
+} srczone_t;
+
+typedef struct tagQ_PT
+{
+  int32_t lat;                    // rounded to geopt16_t or geopt32_t lsbs
+  int32_t lon;
+  double  latDeg;                 // source, for comment
+  double  lonDeg;
+  char    note[NOTE_LEN + 1];
+} qpt_t;
+
+typedef struct tagOUT_ZONE
+{
+  char              name[NAME_LEN + 4];
+  const srczone_t * pSrc;
+  int               piece;        // 1 or 2 when split at 180, otherwise 0
+  geozone16_t       zone;
+  llurzone16_t      box;
+  ptradzone16_t     ptRad;
+  llurzone16_t      llUr;
+  polyzone16_t *    pPoly;
+  qpt_t *           q16;          // pPoly's vertices, w/notes
+  int               n16;
+  qpt_t *           q32;          // -32
+  int               n32;
+} outzone_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static srczone_t * srcs;
+static int         nSrcs;
+static outzone_t * outs;
+static int         nOuts;
+
+
+static int32_t Round(double v)
+{
+  return (int32_t)((0.0 > v) ? (v - 0.5) : (v + 0.5));
+} // end function Round
+
+
+static void CopyNote(char * dst, const char * src)
+{
+  snprintf(dst, NOTE_LEN + 1, "%s", src ? src : "");
+} // end routine CopyNote
+
+
+// Split a CSV line into fields in place, "quoted" fields may hold commas
+static int SplitCsv(char * line, char * fields[], int max)
+{
+  char * pIn  = line;
+  char * pOut;
+  int    n    = 0;
+  bool   isQuoted;
+
+  line[strcspn(line, "\r\n")] = '\0';
+  while (n < max)
+  {
+    while (' ' == *pIn) {
+      pIn++;            }
+    isQuoted    = ('"' == *pIn);
+    pIn        += isQuoted ? 1 : 0;
+    fields[n++] = pOut = pIn;
+    while (('\0' != *pIn) && (isQuoted || (',' != *pIn)))
+    {
+      if (isQuoted && ('"' == *pIn))
+      {
+        if ('"' != pIn[1])
+        {
+          isQuoted = false;
+          pIn++;
+          continue;
+        }
+        pIn++;                          // "" is a quote
+      }
+      *pOut++ = *pIn++;
+    }
+    while ((pOut > fields[n - 1]) && (' ' == pOut[-1])) {
+      pOut--;                                           }
+    if ('\0' == *pIn)
+    {
+      *pOut = '\0';
+      break;
+    }
+    *pOut = '\0';
+    pIn++;
+  }
+  return n;
+} // end function SplitCsv
+
+
+// Zone name as a C identifier, upper case
+static bool MakeName(char * dst, const char * src, const char * where)
+{
+  int i;
+
+  for (i = 0; ('\0' != src[i]) && (i < NAME_LEN); i++)  {
+    dst[i] = isalnum((unsigned char)src[i]) ? toupper((unsigned char)src[i])
+                                            : '_';       }
+  dst[i] = '\0';
+  if ((0 == i) || !isalpha((unsigned char)dst[0]))
+  {
+    fprintf(stderr, "geozonec: %s: zone name '%s' must start with a letter\n",
+            where, src);
+    return false;
+  }
+  return true;
+} // end function MakeName
+
+
+static srczone_t * NewSrc(const char * name, geocat_t cat, const char * where)
+{
+  srczone_t * pZ;
+
+  srcs = realloc(srcs, sizeof(srczone_t) * (nSrcs + 1));
+  pZ   = &srcs[nSrcs];
+  memset(pZ, 0, sizeof(*pZ));
+  if (!MakeName(pZ->name, name, where)) {
+    return NULL;                        }
+  snprintf(pZ->where, sizeof(pZ->where), "%s", where);
+  pZ->cat = cat;
+  nSrcs++;
+  return pZ;
+} // end function NewSrc
+
+
+static void AddPt(srczone_t * pZ, double lat, double lon, const char * note)
+{
+  pZ->v = realloc(pZ->v, sizeof(srcpt_t) * (pZ->n + 1));
+  pZ->v[pZ->n].lat = lat;
+  pZ->v[pZ->n].lon = lon;
+  CopyNote(pZ->v[pZ->n].note, note);
+  pZ->n++;
+} // end routine AddPt
+
+
+static bool ReadCsv(const char * path)
+{
+  static const char * KINDS[] = { "", "ptrad", "llur", "poly" };
+  FILE *      pFile = fopen(path, "r");
+  char        line[LINE_LEN];
+  char        where[LINE_LEN];
+  char *      fields[FIELDS_MAX];
+  char *      pEnd;
+  char        name[NAME_LEN + 1];
+  srczone_t * pZ = NULL;
+  geocat_t    cat;
+  double      lat;
+  double      lon;
+  int         lineNo = 0;
+  int         n;
+
+  if (NULL == pFile)
+  {
+    perror(path);
+    return false;
+  }
+  while (NULL != fgets(line, sizeof(line), pFile))
+  {
+    lineNo++;
+    snprintf(where, sizeof(where), "%s:%d", path, lineNo);
+    n = SplitCsv(line, fields, FIELDS_MAX);
+    if (('#' == fields[0][0]) || ((1 == n) && ('\0' == fields[0][0])) ||
+        (0 == strcmp(fields[0], "zone")))
+    {
+      continue;                         // comment, blank, or column headings
+    }
+    for (cat = GC_PTRAD; cat <= GC_POLY; cat++)
+    {
+      if ((n > 1) && (0 == strcmp(fields[1], KINDS[cat]))) {
+        break;                                             }
+    }
+    lat = NAN;
+    lon = NAN;
+    if (n > 3)
+    {
+      lat = strtod(fields[2], &pEnd);
+      lat = ((pEnd == fields[2]) || ('\0' != *pEnd)) ? NAN : lat;
+      lon = strtod(fields[3], &pEnd);
+      lon = ((pEnd == fields[3]) || ('\0' != *pEnd)) ? NAN : lon;
+    }
+    if ((cat > GC_POLY) || isnan(lat) || isnan(lon) ||
+        (fabs(lat) > 90.0) || (fabs(lon) > 180.0))
+    {
+      fprintf(stderr, "geozonec: %s: need zone,poly|llur|ptrad,lat,lon\n",
+              where);
+      fclose(pFile);
+      return false;
+    }
+    if (!MakeName(name, fields[0], where))
+    {
+      fclose(pFile);
+      return false;
+    }
+    if ((NULL == pZ) || (0 != strcmp(name, pZ->name)) || (cat != pZ->cat))
+    {
+      if (NULL == (pZ = NewSrc(fields[0], cat, where)))
+      {
+        fclose(pFile);
+        return false;
+      }
+      if (GC_PTRAD == cat) {
+        pZ->radius = (n > 4) ? strtod(fields[4], &pEnd) : 0.0; }
+    }
+    AddPt(pZ, lat, lon, (n > 5) ? fields[5] : "");
+  }
+  fclose(pFile);
+  return true;
+} // end function ReadCsv
+
+
+// Text between <tag> (or <tag ...>) and </tag> at or after *ppAt, up to pEnd
+static char * FindTag(const char * pAt, const char * pEnd, const char * tag,
+                      const char ** ppClose)
+{
+  char         open[32];
+  char         close[32];
+  const char * pOpen;
+
+  snprintf(open,  sizeof(open),  "<%s",  tag);
+  snprintf(close, sizeof(close), "</%s>", tag);
+  for (pOpen = strstr(pAt, open); (NULL != pOpen) && (pOpen < pEnd);
+       pOpen = strstr(pOpen + 1, open))
+  {
+    if (('>' == pOpen[strlen(open)]) || isspace((unsigned char)pOpen[strlen(open)]))
+    {
+      pOpen   = strchr(pOpen, '>') + 1;
+      *ppClose = strstr(pOpen, close);
+      return ((NULL != *ppClose) && (*ppClose <= pEnd)) ? (char *)pOpen : NULL;
+    }
+  }
+  return NULL;
+} // end function FindTag
+
+
+static bool ReadKml(const char * path)
+{
+  FILE *       pFile = fopen(path, "rb");
+  char *       text;
+  char         where[LINE_LEN];
+  char         name[NAME_LEN + 1];
+  const char * pAt;
+  const char * pMark;
+  const char * pMarkEnd;
+  const char * pPoly;
+  const char * pPolyEnd;
+  const char * pCoord;
+  const char * pCoordEnd;
+  const char * pName;
+  const char * pNameEnd;
+  char *       pNum;
+  srczone_t *  pZ;
+  double       lat;
+  double       lon;
+  long         size;
+  int          nMark = 0;
+
+  if (NULL == pFile)
+  {
+    perror(path);
+    return false;
+  }
+  fseek(pFile, 0, SEEK_END);
+  size = ftell(pFile);
+  rewind(pFile);
+  text = malloc(size + 1);
+  text[fread(text, 1, size, pFile)] = '\0';
+  fclose(pFile);
+  for (pAt = text;
+       NULL != (pMark = FindTag(pAt, text + size, "Placemark", &pMarkEnd));
+       pAt = pMarkEnd)
+  {
+    nMark++;
+    snprintf(where, sizeof(where), "%s: Placemark %d", path, nMark);
+    pName = FindTag(pMark, pMarkEnd, "name", &pNameEnd);
+    snprintf(name, sizeof(name), "KML%d", nMark);
+    if (NULL != pName) {
+      snprintf(name, sizeof(name), "%.*s", (int)(pNameEnd - pName), pName); }
+    if ((NULL == (pPoly = FindTag(pMark, pMarkEnd, "Polygon", &pPolyEnd))) ||
+        (NULL == (pCoord = FindTag(pPoly, pPolyEnd, "outerBoundaryIs",
+                                   &pCoordEnd))) ||
+        (NULL == (pCoord = FindTag(pCoord, pCoordEnd, "coordinates",
+                                   &pCoordEnd))))
+    {
+      fprintf(stderr, "geozonec: %s: no Polygon, skipped\n", where);
+      continue;
+    }
+    if (NULL == (pZ = NewSrc(name, GC_POLY, where)))
+    {
+      free(text);
+      return false;
+    }
+    while (pCoord < pCoordEnd)
+    { // lon,lat[,alt] tuples, white space between
+      lon = strtod(pCoord, &pNum);
+      if (pNum == pCoord) {
+        break;            }
+      if (',' != *pNum)   {
+        break;            }
+      lat = strtod(pNum + 1, &pNum);
+      if (',' == *pNum)   {
+        strtod(pNum + 1, &pNum); }
+      if ((fabs(lat) > 90.0) || (fabs(lon) > 180.0))
+      {
+        fprintf(stderr, "geozonec: %s: bad coordinates\n", where);
+        free(text);
+        return false;
+      }
+      AddPt(pZ, lat, lon, "");
+      pCoord = pNum;
+    }
+  }
+  free(text);
+  return true;
+} // end function ReadKml
+
+
+// Unwrap a polygon's lons so each edge runs the short way round; false if it
+// goes round a pole (lons don't come back to the first) or an edge is 180
+static bool UnwrapPoly(srczone_t * pZ)
+{
+  double d;
+  int    i;
+
+  if ((pZ->n > 3) && (pZ->v[0].lat == pZ->v[pZ->n - 1].lat) &&
+      (pZ->v[0].lon == pZ->v[pZ->n - 1].lon))
+  {
+    pZ->n--;                            // closing vertex, v[n] is implied
+  }
+  if (pZ->n < 3)
+  {
+    fprintf(stderr, "geozonec: %s: %s needs 3 or more vertices\n", pZ->where,
+            pZ->name);
+    return false;
+  }
+  for (i = 1; i <= pZ->n; i++)
+  {
+    d = pZ->v[i % pZ->n].lon - pZ->v[i - 1].lon;
+    if (180.0 == fabs(d))
+    {
+      fprintf(stderr, "geozonec: %s: %s edge %d spans 180 degrees of lon,"
+              " which way is ambiguous\n", pZ->where, pZ->name, i);
+      return false;
+    }
+    if (i == pZ->n)
+    { // Closing edge must come back to first lon without unwrapping
+      if (fabs(d) > 180.0)
+      {
+        fprintf(stderr, "geozonec: %s: %s goes round a pole\n", pZ->where,
+                pZ->name);
+        return false;
+      }
+    }
+    else if (d > 180.0)
+    {
+      pZ->v[i].lon -= 360.0;
+    }
+    else if (d < -180.0)
+    {
+      pZ->v[i].lon += 360.0;
+    }
+  }
+  return true;
+} // end function UnwrapPoly
+
+
+// Clip polygon to lon >= edge (isAbove) or lon <= edge, Sutherland-Hodgman
+static int ClipLon(const srcpt_t * pIn, int n, double edge, bool isAbove,
+                   srcpt_t * pOut)
+{
+  const srcpt_t * pPrev;
+  const srcpt_t * pCur;
+  bool            isPrevIn;
+  bool            isCurIn;
+  int             m = 0;
+  int             i;
+
+  for (i = 0; i < n; i++)
+  {
+    pPrev    = &pIn[(i + n - 1) % n];
+    pCur     = &pIn[i];
+    isPrevIn = isAbove ? (pPrev->lon >= edge) : (pPrev->lon <= edge);
+    isCurIn  = isAbove ? (pCur->lon  >= edge) : (pCur->lon  <= edge);
+    if (isCurIn != isPrevIn)
+    {
+      pOut[m].lon = edge;
+      pOut[m].lat = pPrev->lat + (edge - pPrev->lon) *
+                    (pCur->lat - pPrev->lat) / (pCur->lon - pPrev->lon);
+      CopyNote(pOut[m].note, "split at Anti-Meridian");
+      m++;
+    }
+    if (isCurIn) {
+      pOut[m++] = *pCur; }
+  }
+  return m;
+} // end function ClipLon
+
+
+// Drop repeated vertices and those in line with their neighbors, round the
+// closed polygon, until none are left; counts each kind dropped
+static int CleanPoly(qpt_t * q, int n, int * pDups, int * pInLine)
+{
+  const qpt_t * p;
+  const qpt_t * c;
+  const qpt_t * x;
+  bool          isDropped = true;
+  int           i;
+
+  while (isDropped && (n >= 3))
+  {
+    isDropped = false;
+    for (i = 0; (i < n) && !isDropped; i++)
+    {
+      p = &q[(i + n - 1) % n];
+      c = &q[i];
+      x = &q[(i + 1) % n];
+      if ((c->lat == p->lat) && (c->lon == p->lon))
+      {
+        (*pDups)++;
+        isDropped = true;
+      }
+      else if (((int64_t)(c->lat - p->lat) * (x->lon - c->lon)) ==
+               ((int64_t)(c->lon - p->lon) * (x->lat - c->lat)))
+      {
+        (*pInLine)++;
+        isDropped = true;
+      }
+      if (isDropped)
+      {
+        memmove(&q[i], &q[i + 1], sizeof(qpt_t) * (n - i - 1));
+        n--;
+      }
+    }
+  }
+  return n;
+} // end function CleanPoly
+
+
+static outzone_t * NewOut(const srczone_t * pSrc, int piece)
+{
+  outzone_t * pOut = &outs[nOuts++];
+
+  memset(pOut, 0, sizeof(*pOut));
+  pOut->pSrc  = pSrc;
+  pOut->piece = piece;
+  snprintf(pOut->name, sizeof(pOut->name), piece ? "%s_%d" : "%s", pSrc->name,
+           piece);
+  pOut->zone.cat = pSrc->cat;
+  return pOut;
+} // end function NewOut
+
+
+// Round a piece (lons within +/-180) to geopt16_t and geopt32_t and clean it
+static bool AddPolyPiece(const srczone_t * pSrc, const srcpt_t * pV, int n,
+                         int piece)
+{
+  outzone_t * pOut = NewOut(pSrc, piece);
+  int         dups = 0;
+  int         inLine = 0;
+  int         dups32 = 0;
+  int         inLine32 = 0;
+  int         i;
+
+  pOut->q16 = malloc(sizeof(qpt_t) * n);
+  pOut->q32 = malloc(sizeof(qpt_t) * n);
+  for (i = 0; i < n; i++)
+  {
+    pOut->q16[i].lat = Round(pV[i].lat / LAT_LSB_DEG);
+    pOut->q16[i].lon = Round(pV[i].lon / LON_LSB_DEG);
+    pOut->q32[i].lat = Round(pV[i].lat * GEOPT32_PER_DEG);
+    pOut->q32[i].lon = Round(pV[i].lon * GEOPT32_PER_DEG);
+    pOut->q16[i].latDeg = pOut->q32[i].latDeg = pV[i].lat;
+    pOut->q16[i].lonDeg = pOut->q32[i].lonDeg = pV[i].lon;
+    CopyNote(pOut->q16[i].note, pV[i].note);
+    CopyNote(pOut->q32[i].note, pV[i].note);
+  }
+  pOut->n32 = CleanPoly(pOut->q32, n, &dups32, &inLine32);
+  pOut->n16 = CleanPoly(pOut->q16, n, &dups, &inLine);
+  if (pOut->n16 < 3)
+  {
+    fprintf(stderr, "geozonec: %s: %s has no area once rounded\n",
+            pSrc->where, pOut->name);
+    return false;
+  }
+  pOut->pPoly    = malloc(sizeof(polyzone16_t) +
+                          sizeof(geopt16_t) * (pOut->n16 + 1));
+  pOut->pPoly->n = pOut->n16;
+  for (i = 0; i <= pOut->n16; i++)
+  {
+    pOut->pPoly->v[i].lat = pOut->q16[i % pOut->n16].lat;
+    pOut->pPoly->v[i].lon = pOut->q16[i % pOut->n16].lon;
+  }
+  pOut->zone.z.poly = pOut->pPoly;
+  GeofenceZoneBox(&pOut->zone, &pOut->box);
+  fprintf(stderr, "%-16s %4d vertices, %2d repeated & %3d in line dropped,"
+          " %4d left\n", pOut->name, n, dups, inLine, pOut->n16);
+  return true;
+} // end function AddPolyPiece
+
+
+// Split polygon into the parts west and east of 180 (at most 2, as no edge
+// spans 180 degrees of lon) and add each
+static bool AddPoly(const srczone_t * pSrc)
+{
+  srcpt_t * pA = malloc(sizeof(srcpt_t) * 2 * pSrc->n);
+  srcpt_t * pB = malloc(sizeof(srcpt_t) * 4 * pSrc->n);
+  double    lonLo = pSrc->v[0].lon;
+  double    lonHi = pSrc->v[0].lon;
+  bool      isOk = true;
+  int       pieces = 0;
+  int       piece = 0;
+  int       k;
+  int       m;
+  int       i;
+
+  for (i = 1; i < pSrc->n; i++)
+  {
+    lonLo = fmin(lonLo, pSrc->v[i].lon);
+    lonHi = fmax(lonHi, pSrc->v[i].lon);
+  }
+  for (k = (int)floor((lonLo + 180.0) / 360.0);
+       (k * 360.0 - 180.0) < lonHi; k++)
+  {
+    if (((k * 360.0 + 180.0) > lonLo) && ((k * 360.0 - 180.0) < lonHi)) {
+      pieces++;                                                        }
+  }
+  for (k = (int)floor((lonLo + 180.0) / 360.0);
+       isOk && ((k * 360.0 - 180.0) < lonHi); k++)
+  {
+    if (((k * 360.0 + 180.0) <= lonLo) || ((k * 360.0 - 180.0) >= lonHi)) {
+      continue;                                                          }
+    m = ClipLon(pSrc->v, pSrc->n, k * 360.0 - 180.0, true, pA);
+    m = ClipLon(pA, m, k * 360.0 + 180.0, false, pB);
+    for (i = 0; i < m; i++)
+    {
+      pB[i].lon = fmax(-180.0, fmin(180.0, pB[i].lon - k * 360.0));
+    }
+    if (m >= 3) {
+      isOk = AddPolyPiece(pSrc, pB, m, (pieces > 1) ? ++piece : 0); }
+  }
+  free(pA);
+  free(pB);
+  return isOk;
+} // end function AddPoly
+
+
+static bool AddPtRad(const srczone_t * pSrc)
+{
+  outzone_t * pOut = NewOut(pSrc, 0);
+
+  if ((1 != pSrc->n) || !(pSrc->radius > 0.0) || (pSrc->radius > 181.0) ||
+      ((fabs(pSrc->v[0].lat) + pSrc->radius / MILES_PER_DEG) >= 90.0))
+  {
+    fprintf(stderr, "geozonec: %s: %s needs 1 row, radius_mi 0 thru 181, and"
+            " to be clear of the poles\n", pSrc->where, pSrc->name);
+    return false;
+  }
+  pOut->ptRad.pt.lat = Round(pSrc->v[0].lat / LAT_LSB_DEG);
+  pOut->ptRad.pt.lon = Round(pSrc->v[0].lon / LON_LSB_DEG);
+  pOut->ptRad.r2     = Round(pSrc->radius * pSrc->radius);
+  pOut->zone.z.ptRad = &pOut->ptRad;
+  GeofenceZoneBox(&pOut->zone, &pOut->box);
+  fprintf(stderr, "%-16s point & radius %.1f miles\n", pOut->name,
+          pSrc->radius);
+  return true;
+} // end function AddPtRad
+
+
+static bool AddLlUr(const srczone_t * pSrc)
+{
+  outzone_t * pOut = NewOut(pSrc, 0);
+
+  if ((2 != pSrc->n) || (pSrc->v[0].lat >= pSrc->v[1].lat))
+  {
+    fprintf(stderr, "geozonec: %s: %s needs 2 rows, LL then UR (north of LL)\n",
+            pSrc->where, pSrc->name);
+    return false;
+  }
+  pOut->llUr.ll.lat = Round(pSrc->v[0].lat / LAT_LSB_DEG);
+  pOut->llUr.ll.lon = Round(pSrc->v[0].lon / LON_LSB_DEG);
+  pOut->llUr.ur.lat = Round(pSrc->v[1].lat / LAT_LSB_DEG);
+  pOut->llUr.ur.lon = Round(pSrc->v[1].lon / LON_LSB_DEG);
+  pOut->zone.z.llUr = &pOut->llUr;
+  GeofenceZoneBox(&pOut->zone, &pOut->box);
+  fprintf(stderr, "%-16s LL-UR%s\n", pOut->name,
+          (pOut->llUr.ur.lon < pOut->llUr.ll.lon) ? ", crosses 180" : "");
+  return true;
+} // end function AddLlUr
+
+
+// Winding number of source polygon (unwrapped lons) at lat, lon degrees
+static int SourceWinding(const srczone_t * pSrc, double lat, double lon)
+{
+  const srcpt_t * a;
+  const srcpt_t * b;
+  double          isLeft;
+  int             wn = 0;
+  int             i;
+
+  for (i = 0; i < pSrc->n; i++)
+  {
+    a      = &pSrc->v[i];
+    b      = &pSrc->v[(i + 1) % pSrc->n];
+    isLeft = (b->lat - a->lat) * (lon - a->lon) - (lat - a->lat) * (b->lon - a->lon);
+    if (a->lon <= lon)
+    {
+      if ((b->lon > lon) && (isLeft > 0.0)) {
+        ++wn;                               }
+    }
+    else if ((b->lon <= lon) && (isLeft < 0.0))
+    {
+      --wn;
+    }
+  }
+  return wn;
+} // end function SourceWinding
+
+
+// Least distance, lsbs, from lat, lon degrees to source polygon's border
+static double SourceDistance(const srczone_t * pSrc, double lat, double lon)
+{
+  const srcpt_t * a;
+  const srcpt_t * b;
+  double          best = INFINITY;
+  double          eLat, eLon, pLat, pLon, t;
+  int             s;
+  int             i;
+
+  for (s = -1; s <= 1; s++)
+  {
+    for (i = 0; i < pSrc->n; i++)
+    {
+      a    = &pSrc->v[i];
+      b    = &pSrc->v[(i + 1) % pSrc->n];
+      eLat = (b->lat - a->lat) / LAT_LSB_DEG;
+      eLon = (b->lon - a->lon) / LON_LSB_DEG;
+      pLat = (lat - a->lat) / LAT_LSB_DEG;
+      pLon = (lon + s * 360.0 - a->lon) / LON_LSB_DEG;
+      t    = ((eLat * pLat) + (eLon * pLon)) /
+             fmax((eLat * eLat) + (eLon * eLon), 1e-12);
+      t    = fmax(0.0, fmin(1.0, t));
+      best = fmin(best, hypot(pLat - t * eLat, pLon - t * eLon));
+    }
+  }
+  return best;
+} // end function SourceDistance
+
+
+// Check the pieces of a polygon together give the source's result, except
+// within CHECK_TOL lsbs of its border, at a lattice over each piece's box
+static bool CheckPoly(const srczone_t * pSrc, int first, int last)
+{
+  geopt16_t p;
+  uint32_t  nPts = 0;
+  uint32_t  nNear = 0;
+  int32_t   lat;
+  int32_t   lon;
+  bool      isIn;
+  bool      isSrcIn;
+  int       i;
+  int       j;
+
+  for (i = first; i <= last; i++)
+  {
+    for (lat = outs[i].box.ll.lat - 1; lat <= (outs[i].box.ur.lat + 1);
+         lat += CHECK_STEP)
+    {
+      for (lon = outs[i].box.ll.lon - 1; lon <= (outs[i].box.ur.lon + 1);
+           lon += CHECK_STEP)
+      {
+        if ((lat < -32767) || (lat > 32767) || (lon < -32767) || (lon > 32767)) {
+          continue;                                                            }
+        p.lat = lat;
+        p.lon = lon;
+        isIn  = false;
+        for (j = first; (j <= last) && !isIn; j++) {
+          isIn = (0 != TestInsidePolygonZone(p, outs[j].pPoly)); }
+        isSrcIn = (0 != SourceWinding(pSrc, lat * LAT_LSB_DEG, lon * LON_LSB_DEG)) ||
+                  (0 != SourceWinding(pSrc, lat * LAT_LSB_DEG,
+                                      lon * LON_LSB_DEG - 360.0)) ||
+                  (0 != SourceWinding(pSrc, lat * LAT_LSB_DEG,
+                                      lon * LON_LSB_DEG + 360.0));
+        nPts++;
+        if (isIn == isSrcIn)  {
+          continue;           }
+        if (SourceDistance(pSrc, lat * LAT_LSB_DEG, lon * LON_LSB_DEG) >
+            CHECK_TOL)
+        {
+          fprintf(stderr, "geozonec: %s: %s %s at %d,%d (%.4f, %.4f) but"
+                  " source %s\n", pSrc->where, pSrc->name,
+                  isIn ? "inside" : "outside", p.lat, p.lon, lat * LAT_LSB_DEG,
+                  lon * LON_LSB_DEG, isSrcIn ? "inside" : "outside");
+          return false;
+        }
+        nNear++;
+      }
+    }
+  }
+  fprintf(stderr, "%-16s checked at %u points, %u differ within %.1f lsb of"
+          " border\n", pSrc->name, nPts, nNear, CHECK_TOL);
+  return true;
+} // end function CheckPoly
+
+
+static void PrintGeo16(const qpt_t * q, bool isLast, const char * note)
+{
+  char head[32];
+
+  snprintf(head, sizeof(head), "  {0x%04X, 0x%04X}%s", (uint16_t)q->lat,
+           (uint16_t)q->lon, isLast ? "" : ",");
+  printf("%-24s/* %8.4f, %9.4f %-*.*s*/  \\\n", head, q->latDeg, q->lonDeg,
+         NOTE_LEN, NOTE_LEN, note);
+} // end routine PrintGeo16
+
+
+static void PrintPoly(const outzone_t * pOut, bool isWith32)
+{
+  const char * note;
+  int          i;
+
+  printf("\n// %s", pOut->pSrc->name);
+  if (0 != pOut->piece) {
+    printf(", part %s of 180", (1 == pOut->piece) ? "west" : "east"); }
+  printf(" (%s)\n", pOut->pSrc->where);
+  printf("#define %s_NUM_PTS %d  // # of points that make zone (but v[] has"
+         " n+1 points)\n", pOut->name, pOut->n16);
+  printf("#define %s_VERTICES%*s\\\n", pOut->name,
+         (int)(78 - strlen(pOut->name) - 17), "");
+  printf("{                       /* LAT LSB = 0.002746666, LON LSB ="
+         " 0.005493332   */  \\\n");
+  for (i = 0; i <= pOut->n16; i++)
+  {
+    PrintGeo16(&pOut->q16[i % pOut->n16], i == pOut->n16,
+               (i == pOut->n16) ? "Back to first point" : pOut->q16[i].note);
+  }
+  printf("}                       /* Note that first & last points must be the"
+         " same */\n");
+  printf("static const polyzone16_t %s_POLYZONE16 = {.n = %s_NUM_PTS, .v = "
+         "%s_VERTICES};\n", pOut->name, pOut->name, pOut->name);
+  if (!isWith32)  {
+    return;       }
+  printf("static const polyzone32_t %s_POLYZONE32 = {.n = %d, .v =\n{\n",
+         pOut->name, pOut->n32);
+  for (i = 0; i <= pOut->n32; i++)
+  {
+    note = (i < pOut->n32) ? pOut->q32[i].note : "Back to first point";
+    printf("  { %9ld, %10ld }%s%s%s%s\n", (long)pOut->q32[i % pOut->n32].lat,
+           (long)pOut->q32[i % pOut->n32].lon, (i < pOut->n32) ? "," : " ",
+           ('\0' != note[0]) ? "  /* " : "", note,
+           ('\0' != note[0]) ? " */" : "");
+  }
+  printf("}};\n");
+} // end routine PrintPoly
+
+
+static void PrintHeader(int argc, char * argv[], bool isWith32)
+{
+  int i;
+
+  printf("#ifndef GEOZONES_H__\n#define GEOZONES_H__\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"//        Property of United States of America - For Official Use Only        //\n"
+"////////////////////////////////////////////////////////////////////////////////\n"
+"/*\n"
+" *  FILE NAME     : geozones.h\n"
+" *\n"
+" *  DESCRIPTION   : Define the geozones D.GLL fixes are checked against for\n"
+" *    geo-muting, as table GEOZONES[] of point-radius, LL-UR, and polygon zones\n"
+" *    (geozone16_t in geofence.h), and the bounding box of each, GEOBOXES[].\n"
+" *    Included by geofence.c only.  GeofenceEvaluate() tries zones in order.\n"
+" *\n"
+" *    GENERATED by host/geozonec.c from");
+  for (i = 1; i < argc; i++)
+  {
+    if ('-' != argv[i][0]) {
+      printf(" %s", argv[i]); }
+  }
+  printf("%s, do not edit; change\n"
+" *    that and run \"make -f host/Makefile geozones\", which also regenerates\n"
+" *    geozones_slab.h.  Polygons crossing the Anti-Meridian are split at 180,\n"
+" *    repeated and collinear vertices dropped.\n"
+" *\n"
+" *  NOTE: geopt16_t scaling as CoordsToGeopt16(), i.e.\n"
+" *  int16_t lat: 2's complement decimal degrees scaled so lsb =  90/32767 degree\n"
+" *  int16_t lon: 2's complement decimal degrees scaled so lsb = 180/32767 degree\n"
+" */\n"
+"#include \"geofence.h\"\n", isWith32 ? " (with -32)" : "");
+} // end routine PrintHeader
+
+
+int main(int argc, char * argv[])
+{
+  static const char * CATS[] = { "GC_UNUSED", "GC_PTRAD", "GC_LLUR", "GC_POLY" };
+  static const char * MEMBERS[] = { "", "ptRad", "llUr", "poly" };
+  outzone_t *         pOut;
+  bool                isWith32 = false;
+  bool                isOk = true;
+  int                 first;
+  int                 i;
+  int                 j;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (0 == strcmp(argv[i], "-32"))
+    {
+      isWith32 = true;
+      continue;
+    }
+    j = strlen(argv[i]);
+    if ((j > 4) && (0 == strcasecmp(argv[i] + j - 4, ".kml")))
+    {
+      if (!ReadKml(argv[i]))  {
+        return EXIT_FAILURE;  }
+    }
+    else if (!ReadCsv(argv[i]))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  if (0 == nSrcs)
+  {
+    fprintf(stderr, "usage: geozonec [-32] file.csv|file.kml ...\n");
+    return EXIT_FAILURE;
+  }
+  outs = malloc(sizeof(outzone_t) * 2 * nSrcs);
+  for (i = 0; isOk && (i < nSrcs); i++)
+  {
+    first = nOuts;
+    switch (srcs[i].cat)
+    {
+      case GC_PTRAD:
+        isOk = AddPtRad(&srcs[i]);
+        break;
+      case GC_LLUR:
+        isOk = AddLlUr(&srcs[i]);
+        break;
+      default:
+        isOk = UnwrapPoly(&srcs[i]) && AddPoly(&srcs[i]) &&
+               CheckPoly(&srcs[i], first, nOuts - 1);
+        break;
+    }
+  }
+  if (!isOk)  {
+    return EXIT_FAILURE;  }
+
+  PrintHeader(argc, argv, isWith32);
+  for (i = 0; i < nOuts; i++)
+  {
+    pOut = &outs[i];
+    switch (pOut->zone.cat)
+    {
+      case GC_PTRAD:
+        printf("\n// %s (%s)\nstatic const ptradzone16_t %s_PTRAD16 =\n",
+               pOut->pSrc->name, pOut->pSrc->where, pOut->name);
+        printf("  { {0x%04X, 0x%04X}, %5d };  /* %8.4f, %9.4f, r %.1f mi */\n",
+               (uint16_t)pOut->ptRad.pt.lat, (uint16_t)pOut->ptRad.pt.lon,
+               pOut->ptRad.r2, pOut->pSrc->v[0].lat, pOut->pSrc->v[0].lon,
+               pOut->pSrc->radius);
+        break;
+      case GC_LLUR:
+        printf("\n// %s (%s)\nstatic const llurzone16_t %s_LLUR16 =\n{\n",
+               pOut->pSrc->name, pOut->pSrc->where, pOut->name);
+        printf("  .ll = {0x%04X,0x%04X},/* %8.4f, %9.4f Lower Left  */\n",
+               (uint16_t)pOut->llUr.ll.lat, (uint16_t)pOut->llUr.ll.lon,
+               pOut->pSrc->v[0].lat, pOut->pSrc->v[0].lon);
+        printf("  .ur = {0x%04X,0x%04X} /* %8.4f, %9.4f Upper Right */\n};\n",
+               (uint16_t)pOut->llUr.ur.lat, (uint16_t)pOut->llUr.ur.lon,
+               pOut->pSrc->v[1].lat, pOut->pSrc->v[1].lon);
+        break;
+      default:
+        PrintPoly(pOut, isWith32);
+        break;
+    }
+  }
+  printf("\n// Geozones, tested in this order\n");
+  printf("static const geozone16_t GEOZONES[] =\n{\n");
+  for (i = 0; i < nOuts; i++)
+  {
+    printf("  { %s,%*s{ .%-5s = &%s_%s } }%s\n", CATS[outs[i].zone.cat],
+           (int)(10 - strlen(CATS[outs[i].zone.cat])), "",
+           MEMBERS[outs[i].zone.cat], outs[i].name,
+           (GC_PTRAD == outs[i].zone.cat) ? "PTRAD16" :
+           (GC_LLUR  == outs[i].zone.cat) ? "LLUR16" : "POLYZONE16",
+           ((i + 1) < nOuts) ? "," : "");
+  }
+  printf("};\n#define GEOZONE_CNT (sizeof(GEOZONES) / sizeof(GEOZONES[0]))\n");
+  printf("\n// Bounding box of each zone of GEOZONES[], as GeofenceZoneBox()\n");
+  printf("static const llurzone16_t GEOBOXES[GEOZONE_CNT] =\n{\n");
+  for (i = 0; i < nOuts; i++)
+  {
+    printf("  { {0x%04X,0x%04X}, {0x%04X,0x%04X} }%s  /* %s */\n",
+           (uint16_t)outs[i].box.ll.lat, (uint16_t)outs[i].box.ll.lon,
+           (uint16_t)outs[i].box.ur.lat, (uint16_t)outs[i].box.ur.lon,
+           ((i + 1) < nOuts) ? "," : " ", outs[i].name);
+  }
+  printf("};\n\n\n#endif  // GEOZONES_H__\n");
+  return EXIT_SUCCESS;
+} // end function main
@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : i2c2_sim.c
+ *
+ *  DESCRIPTION   : Define simulated polled I2C2 master driver (i2c2.h) for the
+ *    host build, with a byte-level model of the two devices on the bus so the
+ *    unmodified mc24aa512_i2c2.c and ltc2943.c drivers run against it:
+ *      - 24AA512 64KB EEPROM (0xA0/0xA1): 2-byte address pointer, writes wrap
+ *        within a 128-byte page, reads wrap at end of memory, and the device
+ *        NACKs its address for 5 ms after a write (write cycle time).
+ *      - LTC2943 gas gauge (0xC8/0xC9): 24 registers with auto-increment.
+ *    As with any I2C slave, the address ACK is reported in I2C2STAT.ACKSTAT.
+ *
+ *    EEPROM content starts erased (0xFF) unless environment ESD_SIM_EEPROM
+ *    names an image file, which is then loaded at first use and saved back
+ *    when the simulation ends, to carry NVMEM across runs.
+ *
+ *    (1) void  ResetBusI2c2()
+ *    (2) bool  WaitForIdleI2c2()
+ *    (3) bool  WaitForMirqI2c2()
+ *    (4) bool  SendStartI2c2()
+ *    (5) bool  SendRestartI2c2()
+ *    (6) bool  ReadI2c2(uint8_t * value)
+ *    (7) bool  WriteI2c2(uint8_t value)
+ *    (8) bool  SendNackI2c2()
+ *    (9) bool  SendAckI2c2()
+ *   (10) bool  SendStopI2c2()
+ *   (11) void  HostI2c2Summary(void)
+ *   (12) void  HostI2c2SaveEeprom(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ *
+ *  REFERENCE DOCUMENTS
+ *    1.  24AA512/24LC512/24FC512 Data Sheet (Microchip DS20001754)
+ *    2.  LTC2943 Data Sheet (Linear Technology)
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "i2c2.h"
+#include "mc24aa512.h"            // for EEPROM_BYTES, EEPROM_PAGE_SIZE
+#include "micro_defs.h"           // for device I2C addresses
+#include "sim.h"
+
+#define EEP_WRT_CYCLE_US  5000    // 24AA512 max write cycle time
+#define LTC_REG_CNT       0x18    // LTC2943 registers 0x00 - 0x17
+
+typedef enum tagI2C_DEVICE
+{
+  ID_NONE,
+  ID_EEPROM,
+  ID_GASGA,
+} i2cdev_t;
+
+typedef enum tagI2C_PHASE
+{
+  IP_IDLE,                        // no START yet
+  IP_ADRS,                        // next write byte is slave address
+  IP_PTR_HI,                      // next write byte is pointer (high byte)
+  IP_PTR_LO,                      // next write byte is pointer (low byte)
+  IP_DATA,                        // write data or read data
+} i2cphs_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static uint8_t  eeprom[EEPROM_BYTES];
+static bool     isEepLoaded   = false;
+static uint16_t eepPtr        = 0;
+static uint64_t eepBusyUntil  = 0;
+static bool     eepWrote      = false;  // data written this transaction
+static uint8_t  ltcReg[LTC_REG_CNT] =
+{ // power-on defaults, plus ~3.6 V battery voltage and ~25 C temperature
+  0x01, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x5E, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x80, 0x00, 0xFF, 0x00,
+};
+static uint8_t  ltcPtr        = 0;
+static i2cdev_t dev           = ID_NONE;
+static bool     isRead        = false;
+static i2cphs_t phase         = IP_IDLE;
+static uint32_t ctXfers       = 0;      // START conditions
+static uint32_t ctEepWrites   = 0;      // completed EEPROM write cycles
+
+
+static void LoadEeprom(void)
+{
+  const char * path = getenv("ESD_SIM_EEPROM");
+  FILE * f;
+
+  isEepLoaded = true;
+  memset(eeprom, 0xFF, sizeof(eeprom));
+  if ((NULL != path) && (NULL != (f = fopen(path, "rb"))))
+  {
+    if (fread(eeprom, 1, sizeof(eeprom), f) != sizeof(eeprom))  {
+      memset(eeprom, 0xFF, sizeof(eeprom));                     }
+    fclose(f);
+  }
+} // end routine LoadEeprom
+
+
+void ResetBusI2c2()
+{
+  phase = IP_IDLE;
+  dev   = ID_NONE;
+} // end routine ResetBusI2c2
+
+
+bool WaitForIdleI2c2()
+{
+  return true;
+} // end function WaitForIdleI2c2
+
+
+bool WaitForMirqI2c2()
+{
+  IFS3bits.MI2C2IF = 0;
+  return I2C2CONLbits.I2CEN ? true : false;
+} // end function WaitForMirqI2c2
+
+
+bool SendStartI2c2()
+{
+  if (!isEepLoaded)         {
+    LoadEeprom();           }
+  ctXfers++;
+  phase     = IP_ADRS;
+  dev       = ID_NONE;
+  eepWrote  = false;
+  return WaitForMirqI2c2();
+} // end function SendStartI2c2
+
+
+bool SendRestartI2c2()
+{
+  phase = IP_ADRS;
+  return WaitForMirqI2c2();
+} // end function SendRestartI2c2
+
+
+bool ReadI2c2(uint8_t * value)
+{
+  uint8_t data = 0xFF;            // undriven bus reads as ones
+
+  if ((IP_DATA == phase) && isRead)
+  {
+    if (ID_EEPROM == dev)
+    {
+      data = eeprom[eepPtr++];    // uint16_t pointer wraps at 64KB
+    }
+    else if (ID_GASGA == dev)
+    {
+      data = ltcReg[ltcPtr];
+      ltcPtr = (ltcPtr + 1) % LTC_REG_CNT;
+    }
+  }
+  I2C2RCV = data;
+  *value  = data;
+  return WaitForMirqI2c2();
+} // end function ReadI2c2
+
+
+bool WriteI2c2(uint8_t value)
+{
+  bool isAck = false;
+
+  I2C2TRN = value;
+  switch (phase)
+  {
+    case IP_ADRS:
+      isRead = (value & 0x01) ? true : false;
+      dev    = ID_NONE;
+      if ((MC24AA512_WRT_ADRS == (value & 0xFE)) &&
+          (HostSimNowUs() >= eepBusyUntil))
+      {                           // EEPROM ignores its address while busy
+        dev = ID_EEPROM;
+      }
+      else if (LTC2943_I2C_WRT_ADDR == (value & 0xFE))
+      {
+        dev = ID_GASGA;
+      }
+      isAck = (ID_NONE != dev);
+      phase = (!isAck) ? IP_IDLE : (isRead ? IP_DATA : IP_PTR_HI);
+      break;
+
+    case IP_PTR_HI:
+      if (ID_EEPROM == dev)
+      {
+        eepPtr  = (uint16_t)(value << 8);
+        phase   = IP_PTR_LO;
+      }
+      else
+      {
+        ltcPtr  = value % LTC_REG_CNT;
+        phase   = IP_DATA;
+      }
+      isAck = true;
+      break;
+
+    case IP_PTR_LO:
+      eepPtr |= value;
+      phase   = IP_DATA;
+      isAck   = true;
+      break;
+
+    case IP_DATA:
+      if (isRead)                 {
+        break;                    }
+      if (ID_EEPROM == dev)
+      {                           // page write wraps within 128-byte page
+        eeprom[eepPtr] = value;
+        eepPtr = (eepPtr & ~(EEPROM_PAGE_SIZE - 1)) |
+                 ((eepPtr + 1) & (EEPROM_PAGE_SIZE - 1));
+        eepWrote = true;
+      }
+      else if (ID_GASGA == dev)
+      {
+        ltcReg[ltcPtr] = value;
+        ltcPtr = (ltcPtr + 1) % LTC_REG_CNT;
+      }
+      isAck = true;
+      break;
+
+    case IP_IDLE:
+    default:
+      break;
+  }
+
+  I2C2STATbits.ACKSTAT = isAck ? 0 : 1;
+  return WaitForMirqI2c2();
+} // end function WriteI2c2
+
+
+bool SendNackI2c2()
+{
+  return WaitForMirqI2c2();
+} // end function SendNackI2c2
+
+
+bool SendAckI2c2()
+{
+  return WaitForMirqI2c2();
+} // end function SendAckI2c2
+
+
+bool SendStopI2c2()
+{
+  if ((ID_EEPROM == dev) && eepWrote)
+  {                               // STOP starts the EEPROM write cycle
+    eepBusyUntil = HostSimNowUs() + EEP_WRT_CYCLE_US;
+    ctEepWrites++;
+  }
+  phase = IP_IDLE;
+  dev   = ID_NONE;
+  return WaitForMirqI2c2();
+} // end function SendStopI2c2
+
+
+void HostI2c2Summary(void)
+{
+  printf("I2C2            : %u transfers, %u EEPROM write cycles\n",
+         ctXfers, ctEepWrites);
+} // end routine HostI2c2Summary
+
+
+void HostI2c2SaveEeprom(void)
+{
+  const char * path = getenv("ESD_SIM_EEPROM");
+  FILE * f;
+
+  if (isEepLoaded && (NULL != path) && (NULL != (f = fopen(path, "wb"))))
+  {
+    fwrite(eeprom, 1, sizeof(eeprom), f);
+    fclose(f);
+  }
+} // end routine HostI2c2SaveEeprom
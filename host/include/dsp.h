@@ -0,0 +1,20 @@
+#ifndef HOST_DSP_H__
+#define HOST_DSP_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : dsp.h  (host build stand-in for the XC16 DSP header)
+ *
+ *  DESCRIPTION   : The ESD uses <dsp.h> only for its definition of PI.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+
+#define PI  3.1415926535897932384626433832795
+
+
+#endif  // HOST_DSP_H__
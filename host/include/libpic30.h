@@ -0,0 +1,33 @@
+#ifndef HOST_LIBPIC30_H__
+#define HOST_LIBPIC30_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : libpic30.h  (host build stand-in for the XC16 header)
+ *
+ *  DESCRIPTION   : Busy-wait delays become advances of the simulated clock so
+ *    that a __delay_ms(3000) costs no wall-clock time yet still lets timers,
+ *    keypad presses, and Lightning reports scheduled during it take effect.
+ *
+ *      (1) __delay_ms(d)
+ *      (2) __delay_us(d)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <stdint.h>
+
+#ifndef FCY
+  #error FCY must be defined before including libpic30.h
+#endif
+
+void HostSimDelayUs(uint64_t us);   // provided by host/sim.c
+
+#define __delay_ms(d)   HostSimDelayUs((uint64_t)(d) * 1000ULL)
+#define __delay_us(d)   HostSimDelayUs((uint64_t)(d))
+
+
+#endif  // HOST_LIBPIC30_H__
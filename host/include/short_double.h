@@ -0,0 +1,50 @@
+#ifndef HOST_SHORT_DOUBLE_H__
+#define HOST_SHORT_DOUBLE_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : short_double.h  (host build stand-in for XC16 double)
+ *
+ *  DESCRIPTION   : XC16 double is 32 bits (as float) unless -fno-short-double.
+ *    Force-included (gcc -include, with -fsingle-precision-constant) ahead of
+ *    a module so its double math is done in float as on the PIC24.  The C
+ *    library headers are included first so their double interfaces stay.
+ *    Don't use long double or pass double between modules built with and
+ *    without this header.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define double  float
+#undef  DBL_MIN
+#define DBL_MIN FLT_MIN
+#undef  DBL_MAX
+#define DBL_MAX FLT_MAX
+#define sin     sinf
+#define cos     cosf
+#define tan     tanf
+#define atan    atanf
+#define atan2   atan2f
+#define sqrt    sqrtf
+#define pow     powf
+#define floor   floorf
+#define fabs    fabsf
+#define log     logf
+#define exp     expf
+#define atanh   atanhf
+#define sinh    sinhf
+#define cosh    coshf
+#define strtod  strtof
+
+
+#endif  // HOST_SHORT_DOUBLE_H__
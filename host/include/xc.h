@@ -0,0 +1,253 @@
+#ifndef HOST_XC_H__
+#define HOST_XC_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : xc.h  (host build stand-in for the XC16 device header)
+ *
+ *  DESCRIPTION   : Lets the ESD application modules compile with a Linux gcc
+ *    by giving them the PIC24FJ128GA202 special function registers (SFR) they
+ *    touch as ordinary RAM.  Writing a control register on the host is simply
+ *    remembered, which is all the application logic needs; the data paths of
+ *    the peripherals (UART1, SPI1, I2C2, CRC, Timer2/3, keypad) are instead
+ *    provided by the simulated drivers in host/..._sim.c that implement the same
+ *    driver headers the target drivers do.
+ *
+ *    Only the registers and bit fields used by the modules compiled into the
+ *    host build are declared.  Each bit field overlays its SFR word just as it
+ *    does on target, so e.g. LATA = 0 also clears LATAbits.LATA0.
+ *
+ *      (1) Nop(), ClrWdt(), Sleep(), Idle(), Reset()
+ *      (2) __builtin_write_OSCCONL(), __builtin_disi()
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ *
+ *  REFERENCE DOCUMENTS
+ *    1.  PIC24FJ128GA202 Data Sheet (Microchip Technology Inc. DS30010038C)
+ */
+#include <stdint.h>
+
+
+//----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
+// host/sfr.c defines HOST_SFR_STORAGE to allocate the registers declared below
+#ifdef HOST_SFR_STORAGE
+  #define HOST_SFR(name)          volatile uint16_t name
+#else
+  #define HOST_SFR(name)   extern volatile uint16_t name
+#endif
+#define HOST_SFR_BITS(name, type) (*(volatile type *)&(name))
+
+
+//----- CPU & SYSTEM -----------------------------------------------------------
+typedef union
+{
+  struct { uint16_t C:1, Z:1, OV:1, N:1, RA:1, IPL:3, DC:1, :7; };
+  struct { uint16_t :5, IPL0:1, IPL1:1, IPL2:1, :8; };
+} SRBITS;
+HOST_SFR(SR);
+#define SRbits        HOST_SFR_BITS(SR, SRBITS)
+
+typedef struct { uint16_t :15, NSTDIS:1; } INTCON1BITS;
+HOST_SFR(INTCON1);
+#define INTCON1bits   HOST_SFR_BITS(INTCON1, INTCON1BITS)
+
+typedef struct
+{
+  uint16_t POR:1, BOR:1, IDLE:1, SLEEP:1, WDTO:1, SWDTEN:1, SWR:1, EXTR:1;
+  uint16_t VREGS:1, CM:1, :1, RETEN:1, :2, IOPUWR:1, TRAPR:1;
+} RCONBITS;
+HOST_SFR(RCON);
+#define RCONbits      HOST_SFR_BITS(RCON, RCONBITS)
+
+typedef struct
+{
+  uint16_t OSWEN:1, SOSCEN:1, POSCEN:1, CF:1, :1, LOCK:1, IOLOCK:1, CLKLOCK:1;
+  uint16_t NOSC:3, :1, COSC:3, :1;
+} OSCCONBITS;
+HOST_SFR(OSCCON);
+#define OSCCONbits    HOST_SFR_BITS(OSCCON, OSCCONBITS)
+
+HOST_SFR(DISICNT);
+
+//----- PERIPHERAL MODULE DISABLE ----------------------------------------------
+typedef struct
+{
+  uint16_t ADC1MD:1, :2, SPI1MD:1, SPI2MD:1, U1MD:1, U2MD:1, I2C1MD:1;
+  uint16_t :3, T1MD:1, T2MD:1, T3MD:1, T4MD:1, T5MD:1;
+} PMD1BITS;
+typedef struct { uint16_t OC1MD:1, OC2MD:1, OC3MD:1, :5, IC1MD:1, :7; } PMD2BITS;
+typedef struct
+{
+  uint16_t :1, I2C2MD:1, :5, CRCMD:1, :1, RTCCMD:1, :6;
+} PMD3BITS;
+HOST_SFR(PMD1);   HOST_SFR(PMD2);   HOST_SFR(PMD3);   HOST_SFR(PMD4);
+HOST_SFR(PMD5);   HOST_SFR(PMD6);   HOST_SFR(PMD7);   HOST_SFR(PMD8);
+#define PMD1bits      HOST_SFR_BITS(PMD1, PMD1BITS)
+#define PMD2bits      HOST_SFR_BITS(PMD2, PMD2BITS)
+#define PMD3bits      HOST_SFR_BITS(PMD3, PMD3BITS)
+
+//----- INTERRUPT CONTROLLER ---------------------------------------------------
+typedef struct
+{
+  uint16_t INT0IE:1, IC1IE:1, OC1IE:1, T1IE:1, :1, IC2IE:1, OC2IE:1, T2IE:1;
+  uint16_t T3IE:1, SPI1IE:1, SPF1IE:1, U1RXIE:1, U1TXIE:1, AD1IE:1, :2;
+} IEC0BITS;
+typedef struct
+{
+  uint16_t INT0IF:1, IC1IF:1, OC1IF:1, T1IF:1, :1, IC2IF:1, OC2IF:1, T2IF:1;
+  uint16_t T3IF:1, SPI1IF:1, SPF1IF:1, U1RXIF:1, U1TXIF:1, AD1IF:1, :2;
+} IFS0BITS;
+typedef struct { uint16_t :3, CNIE:1, INT1IE:1, :8, INT2IE:1, :2; } IEC1BITS;
+typedef struct { uint16_t :3, CNIF:1, INT1IF:1, :8, INT2IF:1, :2; } IFS1BITS;
+typedef struct { uint16_t :1, SI2C2IE:1, MI2C2IE:1, :13; } IEC3BITS;
+typedef struct { uint16_t :1, SI2C2IF:1, MI2C2IF:1, :13; } IFS3BITS;
+typedef struct { uint16_t :1, U1ERIE:1, :1, CRCIE:1, :12; } IEC4BITS;
+typedef struct { uint16_t :1, U1ERIF:1, :1, CRCIF:1, :12; } IFS4BITS;
+typedef struct { uint16_t :1, I2C2BCIE:1, :14; } IEC5BITS;
+typedef struct { uint16_t :1, I2C2BCIF:1, :14; } IFS5BITS;
+typedef struct { uint16_t :12, CNIP:3, :1; } IPC4BITS;
+typedef struct { uint16_t :4, MI2C2IP:3, :1, SI2C2IP:3, :5; } IPC12BITS;
+typedef struct { uint16_t :4, I2C2BCIP:3, :9; } IPC21BITS;
+HOST_SFR(IEC0);   HOST_SFR(IEC1);   HOST_SFR(IEC3);   HOST_SFR(IEC4);
+HOST_SFR(IEC5);   HOST_SFR(IFS0);   HOST_SFR(IFS1);   HOST_SFR(IFS3);
+HOST_SFR(IFS4);   HOST_SFR(IFS5);   HOST_SFR(IPC4);   HOST_SFR(IPC12);
+HOST_SFR(IPC21);
+#define IEC0bits      HOST_SFR_BITS(IEC0,  IEC0BITS)
+#define IEC1bits      HOST_SFR_BITS(IEC1,  IEC1BITS)
+#define IEC3bits      HOST_SFR_BITS(IEC3,  IEC3BITS)
+#define IEC4bits      HOST_SFR_BITS(IEC4,  IEC4BITS)
+#define IEC5bits      HOST_SFR_BITS(IEC5,  IEC5BITS)
+#define IFS0bits      HOST_SFR_BITS(IFS0,  IFS0BITS)
+#define IFS1bits      HOST_SFR_BITS(IFS1,  IFS1BITS)
+#define IFS3bits      HOST_SFR_BITS(IFS3,  IFS3BITS)
+#define IFS4bits      HOST_SFR_BITS(IFS4,  IFS4BITS)
+#define IFS5bits      HOST_SFR_BITS(IFS5,  IFS5BITS)
+#define IPC4bits      HOST_SFR_BITS(IPC4,  IPC4BITS)
+#define IPC12bits     HOST_SFR_BITS(IPC12, IPC12BITS)
+#define IPC21bits     HOST_SFR_BITS(IPC21, IPC21BITS)
+
+//----- I/O PORTS --------------------------------------------------------------
+typedef struct
+{
+  uint16_t TRISA0:1, TRISA1:1, TRISA2:1, TRISA3:1, TRISA4:1, :11;
+} TRISABITS;
+typedef struct
+{
+  uint16_t TRISB0:1, TRISB1:1, TRISB2:1, TRISB3:1, TRISB4:1, TRISB5:1;
+  uint16_t TRISB6:1, TRISB7:1, TRISB8:1, TRISB9:1, TRISB10:1, TRISB11:1;
+  uint16_t TRISB12:1, TRISB13:1, TRISB14:1, TRISB15:1;
+} TRISBBITS;
+typedef struct { uint16_t RA0:1, RA1:1, RA2:1, RA3:1, RA4:1, :11; } PORTABITS;
+typedef struct
+{
+  uint16_t RB0:1, RB1:1, RB2:1, RB3:1, RB4:1, RB5:1, RB6:1, RB7:1;
+  uint16_t RB8:1, RB9:1, RB10:1, RB11:1, RB12:1, RB13:1, RB14:1, RB15:1;
+} PORTBBITS;
+typedef struct
+{
+  uint16_t LATA0:1, LATA1:1, LATA2:1, LATA3:1, LATA4:1, :11;
+} LATABITS;
+typedef union
+{
+  struct
+  {
+    uint16_t LATB0:1, LATB1:1, LATB2:1, LATB3:1, LATB4:1, LATB5:1;
+    uint16_t LATB6:1, LATB7:1, LATB8:1, LATB9:1, LATB10:1, LATB11:1;
+    uint16_t LATB12:1, LATB13:1, LATB14:1, LATB15:1;
+  };
+  struct { uint16_t :8, RB8:1, :7; };   // micro_defs.h LED_PWM_DRV spelling
+} LATBBITS;
+typedef struct { uint16_t CN0IE:1, :15; } CNEN1BITS;
+HOST_SFR(TRISA);  HOST_SFR(TRISB);  HOST_SFR(PORTA);  HOST_SFR(PORTB);
+HOST_SFR(LATA);   HOST_SFR(LATB);   HOST_SFR(ODCA);   HOST_SFR(ODCB);
+HOST_SFR(ANSA);   HOST_SFR(ANSB);   HOST_SFR(CNEN1);
+HOST_SFR(CNPU1);  HOST_SFR(CNPU2);  HOST_SFR(CNPU3);
+HOST_SFR(CNPD1);  HOST_SFR(CNPD2);  HOST_SFR(CNPD3);
+#define TRISAbits     HOST_SFR_BITS(TRISA, TRISABITS)
+#define TRISBbits     HOST_SFR_BITS(TRISB, TRISBBITS)
+#define PORTAbits     HOST_SFR_BITS(PORTA, PORTABITS)
+#define PORTBbits     HOST_SFR_BITS(PORTB, PORTBBITS)
+#define LATAbits      HOST_SFR_BITS(LATA,  LATABITS)
+#define LATBbits      HOST_SFR_BITS(LATB,  LATBBITS)
+#define CNEN1bits     HOST_SFR_BITS(CNEN1, CNEN1BITS)
+
+//----- PERIPHERAL PIN SELECT --------------------------------------------------
+typedef struct { uint16_t :8, INT1R:6, :2; } RPINR0BITS;
+typedef struct { uint16_t INT2R:6, :10; } RPINR1BITS;
+typedef struct { uint16_t U1RXR:6, :10; } RPINR18BITS;
+typedef struct { uint16_t :8, RP5R:6, :2; } RPOR2BITS;
+typedef struct { uint16_t RP8R:6, :2, RP9R:6, :2; } RPOR4BITS;
+typedef struct { uint16_t RP12R:6, :10; } RPOR6BITS;
+typedef struct { uint16_t :8, RP15R:6, :2; } RPOR7BITS;
+HOST_SFR(RPINR0); HOST_SFR(RPINR1); HOST_SFR(RPINR18);
+HOST_SFR(RPOR2);  HOST_SFR(RPOR4);  HOST_SFR(RPOR6);  HOST_SFR(RPOR7);
+#define RPINR0bits    HOST_SFR_BITS(RPINR0,  RPINR0BITS)
+#define RPINR1bits    HOST_SFR_BITS(RPINR1,  RPINR1BITS)
+#define RPINR18bits   HOST_SFR_BITS(RPINR18, RPINR18BITS)
+#define RPOR2bits     HOST_SFR_BITS(RPOR2,   RPOR2BITS)
+#define RPOR4bits     HOST_SFR_BITS(RPOR4,   RPOR4BITS)
+#define RPOR6bits     HOST_SFR_BITS(RPOR6,   RPOR6BITS)
+#define RPOR7bits     HOST_SFR_BITS(RPOR7,   RPOR7BITS)
+
+//----- TIMERS & OUTPUT COMPARE ------------------------------------------------
+HOST_SFR(TMR2);   HOST_SFR(TMR3);   HOST_SFR(PR2);    HOST_SFR(PR3);
+typedef struct { uint16_t OCM:3, :7, OCTSEL:3, :3; } OC1CON1BITS;
+typedef struct { uint16_t SYNCSEL:5, :11; } OC1CON2BITS;
+HOST_SFR(OC1CON1);  HOST_SFR(OC1CON2);  HOST_SFR(OC1R);   HOST_SFR(OC1RS);
+#define OC1CON1bits   HOST_SFR_BITS(OC1CON1, OC1CON1BITS)
+#define OC1CON2bits   HOST_SFR_BITS(OC1CON2, OC1CON2BITS)
+
+//----- SPI1 -------------------------------------------------------------------
+typedef struct { uint16_t :15, SPIEN:1; } SPI1CON1LBITS;
+typedef struct
+{
+  uint16_t SPIRBF:1, SPITBF:1, :1, SPITBE:1, :1, SPIRBE:1, SPIROV:1, SRMT:1;
+  uint16_t SPITUR:1, :2, SPIBUSY:1, FRMERR:1, :3;
+} SPI1STATLBITS;
+HOST_SFR(SPI1CON1L);  HOST_SFR(SPI1STATL);  HOST_SFR(SPI1BUFL);
+HOST_SFR(SPI1BUFH);   HOST_SFR(SPI1BRGL);
+#define SPI1CON1Lbits HOST_SFR_BITS(SPI1CON1L, SPI1CON1LBITS)
+#define SPI1STATLbits HOST_SFR_BITS(SPI1STATL, SPI1STATLBITS)
+
+//----- I2C2 -------------------------------------------------------------------
+typedef struct
+{
+  uint16_t SEN:1, RSEN:1, PEN:1, RCEN:1, ACKEN:1, ACKDT:1, STREN:1, GCEN:1;
+  uint16_t SMEN:1, DISSLW:1, A10M:1, STRICT:1, SCLREL:1, :1, I2CSIDL:1, I2CEN:1;
+} I2C2CONLBITS;
+typedef struct
+{
+  uint16_t TBF:1, RBF:1, R_W:1, S:1, P:1, D_A:1, I2COV:1, IWCOL:1;
+  uint16_t ADD10:1, GCSTAT:1, BCL:1, :2, ACKTIM:1, TRSTAT:1, ACKSTAT:1;
+} I2C2STATBITS;
+HOST_SFR(I2C2CONL); HOST_SFR(I2C2STAT); HOST_SFR(I2C2BRG);  HOST_SFR(I2C2ADD);
+HOST_SFR(I2C2MSK);  HOST_SFR(I2C2TRN);  HOST_SFR(I2C2RCV);
+#define I2C2CONLbits  HOST_SFR_BITS(I2C2CONL, I2C2CONLBITS)
+#define I2C2STATbits  HOST_SFR_BITS(I2C2STAT, I2C2STATBITS)
+
+//----- UART1 ------------------------------------------------------------------
+typedef struct { uint16_t :3, BRGH:1, :11, UARTEN:1; } U1MODEBITS;
+HOST_SFR(U1MODE);
+#define U1MODEbits    HOST_SFR_BITS(U1MODE, U1MODEBITS)
+
+
+//----- BUILT-INS & INTRINSICS -------------------------------------------------
+void HostSimSleep(void);            // provided by host/sim.c
+void HostSimIdle(void);             // provided by host/sim.c
+void HostSimReset(void);            // provided by host/sim.c
+
+#define Nop()                       do { } while (0)
+#define ClrWdt()                    do { } while (0)
+#define Sleep()                     HostSimSleep()
+#define Idle()                      HostSimIdle()
+#define Reset()                     HostSimReset()
+#define __builtin_write_OSCCONL(v)  do { OSCCON = (OSCCON & 0xFF00) | (v); } \
+                                    while (0)
+#define __builtin_disi(n)           do { DISICNT = (n); } while (0)
+
+
+#endif  // HOST_XC_H__
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : keypad_sim.c
+ *
+ *  DESCRIPTION   : Define simulated keypad driver (keypad.h) for the host build.
+ *    Scenario key presses arrive already debounced, i.e. as the scan (Timer-3)
+ *    ISR would accept them.  While in wake ops (asleep) only PWR is accepted
+ *    and, like the INT2 ISR, it is reported as KEYPAD_SCANCODE_NONE.
+ *
+ *    (1) void  InitKeypadDriver(void)
+ *    (2) void  StartKeypadScanOps(void)
+ *    (3) void  StartKeypadWakeOps(void)
+ *    (4) void  HostKeypadPress(uint8_t scancode, bool isAsleep)
+ *    (5) void  HostKeypadSync(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "keypad.h"
+#include "main.h"                 // for doNotSleep
+#include "micro_defs.h"           // for FCY
+#include "sim.h"
+
+#define PR_128HZ      305         // same Timer-3 period as keypad.c
+
+typedef enum tagKEYPAD_OPS
+{
+  KO_NONE,
+  KO_SCAN,
+  KO_WAKE,
+} kpops_t;
+
+
+//----- EXPOSED ATTRIBUTE DECLARATIONS -----------------------------------------
+volatile bool         isKeypadInputReady;     // informs consumer when key ready
+volatile uint8_t      acptKeypadInput;        // tell consumer the accepted key
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static kpops_t  kpOps     = KO_NONE;
+static uint64_t tmr3StrtUs= 0;
+
+
+void InitKeypadDriver(void)
+{
+  kpOps               = KO_NONE;
+  PR3                 = PR_128HZ;
+  isKeypadInputReady  = false;
+  acptKeypadInput     = KEYPAD_RESET_CODE;
+} // end routine InitKeypadDriver
+
+
+void StartKeypadScanOps(void)
+{
+  kpOps       = KO_SCAN;
+  TMR3        = 0x0000;
+  tmr3StrtUs  = HostSimNowUs();
+} // end routine StartKeypadScanOps
+
+
+void StartKeypadWakeOps(void)
+{
+  kpOps       = KO_WAKE;
+} // end routine StartKeypadWakeOps
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostKeypadPress(uint8_t scancode, bool isAsleep)
+//  Delivers scenario key press as the scan or wake ISR would.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostKeypadPress(uint8_t scancode, bool isAsleep)
+{
+  (void)isAsleep;
+  if ((KO_SCAN == kpOps) && !isKeypadInputReady)
+  {
+    HostSimLog("KEY 0x%02X", scancode);
+    acptKeypadInput     = scancode;
+    isKeypadInputReady  = true;
+    doNotSleep          = true;
+  }
+  else if ((KO_WAKE == kpOps) && (KEYPAD_SCANCODE_PWR == scancode))
+  {
+    HostSimLog("KEY PWR (wake)");
+    acptKeypadInput     = KEYPAD_SCANCODE_NONE;
+    isKeypadInputReady  = true;
+    doNotSleep          = true;
+  }
+  else
+  {
+    HostSimLog("KEY 0x%02X ignored", scancode);
+  }
+} // end routine HostKeypadPress
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostKeypadSync(void)
+//  Brings the TMR3 register up to date with sim time while scanning.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostKeypadSync(void)
+{
+  if (KO_SCAN == kpOps)
+  {
+    uint64_t ticks = ((HostSimNowUs() - tmr3StrtUs) * (FCY / 1000000ULL)) / 256;
+    TMR3 = (uint16_t)(ticks % (PR_128HZ + 1ULL));
+  }
+} // end routine HostKeypadSync
@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : sfr.c
+ *
+ *  DESCRIPTION   : Allocates the host build's stand-in special function
+ *    registers declared by host/include/xc.h.  Like the target after reset
+ *    they are simply zero unless noted below.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#define HOST_SFR_STORAGE
+#include <xc.h>
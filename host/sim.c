@@ -0,0 +1,355 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : sim.c
+ *
+ *  DESCRIPTION   : Define the host build's simulated clock and scenario player.
+ *    The firmware's delays, Idle() and Sleep() land here (see host/include).
+ *    Interrupt-like events are delivered only while the firmware has interrupts
+ *    enabled (SR IPL < 7), just as the ISRs would run on target:
+ *      - Timer-2 expirations (tmr2_sim.c calls the requested callback)
+ *      - keypad presses from the scenario (keypad_sim.c)
+ *      - Lightning reports from the scenario (uart1_sim.c RX path)
+ *    When the scenario is exhausted, or the firmware would sleep with nothing
+ *    left to wake it, a summary is printed and the process exits.
+ *
+ *    SCENARIO FORMAT, one event per line, times in ms since power-up and in
+ *    non-decreasing order ('#' starts a comment):
+ *      <ms> KEY <ENT|RT|UP|PWR|911|ZERO|HDN>   keypad input accepted
+ *      <ms> RPT <text>                         Lightning report, the frame
+ *                                              start/stop characters are added
+ *      <ms> SNAP <name>                        log LCD image hash and bus cost
+ *                                              since last SNAP (uc1701x_emu.c)
+ *      <ms> END                                stop the simulation
+ *    The scenario is read from the file named by environment ESD_SIM_SCRIPT,
+ *    otherwise from stdin.
+ *
+ *      (1) uint64_t HostSimNowUs(void)
+ *      (2) void HostSimDelayUs(uint64_t us)
+ *      (3) void HostSimIdle(void)
+ *      (4) void HostSimSleep(void)
+ *      (5) void HostSimReset(void)
+ *      (6) void HostSimLog(const char * fmt, ...)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add SNAP event, end LCD bus cost pass at each Idle() and Sleep()
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "keypad.h"           // for KEYPAD_SCANCODE_*
+#include "main.h"             // for esdErrFlags
+
+#define RTI_FSC         0xA1  // Lightning frames start w/ <FLIP-EXCLAME>
+#define RTI_FPC         0xB6  // Lightning frames stop  w/ <PILCROW>
+#define SCRIPT_LINE_LEN 256
+
+typedef enum tagSIM_EVENT
+{
+  SE_NONE,                    // scenario exhausted
+  SE_KEY,
+  SE_RPT,
+  SE_SNAP,
+  SE_END,
+} simevt_t;
+
+typedef struct tagSIM_SCRIPT_EVENT
+{
+  simevt_t  type;
+  uint64_t  dueUs;
+  uint8_t   scancode;         // SE_KEY
+  uint8_t   frame[SCRIPT_LINE_LEN];   // SE_RPT, including FSC & FPC;
+  uint16_t  len;                      // SE_SNAP, name ('\0' terminated)
+} simscr_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static  uint64_t  nowUs     = 0;
+static  FILE *    script    = NULL;
+static  uint32_t  scriptLn  = 0;
+static  simscr_t  nextEvt   = {.type = SE_NONE};
+static  bool      isLoaded  = false;  // nextEvt read (or script exhausted)
+static  uint32_t  ctIdle    = 0;      // Idle() calls, i.e. main loop wakeups
+static  uint32_t  ctSleep   = 0;      // Sleep() calls
+static  uint32_t  ctEvents  = 0;      // scenario events delivered
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static uint8_t KeyNameToScancode(const char * name)
+//  Translates scenario key name to keypad scan code, 0 if unknown.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static uint8_t KeyNameToScancode(const char * name)
+{
+  static const struct { const char * name; uint8_t code; } keys[] =
+  {
+    {"ENT",  KEYPAD_SCANCODE_ENT},  {"RT",   KEYPAD_SCANCODE_RT},
+    {"UP",   KEYPAD_SCANCODE_UP},   {"PWR",  KEYPAD_SCANCODE_PWR},
+    {"911",  KEYPAD_SCANCODE_911},  {"ZERO", KEYPAD_SCANCODE_ZERO},
+    {"HDN",  KEYPAD_SCANCODE_HDN},
+  };
+  size_t i;
+
+  for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)  {
+    if (0 == strcmp(name, keys[i].name))                {
+      return keys[i].code;                              }
+  }
+  return 0;
+} // end function KeyNameToScancode
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void LoadNextEvent(void)
+//  Reads scenario lines until next event (or end of file) is in nextEvt.
+//  Malformed lines are fatal so a typo cannot silently change a scenario.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void LoadNextEvent(void)
+{
+  char line[SCRIPT_LINE_LEN];
+
+  isLoaded      = true;
+  nextEvt.type  = SE_NONE;
+  if (NULL == script)
+  {
+    const char * path = getenv("ESD_SIM_SCRIPT");
+    script = (NULL != path) ? fopen(path, "r") : stdin;
+    if (NULL == script)
+    {
+      fprintf(stderr, "esd_host: cannot open scenario '%s'\n", path);
+      exit(2);
+    }
+  }
+
+  while (NULL != fgets(line, sizeof(line), script))
+  {
+    char *    p = line;
+    char *    cmd;
+    char *    arg;
+    uint64_t  ms;
+
+    scriptLn++;
+    line[strcspn(line, "\r\n")] = '\0';
+    while (isspace((unsigned char)*p))  {
+      p++;                              }
+    if (('\0' == *p) || ('#' == *p))    {
+      continue;                         }
+
+    ms  = strtoull(p, &cmd, 10);
+    while (isspace((unsigned char)*cmd)){
+      cmd++;                            }
+    arg = cmd + strcspn(cmd, " \t");
+    if ('\0' != *arg)                   {
+      *arg++ = '\0';                    }
+
+    nextEvt.dueUs = ms * 1000ULL;
+    if (0 == strcmp(cmd, "KEY"))
+    {
+      nextEvt.scancode = KeyNameToScancode(arg);
+      if (0 != nextEvt.scancode)          {
+        nextEvt.type = SE_KEY;            }
+    }
+    else if (0 == strcmp(cmd, "RPT"))
+    {
+      nextEvt.len       = 0;
+      nextEvt.frame[nextEvt.len++] = RTI_FSC;
+      while (*arg && (nextEvt.len < sizeof(nextEvt.frame) - 1))  {
+        nextEvt.frame[nextEvt.len++] = (uint8_t)*arg++;         }
+      nextEvt.frame[nextEvt.len++] = RTI_FPC;
+      nextEvt.type      = SE_RPT;
+    }
+    else if ((0 == strcmp(cmd, "SNAP")) && ('\0' != *arg))
+    {
+      nextEvt.len       = (uint16_t)strcspn(arg, " \t");
+      memcpy(nextEvt.frame, arg, nextEvt.len);
+      nextEvt.frame[nextEvt.len] = '\0';
+      nextEvt.type      = SE_SNAP;
+    }
+    else if (0 == strcmp(cmd, "END"))
+    {
+      nextEvt.type = SE_END;
+    }
+
+    if (SE_NONE == nextEvt.type)
+    {
+      fprintf(stderr, "esd_host: scenario line %u not understood\n", scriptLn);
+      exit(2);
+    }
+    return;
+  }
+} // end routine LoadNextEvent
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void Finish(const char * why)
+//  Prints simulation summary and terminates the process.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void Finish(const char * why)
+{
+  HostSimLog("simulation ends: %s", why);
+  printf("---- summary ----\n");
+  printf("sim time        : %llu.%03llu s\n",
+         (unsigned long long)(nowUs / 1000000ULL),
+         (unsigned long long)((nowUs / 1000ULL) % 1000ULL));
+  printf("scenario events : %u\n", ctEvents);
+  printf("Idle() wakeups  : %u\n", ctIdle);
+  printf("Sleep() calls   : %u\n", ctSleep);
+  HostUart1Summary();
+  HostSpi1Summary();
+  HostLcdSummary();
+  HostI2c2Summary();
+  printf("esdErrFlags     : 0x%04X\n", esdErrFlags.val);
+  fflush(stdout);
+  HostI2c2SaveEeprom();
+  exit(0);
+} // end routine Finish
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static bool DeliverNextEvent(uint64_t limitUs, bool isAsleep)
+//  Advances time to and delivers the earliest event due at or before limitUs.
+//  While asleep Timer-2 does not run (its peripheral clock is stopped), so
+//  only scenario events can be delivered.
+//
+//  OUTPUT: bool - true if an event was delivered
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static bool DeliverNextEvent(uint64_t limitUs, bool isAsleep)
+{
+  uint64_t  t2Us;
+  bool      isT2;
+
+  if (!isLoaded)              {
+    LoadNextEvent();          }
+
+  isT2 = (!isAsleep) && HostTmr2NextUs(&t2Us) && (t2Us <= limitUs);
+  if ((SE_NONE != nextEvt.type) && (nextEvt.dueUs <= limitUs) &&
+      ((!isT2) || (nextEvt.dueUs < t2Us)))
+  {
+    if (nextEvt.dueUs > nowUs)  {
+      nowUs = nextEvt.dueUs;    }
+    HostTmr2Sync();
+    HostKeypadSync();
+    ctEvents++;
+    switch (nextEvt.type)
+    {
+      case SE_KEY:
+        HostKeypadPress(nextEvt.scancode, isAsleep);
+        break;
+      case SE_RPT:
+        HostSimLog("LTNG->ESD %.*s", nextEvt.len - 2, &nextEvt.frame[1]);
+        HostUart1Receive(nextEvt.frame, nextEvt.len);
+        break;
+      case SE_SNAP:
+        HostLcdSnap((const char *)nextEvt.frame);
+        break;
+      case SE_END:
+      default:
+        Finish("END");
+        break;
+    }
+    isLoaded = false;
+    return true;
+  }
+  if (isT2)
+  {
+    if (t2Us > nowUs)           {   // Timer-2 IRQ may have been held off
+      nowUs = t2Us;             }   // while IRQs were disabled
+    HostKeypadSync();
+    HostTmr2Expire();
+    return true;
+  }
+  return false;
+} // end function DeliverNextEvent
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  uint64_t HostSimNowUs(void)
+//  Returns simulated microseconds since power-up.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+uint64_t HostSimNowUs(void)
+{
+  return nowUs;
+} // end function HostSimNowUs
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostSimDelayUs(uint64_t us)
+//  Busy-wait stand-in for __delay_us/__delay_ms.  Interrupts still fire during
+//  a busy wait on target, so due events are delivered if IRQs are enabled.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostSimDelayUs(uint64_t us)
+{
+  uint64_t endUs = nowUs + us;
+
+  if (SRbits.IPL < 7)                             {
+    while (DeliverNextEvent(endUs, false))        { ; }
+  }
+  nowUs = endUs;
+  HostTmr2Sync();
+  HostKeypadSync();
+} // end routine HostSimDelayUs
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostSimIdle(void)
+//  Idle() stand-in: jump to and deliver the next event.  Idle() ends a main
+//  loop pass, and so the LCD bus cost of that pass's UpdateDisplay().
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostSimIdle(void)
+{
+  ctIdle++;
+  HostLcdPassEnd();
+  if (!DeliverNextEvent(UINT64_MAX, false)) {
+    Finish("scenario exhausted");           }
+} // end routine HostSimIdle
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostSimSleep(void)
+//  Sleep() stand-in: jump to and deliver the next scenario event.  With IRQs
+//  disabled (e.g. zeroized) nothing can ever wake the processor.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostSimSleep(void)
+{
+  ctSleep++;
+  HostLcdPassEnd();
+  if (SRbits.IPL >= 7)                      {
+    Finish("Sleep() with interrupts disabled"); }
+  if (!DeliverNextEvent(UINT64_MAX, true))  {
+    Finish("asleep with scenario exhausted"); }
+} // end routine HostSimSleep
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostSimReset(void)
+//  Reset() stand-in: a software reset ends the simulation (e.g. after zeroize).
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostSimReset(void)
+{
+  Finish("software Reset()");
+} // end routine HostSimReset
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostSimLog(const char * fmt, ...)
+//  Prints a time-stamped line of simulation output.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostSimLog(const char * fmt, ...)
+{
+  va_list args;
+
+  printf("[%7llu.%03llu] ", (unsigned long long)(nowUs / 1000000ULL),
+         (unsigned long long)((nowUs / 1000ULL) % 1000ULL));
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+  putchar('\n');
+} // end routine HostSimLog
@@ -0,0 +1,86 @@
+#ifndef HOST_SIM_H__
+#define HOST_SIM_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : sim.h
+ *
+ *  DESCRIPTION   : Declares the glue between the host build's simulated clock
+ *    and scenario player (sim.c) and its simulated peripheral drivers
+ *    (..._sim.c).  None of this is visible to the application modules, which
+ *    only see the ordinary driver headers (uart1_queued.h, spi1.h, etc.).
+ *
+ *    Simulated time is kept in microseconds and only moves when the firmware
+ *    delays (__delay_ms/us), idles (Idle()), or sleeps (Sleep()).  Idle and
+ *    Sleep jump straight to the next event, so a scenario spanning hours runs
+ *    in a fraction of a second.
+ *
+ *    Sim clock & scenario (sim.c)
+ *      (1) uint64_t HostSimNowUs(void)
+ *      (2) void HostSimDelayUs(uint64_t us)
+ *      (3) void HostSimIdle(void)
+ *      (4) void HostSimSleep(void)
+ *      (5) void HostSimReset(void)
+ *      (6) void HostSimLog(const char * fmt, ...)
+ *    Timer-2 (tmr2_sim.c)
+ *      (7) bool HostTmr2NextUs(uint64_t * dueUs)
+ *      (8) void HostTmr2Expire(void)
+ *      (9) void HostTmr2Sync(void)
+ *    Keypad & Timer-3 (keypad_sim.c)
+ *     (10) void HostKeypadPress(uint8_t scancode, bool isAsleep)
+ *     (11) void HostKeypadSync(void)
+ *    UART1 (uart1_sim.c)
+ *     (12) void HostUart1Receive(const uint8_t * data, uint16_t len)
+ *     (13) void HostUart1Summary(void)
+ *    SPI1 (spi1_sim.c)
+ *     (14) void HostSpi1Summary(void)
+ *    I2C2 (i2c2_sim.c)
+ *     (15) void HostI2c2Summary(void)
+ *     (16) void HostI2c2SaveEeprom(void)
+ *    UC1701X LCD controller model (uc1701x_emu.c)
+ *     (17) void HostLcdWrite(bool isData, uint8_t value)
+ *     (18) void HostLcdPassEnd(void)
+ *     (19) void HostLcdSnap(const char * name)
+ *     (20) void HostLcdSummary(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add UC1701X LCD controller model
+ *      Initial implementation for the Linux host build
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+
+//----- EXPOSED PROCEDURES -----------------------------------------------------
+uint64_t HostSimNowUs(void);
+void HostSimDelayUs(uint64_t us);
+void HostSimIdle(void);
+void HostSimSleep(void);
+void HostSimReset(void);
+void HostSimLog(const char * fmt, ...) __attribute__((format(printf, 1, 2)));
+
+bool HostTmr2NextUs(uint64_t * dueUs);
+void HostTmr2Expire(void);
+void HostTmr2Sync(void);
+
+void HostKeypadPress(uint8_t scancode, bool isAsleep);
+void HostKeypadSync(void);
+
+void HostUart1Receive(const uint8_t * data, uint16_t len);
+void HostUart1Summary(void);
+
+void HostSpi1Summary(void);
+
+void HostI2c2Summary(void);
+void HostI2c2SaveEeprom(void);
+
+void HostLcdWrite(bool isData, uint8_t value);
+void HostLcdPassEnd(void);
+void HostLcdSnap(const char * name);
+void HostLcdSummary(void);
+
+
+#endif  // HOST_SIM_H__
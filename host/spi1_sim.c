@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : spi1_sim.c
+ *
+ *  DESCRIPTION   : Define simulated queued SPI1 driver (spi1.h) for the host
+ *    build.  Counts the bytes sent to the LCD, split into commands and display
+ *    data by each run's CD (A0) level, and models the time the target's ISR
+ *    takes to drain the queue at 5 MHz: a transfer stays busy until its last
+ *    byte would have been shifted out, Spi1WaitTxDone() advances the sim clock
+ *    to then, and Spi1PutRun() does so only when the queue would be full.
+ *    Every byte is also handed to the LCD controller model (uc1701x_emu.c).
+ *
+ *    (1) void  InitSpi1Driver(void)
+ *    (2) bool  Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len,
+ *                         uint8_t mask)
+ *    (3) bool  Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+ *    (4) bool  Spi1WaitTxDone(void)
+ *    (5) bool  Spi1IsTxDone(void)
+ *    (6) spi1xfer_t Spi1GetLastXfer(void)
+ *    (7) void  HostSpi1Summary(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add Spi1PutFill()
+ *      Feed sent bytes to UC1701X model
+      Model queued command/data runs and transfer timing of new SPI1 driver
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "spi1.h"
+#include "micro_defs.h"           // for LCD_CD
+#include "sim.h"
+
+#define SPI_BYTE_NS       1600    // 8 clocks at Fcy/2 = 5 MHz
+#define NS_PER_US         1000
+
+
+static uint32_t   ctCmdBytes  = 0;  // bytes sent with CD low
+static uint32_t   ctDataBytes = 0;  // bytes sent with CD high
+static uint32_t   ctXfers     = 0;  // transfers (idle to idle)
+static uint64_t   startNs     = 0;  // when active transfer started
+static uint64_t   doneNs      = 0;  // when active transfer's last bit leaves
+static bool       isXferOpen  = false;
+static spi1xfer_t xferNow;
+static spi1xfer_t xferLast;
+static spi1xfer_t xferMax;          // transfer that took the longest
+
+
+static void CloseXferIfDone(void)
+{
+  uint64_t ticks;
+
+  if (isXferOpen && (HostSimNowUs() * NS_PER_US >= doneNs))
+  {
+    ticks = (doneNs - startNs) / SPI1_TICK_NS;
+    xferNow.ticks = (ticks > 0xFFFF) ? 0xFFFF : (uint16_t)ticks;
+    xferLast      = xferNow;
+    if (xferNow.ticks >= xferMax.ticks) {
+      xferMax = xferNow;                }
+    isXferOpen    = false;
+  }
+} // end routine CloseXferIfDone
+
+
+void InitSpi1Driver(void)
+{
+  SPI1CON1L           = 0x0071;
+  SPI1CON1Lbits.SPIEN = 1;
+  isXferOpen          = false;
+} // end routine InitSpi1Driver
+
+
+static bool PutBytes(bool isData, const uint8_t bytes[], uint8_t step,
+                     uint16_t len, uint8_t mask)
+{
+  uint64_t nowNs;
+  uint64_t fullNs;
+  uint16_t runLen;
+  uint16_t k;
+
+  if (!SPI1CON1Lbits.SPIEN)   {   // When SPI1 not enabled the bytes never
+    return false;             }   // leave, as on target
+
+  while (len)
+  {
+    runLen = (len > SPI1_RUN_MAX) ? SPI1_RUN_MAX : len;
+    len   -= runLen;
+    CloseXferIfDone();
+    nowNs  = HostSimNowUs() * NS_PER_US;
+    if (!isXferOpen)
+    {                             // SPI1 idle so this starts a transfer
+      isXferOpen      = true;
+      startNs         = nowNs;
+      doneNs          = nowNs;
+      xferNow.bytes   = 0;
+      xferNow.runs    = 0;
+      xferNow.a0Chgs  = 0;
+      ctXfers++;
+    }
+    fullNs = doneNs - (uint64_t)(SPI1_TXQ_LEN - 1 - runLen) * SPI_BYTE_NS;
+    if ((doneNs > (uint64_t)(SPI1_TXQ_LEN - 1 - runLen) * SPI_BYTE_NS) &&
+        (fullNs > nowNs))
+    {                             // Wait, as target does, for queue room
+      HostSimDelayUs((fullNs - nowNs + NS_PER_US - 1) / NS_PER_US);
+    }
+    if (isData != (LCD_CD ? true : false))
+    {
+      LCD_CD = isData ? 1 : 0;
+      xferNow.a0Chgs++;
+    }
+    if (isData)               {
+      ctDataBytes += runLen;  }
+    else                      {
+      ctCmdBytes  += runLen;  }
+    for (k = 0; k < runLen; k++, bytes += step) {
+      HostLcdWrite(isData, *bytes ^ mask);      }
+    xferNow.bytes += runLen;
+    xferNow.runs++;
+    doneNs        += (uint64_t)runLen * SPI_BYTE_NS;
+  }
+  return true;
+} // end function PutBytes
+
+
+bool Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len, uint8_t mask)
+{
+  return PutBytes(isData, bytes, 1, len, mask);
+} // end function Spi1PutRun
+
+
+bool Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+{
+  return PutBytes(isData, &value, 0, len, 0x00);
+} // end function Spi1PutFill
+
+
+bool Spi1WaitTxDone(void)
+{
+  uint64_t nowNs = HostSimNowUs() * NS_PER_US;
+
+  if (isXferOpen && (doneNs > nowNs)) {
+    HostSimDelayUs((doneNs - nowNs + NS_PER_US - 1) / NS_PER_US); }
+  CloseXferIfDone();
+  return true;
+} // end function Spi1WaitTxDone
+
+
+bool Spi1IsTxDone(void)
+{
+  CloseXferIfDone();
+  return !isXferOpen;
+} // end function Spi1IsTxDone
+
+
+spi1xfer_t Spi1GetLastXfer(void)
+{
+  CloseXferIfDone();
+  return xferLast;
+} // end function Spi1GetLastXfer
+
+
+void HostSpi1Summary(void)
+{
+  CloseXferIfDone();
+  printf("SPI1 to LCD     : %u bytes (%u cmd, %u data)\n",
+         ctCmdBytes + ctDataBytes, ctCmdBytes, ctDataBytes);
+  printf("SPI1 transfers  : %u, longest %u bytes in %u runs (%u us)\n",
+         ctXfers, xferMax.bytes, xferMax.runs,
+         (uint32_t)xferMax.ticks * SPI1_TICK_NS / NS_PER_US);
+} // end routine HostSpi1Summary
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : tmr2_sim.c
+ *
+ *  DESCRIPTION   : Define simulated TIMER2 driver (tmr2.h) for the host build.
+ *    The callback requested with ReqTmr2Srvc is called by the simulated clock
+ *    (sim.c) every period, where on target the T2 ISR would call it.
+ *
+ *    (1) void  InitTmr2Driver(void)
+ *    (2) bool  ReqTmr2Srvc(tmr2srvc_t period, pvfv_t callback)
+ *    (3) void  EndTmr2Srvc(void)
+ *    (4) bool  HostTmr2NextUs(uint64_t * dueUs)
+ *    (5) void  HostTmr2Expire(void)
+ *    (6) void  HostTmr2Sync(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stddef.h>               // for NULL
+#include "tmr2.h"
+#include "main.h"                 // for esdErrFlags
+#include "sim.h"
+
+// Timer-2 ticks at Fcy/256, i.e. every 25.6 us
+#define TICKS_TO_US(t)  (((uint64_t)(t) * 256ULL) / (FCY / 1000000ULL))
+
+
+static pvfv_t   tmr2cb    = NULL; // callback function for TIMER2 service
+static uint16_t tmr2Prd   = 0;    // ticks per period
+static uint64_t tmr2StrtUs= 0;    // sim time current period started
+
+
+void InitTmr2Driver(void)
+{
+  tmr2cb  = NULL;
+  TMR2    = 0;
+} // end routine InitTmr2Driver
+
+
+bool ReqTmr2Srvc(tmr2srvc_t period, pvfv_t callback)
+{
+  if (NULL == tmr2cb)
+  {                               // Only when not already using Timer-2
+    tmr2cb      = callback;
+    tmr2Prd     = period;
+    PR2         = period;
+    TMR2        = 0x0000;
+    tmr2StrtUs  = HostSimNowUs();
+    return true;
+  }
+  esdErrFlags.fw = 1;             // note firmware did something stupid
+  return false;
+} // end function ReqTmr2Srvc
+
+
+void EndTmr2Srvc(void)
+{
+  tmr2cb = NULL;
+} // end routine EndTmr2Srvc
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool HostTmr2NextUs(uint64_t * dueUs)
+//  Provides sim time of next Timer-2 expiration, if timer service is running.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool HostTmr2NextUs(uint64_t * dueUs)
+{
+  if (NULL == tmr2cb)   {
+    return false;       }
+  *dueUs = tmr2StrtUs + TICKS_TO_US(tmr2Prd);
+  return true;
+} // end function HostTmr2NextUs
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostTmr2Expire(void)
+//  Starts next period and calls callback, as the T2 ISR does.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostTmr2Expire(void)
+{
+  tmr2StrtUs += TICKS_TO_US(tmr2Prd);
+  if (tmr2StrtUs + TICKS_TO_US(tmr2Prd) <= HostSimNowUs())  {
+    tmr2StrtUs = HostSimNowUs();                            }
+  HostTmr2Sync();
+  if (NULL != tmr2cb)       {
+    tmr2cb();               }
+} // end routine HostTmr2Expire
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostTmr2Sync(void)
+//  Brings the TMR2 register up to date with sim time.
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostTmr2Sync(void)
+{
+  if ((NULL != tmr2cb) && tmr2Prd)
+  {
+    uint64_t ticks = ((HostSimNowUs() - tmr2StrtUs) * (FCY / 1000000ULL)) / 256;
+    TMR2 = (uint16_t)(ticks % (tmr2Prd + 1ULL));
+  }
+} // end routine HostTmr2Sync
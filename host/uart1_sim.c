@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : uart1_sim.c
+ *
+ *  DESCRIPTION   : Define simulated queued UART1 driver (uart1_queued.h) for
+ *    the host build.  Writes drain the write queue at once and are logged one
+ *    Lightning frame per line.  Scenario Lightning reports are received through
+ *    HostUart1Receive() using the same queueing, trigger, and overflow rules
+ *    as the target's _U1RXInterrupt.
+ *
+ *    (1) bool  OpenUart1(void)
+ *    (2) bool  StartReadUart1(uint8queue* readQ, uint16_t count)
+ *    (3) void  StopReadUart1(void)
+ *    (4) bool  StartWriteUart1(uint8queue* writeQ)
+ *    (5) void  StopWriteUart1(void)
+ *    (6) void  CloseUart1(void)
+ *    (7) uartstat_t GetUart1Status(void)
+ *    (8) bool  GetUart1IsWriteDone(void)
+ *    (9) void  ClearUart1StatusFlag(uartflag_t flag)
+ *   (10) void  HostUart1Receive(const uint8_t * data, uint16_t len)
+ *   (11) void  HostUart1Summary(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stddef.h>               // for NULL
+#include <stdint.h>
+#include <stdio.h>
+#include "uart1_queued.h"
+#include "main.h"                 // for doNotSleep
+#include "micro_defs.h"           // for UART1_RX_TRIG_BYTE
+#include "sim.h"
+
+#define RTI_FPC         0xB6      // Lightning frames stop  w/ <PILCROW>
+#define TX_LINE_LEN     256
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static uint8queue *   rQUart1     = NULL; // UART1 Receive queue
+static uint16_t       uart1RxCtdn = 0;    // countdown bytes to read
+static bool           isReading   = false;
+static uartstat_t     uart1Stat   = {.stat = 0};
+static char           txLine[TX_LINE_LEN];
+static uint16_t       txLen       = 0;
+static uint32_t       ctTxBytes   = 0;
+static uint32_t       ctTxFrames  = 0;
+static uint32_t       ctRxBytes   = 0;
+static uint32_t       ctRxLost    = 0;
+
+
+bool OpenUart1(void)
+{
+  if (U1MODEbits.UARTEN)          {   // When UART already enabled, don't
+    return false;                 }   // stomp on it
+  uart1Stat.stat      = 0;
+  uart1Stat.wrtLast   = 1;            // Just opening so no write in progress
+  U1MODEbits.BRGH     = 1;
+  U1MODEbits.UARTEN   = 1;
+  return true;
+} // end function OpenUart1
+
+
+bool StartReadUart1(uint8queue* readQ, uint16_t count)
+{
+  if (isReading)                  {
+    return false;                 }
+  if (NULL == readQ)
+  {
+    uart1Stat.rqerr = 1;
+    return false;
+  }
+  uart1Stat.rqerr = 0;
+  rQUart1         = readQ;
+  uart1RxCtdn     = count;
+  isReading       = true;
+  return true;
+} // end function StartReadUart1
+
+
+void StopReadUart1(void)
+{
+  isReading   = false;
+  uart1RxCtdn = 1;
+} // end routine StopReadUart1
+
+
+bool StartWriteUart1(uint8queue* writeQ)
+{
+  uint8_t data;
+
+  if (NULL == writeQ)
+  {
+    uart1Stat.wqerr = 1;
+    return false;
+  }
+  uart1Stat.wqerr = 0;
+  while (QUEUE_NOT_EMPTY(writeQ))
+  {                                   // Transmit everything at once, logging
+    QUEUE_GET(writeQ, data);          // each completed Lightning frame
+    ctTxBytes++;
+    if (0x20 <= data && data < 0x7F && txLen < TX_LINE_LEN - 1) {
+      txLine[txLen++] = (char)data;                             }
+    if (RTI_FPC == data)
+    {
+      ctTxFrames++;
+      txLine[txLen] = '\0';
+      HostSimLog("ESD->LTNG %s", txLine);
+      txLen = 0;
+    }
+  }
+  uart1Stat.wrtLast = 1;
+  return true;
+} // end function StartWriteUart1
+
+
+void StopWriteUart1(void)
+{
+  uart1Stat.wrtLast = 1;
+} // end routine StopWriteUart1
+
+
+void CloseUart1(void)
+{
+  U1MODEbits.UARTEN = 0;
+  uart1Stat.wrtLast = 1;
+  isReading         = false;
+  rQUart1           = NULL;
+} // end routine CloseUart1
+
+
+uartstat_t GetUart1Status(void)
+{
+  return uart1Stat;
+} // end function GetUart1Status
+
+
+bool GetUart1IsWriteDone(void)
+{
+  return uart1Stat.wrtLast ? true : false;
+} // end function GetUart1IsWriteDone
+
+
+void ClearUart1StatusFlag(uartflag_t flag)
+{
+  switch (flag)
+  {
+    case ALLERR   :   uart1Stat.stat   &= ~UARTSTAT_ERR_BITS;   break;
+    case WQERR    :   uart1Stat.wqerr   = 0;                    break;
+    case RQERR    :   uart1Stat.rqerr   = 0;                    break;
+    case OERR     :   uart1Stat.oerr    = 0;                    break;
+    case FERR     :   uart1Stat.ferr    = 0;                    break;
+    case PERR     :   uart1Stat.perr    = 0;                    break;
+    case RXTRIG   :   uart1Stat.trigCnt = 0;                    break;
+    case TRIGCNT  :   uart1Stat.trigCnt--;                      break;
+    default       :                                             break;
+  }
+} // end routine ClearUart1StatusFlag
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void HostUart1Receive(const uint8_t * data, uint16_t len)
+//  Receives bytes from the simulated Lightning as _U1RXInterrupt would.
+//  Bytes are lost when the UART is closed or not reading (Lightning off).
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void HostUart1Receive(const uint8_t * data, uint16_t len)
+{
+  for ( ; len; len--, data++)
+  {
+    if (!U1MODEbits.UARTEN || !isReading)
+    {
+      ctRxLost++;
+      continue;
+    }
+    ctRxBytes++;
+    if (uart1RxCtdn)
+    {
+      uart1RxCtdn--;
+      if (!uart1RxCtdn)
+      {
+        isReading   = false;
+        doNotSleep  = true;
+      }
+    }
+    #ifdef UART1_RX_TRIG_BYTE
+    if (UART1_RX_TRIG_BYTE == *data)
+    {
+      doNotSleep  = true;
+      uart1Stat.trigCnt++;
+    }
+    #endif
+    if ((NULL != rQUart1) && QUEUE_NOT_FULL(rQUart1))
+    {
+      QUEUE_PUT(rQUart1, *data);
+      if (QUEUE_FULL(rQUart1))  {
+        doNotSleep = true;      }
+    }
+    else
+    {
+      uart1Stat.rqerr = 1;
+    }
+  }
+} // end routine HostUart1Receive
+
+
+void HostUart1Summary(void)
+{
+  printf("UART1 TX        : %u bytes, %u frames\n", ctTxBytes, ctTxFrames);
+  printf("UART1 RX        : %u bytes, %u lost\n", ctRxBytes, ctRxLost);
+} // end routine HostUart1Summary
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : uc1701x_emu.c
+ *
+ *  DESCRIPTION   : Define host build model of the UC1701 LCD controller of
+ *    the EA DOGS102W-6, fed the exact command/data byte stream the firmware
+ *    sends over SPI1 (spi1_sim.c).  It decodes the UC1701 command set, keeps
+ *    the 132 x 65 pixel display data RAM (9 pages, page 8 being the icon row)
+ *    with page/column auto-increment, and renders what the 102 x 64 glass shows
+ *    (display enable, all-pixels-on, inverse, scroll line, COM direction).
+ *
+ *    Bus cost is measured per main loop pass, i.e. per UpdateDisplay() and the
+ *    LCDFlush() that follows it, which on host ends at the next Idle() or
+ *    Sleep():  command bytes, data bytes, data bytes that did not change RAM,
+ *    and address sets (page/column commands) that left the address unchanged.
+ *
+ *    Environment ESD_SIM_LCD_DIR names a directory into which every pass that
+ *    touched the LCD is dumped as frame_NNNN.pbm and logged with its cost.
+ *    Scenario SNAP events log a hash of the glass image and the cost since the
+ *    previous SNAP, and write <name>.pbm into ESD_SIM_LCD_DIR when set, so each
+ *    screen (focus point) can be checked for both pixels and bus cost.
+ *
+ *    (1) void  HostLcdWrite(bool isData, uint8_t value)
+ *    (2) void  HostLcdPassEnd(void)
+ *    (3) void  HostLcdSnap(const char * name)
+ *    (4) void  HostLcdSummary(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation for the Linux host build
+ *
+ *  REFERENCE DOCUMENTS
+ *    1.  DOGS Graphic Series 102x6 Dots Data Sheet 06.2013
+ *    2.  UC1701 Single-Chip 65x132 Matrix Passive LCD Controller-Driver
+ *        (UltraChip Inc.)
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "sim.h"
+
+#define RAM_PAGES       9         // 8 pages of 8 rows plus icon row page
+#define RAM_COLUMNS     132
+#define GLASS_COLUMNS   102       // DOGS102: columns 0-101 with SEG reversed
+#define GLASS_ROWS      64
+#define FNV_OFFSET      2166136261u
+#define FNV_PRIME       16777619u
+
+typedef struct tagLCD_COST
+{
+  uint32_t cmdBytes;              // bytes sent with CD low
+  uint32_t dataBytes;             // bytes sent with CD high
+  uint32_t sameData;              // data bytes equal to RAM already there
+  uint32_t adrsSets;              // page or column address commands
+  uint32_t sameAdrs;              // ... that left the address unchanged
+} lcdcost_t;
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static uint8_t    ram[RAM_PAGES][RAM_COLUMNS];
+static uint8_t    page        = 0;
+static uint8_t    column      = 0;
+static uint8_t    scrollLine  = 0;
+static bool       isEnabled   = false;  // display enable (DC2)
+static bool       isAllOn     = false;  // all pixels on (DC1)
+static bool       isInverse   = false;  // inverse display (DC0)
+static bool       isComMirror = false;  // COM direction (MY)
+static uint8_t    pendingCmd  = 0;      // first byte of a 2-byte command
+static lcdcost_t  pass;                 // cost of current main loop pass
+static lcdcost_t  sinceSnap;            // cost since last SNAP
+static lcdcost_t  total;
+static lcdcost_t  worst;                // most costly pass
+static uint32_t   ctPasses    = 0;      // passes that touched LCD
+static uint32_t   ctSnaps     = 0;
+
+
+static void AddCost(lcdcost_t * pSum, const lcdcost_t * pAdd)
+{
+  pSum->cmdBytes  += pAdd->cmdBytes;
+  pSum->dataBytes += pAdd->dataBytes;
+  pSum->sameData  += pAdd->sameData;
+  pSum->adrsSets  += pAdd->adrsSets;
+  pSum->sameAdrs  += pAdd->sameAdrs;
+} // end routine AddCost
+
+
+static void SetAdrs(uint8_t newPage, uint8_t newColumn)
+{
+  pass.adrsSets++;
+  if ((newPage == page) && (newColumn == column)) {
+    pass.sameAdrs++;                              }
+  page   = newPage;
+  column = newColumn;
+} // end routine SetAdrs
+
+
+static void DecodeCmd(uint8_t cmd)
+{
+  if (0 != pendingCmd)
+  {                               // Second byte of a 2-byte command:
+    pendingCmd = 0;               // electronic volume or adv. program
+    return;                       // control; neither changes the image
+  }
+  if      (0x00 == (cmd & 0xF0))  { SetAdrs(page, (column & 0xF0) | (cmd & 0x0F)); }
+  else if (0x10 == (cmd & 0xF0))  { SetAdrs(page, (column & 0x0F) | ((cmd & 0x0F) << 4)); }
+  else if (0xB0 == (cmd & 0xF0))  { SetAdrs(cmd & 0x0F, column);  }
+  else if (0x40 == (cmd & 0xC0))  { scrollLine  = cmd & 0x3F;     }
+  else if (0xAE == (cmd & 0xFE))  { isEnabled   = cmd & 0x01;     }
+  else if (0xA4 == (cmd & 0xFE))  { isAllOn     = cmd & 0x01;     }
+  else if (0xA6 == (cmd & 0xFE))  { isInverse   = cmd & 0x01;     }
+  else if (0xC0 == (cmd & 0xF7))  { isComMirror = (cmd & 0x08) ? true : false; }
+  else if ((0x81 == cmd) || (0xFA == cmd))
+  {
+    pendingCmd = cmd;
+  }
+  else if (0xE2 == cmd)
+  {                               // System reset: registers to defaults,
+    page        = 0;              // RAM untouched
+    column      = 0;
+    scrollLine  = 0;
+    isAllOn     = false;
+    isInverse   = false;
+    isComMirror = false;
+  }
+  // others (power control, resistor ratio, bias, SEG direction, NOP) don't
+  // change what the model shows
+} // end routine DecodeCmd
+
+
+static bool GlassPixel(uint8_t x, uint8_t y)
+{
+  uint8_t row;
+
+  if (!isEnabled)       {         // Display off (e.g. LCD_SLEEP_MODE) is
+    return false;       }         // blank whatever all pixels on says
+  if (isAllOn)          {
+    return true;        }
+  row = ((isComMirror ? (GLASS_ROWS - 1 - y) : y) + scrollLine) % GLASS_ROWS;
+  return (((ram[row / 8][x] >> (row % 8)) & 1) ? true : false) ^ isInverse;
+} // end function GlassPixel
+
+
+static uint32_t GlassHash(void)
+{
+  uint32_t h = FNV_OFFSET;
+  uint8_t  x;
+  uint8_t  y;
+
+  for (y = 0; y < GLASS_ROWS; y++)    {
+    for (x = 0; x < GLASS_COLUMNS; x++) {
+      h = (h ^ (GlassPixel(x, y) ? 1 : 0)) * FNV_PRIME; }
+  }
+  return h;
+} // end function GlassHash
+
+
+static void WritePbm(const char * name)
+{
+  const char * dir = getenv("ESD_SIM_LCD_DIR");
+  char         path[512];
+  FILE *       f;
+  uint8_t      x;
+  uint8_t      y;
+
+  if (NULL == dir)    {
+    return;           }
+  snprintf(path, sizeof(path), "%s/%s.pbm", dir, name);
+  if (NULL == (f = fopen(path, "w")))
+  {
+    fprintf(stderr, "esd_host: cannot write '%s'\n", path);
+    return;
+  }
+  fprintf(f, "P1\n# %s\n%u %u\n", name, GLASS_COLUMNS, GLASS_ROWS);
+  for (y = 0; y < GLASS_ROWS; y++)
+  {
+    for (x = 0; x < GLASS_COLUMNS; x++)   {
+      fputc(GlassPixel(x, y) ? '1' : '0', f); }
+    fputc('\n', f);
+  }
+  fclose(f);
+} // end routine WritePbm
+
+
+void HostLcdWrite(bool isData, uint8_t value)
+{
+  if (!isData)
+  {
+    pass.cmdBytes++;
+    DecodeCmd(value);
+    return;
+  }
+  pass.dataBytes++;
+  if ((page < RAM_PAGES) && (column < RAM_COLUMNS))
+  {
+    if (ram[page][column] == value) {
+      pass.sameData++;              }
+    ram[page][column] = value;
+  }
+  if (column < RAM_COLUMNS)       {   // Column address auto-increments, and
+    column++;                     }   // stops at last column (no wrap)
+} // end routine HostLcdWrite
+
+
+void HostLcdPassEnd(void)
+{
+  char name[32];
+
+  if (0 == (pass.cmdBytes + pass.dataBytes))  {
+    return;                                   }
+
+  ctPasses++;
+  AddCost(&sinceSnap, &pass);
+  AddCost(&total, &pass);
+  if ((pass.cmdBytes + pass.dataBytes) > (worst.cmdBytes + worst.dataBytes)) {
+    worst = pass;                                                           }
+  if (NULL != getenv("ESD_SIM_LCD_DIR"))
+  {
+    snprintf(name, sizeof(name), "frame_%04u", ctPasses);
+    WritePbm(name);
+    HostSimLog("LCD %s: %u cmd, %u data (%u same), %u adrs sets (%u same)",
+               name, pass.cmdBytes, pass.dataBytes, pass.sameData,
+               pass.adrsSets, pass.sameAdrs);
+  }
+  pass = (lcdcost_t){0};
+} // end routine HostLcdPassEnd
+
+
+void HostLcdSnap(const char * name)
+{
+  HostLcdPassEnd();
+  ctSnaps++;
+  WritePbm(name);
+  HostSimLog("LCD SNAP %s: image %08X, since last SNAP %u cmd, %u data "
+             "(%u same), %u adrs sets (%u same)", name, GlassHash(),
+             sinceSnap.cmdBytes, sinceSnap.dataBytes, sinceSnap.sameData,
+             sinceSnap.adrsSets, sinceSnap.sameAdrs);
+  sinceSnap = (lcdcost_t){0};
+} // end routine HostLcdSnap
+
+
+void HostLcdSummary(void)
+{
+  HostLcdPassEnd();
+  printf("LCD passes      : %u, costliest %u cmd + %u data bytes\n",
+         ctPasses, worst.cmdBytes, worst.dataBytes);
+  printf("LCD redundancy  : %u of %u data bytes same, "
+         "%u of %u adrs sets same\n", total.sameData, total.dataBytes,
+         total.sameAdrs, total.adrsSets);
+  printf("LCD image       : %08X\n", GlassHash());
+} // end routine HostLcdSummary
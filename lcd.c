@@ -11,11 +11,58 @@
  *      (3) bool LCDWriteStringTerminal12X16(page, column, string[], invert)
  *      (4) bool LCDWriteStringVerdana34X56(page, column, string[], invert)
  *      (5) bool LCDClearScreen(void)
+ *      (6) bool LCDWriteString(page, column, string[], pFont, invert)
+ *      (7) bool LCDFlush(void)
+ *      (*) const uint8_t * FontGlyph(const font_t * pFont, char c)
+ *      (*) bool LCDSetCursor(page, column)
+ *      (*) void LCDPutData(data[], len, invert)
+ *      (*) void LCDPutFill(value, len, invert)
+ *      (*) const uint8_t * LCDPutPackedRow(pRow, width, len, invert)
+ *      (*) uint8_t CellTag(const font_t * pFont)
+ *      (*) uint8_t CellWidth(uint16_t cell)
+ *      (*) uint16_t CellWord(column, code, invert, tag)
+ *      (*) bool LCDCellIsSame(page, column, code, invert, pFont)
+ *      (*) void LCDCellClear(page, column, width)
+ *      (*) void LCDCellSet(page, column, code, invert, pFont)
+ *
+ *  When LCD_USE_FRAMEBUFFER (lcd.h) is 1 everything is drawn into lcdFb[][],
+ *  a RAM copy of the LCD's 8 pages x 102 columns, and only columns whose byte
+ *  changes are noted as dirty in lcdClean[][].  LCDFlush() then sends each run
+ *  of dirty columns, bridging gaps of up to LCD_FLUSH_GAP clean columns where
+ *  re-sending them is cheaper than setting the column address again.  So a
+ *  page that changes at both ends (e.g. paging INFIL messages) costs about its
+ *  changed bytes, not its whole span.  Otherwise drawing goes straight to LCD.
+ *
+ *  When LCD_USE_TEXT_SHADOW (lcd.h) is 1, lcdCell[][] remembers which glyph
+ *  (character code, invert, font page row, column) was last drawn in each
+ *  6-column text cell of each page, so LCDWriteString() skips characters that
+ *  are already displayed.  As no glyph is narrower than 6 columns, glyphs that
+ *  don't overlap never share a cell.  Anything drawn over a glyph clears its
+ *  cells, so a cell only matches while its glyph is intact on the LCD.
+ *
+ *  Fonts stored packed (font_t index not NULL, see FONTS_USE_RLE in fonts.h)
+ *  are unpacked by LCDPutPackedRow() one page row at a time as they're drawn:
+ *  literal bytes go on straight from the font and runs as LCDPutFill(), so a
+ *  glyph is never staged in RAM.
  *
  *  USE: call
  *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Draw packed glyphs (TERMINAL 12X16, VERDANA 34X56) via LCDPutPackedRow()
+ *      Track dirty framebuffer columns in a per-page bitmap and flush runs of
+ *      dirty columns instead of one span per page
+ *      Add optional text-cell shadow so LCDWriteString() only draws characters
+ *      whose code, inversion or position changed
+ *      Add optional page framebuffer with per-page dirty column span and
+ *      LCDFlush(); draw via LCDSetCursor() and LCDPutData()
+ *      Replace Glyph___() switch(c) look-ups with constant time FontGlyph()
+ *      into font atlas; make LCDWriteStringRun() public as LCDWriteString()
+ *      Set page & column once per page row in LCDWriteFont() and stream bytes
+ *      using LCD column auto-increment (was 3 command bytes per data byte)
+ *      LCDWriteString___() now stream whole text run per page row via new
+ *      LCDWriteString(); per-character switch(*s) moved to Glyph___()
  *    2021/06/01, Robert Kirby, NSWC H12
  *      Use VERDANA_34X56_SPACE instead of VERDANA_34X56_EQUALS for default:
  *      as <SP> is good way to clear 7 out of LCD's 8 character rows
@@ -33,17 +80,384 @@
  *    1.
  */
 #include <xc.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "lcd.h"
 #include "fonts.h"
 #include "uc1701x.h"
 
+#define LCD_PAGES       (LCD_MAX_PAGES + 1)
+#define LCD_COLUMNS     (UC1701X_LAST_COLUMN + 1)
+#define LCD_CELL_COLS   (UC1701X_LAST_COLUMN / WIDTH_6X8 + 1) // 6X8 narrowest
+#define LCD_CLEAN_BYTES ((LCD_COLUMNS + 7) / 8)   // 1 bit per column
+// Clean columns between dirty ones that LCDFlush() re-sends rather than start
+// a new run, which costs 2 column address command bytes and an A0 turnaround
+#define LCD_FLUSH_GAP   3
+
+// lcdCell[][] word: code | invert | tag (font & its page row) | column in cell
+#define CELL_CODE_MASK  0x00FF
+#define CELL_INVERT     0x0100
+#define CELL_TAG_POS    9           // 4-bit tag, 0 = no glyph
+#define CELL_TAG_MASK   0x000F
+#define CELL_OFS_POS    13          // 3-bit column offset within 6-column cell
+#define CELL_EMPTY      0x0000
+#define CELL_LOOK_BACK  ((WIDTH_34X56 - 1) / WIDTH_6X8 + 1) // cells widest glyph spans
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+#if (LCD_USE_FRAMEBUFFER == 1)
+static uint8_t lcdFb[LCD_PAGES][LCD_COLUMNS]; // RAM copy of LCD display data
+// Bit set when LCD column already shows lcdFb[][] byte.  All columns start
+// dirty so first LCDFlush() overwrites LCD RAM's power-on garbage.
+static uint8_t lcdClean[LCD_PAGES][LCD_CLEAN_BYTES];
+#define IS_CLEAN(p, c)  (lcdClean[p][(c) >> 3] & (1 << ((c) & 7)))
+static uint8_t fbPage;                        // where LCDPutData() draws next
+static uint8_t fbColumn;
+#endif
+#if (LCD_USE_TEXT_SHADOW == 1)
+static uint16_t lcdCell[LCD_PAGES][LCD_CELL_COLS]; // glyph drawn in each cell
+// Fonts whose glyphs are remembered in lcdCell[][].  Each page row of each
+// font gets own tag: tag 1 is TERMINAL_6X8, 2-3 TERMINAL_12X16, and so on.
+static const font_t * const pCellFont[] =
+{
+  &TERMINAL_6X8_FONT, &TERMINAL_12X16_FONT, &VERDANA_34X56_FONT
+};
+#define CELL_FONTS      (sizeof(pCellFont) / sizeof(pCellFont[0]))
+#endif
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static bool LCDSetCursor(uint8_t page, uint8_t column)
+//  Sets page and column at which following LCDPutData() draws, either in the
+//  framebuffer or on the LCD itself.
+//
+//  INPUT : uint8_t page - page (row) on LCD, 0 - LCD_MAX_PAGES
+//          uint8_t column - LCD pixel column, 0 - UC1701X_LAST_COLUMN
+//  OUTPUT: bool - true if procedure succeeded, otherwise false (bad position)
+//  CALLS : UC1701XSetPageAddress
+//          UC1701XSetColumnAddress
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static bool LCDSetCursor( uint8_t page, uint8_t column )
+{
+#if (LCD_USE_FRAMEBUFFER == 1)
+  if ( (page > LCD_MAX_PAGES) || (column > UC1701X_LAST_COLUMN) ) {
+    return false;                                                 }
+  fbPage   = page;
+  fbColumn = column;
+  return true;
+#else
+  return ( UC1701XSetPageAddress( page ) && UC1701XSetColumnAddress( column ) );
+#endif
+} // end function LCDSetCursor
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void LCDPutData(const uint8_t data[], uint8_t len, bool invert)
+//  Draws a run of display data bytes at the cursor, which then advances by len
+//  as the LCD's column address does.  Caller ensures run does not pass last
+//  column.  In the framebuffer only bytes that differ are marked dirty.
+//
+//  INPUT : const uint8_t data[] - display data bytes (1 byte per column)
+//          uint8_t len - number of bytes
+//          bool invert - ? invert video of bytes ?
+//  OUTPUT: NONE
+//  CALLS : UC1701XWriteDataRun
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void LCDPutData( const uint8_t data[], uint8_t len, bool invert )
+{
+#if (LCD_USE_FRAMEBUFFER == 1)
+  uint8_t * pFb  = &lcdFb[fbPage][fbColumn];
+  uint8_t   mask = invert ? 0xFF : 0x00;
+  uint8_t   col;
+  uint8_t   b;
+
+  for ( col = fbColumn; len--; col++, pFb++ )
+  {
+    b = *data++ ^ mask;
+    if ( *pFb != b )
+    {                                       // When byte changed note column
+      *pFb = b;                             // dirty to send on next flush
+      lcdClean[fbPage][col >> 3] &= ~(1 << (col & 7));
+    }
+  }
+  fbColumn = col;
+#else
+  UC1701XWriteDataRun( data, len, invert );
+#endif
+} // end routine LCDPutData
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void LCDPutFill(uint8_t value, uint8_t len, bool invert)
+//  Draws len copies of one display data byte at the cursor, as LCDPutData()
+//  draws a run of bytes.
+//
+//  INPUT : uint8_t value - display data byte (1 column)
+//          uint8_t len - number of columns
+//          bool invert - ? invert video of byte ?
+//  OUTPUT: NONE
+//  CALLS : UC1701XWriteDataFill
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void LCDPutFill( uint8_t value, uint8_t len, bool invert )
+{
+#if (LCD_USE_FRAMEBUFFER == 1)
+  uint8_t * pFb = &lcdFb[fbPage][fbColumn];
+  uint8_t   col;
+
+  if ( invert ) {
+    value = ~value; }
+  for ( col = fbColumn; len--; col++, pFb++ )
+  {
+    if ( *pFb != value )
+    {
+      *pFb = value;
+      lcdClean[fbPage][col >> 3] &= ~(1 << (col & 7));
+    }
+  }
+  fbColumn = col;
+#else
+  UC1701XWriteDataFill( value, len, invert );
+#endif
+} // end routine LCDPutFill
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static const uint8_t * LCDPutPackedRow(pRow, width, len, invert)
+//  Unpacks one page row of a packed glyph (see RLE_ZEROS et al. in fonts.h)
+//  and draws its first len bytes at the cursor.  Literal bytes are drawn from
+//  the font itself and runs are filled, so no row is staged in RAM.
+//
+//  INPUT : const uint8_t * pRow - packed page row
+//          uint8_t width - bytes the row unpacks to (font width)
+//          uint8_t len - bytes to draw, less than width if glyph is clipped
+//          bool invert - ? invert video of bytes ?
+//  OUTPUT: const uint8_t * - packed page row that follows
+//  CALLS : LCDPutData
+//          LCDPutFill
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static const uint8_t * LCDPutPackedRow( const uint8_t * pRow, uint8_t width, uint8_t len, bool invert )
+{
+  uint8_t token;
+  uint8_t n;                                // bytes token unpacks to
+  uint8_t nPut;                             // ... of which are drawn
+
+  while ( 0 < width )
+  {
+    token  = *pRow++;
+    n      = (token & ((token & RLE_LITERAL) ? 0x7F : 0x3F)) + 1;
+    nPut   = (n < len) ? n : len;
+    width -= n;
+    len   -= nPut;
+    if ( token & RLE_LITERAL )
+    {
+      if ( nPut ) {
+        LCDPutData( pRow, nPut, invert ); }
+      pRow += n;
+    }
+    else if ( token & RLE_REPEAT )
+    {
+      if ( nPut ) {
+        LCDPutFill( *pRow, nPut, invert ); }
+      pRow++;
+    }
+    else if ( nPut )
+    {
+      LCDPutFill( 0x00, nPut, invert );
+    }
+  }
+  return pRow;
+} // end function LCDPutPackedRow
+
+
+#if (LCD_USE_TEXT_SHADOW == 1)
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static uint8_t CellTag(const font_t * pFont)
+//  Look-up lcdCell[][] tag of first page row of font pFont's glyphs.
+//
+//  INPUT : const font_t * pFont - font of glyph
+//  OUTPUT: uint8_t - tag of font's first page row, 0 if font not remembered
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static uint8_t CellTag( const font_t * pFont )
+{
+  uint8_t tag = 1;
+  uint8_t f;
+
+  for ( f = 0; f < CELL_FONTS; tag += pCellFont[f++]->height )
+  {
+    if ( pFont == pCellFont[f] )  {
+      return tag;                 }
+  }
+  return 0;
+} // end function CellTag
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static uint8_t CellWidth(uint16_t cell)
+//  Look-up width of glyph remembered in an lcdCell[][] word.
+//
+//  INPUT : uint16_t cell - lcdCell[][] word (not CELL_EMPTY)
+//  OUTPUT: uint8_t - width of glyph in columns
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static uint8_t CellWidth( uint16_t cell )
+{
+  uint8_t tag = (cell >> CELL_TAG_POS) & CELL_TAG_MASK;
+  uint8_t f;
+
+  for ( f = 0; (f < (CELL_FONTS - 1)) && (tag > pCellFont[f]->height); f++ )
+  {
+    tag -= pCellFont[f]->height;
+  }
+  return pCellFont[f]->width;
+} // end function CellWidth
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static uint16_t CellWord(column, code, invert, tag)
+//  Builds lcdCell[][] word for a glyph page row drawn at column.
+//
+//  INPUT : uint8_t column - LCD pixel column of glyph's left edge
+//          uint8_t code - character code
+//          bool invert - ? inverted video ?
+//          uint8_t tag - tag of glyph's font and page row
+//  OUTPUT: uint16_t - lcdCell[][] word
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static uint16_t CellWord( uint8_t column, uint8_t code, bool invert, uint8_t tag )
+{
+  return ( (uint16_t)code
+         | (invert ? CELL_INVERT : 0)
+         | ((uint16_t)tag << CELL_TAG_POS)
+         | ((uint16_t)(column % WIDTH_6X8) << CELL_OFS_POS) );
+} // end function CellWord
+#endif
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static bool LCDCellIsSame(page, column, code, invert, pFont)
+//  Checks if the glyph of character code in font pFont is already displayed
+//  whole at (column, page) as remembered in lcdCell[][].
+//
+//  INPUT : uint8_t page - page (row) of glyph's top
+//          uint8_t column - LCD pixel column of glyph's left edge
+//          char code - character code
+//          bool invert - ? inverted video ?
+//          const font_t * pFont - font of glyph
+//  OUTPUT: bool - true if glyph already displayed (false if no text shadow)
+//  CALLS : CellTag
+//          CellWord
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static bool LCDCellIsSame( uint8_t page, uint8_t column, char code, bool invert, const font_t * pFont )
+{
+#if (LCD_USE_TEXT_SHADOW == 1)
+  uint8_t tag = CellTag( pFont );
+  uint8_t row;
+
+  if ( (0 == tag) || ((page + pFont->height) > LCD_PAGES) ||
+       ((column + pFont->width) > LCD_COLUMNS) )
+  {                                         // Not remembered, off LCD, or
+    return false;                           // clipped glyphs always drawn
+  }
+  for ( row = 0; row < pFont->height; row++ )
+  {
+    if ( lcdCell[page + row][column / WIDTH_6X8] !=
+         CellWord( column, (uint8_t)code, invert, tag + row ) )
+    {
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+} // end function LCDCellIsSame
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void LCDCellClear(uint8_t page, uint8_t column, uint8_t width)
+//  Forgets remembered glyphs of page that overlap columns drawn over.
+//
+//  INPUT : uint8_t page - page (row) drawn
+//          uint8_t column - first LCD pixel column drawn
+//          uint8_t width - number of columns drawn
+//  OUTPUT: NONE
+//  CALLS : CellWidth
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void LCDCellClear( uint8_t page, uint8_t column, uint8_t width )
+{
+#if (LCD_USE_TEXT_SHADOW == 1)
+  uint16_t * pCell;
+  uint16_t   glyphCol;
+  int8_t     cell = (column / WIDTH_6X8) - CELL_LOOK_BACK;
+  int8_t     last = (column + width - 1) / WIDTH_6X8;
+
+  if ( page > LCD_MAX_PAGES )       {
+    return;                         }
+  if ( cell < 0 )                   {
+    cell = 0;                       }
+  if ( last >= LCD_CELL_COLS )      {
+    last = LCD_CELL_COLS - 1;       }
+
+  for ( pCell = &lcdCell[page][cell]; cell <= last; cell++, pCell++ )
+  {
+    if ( CELL_EMPTY != *pCell )
+    {                                       // When remembered glyph overlaps
+      glyphCol = (cell * WIDTH_6X8) + (*pCell >> CELL_OFS_POS);
+      if ( ((glyphCol + CellWidth( *pCell )) > column) &&
+           (glyphCol < (column + width)) )
+      {
+        *pCell = CELL_EMPTY;                // forget it as it is drawn over
+      }
+    }
+  }
+#endif
+} // end routine LCDCellClear
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static void LCDCellSet(page, column, code, invert, pFont)
+//  Remembers glyph of character code in font pFont as displayed whole at
+//  (column, page), after forgetting any glyphs it was drawn over.
+//
+//  INPUT : uint8_t page - page (row) of glyph's top
+//          uint8_t column - LCD pixel column of glyph's left edge
+//          char code - character code
+//          bool invert - ? inverted video ?
+//          const font_t * pFont - font of glyph
+//  OUTPUT: NONE
+//  CALLS : CellTag
+//          CellWord
+//          LCDCellClear
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void LCDCellSet( uint8_t page, uint8_t column, char code, bool invert, const font_t * pFont )
+{
+#if (LCD_USE_TEXT_SHADOW == 1)
+  uint8_t tag     = CellTag( pFont );
+  bool    isWhole = ( ((column + pFont->width) <= LCD_COLUMNS) &&
+                      ((page + pFont->height) <= LCD_PAGES) );
+  uint8_t row;
+
+  for ( row = 0; (row < pFont->height) && ((page + row) < LCD_PAGES); row++ )
+  {
+    LCDCellClear( page + row, column, pFont->width );
+    if ( (0 != tag) && isWhole )
+    {
+      lcdCell[page + row][column / WIDTH_6X8] =
+        CellWord( column, (uint8_t)code, invert, tag + row );
+    }
+  }
+#endif
+} // end routine LCDCellSet
+
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  bool LCDWriteFont(startPage,startColumn,fontHeight,fontWidth,fontChar,invert)
 //  The character specified by fontChar is displayed on the LCD at position
-//  (startColumn, startPage).
+//  (startColumn, startPage).  Page and column are set once per page row and
+//  then the row's bytes are streamed as LCD auto-increments column address.
 //
 //  NOTE: Consideration needs to be given to turning off the display before
 //        writing the character, and then turning the display back on again to
@@ -55,45 +469,150 @@
 //          uint8_t fontWidth - width of font in columns (1-byte each column)
 //          const uint8_t fontChar[] - array font info for character to display
 //          bool invert - ? invert video of character ?
-//  OUTPUT: bool - true if procedure succeeded, otherwise false
-//  CALLS : UC1701XSetPageAddress
-//          UC1701XSetColumnAddress
-//          UC1701XWriteData
+//  OUTPUT: bool - true if procedure succeeded, otherwise false (e.g. character
+//                 clipped at right edge of LCD)
+//  CALLS : LCDSetCursor
+//          LCDCellClear
+//          LCDPutData
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool LCDWriteFont( uint8_t startPage, uint8_t startColumn, uint8_t fontHeight, uint8_t fontWidth, const uint8_t fontChar[], bool invert )
 {
-  // currentPage and currentColumn are used as loop counters, starting at the upper-left-most byte
-  int16_t currentPage = startPage;
-  int16_t currentColumn = startColumn;
-  uint16_t index = 0;
+  uint8_t page;
+  uint8_t runLen = fontWidth;
 
-  while ( currentPage < (startPage + fontHeight) )
+  if ( startColumn > UC1701X_LAST_COLUMN )                    {
+    return false;                                             }
+  if ( (startColumn + fontWidth - 1) > UC1701X_LAST_COLUMN )  {
+    runLen = UC1701X_LAST_COLUMN - startColumn + 1;           }
+
+  for ( page = 0; page < fontHeight; page++, fontChar += fontWidth )
   {
-    if ( false == UC1701XSetPageAddress( currentPage ) )        {
-      return false;                                             }
-    while ( currentColumn < (startColumn + fontWidth) )
+    if ( false == LCDSetCursor( startPage + page, startColumn ) ) {
+      return false;                                               }
+    LCDCellClear( startPage + page, startColumn, runLen );
+    LCDPutData( fontChar, runLen, invert );
+  }
+
+  return ( runLen == fontWidth );
+} // end function LCDWriteFont
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static const uint8_t * FontGlyph(const font_t * pFont, char c)
+//  Look-up glyph of character c within atlas of font pFont, via the font's
+//  index when its glyphs are packed.
+//
+//  INPUT : const font_t * pFont - font containing glyph
+//          char c - character to display
+//  OUTPUT: const uint8_t * - glyph of c (or fallback glyph if c not in font)
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static const uint8_t * FontGlyph( const font_t * pFont, char c )
+{
+  uint8_t code = (uint8_t)c;
+  uint8_t idx  = pFont->fallback;
+
+  if ( (code >= pFont->first) && (code <= pFont->last) )
+  {
+    idx = code - pFont->first;
+  }
+  else if ( (code >= pFont->extFirst) && (code <= pFont->extLast) )
+  {
+    idx = (pFont->last - pFont->first + 1) + (code - pFont->extFirst);
+  }
+
+  if ( NULL != pFont->index ) {
+    return ( pFont->atlas + pFont->index[idx] ); }
+  return ( pFont->atlas + ((uint16_t)idx * (pFont->width * pFont->height)) );
+} // end function FontGlyph
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool LCDWriteString(startPage,startColumn,*str,pFont,invert)
+//  The character string specified by s is displayed to the LCD at position
+//  (startColumn, startPage) one page row at a time: page and column are set
+//  once per run of characters to draw in a page row and then that row's slice
+//  of each character's glyph is streamed as LCD auto-increments column address.
+//  Characters the text shadow shows as already displayed are skipped and
+//  characters beyond right edge of LCD are clipped.
+//
+//  INPUT : uint8_t startPage - equivalent to row on LCD at which to place text
+//          uint8_t startColumn - LCD pixel column at which to place string
+//          char    s[] - null terminated set of characters to display
+//          const font_t * pFont - font in which to display string
+//          bool invert - ? invert video of character ?
+//  OUTPUT: bool - true if procedure succeeded, otherwise false (e.g. string
+//                 clipped at right edge of LCD)
+//  CALLS : LCDSetCursor
+//          LCDPutData
+//          LCDPutPackedRow
+//          LCDCellIsSame
+//          LCDCellSet
+//          FontGlyph
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool LCDWriteString( uint8_t startPage, uint8_t startColumn, char s[], const font_t * pFont, bool invert )
+{
+  const uint8_t * pGlyph[LCD_MAX_COLS + 1]; // 6X8 is narrowest, 17 fit on LCD
+  bool    isNew[LCD_MAX_COLS + 1];          // glyph not already displayed
+  uint8_t nGlyph  = 0;
+  uint8_t nNew    = 0;
+  uint8_t lastLen = pFont->width;           // bytes of right most glyph shown
+  uint16_t column = startColumn;
+  uint16_t offset;
+  uint8_t page;
+  uint8_t i;
+
+  // Look-up glyph of each character that (at least partly) fits on the LCD
+  // and remember it as displayed unless it already is
+  for ( ; ('\0' != *s) && (column <= UC1701X_LAST_COLUMN); s++ )
+  {
+    isNew[nGlyph] = !LCDCellIsSame( startPage, column, *s, invert, pFont );
+    if ( isNew[nGlyph] )
     {
-      if ( false == UC1701XSetColumnAddress( currentColumn ) )  {
-        return false;                                           }
-      // Write byte indexed at current page and column
-      // Since fontChar array is one dimension, have to perform multiplication to get the index right
-      if ( invert )                                             {
-        UC1701XWriteData( ~fontChar[index++] );                 }
-      else                                                      {
-        UC1701XWriteData( fontChar[index++] );                  }
-
-      // Move on to the next column
-      ++currentColumn;
+      LCDCellSet( startPage, column, *s, invert, pFont );
+      nNew++;
     }
-    // After column boundary has been reached, move back to beginning column
-    currentColumn = startColumn;
+    pGlyph[nGlyph++] = FontGlyph( pFont, *s );
+    column += pFont->width;
+  }
+  if ( column > (UC1701X_LAST_COLUMN + 1) )
+  {                                         // When right most glyph clipped
+    lastLen = pFont->width - (column - (UC1701X_LAST_COLUMN + 1));
+  }
+  if ( 0 == nNew )
+  {                                         // Nothing to draw if all of
+    return ( ('\0' == *s) && (lastLen == pFont->width) ); // string displayed
+  }
 
-    // Move on to the next page
-    ++currentPage;
+  // Draw each page row's runs of new glyphs, skipping displayed ones
+  for ( page = 0, offset = 0; page < pFont->height; page++, offset += pFont->width )
+  {
+    for ( i = 0, column = startColumn; i < nGlyph; )
+    {
+      if ( ! isNew[i] )
+      {
+        i++;
+        column += pFont->width;
+        continue;
+      }
+      if ( false == LCDSetCursor( startPage + page, column ) ) {
+        return false;                                          }
+      for ( ; (i < nGlyph) && isNew[i]; i++, column += pFont->width )
+      {
+        if ( NULL != pFont->index )
+        {                                   // Packed glyph: draw this row and
+          pGlyph[i] = LCDPutPackedRow( pGlyph[i], pFont->width, // keep next
+                        (i == (nGlyph - 1)) ? lastLen : pFont->width, invert );
+          continue;
+        }
+        LCDPutData( pGlyph[i] + offset,
+                    (i == (nGlyph - 1)) ? lastLen : pFont->width, invert );
+      }
+    }
   }
 
-  return true;
-} // end function LCDWriteFont
+  return ( ('\0' == *s) && (lastLen == pFont->width) );
+} // end function LCDWriteString
 
 
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -106,125 +625,11 @@ bool LCDWriteFont( uint8_t startPage, uint8_t startColumn, uint8_t fontHeight, u
 //          char    s[] - null terminated set of characters to display
 //          bool invert - ? invert video of character ?
 //  OUTPUT: bool - true if procedure succeeded, otherwise false
-//  CALLS : LCDWriteFont
+//  CALLS : LCDWriteString
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool LCDWriteStringTerminal6X8( uint8_t startPage, uint8_t startColumn, char s[], bool invert )
 {
-  // TODO:  Change this function to print up to whichever comes first \0 or a len parameter
-  uint8_t currentColumn;
-  const uint8_t * pFontChar;
-  bool    isOk = true;
-
-  for( currentColumn = startColumn; isOk && (*s != '\0'); currentColumn += WIDTH_6X8, s++ )
-  {
-    switch (*s)
-    {
-      case ENVELOPE_LEFT_CHAR:  pFontChar = ENVELOPE_6X8_LEFT;   break;
-      case ENVELOPE_RIGHT_CHAR: pFontChar = ENVELOPE_6X8_RIGHT;  break;
-
-      case ' ':   pFontChar = TERMINAL_6X8_SPACE;         break;
-      case '!':   pFontChar = TERMINAL_6X8_EXCLAMATION;   break;
-      case '"':   pFontChar = TERMINAL_6X8_DOUBLEQUOTE;   break;
-      case '#':   pFontChar = TERMINAL_6X8_HASH;          break;
-      case '$':   pFontChar = TERMINAL_6X8_DOLLAR;        break;
-      case '%':   pFontChar = TERMINAL_6X8_PERCENT;       break;
-      case '&':   pFontChar = TERMINAL_6X8_AMPERSAND;     break;
-      case '\'':  pFontChar = TERMINAL_6X8_SINGLEQUOTE;   break;
-      case '(':   pFontChar = TERMINAL_6X8_OPENPAREN;     break;
-      case ')':   pFontChar = TERMINAL_6X8_CLOSEPAREN;    break;
-      case '*':   pFontChar = TERMINAL_6X8_ASTERISK;      break;
-      case '+':   pFontChar = TERMINAL_6X8_PLUS;          break;
-      case ',':   pFontChar = TERMINAL_6X8_COMMA;         break;
-      case '-':   pFontChar = TERMINAL_6X8_MINUS;         break;
-      case '.':   pFontChar = TERMINAL_6X8_PERIOD;        break;
-      case '/':   pFontChar = TERMINAL_6X8_FWDSLASH;      break;
-      case '0':   pFontChar = TERMINAL_6X8_0;             break;
-      case '1':   pFontChar = TERMINAL_6X8_1;             break;
-      case '2':   pFontChar = TERMINAL_6X8_2;             break;
-      case '3':   pFontChar = TERMINAL_6X8_3;             break;
-      case '4':   pFontChar = TERMINAL_6X8_4;             break;
-      case '5':   pFontChar = TERMINAL_6X8_5;             break;
-      case '6':   pFontChar = TERMINAL_6X8_6;             break;
-      case '7':   pFontChar = TERMINAL_6X8_7;             break;
-      case '8':   pFontChar = TERMINAL_6X8_8;             break;
-      case '9':   pFontChar = TERMINAL_6X8_9;             break;
-      case ':':   pFontChar = TERMINAL_6X8_COLON;         break;
-      case ';':   pFontChar = TERMINAL_6X8_SEMICOLON;     break;
-      case '<':   pFontChar = TERMINAL_6X8_LESS;          break;
-      case '=':   pFontChar = TERMINAL_6X8_EQUALS;        break;
-      case '>':   pFontChar = TERMINAL_6X8_GREATER;       break;
-      case '?':   pFontChar = TERMINAL_6X8_QUESTION;      break;
-      case '@':   pFontChar = TERMINAL_6X8_AT;            break;
-      case 'A':   pFontChar = TERMINAL_6X8_A;             break;
-      case 'B':   pFontChar = TERMINAL_6X8_B;             break;
-      case 'C':   pFontChar = TERMINAL_6X8_C;             break;
-      case 'D':   pFontChar = TERMINAL_6X8_D;             break;
-      case 'E':   pFontChar = TERMINAL_6X8_E;             break;
-      case 'F':   pFontChar = TERMINAL_6X8_F;             break;
-      case 'G':   pFontChar = TERMINAL_6X8_G;             break;
-      case 'H':   pFontChar = TERMINAL_6X8_H;             break;
-      case 'I':   pFontChar = TERMINAL_6X8_I;             break;
-      case 'J':   pFontChar = TERMINAL_6X8_J;             break;
-      case 'K':   pFontChar = TERMINAL_6X8_K;             break;
-      case 'L':   pFontChar = TERMINAL_6X8_L;             break;
-      case 'M':   pFontChar = TERMINAL_6X8_M;             break;
-      case 'N':   pFontChar = TERMINAL_6X8_N;             break;
-      case 'O':   pFontChar = TERMINAL_6X8_O;             break;
-      case 'P':   pFontChar = TERMINAL_6X8_P;             break;
-      case 'Q':   pFontChar = TERMINAL_6X8_Q;             break;
-      case 'R':   pFontChar = TERMINAL_6X8_R;             break;
-      case 'S':   pFontChar = TERMINAL_6X8_S;             break;
-      case 'T':   pFontChar = TERMINAL_6X8_T;             break;
-      case 'U':   pFontChar = TERMINAL_6X8_U;             break;
-      case 'V':   pFontChar = TERMINAL_6X8_V;             break;
-      case 'W':   pFontChar = TERMINAL_6X8_W;             break;
-      case 'X':   pFontChar = TERMINAL_6X8_X;             break;
-      case 'Y':   pFontChar = TERMINAL_6X8_Y;             break;
-      case 'Z':   pFontChar = TERMINAL_6X8_Z;             break;
-      case '[':   pFontChar = TERMINAL_6X8_OPENBRACKET;   break;
-      case '\\':  pFontChar = TERMINAL_6X8_BACKSLASH;     break;
-      case ']':   pFontChar = TERMINAL_6X8_CLOSEDBRACKET; break;
-      case '^':   pFontChar = TERMINAL_6X8_CARET;         break;
-      case '_':   pFontChar = TERMINAL_6X8_UNDERSCORE;    break;
-      case '`':   pFontChar = TERMINAL_6X8_GRAVE;         break;
-      case 'a':   pFontChar = TERMINAL_6X8_a;             break;
-      case 'b':   pFontChar = TERMINAL_6X8_b;             break;
-      case 'c':   pFontChar = TERMINAL_6X8_c;             break;
-      case 'd':   pFontChar = TERMINAL_6X8_d;             break;
-      case 'e':   pFontChar = TERMINAL_6X8_e;             break;
-      case 'f':   pFontChar = TERMINAL_6X8_f;             break;
-      case 'g':   pFontChar = TERMINAL_6X8_g;             break;
-      case 'h':   pFontChar = TERMINAL_6X8_h;             break;
-      case 'i':   pFontChar = TERMINAL_6X8_i;             break;
-      case 'j':   pFontChar = TERMINAL_6X8_j;             break;
-      case 'k':   pFontChar = TERMINAL_6X8_k;             break;
-      case 'l':   pFontChar = TERMINAL_6X8_l;             break;
-      case 'm':   pFontChar = TERMINAL_6X8_m;             break;
-      case 'n':   pFontChar = TERMINAL_6X8_n;             break;
-      case 'o':   pFontChar = TERMINAL_6X8_o;             break;
-      case 'p':   pFontChar = TERMINAL_6X8_p;             break;
-      case 'q':   pFontChar = TERMINAL_6X8_q;             break;
-      case 'r':   pFontChar = TERMINAL_6X8_r;             break;
-      case 's':   pFontChar = TERMINAL_6X8_s;             break;
-      case 't':   pFontChar = TERMINAL_6X8_t;             break;
-      case 'u':   pFontChar = TERMINAL_6X8_u;             break;
-      case 'v':   pFontChar = TERMINAL_6X8_v;             break;
-      case 'w':   pFontChar = TERMINAL_6X8_w;             break;
-      case 'x':   pFontChar = TERMINAL_6X8_x;             break;
-      case 'y':   pFontChar = TERMINAL_6X8_y;             break;
-      case 'z':   pFontChar = TERMINAL_6X8_z;             break;
-      case '{':   pFontChar = TERMINAL_6X8_OPENBRACE;     break;
-      case '}':   pFontChar = TERMINAL_6X8_CLOSEDBRACE;   break;
-      case '|':   pFontChar = TERMINAL_6X8_VERTBAR;       break;
-      // Print a '?' for an unhandled character as well as for '?'
-      default:    pFontChar = TERMINAL_6X8_QUESTION;      break;
-    }
-    isOk = LCDWriteFont(startPage, currentColumn,
-                        HEIGHT_6X8, WIDTH_6X8,
-                        pFontChar, invert);
-  }
-
-  return isOk;
+  return LCDWriteString( startPage, startColumn, s, &TERMINAL_6X8_FONT, invert );
 } // end function LCDWriteStringTerminal6X8
 
 
@@ -238,121 +643,11 @@ bool LCDWriteStringTerminal6X8( uint8_t startPage, uint8_t startColumn, char s[]
 //          char    s[] - null terminated set of characters to display
 //          bool invert - ? invert video of character ?
 //  OUTPUT: bool - true if procedure succeeded, otherwise false
-//  CALLS : LCDWriteFont
+//  CALLS : LCDWriteString
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool LCDWriteStringTerminal12X16( uint8_t startPage, uint8_t startColumn, char s[], bool invert )
 {
-  // TODO:  Change this function to print up to whichever comes first \0 or a len parameter
-  uint8_t currentColumn;
-  const uint8_t * pFontChar;
-  bool    isOk = true;
-
-  for( currentColumn = startColumn; isOk && (*s != '\0'); currentColumn += WIDTH_12X16, s++ )
-  {
-    switch (*s)
-    {
-      case ' ':   pFontChar = TERMINAL_12X16_SPACE;         break;
-      case '!':   pFontChar = TERMINAL_12X16_EXCLAMATION;   break;
-      case '"':   pFontChar = TERMINAL_12X16_DOUBLEQUOTE;   break;
-      case '#':   pFontChar = TERMINAL_12X16_HASH;          break;
-      case '$':   pFontChar = TERMINAL_12X16_DOLLAR;        break;
-      case '%':   pFontChar = TERMINAL_12X16_PERCENT;       break;
-      case '&':   pFontChar = TERMINAL_12X16_AMPERSAND;     break;
-      case '\'':  pFontChar = TERMINAL_12X16_SINGLEQUOTE;   break;
-      case '(':   pFontChar = TERMINAL_12X16_OPENPAREN;     break;
-      case ')':   pFontChar = TERMINAL_12X16_CLOSEPAREN;    break;
-      case '*':   pFontChar = TERMINAL_12X16_ASTERISK;      break;
-      case '+':   pFontChar = TERMINAL_12X16_PLUS;          break;
-      case ',':   pFontChar = TERMINAL_12X16_COMMA;         break;
-      case '-':   pFontChar = TERMINAL_12X16_MINUS;         break;
-      case '.':   pFontChar = TERMINAL_12X16_PERIOD;        break;
-      case '/':   pFontChar = TERMINAL_12X16_FWDSLASH;      break;
-      case '0':   pFontChar = TERMINAL_12X16_0;             break;
-      case '1':   pFontChar = TERMINAL_12X16_1;             break;
-      case '2':   pFontChar = TERMINAL_12X16_2;             break;
-      case '3':   pFontChar = TERMINAL_12X16_3;             break;
-      case '4':   pFontChar = TERMINAL_12X16_4;             break;
-      case '5':   pFontChar = TERMINAL_12X16_5;             break;
-      case '6':   pFontChar = TERMINAL_12X16_6;             break;
-      case '7':   pFontChar = TERMINAL_12X16_7;             break;
-      case '8':   pFontChar = TERMINAL_12X16_8;             break;
-      case '9':   pFontChar = TERMINAL_12X16_9;             break;
-      case ':':   pFontChar = TERMINAL_12X16_COLON;         break;
-      case ';':   pFontChar = TERMINAL_12X16_SEMICOLON;     break;
-      case '<':   pFontChar = TERMINAL_12X16_LESS;          break;
-      case '=':   pFontChar = TERMINAL_12X16_EQUALS;        break;
-      case '>':   pFontChar = TERMINAL_12X16_GREATER;       break;
-      case '?':   pFontChar = TERMINAL_12X16_QUESTION;      break;
-      case '@':   pFontChar = TERMINAL_12X16_AT;            break;
-      case 'A':   pFontChar = TERMINAL_12X16_A;             break;
-      case 'B':   pFontChar = TERMINAL_12X16_B;             break;
-      case 'C':   pFontChar = TERMINAL_12X16_C;             break;
-      case 'D':   pFontChar = TERMINAL_12X16_D;             break;
-      case 'E':   pFontChar = TERMINAL_12X16_E;             break;
-      case 'F':   pFontChar = TERMINAL_12X16_F;             break;
-      case 'G':   pFontChar = TERMINAL_12X16_G;             break;
-      case 'H':   pFontChar = TERMINAL_12X16_H;             break;
-      case 'I':   pFontChar = TERMINAL_12X16_I;             break;
-      case 'J':   pFontChar = TERMINAL_12X16_J;             break;
-      case 'K':   pFontChar = TERMINAL_12X16_K;             break;
-      case 'L':   pFontChar = TERMINAL_12X16_L;             break;
-      case 'M':   pFontChar = TERMINAL_12X16_M;             break;
-      case 'N':   pFontChar = TERMINAL_12X16_N;             break;
-      case 'O':   pFontChar = TERMINAL_12X16_O;             break;
-      case 'P':   pFontChar = TERMINAL_12X16_P;             break;
-      case 'Q':   pFontChar = TERMINAL_12X16_Q;             break;
-      case 'R':   pFontChar = TERMINAL_12X16_R;             break;
-      case 'S':   pFontChar = TERMINAL_12X16_S;             break;
-      case 'T':   pFontChar = TERMINAL_12X16_T;             break;
-      case 'U':   pFontChar = TERMINAL_12X16_U;             break;
-      case 'V':   pFontChar = TERMINAL_12X16_V;             break;
-      case 'W':   pFontChar = TERMINAL_12X16_W;             break;
-      case 'X':   pFontChar = TERMINAL_12X16_X;             break;
-      case 'Y':   pFontChar = TERMINAL_12X16_Y;             break;
-      case 'Z':   pFontChar = TERMINAL_12X16_Z;             break;
-      case '[':   pFontChar = TERMINAL_12X16_OPENBRACKET;   break;
-      case '\\':  pFontChar = TERMINAL_12X16_BACKSLASH;     break;
-      case ']':   pFontChar = TERMINAL_12X16_CLOSEDBRACKET; break;
-      case '^':   pFontChar = TERMINAL_12X16_CARET;         break;
-      case '_':   pFontChar = TERMINAL_12X16_UNDERSCORE;    break;
-      case '`':   pFontChar = TERMINAL_12X16_GRAVE;         break;
-      case 'a':   pFontChar = TERMINAL_12X16_a;             break;
-      case 'b':   pFontChar = TERMINAL_12X16_b;             break;
-      case 'c':   pFontChar = TERMINAL_12X16_c;             break;
-      case 'd':   pFontChar = TERMINAL_12X16_d;             break;
-      case 'e':   pFontChar = TERMINAL_12X16_e;             break;
-      case 'f':   pFontChar = TERMINAL_12X16_f;             break;
-      case 'g':   pFontChar = TERMINAL_12X16_g;             break;
-      case 'h':   pFontChar = TERMINAL_12X16_h;             break;
-      case 'i':   pFontChar = TERMINAL_12X16_i;             break;
-      case 'j':   pFontChar = TERMINAL_12X16_j;             break;
-      case 'k':   pFontChar = TERMINAL_12X16_k;             break;
-      case 'l':   pFontChar = TERMINAL_12X16_l;             break;
-      case 'm':   pFontChar = TERMINAL_12X16_m;             break;
-      case 'n':   pFontChar = TERMINAL_12X16_n;             break;
-      case 'o':   pFontChar = TERMINAL_12X16_o;             break;
-      case 'p':   pFontChar = TERMINAL_12X16_p;             break;
-      case 'q':   pFontChar = TERMINAL_12X16_q;             break;
-      case 'r':   pFontChar = TERMINAL_12X16_r;             break;
-      case 's':   pFontChar = TERMINAL_12X16_s;             break;
-      case 't':   pFontChar = TERMINAL_12X16_t;             break;
-      case 'u':   pFontChar = TERMINAL_12X16_u;             break;
-      case 'v':   pFontChar = TERMINAL_12X16_v;             break;
-      case 'w':   pFontChar = TERMINAL_12X16_w;             break;
-      case 'x':   pFontChar = TERMINAL_12X16_x;             break;
-      case 'y':   pFontChar = TERMINAL_12X16_y;             break;
-      case 'z':   pFontChar = TERMINAL_12X16_z;             break;
-      case '{':   pFontChar = TERMINAL_12X16_OPENBRACE;     break;
-      case '}':   pFontChar = TERMINAL_12X16_CLOSEDBRACE;   break;
-      case '|':   pFontChar = TERMINAL_12X16_VERTBAR;       break;
-      // Print a '?' for an unhandled character as well as for '?'
-      default:    pFontChar = TERMINAL_12X16_QUESTION;      break;
-    }
-    isOk = LCDWriteFont(startPage, currentColumn,
-                        HEIGHT_12X16, WIDTH_12X16,
-                        pFontChar, invert);
-  }
-  return isOk;
+  return LCDWriteString( startPage, startColumn, s, &TERMINAL_12X16_FONT, invert );
 } // end function LCDWriteStringTerminal12X16
 
 
@@ -366,37 +661,11 @@ bool LCDWriteStringTerminal12X16( uint8_t startPage, uint8_t startColumn, char s
 //          char    s[] - null terminated set of characters to display
 //          bool invert - ? invert video of character ?
 //  OUTPUT: bool - true if procedure succeeded, otherwise false
-//  CALLS : LCDWriteFont
+//  CALLS : LCDWriteString
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 bool LCDWriteStringVerdana34X56( uint8_t startPage, uint8_t startColumn, char s[], bool invert )
 {
-  uint8_t currentColumn;
-  const uint8_t * pFontChar;
-  bool    isOk = true;
-
-  for( currentColumn = startColumn; isOk && (*s != '\0'); currentColumn += WIDTH_34X56, s++ )
-  {
-    switch (*s)
-    {
-      case '0':   pFontChar = VERDANA_34X56_0;        break;
-      case '1':   pFontChar = VERDANA_34X56_1;        break;
-      case '2':   pFontChar = VERDANA_34X56_2;        break;
-      case '3':   pFontChar = VERDANA_34X56_3;        break;
-      case '4':   pFontChar = VERDANA_34X56_4;        break;
-      case '5':   pFontChar = VERDANA_34X56_5;        break;
-      case '6':   pFontChar = VERDANA_34X56_6;        break;
-      case '7':   pFontChar = VERDANA_34X56_7;        break;
-      case '8':   pFontChar = VERDANA_34X56_8;        break;
-      case '9':   pFontChar = VERDANA_34X56_9;        break;
-      // Print a '=' for an unhandled character as well as for '='
-      default:    pFontChar = VERDANA_34X56_SPACE;   break;
-    }
-    isOk = LCDWriteFont(startPage, currentColumn,
-                        HEIGHT_34X56, WIDTH_34X56,
-                        pFontChar, invert);
-  }
-
-  return isOk;
+  return LCDWriteString( startPage, startColumn, s, &VERDANA_34X56_FONT, invert );
 } // end function LCDWriteStringVerdana34X56
 
 
@@ -421,3 +690,66 @@ bool LCDClearScreen(void)
 
   return isOk;
 } // end function LCDClearScreen
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool LCDFlush(void)
+//  Sends the dirty columns of each page of the framebuffer to the LCD, as runs
+//  of display data that bridge gaps of up to LCD_FLUSH_GAP clean columns, and
+//  marks the page clean.  Call once per main loop pass, and before anything
+//  (e.g. Sleep()) that needs the LCD current.
+//  Does nothing when LCD_USE_FRAMEBUFFER is 0 as drawing went to the LCD.
+//
+//  INPUT : NONE
+//  OUTPUT: bool - true if procedure succeeded, otherwise false
+//  CALLS : UC1701XSetPageAddress
+//          UC1701XSetColumnAddress
+//          UC1701XWriteDataRun
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool LCDFlush(void)
+{
+#if (LCD_USE_FRAMEBUFFER == 1)
+  uint8_t page;
+  uint8_t col;
+  uint8_t lo;                               // first & last dirty columns
+  uint8_t hi;                               // of run being sent
+  bool    isPageSet;
+  bool    isOk = true;
+
+  for ( page = 0; isOk && (page < LCD_PAGES); page++ )
+  {
+    isPageSet = false;
+    col       = 0;
+    while ( isOk && (col < LCD_COLUMNS) )
+    {
+      if ( (0 == (col & 7)) && (0xFF == lcdClean[page][col >> 3]) )
+      {                                     // Skip 8 clean columns at once
+        col += 8;
+        continue;
+      }
+      if ( IS_CLEAN( page, col ) )  {
+        col++;
+        continue;                   }
+      lo = hi = col;                        // Extend run while next dirty
+      for ( col++; (col < LCD_COLUMNS) && (col <= hi + LCD_FLUSH_GAP + 1); col++ )
+      {                                     // column is within gap of last
+        if ( ! IS_CLEAN( page, col ) )  {
+          hi = col;                     }
+      }
+      isOk = ( isPageSet || UC1701XSetPageAddress( page ) )
+          && UC1701XSetColumnAddress( lo );
+      if ( isOk )
+      {
+        UC1701XWriteDataRun( &lcdFb[page][lo], hi - lo + 1, false );
+        isPageSet = true;
+      }
+    }
+    if ( isOk )                                           {   // Page now clean
+      memset( lcdClean[page], 0xFF, sizeof(lcdClean[page]) ); }
+  }
+
+  return isOk;
+#else
+  return true;
+#endif
+} // end function LCDFlush
@@ -13,11 +13,18 @@
  *      (3) bool LCDWriteStringTerminal12X16(page, column, string[], invert)
  *      (4) bool LCDWriteStringVerdana34X56(page, column, string[], invert)
  *      (5) bool LCDClearScreen(void)
+ *      (6) bool LCDWriteString(page, column, string[], pFont, invert)
+ *      (7) bool LCDFlush(void)
  *
  *  USE: call
  *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Update framebuffer RAM note for dirty column bitmap
+ *      Add LCD_USE_TEXT_SHADOW switch
+ *      Add LCD_USE_FRAMEBUFFER switch and LCDFlush()
+ *      Add LCDWriteString() to display string in any font_t font
  *    2017/03/31, Robert Kirby, NSWC H12
  *      Change Verdana34X64 to Verdana34X56, saves memory by getting rid of
  *      wasted white space above characters and allows displaying a row of 6X8
@@ -28,10 +35,29 @@
  */
 #include <stdint.h>          /* For uint32_t definition */
 #include <stdbool.h>         /* For true/false definition */
+#include "fonts.h"           /* For font_t definition */
 
 #define LCD_MAX_PAGES (7)
 #define LCD_MAX_COLS (16)   // correct answer is 17 for 6X8 font (102/6 = 17)
 
+// 1: LCDWrite___() draw into a RAM framebuffer and LCDFlush() sends only the
+//    changed columns of each page to the LCD
+// 0: LCDWrite___() write straight to the LCD and LCDFlush() does nothing
+// RAM: framebuffer costs 8 pages x 102 columns = 816 bytes plus 106 bytes of
+//    dirty column bitmap/cursor; 1.6.0.D used 5,616 of 8,192 bytes (69%) of
+//    data RAM, the SPI1 TX queue adds 256, so with framebuffer ~6,794 (83%)
+#ifndef LCD_USE_FRAMEBUFFER
+#define LCD_USE_FRAMEBUFFER (1)
+#endif
+
+// 1: LCDWriteString() remembers the glyph drawn in each 6-column text cell of
+//    each page and skips characters already displayed
+// 0: LCDWriteString() draws every character
+// RAM: 8 pages x 17 cells x 2 bytes = 272 bytes
+#ifndef LCD_USE_TEXT_SHADOW
+#define LCD_USE_TEXT_SHADOW (1)
+#endif
+
 /* LCDWriteFont
  * In: startPage: starting page (row) number on LCD
  *     startColumn: starting column number on LCD
@@ -77,10 +103,28 @@ bool LCDWriteStringTerminal12X16( uint8_t startPage, uint8_t startColumn, char s
  *            at position (startColumn, startPage) */
 bool LCDWriteStringVerdana34X56( uint8_t startPage, uint8_t startColumn, char s[], bool invert );
 
+/* LCDWriteString
+ * In: startPage: starting page (row) number on LCD
+ *     startColumn: starting column number on LCD
+ *     s: char array to be output to LCD
+ *     pFont: font in which to display s (e.g. &TERMINAL_6X8_FONT)
+ *     invert: true to display inverted, false to display normal
+ * Out: Returns true if success, otherwise false (e.g. s clipped at LCD edge)
+ * Function:  The character string specified by s is displayed to the LCD
+ *            at position (startColumn, startPage) one page row at a time */
+bool LCDWriteString( uint8_t startPage, uint8_t startColumn, char s[], const font_t * pFont, bool invert );
+
 /* LCDClearScreen
  * In: N/A
  * Out: Returns true if success, otherwise false
  * Function:  This function clears the LCD screen */
 bool LCDClearScreen( void );
 
+/* LCDFlush
+ * In: N/A
+ * Out: Returns true if success, otherwise false
+ * Function:  Sends the changed column span of each framebuffer page to the
+ *            LCD (does nothing when LCD_USE_FRAMEBUFFER is 0) */
+bool LCDFlush( void );
+
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@
  *
  *      (*) void Tmr2_1SecEventsCb(void)
  *      (*) uint8_t htou8(char * hex)
+ *      (*) void SysTimeToStr(char * str)
  *      (*) void SetWaveformTraits(void)
  *      (*) void PostLtngCmd(void)
  *      (*) bool QueueLtngCmd(cmdid_t cmd, char * param)
@@ -93,6 +94,33 @@
  *
  *  WRITTEN BY    : Robert Kirby, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      plidat_t holds the PLI fix as geopt32_t (HexDegToPt32), and R&B takes
+ *      myLoc and PLI geopt32_t, so no float between D.GLL and the geofence
+ *      or range & bearing
+ *      Format displayed numbers by numfmt.c in place of sprintf() (stdio.h
+ *      dropped); clock text by SysTimeToStr(); btryPctStr fits "100%"
+ *      plidat_t trig set once by AddGdbPliData(), and myLoc trig per fix, for
+ *      CalcRngBrg() in UpdateRngBrgDisplay()
+ *      UpdateDisplayedCoord() renders myLoc lines by RenderCoords(), so only
+ *      the format HOME shows is built, and only when its text would change
+ *      SetMgrsStd() from devCfg.mgrsStd once device config is read
+ *      Only convert and track a D.GLL fix when GeofenceIsDue() says it could be
+ *      past myGeofix margin, given worst-case speed since the last one tracked
+ *      Drop GeofenceInit() from InitSystem(), geozone boxes are now const
+ *      Check D.GLL fix by GeofenceTrack(), reusing myGeofix decision while fix
+ *      moves less than its margin, and holding it near a zone boundary so
+ *      wgmOpt doesn't chatter (queueing repeated CID_CBDC)
+ *      Check D.GLL fix against all geozones via GeofenceEvaluate(), rather
+ *      than against the USA polygon alone; GeofenceInit() in InitSystem()
+ *      AddGdbGenMsg() compare to (char)RTI_FPC, as char is signed, and stop at
+ *      end of gdbMsgQ[].msg
+ *      LCDFlush() LCD framebuffer once per main loop pass and before the LCD
+ *      needs to be current (P-BIT pauses, Sleep())
+ *      Let queued SPI1 LCD transfers finish before Sleep() as SPI1 halts then
+ *      Use Reset() rather than inline asm so main.c also builds on host
+ *      Declare fsetTrait[], txCount and dsplfld_t fsetOpt, txCount used by
+ *      Admin FSET and HOME transmit count work in progress
  *    2021/10/26, Robert Kirby, NSWC H15
  *      More pre-defined waveforms, specifically for 2021/09/28 wf discussion, &
  *      anticipating future growth. Now (AME6|AME8|UWRL|SHLN * Band_1|2|3 * G)
@@ -238,7 +266,6 @@
 #include <ctype.h>          // for isdigit()
 #include <stdbool.h>        // Includes true/false definition
 #include <stdint.h>         // Includes uint16_t definition
-#include <stdio.h>
 #include <string.h>         // for strcmp, memcpy, etc.
 #include <stdlib.h>
 #include "stdint_extended.h"
@@ -251,9 +278,11 @@
 #include "geofence.h"
 #include "i2c2.h"           // functions (or macros) to run I2C in polled mode
 #include "lcd.h"            // for LCD_MAX_COLS etc.
+#include "numfmt.h"         // for FmtUDec() etc. in place of sprintf()
 #include "ltc2943.h"        // for LTC2943_ZERO_PT
 #include "keypad.h"
 #include "queue.h"
+#include "spi1.h"           // for Spi1WaitTxDone()
 #include "tmr2.h"
 #include "uc1701x.h"
 #include "uart.h"
@@ -442,6 +471,8 @@ typedef union tagDISPLAY_FIELD
     uint64_t rngBrg   :1;   // BITU RANGE & BEARING screen
     uint64_t dirY_N   :1;   // BITV Delete INFIL and R&B Y/N option (w/ timeout)
     uint64_t lpmY_N   :1;   // BITW Use Low Power Mode Y/N option
+    uint64_t fsetOpt  :1;   // BITX Admin FSET options screen
+    uint64_t txCount  :1;   // BITY HOME: count of transmissions
   //uint64_t  :1; // BITa follows BITZ
   };              // Any movement of bits requires check/update of defines below
   uint64_t val;
@@ -528,8 +559,8 @@ typedef struct tagPLI_DATA
 { // structure to hold data from D.
   uint16_t age;                 // seconds since PLI info received by ESD
   bool     xof;                 // device TXed old fix data
-  double   lat;                 // 8-hex scaled latitude  converted to double
-  double   lon;                 // 8-hex scaled longitude converted to double
+  geopt32_t pt;                 // 8-hex scaled lat & lon as 0.00001 degree
+  geotrig_t trig;               // sines & cosines of lat & lon for CalcRngBrg
   uint64_t uId;                 // ID as 64-bit unsigned int for easy compares
   char     cId[6+1];            // 6-char ID as native array for display
   char     brev[3+1];           // 3-digit exfil brevity code associate with PLI
@@ -547,6 +578,8 @@ static          esd_t       prevErrFlags = {.val=0};// use to detect changes
 static          ltng_t      ltngBitRpt = {.val=0};  // use for reported BIT
 static          wet_t       wfTrait[N_WFI];     // Waveform drives user options
 #define selWfTrait wfTrait[devCfg.selWfIdx]
+static          wet_t       fsetTrait[15];      // Fset choices (names) for Admin
+static          uint16_t    txCount = 0;        // count of transmissions
 static          char        uKeyName[7] = SP6;  // Unique GDB Key Name
 static          char        gKeyName[7] = SP6;  // Active Group GDB Key Name
 static          char        infKey1[7]  = SP6;  // Infil Group GDB Key 1 Name
@@ -571,6 +604,7 @@ static          uint16byte_t acr={.val=LTC2943_ZERO_PT}; // gas gauge Charge
 static          uint16_t    btryPct = 0;        // remaining battery percent
 static          dsplstat_t  dsplStatus = DS_POR;// enum of POR, ZEROED, etc.
 static          coords_t    myLoc;
+static          geofix16_t  myGeofix;           // geozone decision of myLoc
 static volatile uint16_t    sysSec = 0;         // System/GPS Time's seconds
 static          uint16_t    sysMin = 0;         // System/GPS Time's minutes
 static          uint16_t    sysHr  = 0;         // System/GPS Time's hours
@@ -1061,8 +1095,9 @@ static inline void AddGdbPliData(char * rpt)
     *pD++ = *pS++;                    } // in standard human readable format
   *pD = '\0';                           // then null terminate it for display
 
-  newPli.lat = HexDegToDblDeg(&rpt[34],1);// Covert 8-hexdigit scaled latitude &
-  newPli.lon = HexDegToDblDeg(&rpt[43],0);// longitude for later computations
+  newPli.pt.lat = HexDegToPt32(&rpt[34],1);// Covert 8-hexdigit scaled lat &
+  newPli.pt.lon = HexDegToPt32(&rpt[43],0);// lon for later computations
+  SetGeoTrig(newPli.pt, &newPli.trig);  // once, not per R&B shown
 
   if ((PLI_DAT_Q_LEN-1) <= hiPliIdx)
   {                                     // When the Q is already [over]full
@@ -1138,6 +1173,26 @@ static inline void AddGdbPliData(char * rpt)
 } // end routine AddGdbPliData
 
 
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void SysTimeToStr(char * str)
+//  Formats system time as <HH:MM:SS>, or <HH-MM-SS> when not GPS time.
+//
+//  INPUT : char * str - 9 chars to update
+//  OUTPUT: updates str
+//  CALLS : FmtUDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void SysTimeToStr(char * str)
+{
+  char sep = (sysStat.gpsTime) ? ':' : '-'; // '-' when GPS time not valid
+
+  str    = FmtUDec(str, sysHr,  2, '0');
+  *str++ = sep;
+  str    = FmtUDec(str, sysMin, 2, '0');
+  *str++ = sep;
+  FmtUDec(str, sysSec, 2, '0');
+} // end routine SysTimeToStr
+
+
 //++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  void AddGdbGenMsg(char * rpt) - Add generic/C2 message to Q for INFIL screen
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -1146,11 +1201,7 @@ static inline void AddGdbGenMsg(char * rpt)
   char *pMsg;                     // add D.GID message data to INFIL scrn
   int  i,j;
 
-  sprintf(gdbMsgQ[hdGdbMsgQ].tStamp, "%02u:%02u:%02u", sysHr, sysMin, sysSec);
-  if ( ! sysStat.gpsTime)
-  { // When no valid GPS time replace msg time-stamp's ':' with '-'
-    gdbMsgQ[hdGdbMsgQ].tStamp[2] = gdbMsgQ[hdGdbMsgQ].tStamp[5] = '-';
-  }
+  SysTimeToStr(gdbMsgQ[hdGdbMsgQ].tStamp); // '-' for ':' if not GPS time
 
   if ((GDB_MSG_Q_LEN > numUnrdGdbMsgs) && ( ! gdbMsgQ[hdGdbMsgQ].unread))
   {                   // Only increment unread count if not already maxed and
@@ -1160,7 +1211,8 @@ static inline void AddGdbGenMsg(char * rpt)
   // Fill msg w/<SPACE> chars to clear all old data on display; NULL terminate
   memset((void*)(gdbMsgQ[hdGdbMsgQ].msg), ' ', GDB_MSG_SIZE_MAX-1);
   gdbMsgQ[hdGdbMsgQ].msg[GDB_MSG_SIZE_MAX-1] = '\0';
-  for (i = 0, j = 0, pMsg = &rpt[7];  RTI_FPC != *pMsg;  ++i, ++j, ++pMsg)
+  for (i = 0, j = 0, pMsg = &rpt[7];
+       ((char)RTI_FPC != *pMsg) && (GDB_MSG_SIZE_MAX - 1 > i);  ++i, ++j, ++pMsg)
   { // Copy actual message text from report, stopping on Framing Stop Char
     if (j && (0 == j % LCD_MAX_COLS))
     { // Add in NULL terminator after every 16th char for ease of display
@@ -1311,23 +1363,23 @@ static void ProcessLtngRpt(void)
     }
     else if (NULL != strstr(rpt, "D.GLL"))
     { // process GPS Lat/Lon message -- now accepting only decimal degrees text
+      int16_t isDue = GeofenceIsDue(&myGeofix, aof); // aof: secs since last
       SetCoordsFromDecLatLon(&myLoc, &rpt[7], &rpt[18]);
-      if (COORD_ERR == myLoc.dblLat)
+      if (COORD_ERR_PT == myLoc.pt.lat)
       {
         esdErrFlags.ltng = 1;
       }
       else if (WGM_OVRDN < devCfg.geoMuting)
       { // When waveform has geo-mute that isn't overridden, check if 'in zone'
-        geopt16_t curPt;
-        CoordsToGeopt16(&myLoc, &curPt);
-        wgm_t wgm = WGM_OUTGZ;        // most of world is outside of geozone
-        //llurzone16_t geoRect = USA_LLUR16;
-        //if (TestInsideLlUrZone(curPt, geoRect))
-        {
-          static polyzone16_t usaPoly = {.n = USA_NUM_PTS, .v = USA_VERTICES};
-          if (TestInsidePolygonZone(curPt, &usaPoly)) {
-            wgm = WGM_ACTVD;                          }
+        wgm_t wgm = WGM_OUTGZ;        // most of world is outside of geozones
+        if (isDue)
+        { // Fix could be past myGeofix margin (else held decision stands)
+          geopt16_t curPt;
+          CoordsToGeopt16(&myLoc, &curPt);
+          GeofenceTrack(curPt, &myGeofix);      // w/hysteresis
         }
+        if (GZ_NONE != myGeofix.zone) {
+          wgm = WGM_ACTVD;            }
         if (wgm != selWfTrait.wgmOpt)
         { // Update wfTrait, various screen fields, and MUTE TX if appropriate
           selWfTrait.wgmOpt = wgm;
@@ -1524,7 +1576,7 @@ static void ProcessLtngRpt(void)
 //          ReadGasGaugeFromNvMem
 ////          Si7021ReadRelativeHumidityHoldMasterMode
 ////          Si7021ReadTemperatureHoldMasterMode
-//          sprintf
+//          FmtHex2
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 static void UpdateSysCheckDisplay(void)
 {
@@ -1542,6 +1594,7 @@ static void UpdateSysCheckDisplay(void)
     if ( ! sysStat.cfgInit)
     {
       LCDWriteStringTerminal6X8(3, 0, "NVMEM Read/Write ", false);
+      LCDFlush();
       ReadCfgFromNvMem();
       if (OS_ZEROED == devCfg.opStat)
       {                                 // Act immediately if opStat is zeroed
@@ -1550,6 +1603,8 @@ static void UpdateSysCheckDisplay(void)
           LTG_VLTG_EN = 0;              // turn off Lightning
           SET_BKLT_OFF();               // turn off backlight
           LCDClearScreen();             // clear LCD of all text
+          LCDFlush();
+          Spi1WaitTxDone();             // and let it reach the LCD, then
           mGlobalIntDisable();          // disable all IRQs that could wake
           Sleep();                      // processor which want only to sleep
         } while (1);                    // and thus execute no more
@@ -1565,6 +1620,7 @@ static void UpdateSysCheckDisplay(void)
           (MAX_WF < devCfg.selWfChar)){ // or invalid wf selection in config
         esdErrFlags.nvmem = 1;        } // flag a config memory error.
       selWfTrait.wgmOpt = devCfg.geoMuting; // Set geo-muting mode
+      SetMgrsStd(devCfg.mgrsStd);       // Set MGRS standard in use
       #if (BOOT_MUTE == 1)              // Two user groups requested BOOT_MUTE
         devCfg.txDtyCy = TDC_MUTE;      // so always override any other setting
       #endif                            // when defined to function that way
@@ -1659,7 +1715,7 @@ static void UpdateSysCheckDisplay(void)
       if (ltngBitRpt.hwF || esdErrFlags.hwF)
       {
         char esdHwCode[3];
-        sprintf(esdHwCode, "%02X", esdErrFlags.hwF);
+        FmtHex2(esdHwCode, esdErrFlags.hwF);
         LCDWriteStringTerminal6X8(4, WIDTH_6X8, "SYSHW....0x", false);
         LCDWriteStringTerminal6X8(4, (12*WIDTH_6X8), ltngHwCode,false);
         LCDWriteStringTerminal6X8(4, (14*WIDTH_6X8), esdHwCode, false);
@@ -1672,7 +1728,7 @@ static void UpdateSysCheckDisplay(void)
       if (ltngBitRpt.fwF || esdErrFlags.fwF)
       {
         char esdFwCode[3];
-        sprintf(esdFwCode, "%02X", esdErrFlags.fwF);
+        FmtHex2(esdFwCode, esdErrFlags.fwF);
         LCDWriteStringTerminal6X8(5, WIDTH_6X8, "SYSFW....0x", false);
         LCDWriteStringTerminal6X8(5, (12*WIDTH_6X8), ltngFwCode, false);
         LCDWriteStringTerminal6X8(5, (14*WIDTH_6X8), esdFwCode, false);
@@ -1691,6 +1747,7 @@ static void UpdateSysCheckDisplay(void)
 
       updtFld.sysChk = 0;               // Field/screen updated so clear flag
     }
+    LCDFlush();
     __delay_ms(150);                    // some delay to see display but not
   }                                     // enough to overflow ltngRptQ
 } // end routine UpdateSysCheckDisplay
@@ -1862,7 +1919,7 @@ static void UpdateExfilCtdnDisplay(void)
   }                                     // timing (wf change as BOLT TX ready!)
                                         // while not resulting in an overflow of
   char ctdnStr[3];                      // two digits plus NULL terminator to
-  sprintf(ctdnStr, "%02d", scrnCtdn);   // display 60,59,...,01 countdown
+  FmtUDec(ctdnStr, scrnCtdn, 2, '0'); // display 60,59,...,01 countdown
   LCDWriteStringTerminal12X16(4, 39, ctdnStr, false);
 
   if (9 == scrnCtdn)                    // After BOLT had 45+ seconds to reset
@@ -1983,8 +2040,8 @@ static void UpdateDisplayedTXCount(void)
 {
   if (updtFld.txCount)
   {
-    char txCountStr[10];
-    sprintf(txCountStr, "TX: %d", txCount);
+    char txCountStr[10] = "TX: ";
+    FmtUDec(&txCountStr[4], txCount, 0, ' ');
     LCDWriteStringTerminal6X8(5, 66, txCountStr, false);
     updtFld.txCount = 0;                // Field updated so clear flag
   }
@@ -1998,27 +2055,15 @@ static void UpdateDisplayedTXCount(void)
 static void UpdateDisplayedCoord(void)
 {
   if (updtFld.coord)
-  { // lat/lon from Lightning or MGRS should already be in their attributes
+  { // lines formatted here, and only when what they show changed
     bool invCoord;
 
     // Once age of fix is critical flash coordinates each second
     invCoord = ((CRIT_AOF <= aof) && (sysSec & 0x01));
 
-    if (CS_DMS == devCfg.cSysSet)
-    {
-      LCDWriteStringTerminal6X8(0, 0, myLoc.dmsLat, invCoord);
-      LCDWriteStringTerminal6X8(1, 0, myLoc.dmsLon, invCoord);
-    }
-    else if (CS_DEC == devCfg.cSysSet)
-    {
-      LCDWriteStringTerminal6X8(0, 0, myLoc.decLat, invCoord);
-      LCDWriteStringTerminal6X8(1, 0, myLoc.decLon, invCoord);
-    }
-    else // CS_MGRS
-    {
-      LCDWriteStringTerminal6X8(0, 0, myLoc.mgrsGzd, invCoord);
-      LCDWriteStringTerminal6X8(1, 0, myLoc.mgrs10m, invCoord);
-    }
+    RenderCoords(&myLoc, (coordfmt_t)devCfg.cSysSet);
+    LCDWriteStringTerminal6X8(0, 0, myLoc.memo.line[0], invCoord);
+    LCDWriteStringTerminal6X8(1, 0, myLoc.memo.line[1], invCoord);
     updtFld.coord = 0;                  // Field updated so clear flag
   }
 } // end routine UpdateDisplayedCoord
@@ -2047,7 +2092,8 @@ static void UpdateDisplayedBitIcon(void)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 static void UpdateDisplayedPwrStat(void)
 {
-  char btryPctStr[4];
+  char btryPctStr[5];                   // "100%" plus NULL terminator
+  char *pS;
 
   if (updtFld.pwr)
   {
@@ -2083,7 +2129,9 @@ static void UpdateDisplayedPwrStat(void)
         default:  pFontChar = BATTERY_18X8_0;
       }
       LCDWriteFont(0,82,HEIGHT_18X8,WIDTH_18X8,pFontChar,invGa);
-      sprintf(btryPctStr, "%3u%%", btryPct);
+      pS    = FmtUDec(btryPctStr, btryPct, 3, ' ');
+      *pS++ = '%';
+      *pS   = '\0';
       LCDWriteStringTerminal6X8(1, 76, btryPctStr, invGa);
 
       if (esdErrFlags.gasGa)
@@ -2115,11 +2163,7 @@ static void UpdateDisplayedSysTime(void)
   if (updtFld.time)
   {
     char timeString[9];
-    sprintf(timeString, "%02u:%02u:%02u", sysHr, sysMin, sysSec);
-    if ( ! sysStat.gpsTime)
-    { // when GPS not valid replace the two ':' in time with '-'
-      timeString[2] = timeString[5] = '-';
-    }
+    SysTimeToStr(timeString);           // '-' for ':' when GPS not valid
     LCDWriteStringTerminal12X16(3, 3, timeString, false);
     updtFld.time = 0;                   // Field updated so clear flag
   }
@@ -2180,7 +2224,7 @@ static void UpdateDisplayedMailIcon(void)
       LCDWriteStringTerminal6X8(7, ENV_COL, ENVELOPE_STR, rvEnv);
       if (FP_GDB == focusPoint)
       {
-        sprintf(cntStr, "%2u", numUnrdGdbMsgs);
+        FmtUDec(cntStr, numUnrdGdbMsgs, 2, ' ');
         LCDWriteStringTerminal6X8(7, CNT_COL, cntStr, false);
       }
     }
@@ -2215,6 +2259,7 @@ static void UpdateDisplayedAof(void)
   {
     char timeUnit;
     char aofString[7] = "      ";
+    char *pS;
     if (sysStat.aofValid)
     {
       uint16_t scaledAof;
@@ -2233,7 +2278,10 @@ static void UpdateDisplayedAof(void)
         timeUnit  = 's';
         scaledAof = aof;
       }
-      sprintf(aofString, "aof%2u%c", scaledAof, timeUnit);
+      strcpy(aofString, "aof");
+      pS    = FmtUDec(&aofString[3], scaledAof, 2, ' ');
+      *pS++ = timeUnit;
+      *pS   = '\0';
     }
     LCDWriteStringTerminal6X8(6, 66, aofString, false);
     updtFld.aof = 0;                    // Field updated so clear flag
@@ -2250,6 +2298,7 @@ static void UpdateDisplayedOpStatus(void)
   if (updtFld.ops)
   {
     char ctdnStr[8];
+    char *pS;
     switch (dsplStatus)
     {
       case DS_POR:
@@ -2265,10 +2314,17 @@ static void UpdateDisplayedOpStatus(void)
         LCDWriteStringTerminal6X8(7, 66, "   XMT", false);
         break;
       case DS_CTDN:
-        if (nbeHr == 0 && nbeMin == 0 && nbeSec < 31)         { // display only
-          sprintf(ctdnStr, "X  %02us", nbeSec);               } // reasonable
-        else                                                  { // countdown, is
-          sprintf(ctdnStr, " SLEEP");                         } // truly asleep
+        if (nbeHr == 0 && nbeMin == 0 && nbeSec < 31)
+        { // display only reasonable countdown
+          strcpy(ctdnStr, "X  ");
+          pS    = FmtUDec(&ctdnStr[3], (uint16_t)nbeSec, 2, '0');
+          *pS++ = 's';
+          *pS   = '\0';
+        }
+        else
+        { // is truly asleep
+          strcpy(ctdnStr, " SLEEP");
+        }
         LCDWriteStringTerminal6X8(7, 66, ctdnStr, false);
         break;
       case DS_GDB:
@@ -2388,7 +2444,9 @@ static void UpdateDisplayedGdbXY(void)
       curMsg = (dsplGdbMsg >= tlGdbMsgQ)
              ? (dsplGdbMsg - tlGdbMsgQ + 1)
              : (GDB_MSG_Q_LEN - tlGdbMsgQ + dsplGdbMsg + 1);
-      sprintf(gdbXY, "%02u/%02u", curMsg, numGdbMsgs);
+      char *pS = FmtUDec(gdbXY, curMsg, 2, '0');
+      *pS++    = '/';
+      FmtUDec(pS, numGdbMsgs, 2, '0');
     }
     LCDWriteStringTerminal6X8(7, (12*WIDTH_6X8), gdbXY , false);
     updtFld.gdbXY = 0;                  // Field updated so clear flag
@@ -2449,9 +2507,8 @@ void UpdateRngBrgDisplay(void)
       char rng[4] = {0,0,0,0};          // 3-char range + NULL terminator
       char brg[4] = {0,0,0,0};          // 3-char bearing + NULL terminator
       char tmp[2] = {0,0};              // 1-char temporary + NULL terminator
-      bool kmRng  = CalcRngBrg(myLoc.dblLat, myLoc.dblLon,
-                               pliDatQ[dsplPliIdx].lat, pliDatQ[dsplPliIdx].lon,
-                               rng, brg);
+      bool kmRng  = CalcRngBrg(myLoc.pt, &myLoc.trig, pliDatQ[dsplPliIdx].pt,
+                               &pliDatQ[dsplPliIdx].trig, rng, brg);
 
       LCDClearScreen();
       *tmp = pliDatQ[dsplPliIdx].cId[0];
@@ -2750,8 +2807,8 @@ static void UpdateWfNameDisplay(void)
     LCDWriteStringTerminal6X8(5, 5*WIDTH_6X8, SEL_TXID, false);
 
     // Display the Fset value under the TX ID
-    char fsetStr[10];
-    sprintf(fsetStr, "Fset: %d", devCfg.fset); // Assuming devCfg.fset holds the Fset value
+    char fsetStr[12] = "Fset: ";
+    FmtUDec(&fsetStr[6], devCfg.fset, 0, ' '); // Assuming devCfg.fset holds the Fset value
     LCDWriteStringTerminal6X8(7, 5*WIDTH_6X8, fsetStr, false);
 
     updtFld.wfInfo = 0;
@@ -3255,7 +3312,7 @@ static void ProcessTimeEvents(void)
           break;
 
         case FP_ZERO_A:                 // Zeroize work should be finished
-          __asm__ volatile ("reset");   // perform software reset of PIC uC
+          Reset();                      // perform software reset of PIC uC
           break;
 
         default:
@@ -4766,6 +4823,7 @@ static void PrepForSleep(void)
   LTG_CLOSE_UART();
   LTG_VLTG_EN = 0;
   LCDClearScreen();
+  LCDFlush();
   SET_BKLT_OFF();
   LCD_SLEEP_MODE();
   EndTmr2Srvc();
@@ -4784,6 +4842,7 @@ static void PrepForSleep(void)
   muteSquawkCtdn  = 0;                  // If in MUTE, wakeup w/o TX expectation
   dsplStatus      = DS_POR;             // enum of POR, ZEROED, etc.
   ClearCoords(&myLoc);                  // Clear out myLoc GPS fix related data
+  GeofenceClearFix(&myGeofix);          // and its geozone decision
   sysSec          = 0;                  // System/GPS Time's seconds
   sysMin          = 0;                  // System/GPS Time's minues
   sysHr           = 0;                  // System/GPS Time's hours
@@ -4878,6 +4937,7 @@ static void UpdateDisplay(void)
       mGlobalIntDisable();              // Disable IRQs so we can safely
       doNotSleep = false;               // clear doNotSleep (to Sleep() below)
       PrepForSleep();                   // and now prepare to sleep deeply.
+      Spi1WaitTxDone();                 // LCD updates must finish before Sleep
       StartKeypadWakeOps();             // Future keypad wake ops ISR sets flag
       while ( ! doNotSleep)             // that we check to break sleep cycle.
       {                                 // Loop here while no PWR button input
@@ -5125,6 +5185,7 @@ static void InitSystem(void)
   memset((void*)&gdbMsgQ, 0, sizeof(gdbMsgQ));
   memset((void*)&pliDatQ, 0, sizeof(pliDatQ));
   ClearCoords(&myLoc);
+  GeofenceClearFix(&myGeofix);
   QUEUE_INIT_EMPTY(cidQ, cidBfr, CID_Q_LEN);
   QUEUE_INIT_EMPTY(ltngRptQ, ltngRptBfr, LTNG_RPT_BFR_LEN);
 
@@ -5175,6 +5236,7 @@ static void InitSystem(void)
 //          ProcessLtngData
 //          ProcessErrors
 //          UpdateDisplay
+//          LCDFlush
 //          Idle
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*--*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 int16_t main(void)
@@ -5187,6 +5249,7 @@ int16_t main(void)
     ProcessLtngData();                  // and let GDB data over-ride scr focus
     ProcessErrors();                    // and let errors over-ride all else
     UpdateDisplay();                    // and now ready to update displayed UI
+    LCDFlush();                         // then send what changed to the LCD.
                                         // IRQ and processes set flag doNotSleep
     mGlobalIntDisable();                // Disable IRQs so we can safely
     while ( ! doNotSleep)               // check if have pressing tasking.
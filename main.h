@@ -13,6 +13,10 @@
  *
  *  WRITTEN BY    : Robert Kirby, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add devcfg_t mgrsStd, MGRS standard selected at run time
+ *      Move USA_NUM_PTS, USA_VERTICES, and USA_LLUR16 to geozones.h
+ *      Add devcfg_t fset and selFset for Admin FSET work in progress
  *    2021/10/10, Robert Kirby, NSWC H12
  *      Add option to display GPS coordinates as decimal degrees (+DDD.ddddd)
  *      Move txdtycy_t to bt_waveform_traits.h (from main.h and LTNG bt_intfc.h)
@@ -185,41 +189,15 @@ typedef struct tagDEVICE_CONFIGURATION_PARAMS
   wgm_t       geoMuting;            // NA,NEVER,OVRDN,ACTVD (devCfg never OUTGZ)
   txpwr_t     txPwr;                // HIGH, FULL
   txdtycy_t   txDtyCy;              // MUTE, SLOW, AUTO, HIGH
+  uint16_t    fset;                 // active Fset
+  uint16_t    selFset;              // Fset selected on Admin FSET screen
+  uint16_t    mgrsStd;              // MGRS_1989 or MGRS_2014 (see coords.h)
 } devcfg_t;
 #define FW_KEY  0x23DC              // arbitrary firmware key
 #define FKLB    (FW_KEY & 0x00FF)   // low byte of firmware key
 #define FKHB    (FW_KEY >> 8)       // high byte of firmware key
 
 
-//Polygon covering zone ~1,000 miles around USA/N.Am
-#define USA_NUM_PTS 15  // # of points that make zone (but v[] has n+1 points)
-#define USA_VERTICES                                                          \
-{                       /* LAT LSB = 0.002746666, LON LSB = 0.005493332   */  \
-  {0x71C6, 0xE38E},     /*  80.0000,  -40.0000 Polar region above N.Am    */  \
-  {0x71C6, 0x87A6},     /*  80.0000, -169.2500 n.Greenland to nw of Alaska*/  \
-  {0x5C78, 0x87A6},     /*  65.0189, -169.2500 Tap onto Int'l Date Line   */  \
-  {0x4AEE, 0x78EC},     /*  52.6863,  170.0500 Follow Int'l Date Line     */  \
-  {0x4408, 0x8001},     /*  47.8353, -180.0000 Follow Int'l Date Line     */  \
-  {0x4408, 0x98E4},     /*  47.8353, -145.0000 Cut back toward coast to   */  \
-  {0x31C7, 0x98E4},     /*  35.0000, -145.0000 uncover off WA, OR, & n.CA */  \
-  {0x31C7, 0x8001},     /*  35.0000, -180.0000 Cut back west to cover     */  \
-  {0x1C72, 0x8001},     /*  20.0000, -180.0000 area around Midway Island  */  \
-  {0x071C, 0x91C8},     /*   5.0000, -155.0000 and dip south of Hawaii    */  \
-  {0x1555, 0x9C73},     /*  15.0000, -140.0000 Bump back north a tad to   */  \
-  {0x1555, 0xDC72},     /*  15.0000,  -50.0000 go east thru Caribbean     */  \
-  {0x238E, 0xD1C7},     /*  25.0000,  -65.0000 Cover PR as zig toward FL  */  \
-  {0x31C7, 0xD8E4},     /*  35.0000,  -55.0000 and zag from NC as continue*/  \
-  {0x4000, 0xE38E},     /*  45.0000,  -40.0000 n.e. past Nova Scotia      */  \
-  {0x71C6, 0xE38E}      /*  80.0000,  -40.0000 Then back to n.Greenland   */  \
-}                       /* Note that first & last points must be the same */
-
-// Lower-Left/Upper-Right 'rectangle' container for USA_POLYZONE16
-#define USA_LLUR16                                                            \
-{                       /* rectangular bounds of USA_POLYZONE16           */  \
-  .ll = {0x071C,0x78EB},/*   5.0000,  170.0500 Lower Left                 */  \
-  .ur = {0x71C6,0xE38E} /*  80.0000,  -40.0000 Upper Right                */  \
-}
-
 //----- EXPOSED ATRRIBUTES -----------------------------------------------------
 extern esd_t      volatile esdErrFlags;     // detected ESD system errors
 
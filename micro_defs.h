@@ -11,6 +11,8 @@
  *
  *  WRITTEN BY    : Robert Kirby, NSWC Z17
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add SPI1PRI for interrupt driven LCD transfers
  *    2019/08/13, Robert Kirby, NSWC H12
  *      Stub out code for obsolete SI7021 Temperature & Humidity sensor IC
  *    2017/03/24, Robert Kirby, NSWC H12
@@ -88,6 +90,7 @@ typedef void (*pvfv_t)(void);       // define function pointer to "void foo(void
 #define INT2PRI     4             // External INT2 (PWR button)
 #define T2PRI       4             // Timer2 (16-bit)
 #define T3PRI       4             // Timer3 (16-bit)
+#define SPI1PRI     3             // SPI1 general (LCD TX) below UART & keys
 
 
 //XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=config_memory.c configuration_bits.c crc.c fonts.c i2c2.c interrupts.c keypad.c lcd.c ltc2943.c main.c queue.c tmr2.c traps.c uart1_queued.c uc1701x.c coords.c mc24aa512_i2c2.c geofence.c
+SOURCEFILES_QUOTED_IF_SPACED=config_memory.c configuration_bits.c crc.c fonts.c i2c2.c interrupts.c keypad.c lcd.c ltc2943.c main.c queue.c tmr2.c traps.c uart1_queued.c uc1701x.c coords.c mc24aa512_i2c2.c geofence.c numfmt.c cordic.c spi1.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/config_memory.o ${OBJECTDIR}/configuration_bits.o ${OBJECTDIR}/crc.o ${OBJECTDIR}/fonts.o ${OBJECTDIR}/i2c2.o ${OBJECTDIR}/interrupts.o ${OBJECTDIR}/keypad.o ${OBJECTDIR}/lcd.o ${OBJECTDIR}/ltc2943.o ${OBJECTDIR}/main.o ${OBJECTDIR}/queue.o ${OBJECTDIR}/tmr2.o ${OBJECTDIR}/traps.o ${OBJECTDIR}/uart1_queued.o ${OBJECTDIR}/uc1701x.o ${OBJECTDIR}/coords.o ${OBJECTDIR}/mc24aa512_i2c2.o ${OBJECTDIR}/geofence.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/config_memory.o.d ${OBJECTDIR}/configuration_bits.o.d ${OBJECTDIR}/crc.o.d ${OBJECTDIR}/fonts.o.d ${OBJECTDIR}/i2c2.o.d ${OBJECTDIR}/interrupts.o.d ${OBJECTDIR}/keypad.o.d ${OBJECTDIR}/lcd.o.d ${OBJECTDIR}/ltc2943.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/queue.o.d ${OBJECTDIR}/tmr2.o.d ${OBJECTDIR}/traps.o.d ${OBJECTDIR}/uart1_queued.o.d ${OBJECTDIR}/uc1701x.o.d ${OBJECTDIR}/coords.o.d ${OBJECTDIR}/mc24aa512_i2c2.o.d ${OBJECTDIR}/geofence.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/config_memory.o ${OBJECTDIR}/configuration_bits.o ${OBJECTDIR}/crc.o ${OBJECTDIR}/fonts.o ${OBJECTDIR}/i2c2.o ${OBJECTDIR}/interrupts.o ${OBJECTDIR}/keypad.o ${OBJECTDIR}/lcd.o ${OBJECTDIR}/ltc2943.o ${OBJECTDIR}/main.o ${OBJECTDIR}/queue.o ${OBJECTDIR}/tmr2.o ${OBJECTDIR}/traps.o ${OBJECTDIR}/uart1_queued.o ${OBJECTDIR}/uc1701x.o ${OBJECTDIR}/coords.o ${OBJECTDIR}/mc24aa512_i2c2.o ${OBJECTDIR}/geofence.o ${OBJECTDIR}/numfmt.o ${OBJECTDIR}/cordic.o ${OBJECTDIR}/spi1.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/config_memory.o.d ${OBJECTDIR}/configuration_bits.o.d ${OBJECTDIR}/crc.o.d ${OBJECTDIR}/fonts.o.d ${OBJECTDIR}/i2c2.o.d ${OBJECTDIR}/interrupts.o.d ${OBJECTDIR}/keypad.o.d ${OBJECTDIR}/lcd.o.d ${OBJECTDIR}/ltc2943.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/queue.o.d ${OBJECTDIR}/tmr2.o.d ${OBJECTDIR}/traps.o.d ${OBJECTDIR}/uart1_queued.o.d ${OBJECTDIR}/uc1701x.o.d ${OBJECTDIR}/coords.o.d ${OBJECTDIR}/mc24aa512_i2c2.o.d ${OBJECTDIR}/geofence.o.d ${OBJECTDIR}/numfmt.o.d ${OBJECTDIR}/cordic.o.d ${OBJECTDIR}/spi1.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/config_memory.o ${OBJECTDIR}/configuration_bits.o ${OBJECTDIR}/crc.o ${OBJECTDIR}/fonts.o ${OBJECTDIR}/i2c2.o ${OBJECTDIR}/interrupts.o ${OBJECTDIR}/keypad.o ${OBJECTDIR}/lcd.o ${OBJECTDIR}/ltc2943.o ${OBJECTDIR}/main.o ${OBJECTDIR}/queue.o ${OBJECTDIR}/tmr2.o ${OBJECTDIR}/traps.o ${OBJECTDIR}/uart1_queued.o ${OBJECTDIR}/uc1701x.o ${OBJECTDIR}/coords.o ${OBJECTDIR}/mc24aa512_i2c2.o ${OBJECTDIR}/geofence.o
+OBJECTFILES=${OBJECTDIR}/config_memory.o ${OBJECTDIR}/configuration_bits.o ${OBJECTDIR}/crc.o ${OBJECTDIR}/fonts.o ${OBJECTDIR}/i2c2.o ${OBJECTDIR}/interrupts.o ${OBJECTDIR}/keypad.o ${OBJECTDIR}/lcd.o ${OBJECTDIR}/ltc2943.o ${OBJECTDIR}/main.o ${OBJECTDIR}/queue.o ${OBJECTDIR}/tmr2.o ${OBJECTDIR}/traps.o ${OBJECTDIR}/uart1_queued.o ${OBJECTDIR}/uc1701x.o ${OBJECTDIR}/coords.o ${OBJECTDIR}/mc24aa512_i2c2.o ${OBJECTDIR}/geofence.o ${OBJECTDIR}/numfmt.o ${OBJECTDIR}/cordic.o ${OBJECTDIR}/spi1.o
 
 # Source Files
-SOURCEFILES=config_memory.c configuration_bits.c crc.c fonts.c i2c2.c interrupts.c keypad.c lcd.c ltc2943.c main.c queue.c tmr2.c traps.c uart1_queued.c uc1701x.c coords.c mc24aa512_i2c2.c geofence.c
+SOURCEFILES=config_memory.c configuration_bits.c crc.c fonts.c i2c2.c interrupts.c keypad.c lcd.c ltc2943.c main.c queue.c tmr2.c traps.c uart1_queued.c uc1701x.c coords.c mc24aa512_i2c2.c geofence.c numfmt.c cordic.c spi1.c
 
 
 CFLAGS=
@@ -219,6 +219,27 @@ ${OBJECTDIR}/geofence.o: geofence.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/geofence.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  geofence.c  -o ${OBJECTDIR}/geofence.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/geofence.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
 	@${FIXDEPS} "${OBJECTDIR}/geofence.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/numfmt.o: numfmt.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/numfmt.o.d 
+	@${RM} ${OBJECTDIR}/numfmt.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  numfmt.c  -o ${OBJECTDIR}/numfmt.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/numfmt.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/numfmt.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/cordic.o: cordic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/cordic.o.d 
+	@${RM} ${OBJECTDIR}/cordic.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  cordic.c  -o ${OBJECTDIR}/cordic.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/cordic.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/cordic.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/spi1.o: spi1.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/spi1.o.d 
+	@${RM} ${OBJECTDIR}/spi1.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  spi1.c  -o ${OBJECTDIR}/spi1.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/spi1.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD3=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/spi1.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 else
 ${OBJECTDIR}/config_memory.o: config_memory.c  nbproject/Makefile-${CND_CONF}.mk
@@ -346,6 +367,27 @@ ${OBJECTDIR}/geofence.o: geofence.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/geofence.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  geofence.c  -o ${OBJECTDIR}/geofence.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/geofence.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
 	@${FIXDEPS} "${OBJECTDIR}/geofence.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/numfmt.o: numfmt.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/numfmt.o.d 
+	@${RM} ${OBJECTDIR}/numfmt.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  numfmt.c  -o ${OBJECTDIR}/numfmt.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/numfmt.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/numfmt.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/cordic.o: cordic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/cordic.o.d 
+	@${RM} ${OBJECTDIR}/cordic.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  cordic.c  -o ${OBJECTDIR}/cordic.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/cordic.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/cordic.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+
+${OBJECTDIR}/spi1.o: spi1.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/spi1.o.d 
+	@${RM} ${OBJECTDIR}/spi1.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  spi1.c  -o ${OBJECTDIR}/spi1.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/spi1.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mfillupper=255 -msmall-code -mconst-in-code -O0 -funroll-loops -fomit-frame-pointer -mcci -msmart-io=1 -Werror -Wall -msfr-warn=off -mno-override-inline 
+	@${FIXDEPS} "${OBJECTDIR}/spi1.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
 endif
 
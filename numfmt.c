@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : numfmt.c
+ *
+ *  DESCRIPTION   : Formats numbers as display text into caller buffers, in
+ *    place of sprintf() (see numfmt.h).
+ *
+ *      (*) char * PutDec(char * dst, uint32_t val, uint8_t width, char pad,
+ *                        char sign)
+ *      (1) char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad)
+ *      (2) char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad)
+ *      (3) char * FmtHex2(char * dst, uint8_t val)
+ *      (4) char * FmtFixed(char * dst, uint32_t val, uint8_t width,
+ *                          uint8_t frac)
+ *      (5) char * FmtGrid(char * dst, uint16_t easting, uint16_t northing)
+ *      (6) char * FmtPadRight(char * dst, const char * src, uint8_t width)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+#include <stdint.h>
+#include "numfmt.h"
+
+
+//----- MODULE DEFINES ---------------------------------------------------------
+#define DEC_DIGITS_MAX  (10)        // of a uint32_t
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * PutDec(char * dst, uint32_t val, uint8_t width, char pad, char sign)
+//  Writes decimal val right justified in width chars, sign (if any) ahead of
+//  '0' padding or after ' ' padding, as printf does.  Digits of val above 16
+//  bits are split off in 32-bit math, the rest in 16-bit math.
+//
+//  INPUT : char *  dst   - buffer to write
+//          uint32_t val  - magnitude to write
+//          uint8_t width - least chars to write, including sign
+//          char    pad   - fill ('0' or ' ')
+//          char    sign  - '-' or '\0' for none
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static char * PutDec(char * dst, uint32_t val, uint8_t width, char pad,
+                     char sign)
+{
+  char     digits[DEC_DIGITS_MAX];  // least significant first
+  uint8_t  n = 0;
+  uint16_t v16;
+
+  while (0xFFFF < val)
+  {
+    uint32_t q = val / 10;
+    digits[n++] = '0' + (char)(val - (q * 10));
+    val = q;
+  }
+  v16 = (uint16_t)val;
+  do
+  {
+    digits[n++] = '0' + (char)(v16 % 10);
+    v16 /= 10;
+  } while (v16);
+
+  if (sign)                   {
+    n++;                      }     // sign counts toward width
+  width = (width > n) ? (width - n) : 0;
+  if (sign && ('0' == pad))   {
+    *dst++ = sign;            }
+  for ( ; width; width--)     {
+    *dst++ = pad;             }
+  if (sign)
+  {
+    if ('0' != pad)           {
+      *dst++ = sign;          }
+    n--;
+  }
+  while (n)                   {
+    *dst++ = digits[--n];     }
+  *dst = '\0';
+  return dst;
+} // end function PutDec
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad)
+//  Unsigned decimal, right justified in width chars padded by pad.
+//
+//  INPUT : char *  dst   - buffer to write (width or digits, plus NULL)
+//          uint32_t val  - value to write
+//          uint8_t width - least chars to write (0 or 1 for just the digits)
+//          char    pad   - fill left of the digits ('0' or ' ')
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : PutDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad)
+{
+  return PutDec(dst, val, width, pad, '\0');
+} // end function FmtUDec
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad)
+//  Signed decimal, right justified in width chars padded by pad.
+//
+//  INPUT : char *  dst   - buffer to write (width or sign & digits, plus NULL)
+//          int32_t val   - value to write
+//          uint8_t width - least chars to write, including any '-'
+//          char    pad   - fill ('0' or ' ')
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : PutDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad)
+{
+  if (0 > val)                                            { // -INT32_MIN too
+    return PutDec(dst, 0 - (uint32_t)val, width, pad, '-'); }
+  return PutDec(dst, (uint32_t)val, width, pad, '\0');
+} // end function FmtSDec
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtHex2(char * dst, uint8_t val)
+//  Two upper case hex digits.
+//
+//  INPUT : char *  dst - buffer to write (3 chars)
+//          uint8_t val - value to write
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtHex2(char * dst, uint8_t val)
+{
+  *dst++ = HEX_DIGITS[val >> 4];
+  *dst++ = HEX_DIGITS[val & 0x0F];
+  *dst   = '\0';
+  return dst;
+} // end function FmtHex2
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtFixed(char * dst, uint32_t val, uint8_t width, uint8_t frac)
+//  Fixed-point decimal of val with frac digits after the point, the whole
+//  part zero padded to width digits.
+//
+//  INPUT : char *  dst   - buffer to write (width + frac + 2 chars, or more)
+//          uint32_t val  - value, in units of 10^-frac
+//          uint8_t width - least digits of the whole part
+//          uint8_t frac  - digits after the point (1 to 9)
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : PutDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtFixed(char * dst, uint32_t val, uint8_t width, uint8_t frac)
+{
+  uint32_t div = 1;
+  uint8_t  i;
+
+  for (i = frac; i; i--)  {
+    div *= 10;            }
+  dst    = PutDec(dst, val / div, width, '0', '\0');
+  *dst++ = '.';
+  return PutDec(dst, val % div, frac, '0', '\0');
+} // end function FmtFixed
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtGrid(char * dst, uint16_t easting, uint16_t northing)
+//  MGRS 10 m grid digits <EEEE NNNN>.
+//
+//  INPUT : char *  dst      - buffer to write (10 chars)
+//          uint16_t easting - 10 m easting within the 100 km square (0-9999)
+//          uint16_t northing- 10 m northing within the 100 km square (0-9999)
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : PutDec
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtGrid(char * dst, uint16_t easting, uint16_t northing)
+{
+  dst    = PutDec(dst, easting, 4, '0', '\0');
+  *dst++ = ' ';
+  return PutDec(dst, northing, 4, '0', '\0');
+} // end function FmtGrid
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtPadRight(char * dst, const char * src, uint8_t width)
+//  Copies src, ' ' padded on the right to width chars.
+//
+//  INPUT : char *  dst   - buffer to write (width or strlen(src), plus NULL)
+//          char *  src   - text to copy (may not overlap dst)
+//          uint8_t width - least chars to write
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+char * FmtPadRight(char * dst, const char * src, uint8_t width)
+{
+  for ( ; *src; width = width ? (width - 1) : 0)  {
+    *dst++ = *src++;                              }
+  for ( ; width; width--)                         {
+    *dst++ = ' ';                                 }
+  *dst = '\0';
+  return dst;
+} // end function FmtPadRight
@@ -0,0 +1,106 @@
+#ifndef NUMFMT_H__
+#define NUMFMT_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : numfmt.h
+ *
+ *  DESCRIPTION   : Define procedures which format numbers as display text into
+ *    caller buffers, in place of sprintf() and XC16's printf engine (its stack
+ *    use and the flash it links in).  Each writes its text, NULL terminates it,
+ *    and returns a pointer to that NULL so text can be built up piece by piece
+ *    (e.g. "HH:MM:SS" by three FmtUDec() calls).
+ *
+ *      (1) char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad)
+ *      (2) char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad)
+ *      (3) char * FmtHex2(char * dst, uint8_t val)
+ *      (4) char * FmtFixed(char * dst, uint32_t val, uint8_t width,
+ *                          uint8_t frac)
+ *      (5) char * FmtGrid(char * dst, uint16_t easting, uint16_t northing)
+ *      (6) char * FmtPadRight(char * dst, const char * src, uint8_t width)
+ *
+ *  Values of 16 bits or less are divided in 16-bit math, as the PIC24 divides
+ *  16 by 16 bits in hardware but 32-bit division is a library call.
+ *
+ *  The text is that of the sprintf() formats replaced, checked by host tool
+ *  host/fmtbench.c ("make -f host/Makefile fmtbench"), which also times both.
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Initial implementation
+ */
+//**PROCEDURES******************************************************************
+//  char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad)
+//  Unsigned decimal, right justified in width chars (more if need be) padded
+//  by pad: as sprintf "%0<width>lu" when pad is '0', "%<width>lu" when ' '.
+//
+//  INPUT : char *  dst   - buffer to write (width or digits, plus NULL)
+//          uint32_t val  - value to write
+//          uint8_t width - least chars to write (0 or 1 for just the digits)
+//          char    pad   - fill left of the digits ('0' or ' ')
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad)
+//  Signed decimal, as sprintf "%0<width>ld" when pad is '0' ('-' ahead of the
+//  zeros), "%<width>ld" when ' ' (spaces ahead of the '-').
+//
+//  INPUT : char *  dst   - buffer to write (width or sign & digits, plus NULL)
+//          int32_t val   - value to write
+//          uint8_t width - least chars to write, including any '-'
+//          char    pad   - fill ('0' or ' ')
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtHex2(char * dst, uint8_t val)
+//  Two upper case hex digits, as sprintf "%02X".
+//
+//  INPUT : char *  dst - buffer to write (3 chars)
+//          uint8_t val - value to write
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtFixed(char * dst, uint32_t val, uint8_t width, uint8_t frac)
+//  Fixed-point decimal of val with frac digits after the point, the whole
+//  part zero padded to width digits:  e.g. 0.00001 degrees as <DDD.ddddd> by
+//  width 3 and frac 5, or tenths as <K.m> by width 1 and frac 1.
+//
+//  INPUT : char *  dst   - buffer to write (width + frac + 2 chars, or more)
+//          uint32_t val  - value, in units of 10^-frac
+//          uint8_t width - least digits of the whole part
+//          uint8_t frac  - digits after the point (1 to 9)
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtGrid(char * dst, uint16_t easting, uint16_t northing)
+//  MGRS 10 m grid digits <EEEE NNNN>, as sprintf "%04ld %04ld".
+//
+//  INPUT : char *  dst      - buffer to write (10 chars)
+//          uint16_t easting - 10 m easting within the 100 km square (0-9999)
+//          uint16_t northing- 10 m northing within the 100 km square (0-9999)
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  char * FmtPadRight(char * dst, const char * src, uint8_t width)
+//  Copies src, ' ' padded on the right to width chars, as sprintf "%-<width>s".
+//
+//  INPUT : char *  dst   - buffer to write (width or strlen(src), plus NULL)
+//          char *  src   - text to copy (may not overlap dst)
+//          uint8_t width - least chars to write
+//  OUTPUT: char * - points to NULL terminating text written at dst
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#include <stdint.h>
+
+//----- DEFINES, ENUMS, STRUCTS, TYPEDEFS, ETC. --------------------------------
+
+//----- EXPOSED ATTRIBUTES -----------------------------------------------------
+
+//----- EXPOSED PROCEDURES -----------------------------------------------------
+char * FmtUDec(char * dst, uint32_t val, uint8_t width, char pad);
+char * FmtSDec(char * dst, int32_t val, uint8_t width, char pad);
+char * FmtHex2(char * dst, uint8_t val);
+char * FmtFixed(char * dst, uint32_t val, uint8_t width, uint8_t frac);
+char * FmtGrid(char * dst, uint16_t easting, uint16_t northing);
+char * FmtPadRight(char * dst, const char * src, uint8_t width);
+
+//----- MACROS -----------------------------------------------------------------
+
+
+#endif  // NUMFMT_H__
@@ -0,0 +1,385 @@
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : spi1.c
+ *
+ *  DESCRIPTION   : Define interrupt driven, queued, 8-bit transmit-only SPI1
+ *    master driver used to talk to the UC1701 LCD controller.
+ *
+ *    Each queued run is one header byte (bit 7 = CD/A0 level, bits 6:0 = byte
+ *    count) followed by its bytes.  A whole run is queued with the SPI1 IRQ
+ *    held off, so the ISR never finds a partial run.  The ISR keeps the TX
+ *    FIFO (enhanced buffer) full while SPITBE wakes it, and when the next run
+ *    needs the other A0 level it waits on SRMT for the shift register to empty
+ *    before changing LCD_CD.  Timer-1 runs only while a transfer is active to
+ *    time it.  When IRQs are disabled (e.g. PrepForSleep) the wait loops poll
+ *    the SPI1 IRQ flag and run the ISR's work themselves.
+ *
+ *  NOTE: micro_defs.h must define SPI1PRI and LCD_CD
+ *
+ *    (1) void  InitSpi1Driver(void)
+ *    (2) bool  Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len,
+ *                         uint8_t mask)
+ *    (3) bool  Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+ *    (4) bool  Spi1WaitTxDone(void)
+ *    (5) bool  Spi1IsTxDone(void)
+ *    (6) spi1xfer_t Spi1GetLastXfer(void)
+ *    (*) void  Spi1TxEngine(void)
+ *    (*) void  Spi1PollTxEngine(void)
+ *    (*) bool  Spi1PutBytes(isData, bytes[], step, len, mask)
+ *    (7) void  _SPI1Interrupt(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add Spi1PutFill() to queue a run of one repeated byte (packed fonts)
+ *      Replace blocking Spi1Write() with queued command/data runs drained by
+ *      the SPI1 ISR, and add per-transfer byte and time counters
+ *    2026/10/16, NSWC H12
+ *      Initial development (SPI1 code moved out of uc1701x.c so the LCD driver
+ *      can be used with a simulated SPI1 in the host build)
+ *
+ *  REFERENCE DOCUMENTS
+ *    1.  PIC24FJ128GA202 Data Sheet (Microchip Technology Inc. DS30010038C)
+ *    2.  PIC24 FRM Serial Peripheral Interface (SPI) with Audio Codec Support
+ *        (Microchip Technology Inc. DS70005136)
+ */
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "micro_defs.h"         // to get SPI1PRI and LCD_CD
+#include "queue.h"              // for queues
+#include "spi1.h"
+
+#define RUN_IS_DATA     0x80    // run header bit for CD (A0) HI
+#define RUN_LEN_MASK    0x7F    // run header bits for byte count
+#define SPI1_SANITY     0xFFFF  // wait loop passes before SPI1 deemed hung
+
+
+//----- MODULE ATTRIBUTES ------------------------------------------------------
+static uint8_t              txQItems[SPI1_TXQ_LEN];
+static uint8queue volatile  txQueue;
+#define txQ ((uint8queue*)(&txQueue))
+static volatile bool        isTxActive  = false;  // transfer not yet finished
+static volatile uint8_t     runLeft     = 0;      // bytes left of current run
+static volatile spi1xfer_t  xferNow;              // counts for active transfer
+static volatile spi1xfer_t  xferLast;             // counts for last transfer
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void InitSpi1Driver(void)
+//  Resets and configures SPI1 as an 8-bit TX-only master (idle clock HI,
+//  falling edge TX, manual SSx, enhanced buffer) at Fcy/2, empties the TX
+//  queue, sets up Timer-1 to time transfers, and enables SPI1 and its IRQ.
+//
+//  INPUT : NONE
+//  OUTPUT: NONE
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void InitSpi1Driver(void)
+{
+  // SPI1BRGL
+  // UC1701 datasheet says minimum write cycle time is 30 ns --> 33.333333 MHz
+  // FPB = Fcy = 10 MHz
+  // Baud rate = FPB / (2 * (SPI1BRG + 1)) as per microcontroller datasheet
+  // Setting BRG to 0 means baud rate will be 5 MHz => 200 ns write cycle time
+  // Leaving SPI1 BRG as default of 0 for now
+  // TODO try SPI1 running faster using MCLK (Fosc/2 = 10Mhz instead of Fcy/2 = 5MHz)
+  PMD1bits.SPI1MD = 1;              // Temporarily de-clock/reset SPI-1
+  IEC0bits.SPI1IE = 0;              // Ensure SPI-1's interrupt disabled
+  PMD1bits.SPI1MD = 0;              // Now clock SPI-1 peripheral
+  SPI1BUFL;                         // Clear the SPI1 receive buffers
+  SPI1BUFH;
+  // Enhanced buffer, 8-bit TX-only SPI master, Idle clk HI, falling edge TX,
+  // manual SSx.  SPI1 must not halt in Idle() as main loop idles during xfer
+  SPI1CON1L = 0x0071;
+/*
+  // 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
+  SPI1CON1L = 0x0070;
+  // Halt in idle(), 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
+  SPI1CON1L = 0x2070;
+  // Use MCLK, Halt in idle(), 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
+  SPI1CON1L = 0x2074;
+*/
+  SPI1IMSKL = 0x0000;               // No SPI1 IRQ sources until a transfer
+
+  PMD1bits.T1MD     = 1;            // Temporarily de-clock/reset Timer-1
+  PMD1bits.T1MD     = 0;            // Now clock Timer-1 to time transfers
+  T1CON             = 0x0000;       // Timer-1 off, internal Fcy clock
+  T1CONbits.TCKPS   = 0b10;         // Timer-1 prescaler 1:64 (6.4 us tick)
+  PR1               = 0xFFFF;       // Free-run full 16-bit range
+  IEC0bits.T1IE     = 0;            // Timer-1 IRQ not used, only its flag
+
+  QUEUE_INIT_EMPTY(txQ, txQItems, SPI1_TXQ_LEN);
+  isTxActive        = false;
+  runLeft           = 0;
+  xferLast.bytes    = 0;
+  xferLast.runs     = 0;
+  xferLast.a0Chgs   = 0;
+  xferLast.ticks    = 0;
+
+  IPC2bits.SPI1IP   = SPI1PRI;      // Set SPI1 IRQ priority
+  IFS0bits.SPI1IF   = 0;            // Clear SPI1 IRQ flag before
+  IEC0bits.SPI1IE   = 1;            // enabling the SPI1 IRQ
+  SPI1CON1Lbits.SPIEN = 1;          // Enable SPI1 module
+} // end routine InitSpi1Driver
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void Spi1TxEngine(void)
+//  Does the work of the SPI1 ISR: refills the TX FIFO from the queue, changes
+//  the CD (A0) line between runs once the shift register is empty, and closes
+//  out the transfer counters when the last byte has been shifted out.  Leaves
+//  SPI1IMSKL set for the event that should next call it.
+//
+//  INPUT : NONE
+//  OUTPUT: NONE but TX queue, LCD_CD and transfer counters updated
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void Spi1TxEngine(void)
+{
+  uint8_t data;
+  bool    isData;
+
+  IFS0bits.SPI1IF = 0;                  // Clear flag before checking status
+  while ( ! SPI1STATLbits.SPITBF)
+  {                                     // While TX FIFO has room for a byte
+    if (0 == runLeft)
+    {                                   // When current run finished
+      if (QUEUE_EMPTY(txQ))
+      {                                 // and nothing else is queued
+        if (SPI1STATLbits.SPITBE && SPI1STATLbits.SRMT)
+        {                               // the transfer is done when last bit
+          T1CONbits.TON     = 0;        // is out, so stop transfer stopwatch
+          xferNow.ticks     = IFS0bits.T1IF ? 0xFFFF : TMR1;
+          xferLast          = xferNow;
+          SPI1IMSKL         = 0x0000;   // and need no more SPI1 IRQs.
+          isTxActive        = false;
+        }
+        else
+        {                               // otherwise wake when last bit out
+          SPI1IMSKL         = 0x0000;
+          SPI1IMSKLbits.SRMTEN = 1;
+          if (SPI1STATLbits.SRMT)   {   // (re-flag if it went out meanwhile)
+            IFS0bits.SPI1IF = 1;    }
+        }
+        return;
+      }
+      QUEUE_PEEK(txQ, data);            // Look at next run's header and when
+      isData = (data & RUN_IS_DATA) ? true : false;
+      if (isData != (LCD_CD ? true : false))
+      {                                 // it needs other A0 level
+        if ( ! (SPI1STATLbits.SPITBE && SPI1STATLbits.SRMT))
+        {                               // wait for last bit of previous run
+          SPI1IMSKL         = 0x0000;   // to leave before changing A0
+          SPI1IMSKLbits.SRMTEN = 1;
+          if (SPI1STATLbits.SRMT)   {   // (re-flag if it went out meanwhile)
+            IFS0bits.SPI1IF = 1;    }
+          return;
+        }
+        LCD_CD = isData ? 1 : 0;
+        xferNow.a0Chgs++;
+      }
+      QUEUE_GET(txQ, data);             // Start the run
+      runLeft = data & RUN_LEN_MASK;
+      xferNow.runs++;
+    }
+    QUEUE_GET(txQ, data);               // Whole runs are queued so run's bytes
+    SPI1BUFL = data;                    // are there to feed into TX FIFO
+    runLeft--;
+    xferNow.bytes++;
+  }
+  SPI1IMSKL = 0x0000;                   // TX FIFO full so wake when it's empty
+  SPI1IMSKLbits.SPITBEN = 1;
+  if (SPI1STATLbits.SPITBE)         {   // (re-flag if it emptied meanwhile)
+    IFS0bits.SPI1IF = 1;            }
+} // end routine Spi1TxEngine
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void Spi1PollTxEngine(void)
+//  Runs the transmit engine when its IRQ flag is set, for use in wait loops
+//  that may be called with IRQs disabled so the ISR itself cannot run.
+//
+//  INPUT : NONE
+//  OUTPUT: NONE
+//  CALLS : Spi1TxEngine()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static void Spi1PollTxEngine(void)
+{
+  IEC0bits.SPI1IE = 0;                  // Hold off ISR so only one of us runs
+  if (IFS0bits.SPI1IF)              {   // When an SPI1 event is pending
+    Spi1TxEngine();                 }   // handle it here
+  IEC0bits.SPI1IE = 1;
+} // end routine Spi1PollTxEngine
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  static bool Spi1PutBytes(bool isData, const uint8_t bytes[], uint8_t step,
+//                           uint16_t len, uint8_t mask)
+//  Queues a run of bytes all sent with the same CD (A0) line level and starts
+//  the transfer if SPI1 is idle.  Runs longer than SPI1_RUN_MAX are split.
+//  Waits for queue space when needed, but never an insane amount of time.
+//
+//  INPUT : bool isData - true for display data (A0 HI), false for commands
+//          const uint8_t bytes[] - bytes to transmit
+//          uint8_t step - 1 to send bytes[0..len-1], 0 to send bytes[0] len times
+//          uint16_t len - number of bytes
+//          uint8_t mask - XOR'ed with each byte (0xFF to send inverted data)
+//  OUTPUT: bool - true if run was queued, false if SPI1 appears hung
+//  CALLS : Spi1PollTxEngine()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+static bool Spi1PutBytes(bool isData, const uint8_t bytes[], uint8_t step,
+                         uint16_t len, uint8_t mask)
+{
+  uint16_t sanity;
+  uint8_t  runLen;
+
+  if ( ! SPI1CON1Lbits.SPIEN)       {   // When SPI1 not enabled the bytes
+    return false;                   }   // would never leave
+
+  while (len)
+  {
+    runLen = (len > SPI1_RUN_MAX) ? SPI1_RUN_MAX : (uint8_t)len;
+    sanity = SPI1_SANITY;               // Start with full sanity
+    while ((QUEUE_AVAIL_SPACE(txQ) <= runLen) && sanity)
+    {                                   // Wait for room for header and run
+      Spi1PollTxEngine();               // (draining here if IRQs disabled)
+      sanity--;                         // but don't wait insane time
+    }
+    if ( ! sanity)                  {
+      return false;                 }
+
+    IEC0bits.SPI1IE = 0;                // Queue whole run without ISR running
+    QUEUE_PUT(txQ, (isData ? RUN_IS_DATA : 0) | runLen);
+    len -= runLen;
+    while (runLen--)
+    {
+      QUEUE_PUT(txQ, *bytes ^ mask);
+      bytes += step;
+    }
+    if ( ! isTxActive)
+    {                                   // When SPI1 idle start a transfer
+      isTxActive      = true;
+      xferNow.bytes   = 0;
+      xferNow.runs    = 0;
+      xferNow.a0Chgs  = 0;
+      TMR1            = 0;              // and its stopwatch.
+      IFS0bits.T1IF   = 0;
+      T1CONbits.TON   = 1;
+      IFS0bits.SPI1IF = 1;              // Kick engine to start filling FIFO
+    }
+    IEC0bits.SPI1IE = 1;
+  }
+  return true;
+} // end function Spi1PutBytes
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len,
+//                  uint8_t mask)
+//  Queues a run of bytes all sent with the same CD (A0) line level and starts
+//  the transfer if SPI1 is idle.  Runs longer than SPI1_RUN_MAX are split.
+//  Waits for queue space when needed, but never an insane amount of time.
+//
+//  INPUT : bool isData - true for display data (A0 HI), false for commands
+//          const uint8_t bytes[] - bytes to transmit
+//          uint16_t len - number of bytes
+//          uint8_t mask - XOR'ed with each byte (0xFF to send inverted data)
+//  OUTPUT: bool - true if run was queued, false if SPI1 appears hung
+//  CALLS : Spi1PutBytes()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len, uint8_t mask)
+{
+  return Spi1PutBytes(isData, bytes, 1, len, mask);
+} // end function Spi1PutRun
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+//  Queues a run of len copies of one byte, e.g. a blank stretch of a packed
+//  glyph, without the caller needing a buffer of them.
+//
+//  INPUT : bool isData - true for display data (A0 HI), false for commands
+//          uint8_t value - byte to transmit len times
+//          uint16_t len - number of bytes
+//  OUTPUT: bool - true if run was queued, false if SPI1 appears hung
+//  CALLS : Spi1PutBytes()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+{
+  return Spi1PutBytes(isData, &value, 0, len, 0x00);
+} // end function Spi1PutFill
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1WaitTxDone(void)
+//  Waits until every queued byte has been shifted out, but never waits an
+//  insane amount of time.  Must be called before Sleep() since SPI1 stops then.
+//
+//  INPUT : NONE
+//  OUTPUT: bool - true if transfer finished, false if SPI1 appears hung
+//  CALLS : Spi1PollTxEngine()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool Spi1WaitTxDone(void)
+{
+  uint16_t sanity = SPI1_SANITY;        // Start with full sanity
+
+  while (isTxActive && sanity)
+  {                                     // Wait while bytes still to go out
+    Spi1PollTxEngine();                 // (draining here if IRQs disabled)
+    sanity--;                           // but don't wait insane time
+  }
+  return ( ! isTxActive);
+} // end function Spi1WaitTxDone
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1IsTxDone(void)
+//  Reports if SPI1 has no queued bytes left to shift out.
+//
+//  INPUT : NONE
+//  OUTPUT: bool - true when SPI1 is idle
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+bool Spi1IsTxDone(void)
+{
+  return ( ! isTxActive);
+} // end function Spi1IsTxDone
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  spi1xfer_t Spi1GetLastXfer(void)
+//  Accessor for counters of the last completed transfer, i.e. from the first
+//  byte queued while SPI1 was idle to the last byte shifted out.
+//
+//  INPUT : NONE
+//  OUTPUT: spi1xfer_t - bytes, runs, A0 changes and Timer-1 ticks of transfer
+//  CALLS : NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+spi1xfer_t Spi1GetLastXfer(void)
+{
+  spi1xfer_t xfer;
+
+  IEC0bits.SPI1IE = 0;                  // ISR updates it so copy atomically
+  xfer            = xferLast;
+  IEC0bits.SPI1IE = 1;
+  return xfer;
+} // end function Spi1GetLastXfer
+
+
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void _SPI1Interrupt(void)
+//  Interrupt Service Routine for SPI1 general events enabled in SPI1IMSKL,
+//  which are TX FIFO empty while feeding a run and shift register empty when
+//  waiting to change A0 or finish the transfer.
+//
+//  INPUT : NONE
+//  OUTPUT: NONE but TX queue, LCD_CD and transfer counters updated
+//  CALLS : Spi1TxEngine()
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+void __attribute__((interrupt, no_auto_psv)) _SPI1Interrupt(void)
+{
+  Spi1TxEngine();
+} // end ISR _SPI1Interrupt
@@ -0,0 +1,112 @@
+#ifndef SPI_1_H__
+#define SPI_1_H__
+////////////////////////////////////////////////////////////////////////////////
+//        Property of United States of America - For Official Use Only        //
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  FILE NAME     : spi1.h
+ *
+ *  DESCRIPTION   : Declares interrupt driven, queued, 8-bit transmit-only SPI1
+ *    master driver used to talk to the UC1701 LCD controller.  Callers queue
+ *    runs of command or display data bytes and the SPI1 ISR drains the queue
+ *    through the SPI1 enhanced buffer (TX FIFO), switching the UC1701 CD (A0)
+ *    line between runs, so a screen redraw need not wait on the SPI clock.
+ *    Chip select is a plain port pin owned by the LCD driver (uc1701x.c).
+ *
+ *  NOTE: micro_defs.h must define SPI1PRI and LCD_CD
+ *
+ *    (1) void  InitSpi1Driver(void)
+ *    (2) bool  Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len,
+ *                         uint8_t mask)
+ *    (3) bool  Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+ *    (4) bool  Spi1WaitTxDone(void)
+ *    (5) bool  Spi1IsTxDone(void)
+ *    (6) spi1xfer_t Spi1GetLastXfer(void)
+ *
+ *  WRITTEN BY    : NSWC H12
+ *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add Spi1PutFill()
+ *      Replace blocking Spi1Write() with queued command/data runs drained by
+ *      the SPI1 ISR, and add per-transfer byte and time counters
+ *    2026/10/16, NSWC H12
+ *      Initial development (SPI1 code moved out of uc1701x.c)
+ *
+ *  REFERENCE DOCUMENTS
+ *    1.  PIC24FJ128GA202 Data Sheet (Microchip Technology Inc. DS30010038C)
+ */
+//++PROCEDURE+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  void InitSpi1Driver(void)
+//  Resets and configures SPI1 as an 8-bit TX-only master (idle clock HI,
+//  falling edge TX, manual SSx, enhanced buffer) at Fcy/2, empties the TX
+//  queue, sets up Timer-1 to time transfers, and enables SPI1 and its IRQ.
+//
+//  INPUT : NONE
+//  OUTPUT: NONE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len,
+//                  uint8_t mask)
+//  Queues a run of bytes all sent with the same CD (A0) line level and starts
+//  the transfer if SPI1 is idle.  Waits for queue space when needed, but never
+//  an insane amount of time.
+//
+//  INPUT : bool isData - true for display data (A0 HI), false for commands
+//          const uint8_t bytes[] - bytes to transmit
+//          uint16_t len - number of bytes
+//          uint8_t mask - XOR'ed with each byte (0xFF to send inverted data)
+//  OUTPUT: bool - true if run was queued, false if SPI1 appears hung
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1PutFill(bool isData, uint8_t value, uint16_t len)
+//  Queues a run of len copies of one byte, as Spi1PutRun() does a run of bytes.
+//
+//  INPUT : bool isData - true for display data (A0 HI), false for commands
+//          uint8_t value - byte to transmit len times
+//          uint16_t len - number of bytes
+//  OUTPUT: bool - true if run was queued, false if SPI1 appears hung
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1WaitTxDone(void)
+//  Waits until every queued byte has been shifted out, but never waits an
+//  insane amount of time.  Must be called before Sleep() since SPI1 stops then.
+//
+//  INPUT : NONE
+//  OUTPUT: bool - true if transfer finished, false if SPI1 appears hung
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  bool Spi1IsTxDone(void)
+//  Reports if SPI1 has no queued bytes left to shift out.
+//
+//  INPUT : NONE
+//  OUTPUT: bool - true when SPI1 is idle
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  spi1xfer_t Spi1GetLastXfer(void)
+//  Accessor for counters of the last completed transfer, i.e. from the first
+//  byte queued while SPI1 was idle to the last byte shifted out.
+//
+//  INPUT : NONE
+//  OUTPUT: spi1xfer_t - bytes, runs, A0 changes and Timer-1 ticks of transfer
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#include <xc.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPI1_TXQ_LEN      256     // bytes of queued runs (incl. run headers)
+#define SPI1_RUN_MAX      127     // bytes per queued run, longer ones are split
+#define SPI1_TICK_NS      6400    // Timer-1 tick is Fcy/64 = 6.4 us
+
+typedef struct tagSPI1XFER
+{
+  uint16_t bytes;                 // bytes shifted out to LCD
+  uint16_t runs;                  // command/data runs
+  uint16_t a0Chgs;                // changes of CD (A0) line between runs
+  uint16_t ticks;                 // SPI1_TICK_NS ticks (saturates at 0xFFFF)
+} spi1xfer_t;
+
+
+void InitSpi1Driver(void);
+bool Spi1PutRun(bool isData, const uint8_t bytes[], uint16_t len, uint8_t mask);
+bool Spi1PutFill(bool isData, uint8_t value, uint16_t len);
+bool Spi1WaitTxDone(void);
+bool Spi1IsTxDone(void);
+spi1xfer_t Spi1GetLastXfer(void);
+
+
+#endif // SPI_1_H__
@@ -27,11 +27,20 @@
  *     (15) void UC1701XSystemReset()
  *     (16) void UC1701XSetAdvProgCntl0(bool tc, bool wc, bool wp)
  *     (17) void UC1701XSetLCDBiasRatio(bool br)
+ *     (18) void UC1701XWriteDataRun(const uint8_t data[], uint8_t len, bool invert)
+ *     (19) void UC1701XWriteDataFill(uint8_t value, uint8_t len, bool invert)
+ *      (*) void UC1701XPutRun(const uint8_t bytes[], uint8_t len, uint8_t mask)
  *
  *  USE:
  *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add UC1701XWriteDataFill() to write a run of one repeated data byte
+ *      Queue bytes as command/data runs to the interrupt driven SPI1 driver,
+ *      which now drives A0, so display updates don't wait on the SPI clock
+ *      Add UC1701XWriteDataRun() to stream bytes using column auto-increment
+ *      Move SPI1 set-up and byte transmit into new spi1.c driver
  *    2018/09/21, Robert Kirby, NSWC H12
  *      Refactor sysErrFlags to esdErrFlags as it doesn't cover Ltng errors
  *    2017/04/10, Robert Kirby, NSWC H12
@@ -45,6 +54,7 @@
  */
 #include <xc.h>
 #include "uc1701x.h"
+#include "spi1.h"
 #include "main.h"           // for esdErrFlags.spi
 #include "micro_defs.h"     // System stuff like FCY
 #include <libpic30.h>       // For delay functions MUST follow define of FCY
@@ -57,9 +67,10 @@
 #define UC1701_RESET()      { LCD_RST = 0; }
 #define UC1701_ACTIVATE()   { LCD_RST = 1; }
 
-// UC1701 data mode enable control output on A0
-#define UC1701_DATA_MODE()  { LCD_CD = 1; }
-#define UC1701_CMD_MODE()   { LCD_CD = 0; }
+// UC1701 data mode enable control output on A0, which the SPI1 driver sets
+// for each queued run as bytes leave, so here just note the mode for runs
+#define UC1701_DATA_MODE()  { isDataMode = true; }
+#define UC1701_CMD_MODE()   { isDataMode = false; }
 
 // Useful UC1701 macros
 #define UC1701_POWER_UP()   {                                               \
@@ -212,37 +223,27 @@
 #define UC1701X_SPI_SET_ADVANCED_PROGRAM_CONTROL_0_2 (0b00010000)
 
 
+static bool isDataMode = false;     // next run is display data, not commands
+
+
+/* UC1701XPutRun
+ * In: bytes: command or data bytes to queue for LCD in current mode
+ *     len: number of bytes
+ *     mask: XOR'ed with each byte (0xFF inverts data) */
+static void UC1701XPutRun(const uint8_t bytes[], uint8_t len, uint8_t mask)
+{
+  if (!Spi1PutRun(isDataMode, bytes, len, mask))  { // When SPI1 lost sanity
+    esdErrFlags.spi = 1;                          } // note SPI bus issue
+} // end routine UC1701XPutRun
+
+
 
 /* InitUc1701x
  * Configure SPI1 and OC1 peripherals used for LCD
  * and then go thru LCD's reset and configuration power-up sequence */
 void InitUc1701x(void)
 {
-  // Communicate via SPI1, so initialize that peripheral
-  // SPI1BRGL
-  // UC1701 datasheet says minimum write cycle time is 30 ns --> 33.333333 MHz
-  // FPB = Fcy = 10 MHz
-  // Baud rate = FPB / (2 * (SPI1BRG + 1)) as per microcontroller datasheet
-  // Setting BRG to 0 means baud rate will be 5 MHz => 200 ns write cycle time
-  // Leaving SPI1 BRG as default of 0 for now
-  // TODO try halting SPI1 when CPU idle as don't use it then anyway
-  // TODO try SPI1 running faster using MCLK (Fosc/2 = 10Mhz instead of Fcy/2 = 5MHz)
-  PMD1bits.SPI1MD = 1;              // Temporarily de-clock/reset SPI-1
-  IEC0bits.SPI1IE = 0;              // Ensure SPI-1's interrupt disabled
-  PMD1bits.SPI1MD = 0;              // Now clock SPI-1 peripheral
-  SPI1BUFL;                         // Clear the SPI1 receive buffers
-  SPI1BUFH;
-  // 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
-  SPI1CON1L = 0x0070;
-/*
-  // 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
-  SPI1CON1L = 0x0070;
-  // Halt in idle(), 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
-  SPI1CON1L = 0x2070;
-  // Use MCLK, Halt in idle(), 8-bit TX-only SPI master, Idle clk HI, falling edge TX, manual SSx
-  SPI1CON1L = 0x2074;
-*/
-  SPI1CON1Lbits.SPIEN = 1;          // Enable SPI1 module
+  InitSpi1Driver();                 // Communicate via SPI1
 
   // Use Output Compare 1 as PWM to drive backlight, so initialize peripheral
   PMD2bits.OC1MD    = 1;            // De-clock/reset OutputCompare-1
@@ -272,20 +273,7 @@ void InitUc1701x(void)
  * In: value: command or data byte to send to LCD */
 void UC1701XWrite(uint8_t value)
 {
-//  while (0 == SPI1STATLbits.SPITBE); // wait while TX buff not empty
-//  SPI1BUFL = value;
-//  while (1 == SPI1STATLbits.SPIBUSY); // Wait for transmission to finish
-
-  uint8_t sanity = 0xFF;                        // Start with full sanity
-
-  while ((!SPI1STATLbits.SPITBE) && sanity) {   // Wait while TX buff not empty
-    sanity--;                               }   // but don't wait insane time
-  SPI1BUFL = value;                             // Place data to transmit
-  while (SPI1STATLbits.SPIBUSY && sanity)   {   // Wait for transmit to finish
-    sanity--;                               }   // but don't wait insane time
-  if (!sanity)                              {   // When lost all sanity
-    esdErrFlags.spi = 1;                    }   // note SPI bus issue
-
+  UC1701XPutRun(&value, 1, 0x00);
 } // end routine UC1701XWrite
 
 
@@ -304,14 +292,17 @@ void UC1701XWriteData(uint8_t data)
  * Note: Will return false if ca is outside of valid range */
 bool UC1701XSetColumnAddress(uint8_t ca)
 {
-  if (ca > 101)     {
-    return false;   }
+  uint8_t cmd[2];
+
+  if (ca > UC1701X_LAST_COLUMN)   {
+    return false;                 }
 
   UC1701_CMD_MODE();
   // Clear upper nibble of ca and bitwise OR it with first half of command before sending
-  UC1701XWrite((ca&0x0F) | UC1701X_SPI_SET_SRAM_COL_ADDR_1);
+  cmd[0] = (ca&0x0F) | UC1701X_SPI_SET_SRAM_COL_ADDR_1;
   // Clear lower nibble of ca and shift right four times, then bitwise OR it with second half of command before sending
-  UC1701XWrite(((ca&0xF0)>>4) | UC1701X_SPI_SET_SRAM_COL_ADDR_2);
+  cmd[1] = ((ca&0xF0)>>4) | UC1701X_SPI_SET_SRAM_COL_ADDR_2;
+  UC1701XPutRun(cmd, sizeof(cmd), 0x00);
 
   return true;
 } // end function UC1701XSetColumnAddress
@@ -383,12 +374,15 @@ bool UC1701XSetVLCDResistorRatio(uint8_t pc)
  * Note:  Will return false if pm is outside of valid range  */
 bool UC1701XSetElectronicVolume(uint8_t pm)
 {
+  uint8_t cmd[2];
+
   if (pm > 63)      {
     return false;   }
 
   UC1701_CMD_MODE();
-  UC1701XWrite(UC1701X_SPI_SET_ELECTRONIC_VOLUME_1);
-  UC1701XWrite(UC1701X_SPI_SET_ELECTRONIC_VOLUME_2 | pm);
+  cmd[0] = UC1701X_SPI_SET_ELECTRONIC_VOLUME_1;
+  cmd[1] = UC1701X_SPI_SET_ELECTRONIC_VOLUME_2 | pm;
+  UC1701XPutRun(cmd, sizeof(cmd), 0x00);
 
   return true;
 } // end function UC1701XSetElectronicVolume
@@ -460,9 +454,12 @@ void UC1701XSystemReset()
  *     wp: Page wrap around false=OFF; true=ON */
 void UC1701XSetAdvProgCntl0(bool tc, bool wc, bool wp)
 {
+  uint8_t cmd[2];
+
   UC1701_CMD_MODE();
-  UC1701XWrite(UC1701X_SPI_SET_ADVANCED_PROGRAM_CONTROL_0_1);
-  UC1701XWrite(UC1701X_SPI_SET_ADVANCED_PROGRAM_CONTROL_0_2 | (tc ? 128 : 0) | (wc ? 2 : 0) | (wp ? 1 : 0));
+  cmd[0] = UC1701X_SPI_SET_ADVANCED_PROGRAM_CONTROL_0_1;
+  cmd[1] = UC1701X_SPI_SET_ADVANCED_PROGRAM_CONTROL_0_2 | (tc ? 128 : 0) | (wc ? 2 : 0) | (wp ? 1 : 0);
+  UC1701XPutRun(cmd, sizeof(cmd), 0x00);
 } // end routine UC1701XSetAdvProgCntl0
 
 
@@ -473,3 +470,29 @@ void UC1701XSetLCDBiasRatio(bool br)
   UC1701_CMD_MODE();
   UC1701XWrite(UC1701X_SPI_SET_LCD_BIAS_RATIO | (br ? 1 : 0));
 } // end routine UC1701XSetLCDBiasRatio
+
+
+/* UC1701XWriteDataRun
+ * In: data: data bytes to be written to LCD SRAM at current page and column
+ *     len: number of bytes in data
+ *     invert: true to write bytes inverted, false to write them as is */
+void UC1701XWriteDataRun(const uint8_t data[], uint8_t len, bool invert)
+{
+  UC1701_DATA_MODE();               // A0 stays HI for the whole run and
+  UC1701XPutRun(data, len, invert ? 0xFF : 0x00); // LCD auto-increments column
+} // end routine UC1701XWriteDataRun
+
+
+/* UC1701XWriteDataFill
+ * In: value: data byte to be written len times to LCD SRAM at current page
+ *            and column
+ *     len: number of bytes
+ *     invert: true to write value inverted, false to write it as is */
+void UC1701XWriteDataFill(uint8_t value, uint8_t len, bool invert)
+{
+  UC1701_DATA_MODE();
+  if (invert)                       {
+    value = ~value;                 }
+  if (!Spi1PutFill(isDataMode, value, len)) { // When SPI1 lost sanity
+    esdErrFlags.spi = 1;                    } // note SPI bus issue
+} // end routine UC1701XWriteDataFill
@@ -29,18 +29,24 @@
  *     (15) void UC1701XSystemReset()
  *     (16) void UC1701XSetAdvProgCntl0( bool tc, bool wc, bool wp )
  *     (17) void UC1701XSetLCDBiasRatio( bool br )
- *     (18) LCD_DISPLAY_MODE()
- *     (19) LCD_SLEEP_MODE()
- *     (20) SET_BKLT_OFF()
- *     (21) SET_BKLT_NVG()
- *     (22) SET_BKLT_LOW()
- *     (23) SET_BKLT_MED()
- *     (24) SET_BKLT_HIGH()
+ *     (18) void UC1701XWriteDataRun( const uint8_t data[], uint8_t len, bool invert )
+ *     (19) void UC1701XWriteDataFill( uint8_t value, uint8_t len, bool invert )
+ *     (20) LCD_DISPLAY_MODE()
+ *     (21) LCD_SLEEP_MODE()
+ *     (22) SET_BKLT_OFF()
+ *     (23) SET_BKLT_NVG()
+ *     (24) SET_BKLT_LOW()
+ *     (25) SET_BKLT_MED()
+ *     (26) SET_BKLT_HIGH()
  *
  *  USE:
  *
  *  WRITTEN BY    : Nicholus Sunshine, NSWC H12
  *  MODIFICATIONS (in reverse chronological order)
+ *    2026/10/16, NSWC H12
+ *      Add UC1701XWriteDataFill()
+ *      Add UC1701XWriteDataRun() to stream bytes using column auto-increment
+ *      Add UC1701X_LAST_COLUMN
  *    2019/07/22, Robert Kirby, NSWC H12
  *      Change NVG back light from 0.02% to 0.12% to make it readable w/o NVGs
  *      (but still NVG friendly) since focal length of NVGs is such that cannot
@@ -59,6 +65,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#define UC1701X_LAST_COLUMN (101)   // last of the 102 displayed columns
+
 
 void InitUc1701x(void);
 
@@ -152,6 +160,22 @@ void UC1701XSetAdvProgCntl0( bool tc, bool wc, bool wp );
  * In: br: Bias ratio, false = 1/9, true = 1/7 */
 void UC1701XSetLCDBiasRatio( bool br );
 
+/* UC1701XWriteDataRun
+ * In: data: data bytes to be written to LCD SRAM at current page and column
+ *     len: number of bytes in data
+ *     invert: true to write bytes inverted, false to write them as is
+ * Note: LCD advances column address after each byte, so caller sets page and
+ *       column once for the run and ensures run does not pass last column */
+void UC1701XWriteDataRun( const uint8_t data[], uint8_t len, bool invert );
+
+/* UC1701XWriteDataFill
+ * In: value: data byte to be written len times to LCD SRAM at current page
+ *            and column
+ *     len: number of bytes
+ *     invert: true to write value inverted, false to write it as is
+ * Note: as UC1701XWriteDataRun(), caller ensures run does not pass last column */
+void UC1701XWriteDataFill( uint8_t value, uint8_t len, bool invert );
+
 
 #define LCD_DISPLAY_MODE()  {                                   \
                               UC1701XSetDisplayEnable(true);    \